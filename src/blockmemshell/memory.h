@@ -432,6 +432,9 @@ long long BMSgetChunkMemoryUsed_call(
  * Block Memory Management
  *
  * Efficient memory management for objects of varying sizes
+ *
+ * A block memory is not thread-safe: all allocations and frees of a block memory have to happen in the same thread,
+ * or have to be protected by a lock. Parallel code should create a separate block memory for each thread.
  ***********************************************************/
 
 typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of chunk blocks */
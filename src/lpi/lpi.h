@@ -953,6 +953,13 @@ SCIP_Bool SCIPlpiHasStateBasis(
    SCIP_LPISTATE*        lpistate            /**< LPi state information (like basis information) */
    );
 
+/** returns the number of bytes occupied by the given LPi state, or 0 if it is NULL */
+SCIP_EXPORT
+SCIP_Longint SCIPlpiGetStateSize(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   SCIP_LPISTATE*        lpistate            /**< LPi state information (like basis information), or NULL */
+   );
+
 /** reads LPi state (like basis information from a file */
 SCIP_EXPORT
 SCIP_RETCODE SCIPlpiReadState(
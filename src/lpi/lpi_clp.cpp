@@ -3528,6 +3528,21 @@ SCIP_Bool SCIPlpiHasStateBasis(
    return (lpistate != NULL);
 }
 
+/** returns the number of bytes occupied by the given LPi state, or 0 if it is NULL */
+SCIP_Longint SCIPlpiGetStateSize(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   SCIP_LPISTATE*        lpistate            /**< LPi state information (like basis information), or NULL */
+   )
+{  /*lint --e{715}*/
+   assert(lpi != NULL);
+
+   if( lpistate == NULL )
+      return 0;
+
+   return (SCIP_Longint) sizeof(SCIP_LPISTATE) + (SCIP_Longint) colpacketNum(lpistate->ncols) * (SCIP_Longint) sizeof(COLPACKET)
+      + (SCIP_Longint) rowpacketNum(lpistate->nrows) * (SCIP_Longint) sizeof(ROWPACKET);
+}
+
 /** reads LP state (like basis information) from a file */
 SCIP_RETCODE SCIPlpiReadState(
    SCIP_LPI*             lpi,                /**< LP interface structure */
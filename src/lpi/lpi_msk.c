@@ -4930,6 +4930,21 @@ SCIP_Bool SCIPlpiHasStateBasis(
    return ( lpistate != NULL && lpistate->num >= 0);
 }
 
+/** returns the number of bytes occupied by the given LPi state, or 0 if it is NULL */
+SCIP_Longint SCIPlpiGetStateSize(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   SCIP_LPISTATE*        lpistate            /**< LPi state information (like basis information), or NULL */
+   )
+{  /*lint --e{715}*/
+   assert(lpi != NULL);
+
+   if( lpistate == NULL )
+      return 0;
+
+   return (SCIP_Longint) sizeof(SCIP_LPISTATE) + (SCIP_Longint) colpacketNum(lpistate->ncols) * (SCIP_Longint) sizeof(COLPACKET)
+      + (SCIP_Longint) rowpacketNum(lpistate->nrows) * (SCIP_Longint) sizeof(ROWPACKET);
+}
+
 /** reads LP state (like basis information) from a file
  *
  * @note last solve call must have been either simplex or barrier with crossover or base must have been set manually
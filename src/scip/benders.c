@@ -40,6 +40,7 @@
 #include "scip/paramset.h"
 #include "scip/lp.h"
 #include "scip/prob.h"
+#include "scip/var.h"
 #include "scip/pricestore.h"
 #include "scip/scip.h"
 #include "scip/scipdefplugins.h"
@@ -54,6 +55,9 @@
 
 #include "scip/benderscut.h"
 
+#include "tpi/tpi.h"
+#include "tpi/def_openmp.h"
+
 /* Defaults for parameters */
 #define SCIP_DEFAULT_TRANSFERCUTS         FALSE  /** should Benders' cuts generated in LNS heuristics be transferred to the main SCIP instance? */
 #define SCIP_DEFAULT_CUTSASCONSS           TRUE  /** should the transferred cuts be added as constraints? */
@@ -3104,6 +3108,345 @@ SCIP_RETCODE updateSubproblemStatQueue(
    return SCIP_OKAY;
 }
 
+/** solves a single Benders' decomposition subproblem within a solve loop and updates the loop results; this is called
+ *  for all subproblems of the loop, either sequentially or in parallel jobs
+ *
+ *  If solving the subproblem fails, the return code is passed back and the subproblem is flagged as not solved, but
+ *  the loop results are not updated.
+ */
+static
+SCIP_RETCODE solveBendersSubproblemInLoop(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_BENDERSENFOTYPE  type,               /**< the type of solution being enforced */
+   SCIP_BENDERSSOLVELOOP solveloop,          /**< the current solve loop */
+   SCIP_Bool             checkint,           /**< are the subproblems called during a check/enforce of integer sols? */
+   SCIP_Bool             onlyconvexcheck,    /**< are only the convex relaxations of the subproblems checked? */
+   int                   probnumber,         /**< the subproblem to solve */
+   SCIP_Bool*            subprobsolved,      /**< array indicating the subproblems that were solved in this loop */
+   SCIP_BENDERSSUBSTATUS* substatus,         /**< array to store the status of the subsystem */
+   int*                  nverified,          /**< pointer to increase the number of verified subproblems */
+   SCIP_Bool*            infeasible,         /**< pointer to update whether the master problem is infeasible */
+   SCIP_Bool*            optimal,            /**< pointer to update whether the current solution is optimal */
+   SCIP_Bool*            stopped             /**< pointer to store whether the solving process was stopped */
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   SCIP_Bool subinfeas = FALSE;
+   SCIP_Bool convexsub;
+   SCIP_Bool solvesub = TRUE;
+   SCIP_Bool solved;
+
+   assert(benders != NULL);
+   assert(subprobsolved != NULL);
+   assert(substatus != NULL);
+
+   convexsub = SCIPbendersGetSubproblemType(benders, probnumber) == SCIP_BENDERSSUBTYPE_CONVEXCONT;
+
+   /* the subproblem is initially flagged as not solved for this solving loop */
+   subprobsolved[probnumber] = FALSE;
+
+   /* setting the subsystem status to UNKNOWN at the start of each solve loop */
+   substatus[probnumber] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
+
+   /* for the second solving loop, if the problem is an LP, it is not solved again. If the problem is a MIP,
+    * then the subproblem objective function value is set to infinity. However, if the subproblem is proven
+    * infeasible from the LP, then the IP loop is not performed.
+    * If the solve loop is SCIP_BENDERSSOLVELOOP_USERCIP, then nothing is done. It is assumed that the user will
+    * correctly update the objective function within the user-defined solving function.
+    */
+   if( solveloop == SCIP_BENDERSSOLVELOOP_CIP )
+   {
+      if( convexsub || substatus[probnumber] == SCIP_BENDERSSUBSTATUS_INFEAS )
+         solvesub = FALSE;
+      else
+      {
+         SCIPbendersSetSubproblemObjval(benders, probnumber, SCIPbendersSubproblem(benders, probnumber) != NULL ?
+            SCIPinfinity(SCIPbendersSubproblem(benders, probnumber)) : SCIPsetInfinity(set));
+      }
+   }
+
+   /* if the subproblem is independent, then it does not need to be solved. In this case, the nverified flag will
+    * increase by one. When the subproblem is not independent, then it needs to be checked.
+    */
+   if( !subproblemIsActive(benders, probnumber) )
+   {
+      /* NOTE: There is no need to update the optimal flag. This is because optimal is always TRUE until a
+       * non-optimal subproblem is found.
+       */
+      /* if the auxiliary variable value is infinity, then the subproblem has not been solved yet. Currently the
+       * subproblem statue is unknown. */
+      if( SCIPsetIsInfinity(set, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, probnumber))
+         || SCIPsetIsInfinity(set, -SCIPbendersGetAuxiliaryVarVal(benders, set, sol, probnumber))
+         || SCIPsetIsInfinity(set, -SCIPbendersGetSubproblemLowerbound(benders, probnumber)) )
+      {
+         SCIPbendersSetSubproblemObjval(benders, probnumber, SCIPbendersSubproblem(benders, probnumber) != NULL ?
+            SCIPinfinity(SCIPbendersSubproblem(benders, probnumber)) : SCIPsetInfinity(set));
+
+         substatus[probnumber] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
+         *optimal = FALSE;
+
+         SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, but has not been solved."
+           " setting status to UNKNOWN\n", probnumber);
+      }
+      else
+      {
+         if( SCIPrelDiff(SCIPbendersGetSubproblemLowerbound(benders, probnumber),
+               SCIPbendersGetAuxiliaryVarVal(benders, set, sol, probnumber)) < benders->solutiontol )
+         {
+            SCIPbendersSetSubproblemObjval(benders, probnumber, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, probnumber));
+            substatus[probnumber] = SCIP_BENDERSSUBSTATUS_OPTIMAL;
+         }
+         else
+         {
+            SCIPbendersSetSubproblemObjval(benders, probnumber, SCIPbendersGetSubproblemLowerbound(benders, probnumber));
+            substatus[probnumber] = SCIP_BENDERSSUBSTATUS_AUXVIOL;
+         }
+
+         SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, setting status to OPTIMAL\n", probnumber);
+      }
+
+      subprobsolved[probnumber] = TRUE;
+
+      /* the nverified counter is only increased in the convex solving loop */
+      if( solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX )
+         (*nverified)++;
+   }
+   else if( solvesub )
+   {
+      retcode = SCIPbendersExecSubproblemSolve(benders, set, sol, probnumber, solveloop, FALSE, &solved, &subinfeas, type);
+
+      /* the solution for the subproblem is only processed if the return code is SCIP_OKAY */
+      if( retcode == SCIP_OKAY )
+      {
+#ifdef SCIP_DEBUG
+         if( type == SCIP_BENDERSENFOTYPE_LP )
+         {
+         SCIPsetDebugMsg(set, "Enfo LP: Subproblem %d Type %d (%f < %f)\n", probnumber,
+            SCIPbendersGetSubproblemType(benders, probnumber), SCIPbendersGetAuxiliaryVarVal(benders, set, sol, probnumber),
+               SCIPbendersGetSubproblemObjval(benders, probnumber));
+         }
+#endif
+         subprobsolved[probnumber] = solved;
+
+         *infeasible = *infeasible || subinfeas;
+         if( subinfeas )
+            substatus[probnumber] = SCIP_BENDERSSUBSTATUS_INFEAS;
+
+         /* if the subproblems are solved to check integer feasibility, then the optimality check must be performed.
+          * This will only be performed if checkint is TRUE and the subproblem was solved. The subproblem may not be
+          * solved if the user has defined a solving function
+          */
+         if( checkint && subprobsolved[probnumber] )
+         {
+            /* if the subproblem is feasible, then it is necessary to update the value of the auxiliary variable to the
+             * objective function value of the subproblem.
+             */
+            if( !subinfeas )
+            {
+               SCIP_Bool subproboptimal;
+
+               subproboptimal = SCIPbendersSubproblemIsOptimal(benders, set, sol, probnumber);
+
+               if( subproboptimal )
+                  substatus[probnumber] = SCIP_BENDERSSUBSTATUS_OPTIMAL;
+               else
+                  substatus[probnumber] = SCIP_BENDERSSUBSTATUS_AUXVIOL;
+
+               /* It is only possible to determine the optimality of a solution within a given subproblem in four
+                * different cases:
+                * probnumber) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is convex.
+                * ii) solveloop == SCIP_BENDERSOLVELOOP_CONVEX  and only the convex relaxations will be checked.
+                * iii) solveloop == SCIP_BENDERSSOLVELOOP_USERCIP and the subproblem was solved, since the user has
+                * defined a solve function, it is expected that the solving is correctly executed.
+                * iv) solveloop == SCIP_BENDERSSOLVELOOP_CIP and the MIP for the subproblem has been solved.
+                */
+               if( convexsub || onlyconvexcheck
+                  || solveloop == SCIP_BENDERSSOLVELOOP_CIP
+                  || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP )
+                  *optimal = *optimal && subproboptimal;
+
+#ifdef SCIP_DEBUG
+               if( convexsub || solveloop >= SCIP_BENDERSSOLVELOOP_CIP )
+               {
+                  if( subproboptimal )
+                  {
+                     SCIPsetDebugMsg(set, "Subproblem %d is Optimal (%f >= %f)\n", probnumber,
+                        SCIPbendersGetAuxiliaryVarVal(benders, set, sol, probnumber), SCIPbendersGetSubproblemObjval(benders, probnumber));
+                  }
+                  else
+                  {
+                     SCIPsetDebugMsg(set, "Subproblem %d is NOT Optimal (%f < %f)\n", probnumber,
+                        SCIPbendersGetAuxiliaryVarVal(benders, set, sol, probnumber), SCIPbendersGetSubproblemObjval(benders, probnumber));
+                  }
+               }
+#endif
+
+               /* the nverified variable is only incremented when the original form of the subproblem has been solved.
+                * What is meant by "original" is that the LP relaxation of CIPs are solved to generate valid cuts. So
+                * if the subproblem is defined as a CIP, then it is only classified as checked if the CIP is solved.
+                * There are three cases where the "original" form is solved are:
+                * probnumber) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is an LP
+                *    - the original form has been solved.
+                * ii) solveloop == SCIP_BENDERSSOLVELOOP_CIP or USERCIP and the CIP for the subproblem has been
+                *    solved.
+                * iii) or, only a convex check is performed.
+                */
+               if( ((solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX)
+                     && convexsub)
+                  || ((solveloop == SCIP_BENDERSSOLVELOOP_CIP || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP)
+                     && !convexsub)
+                  || onlyconvexcheck )
+                  (*nverified)++;
+            }
+         }
+      }
+   }
+
+   /* checking whether the limits have been exceeded in the master problem */
+   *stopped = SCIPisStopped(set->scip);
+
+   return retcode;
+}
+
+/** data of a job solving a subset of the subproblems in parallel; the job solves every njobs-th subproblem of the solve
+ *  loop, starting at firstidx, and stores its own loop results, which are combined after all jobs have been collected
+ */
+struct SCIP_BendersSubprobJob
+{
+   SCIP_BENDERS*         benders;            /**< Benders' decomposition */
+   SCIP_SET*             set;                /**< global SCIP settings */
+   SCIP_SOL*             sol;                /**< primal CIP solution */
+   SCIP_BENDERSENFOTYPE  type;               /**< the type of solution being enforced */
+   SCIP_BENDERSSOLVELOOP solveloop;          /**< the current solve loop */
+   SCIP_Bool             checkint;           /**< are the subproblems called during a check/enforce of integer sols? */
+   SCIP_Bool             onlyconvexcheck;    /**< are only the convex relaxations of the subproblems checked? */
+   int*                  solveidx;           /**< the indices of subproblems to be solved in this loop */
+   int                   nsolveidx;          /**< the number of subproblems to be solved in this loop */
+   int                   firstidx;           /**< position in solveidx of the first subproblem solved by this job */
+   int                   njobs;              /**< number of jobs that solve the subproblems of this loop */
+   SCIP_Bool*            subprobsolved;      /**< array indicating the subproblems that were solved in this loop */
+   SCIP_BENDERSSUBSTATUS* substatus;         /**< array to store the status of the subsystem */
+   int                   nverified;          /**< number of verified subproblems of this job */
+   SCIP_Bool             infeasible;         /**< has the job proven the master problem infeasible? */
+   SCIP_Bool             optimal;            /**< is the solution optimal w.r.t. the subproblem of this job? */
+   SCIP_Bool             stopped;            /**< was the solving process stopped? */
+};
+typedef struct SCIP_BendersSubprobJob SCIP_BENDERSSUBPROBJOB;
+
+/** job function solving a subset of the subproblems */
+static
+SCIP_RETCODE execBendersSubprobJob(
+   void*                 args                /**< the job data */
+   )
+{
+   SCIP_BENDERSSUBPROBJOB* job;
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   int j;
+
+   job = (SCIP_BENDERSSUBPROBJOB*) args;
+   assert(job != NULL);
+   assert(job->njobs >= 1);
+
+   for( j = job->firstidx; j < job->nsolveidx; j += job->njobs )
+   {
+      SCIP_RETCODE subretcode;
+
+      subretcode = solveBendersSubproblemInLoop(job->benders, job->set, job->sol, job->type, job->solveloop,
+         job->checkint, job->onlyconvexcheck, job->solveidx[j], job->subprobsolved, job->substatus, &job->nverified,
+         &job->infeasible, &job->optimal, &job->stopped);
+      retcode = MIN(retcode, subretcode);
+   }
+
+   return retcode;
+}
+
+/** returns the number of jobs that solve the subproblems in parallel through the task processing interface
+ *
+ *  The number of jobs is min(numthreads, maxnthreads). The subproblems are solved sequentially if this is at most one or
+ *  if no thread pool is available, see SCIPacquireTPI().
+ */
+static
+SCIP_RETCODE bendersGetNJobs(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int*                  njobs               /**< pointer to store the number of parallel jobs, or 1 if sequential */
+   )
+{
+   SCIP_Bool usetpi;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+   assert(njobs != NULL);
+
+   *njobs = MIN(benders->numthreads, set->parallel_maxnthreads);
+
+   if( *njobs <= 1 )
+   {
+      *njobs = 1;
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPacquireTPI(set->scip, &usetpi) );
+
+   if( !usetpi )
+      *njobs = 1;
+
+   return SCIP_OKAY;
+}
+
+/** returns the value of a master problem variable in the given solution
+ *
+ *  While the subproblems are solved in parallel, the value is computed from benders->mastersolvals, which stores the
+ *  values of the active master problem variables, so that the jobs do not access the solution itself.
+ */
+static
+SCIP_Real getMasterVarSolVal(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_VAR*             var                 /**< master problem variable */
+   )
+{
+   SCIP_Real scalar;
+   SCIP_Real constant;
+   SCIP_Real solval;
+   int i;
+
+   assert(benders != NULL);
+   assert(var != NULL);
+
+   if( benders->mastersolvals == NULL )
+      return SCIPgetSolVal(set->scip, sol, var);
+
+   scalar = 1.0;
+   constant = 0.0;
+   SCIP_CALL_ABORT( SCIPvarGetProbvarSum(&var, set, &scalar, &constant) );
+
+   if( var == NULL || scalar == 0.0 )
+      return constant;
+
+   switch( SCIPvarGetStatus(var) )
+   {
+   case SCIP_VARSTATUS_LOOSE:
+   case SCIP_VARSTATUS_COLUMN:
+      assert(SCIPvarGetProbindex(var) >= 0 && SCIPvarGetProbindex(var) < benders->nmastersolvals);
+      return scalar * benders->mastersolvals[SCIPvarGetProbindex(var)] + constant;
+
+   case SCIP_VARSTATUS_MULTAGGR:
+      solval = SCIPvarGetMultaggrConstant(var);
+      for( i = 0; i < SCIPvarGetMultaggrNVars(var); ++i )
+         solval += SCIPvarGetMultaggrScalars(var)[i] * getMasterVarSolVal(benders, set, sol, SCIPvarGetMultaggrVars(var)[i]);
+      return scalar * solval + constant;
+
+   default:
+      SCIPerrorMessage("unexpected status of master problem variable <%s>\n", SCIPvarGetName(var));
+      SCIPABORT();
+      return SCIP_INVALID; /*lint !e527*/
+   }
+}
+
 /** Solves each of the Benders' decomposition subproblems for the given solution. All, or a fraction, of subproblems are
  *  solved before the Benders' decomposition cuts are generated.
  *  Since a convex relaxation of the subproblem could be solved to generate cuts, a parameter nverified is used to
@@ -3130,11 +3473,7 @@ SCIP_RETCODE solveBendersSubproblems(
    )
 {
    SCIP_Bool onlyconvexcheck;
-#ifdef _OPENMP
-   int numthreads;
-   int maxnthreads;
-#endif
-   int i;
+   int njobs;
    int j;
 
    /* local variables for parallelisation of the solving loop */
@@ -3148,16 +3487,6 @@ SCIP_RETCODE solveBendersSubproblems(
    assert(benders != NULL);
    assert(set != NULL);
 
-   /* getting the number of threads to use when solving the subproblems. This will be either be
-    * min(numthreads, maxnthreads).
-    * NOTE: This may not be correct. The Benders' decomposition parallelisation should not take all minimum threads if
-    * they are specified. The number of threads should be specified with the Benders' decomposition parameters.
-    */
-#ifdef _OPENMP
-   SCIP_CALL( SCIPsetGetIntParam(set, "parallel/maxnthreads", &maxnthreads) );
-   numthreads = MIN(benders->numthreads, maxnthreads);
-#endif
-
    /* in the case of an LNS check, only the convex relaxations of the subproblems will be solved. This is a performance
     * feature, since solving the convex relaxation is typically much faster than solving the corresponding CIP. While
     * the CIP is not solved during the LNS check, the solutions are still of higher quality than when Benders' is not
@@ -3176,184 +3505,89 @@ SCIP_RETCODE solveBendersSubproblems(
    }
    else
    {
+      SCIP_CALL( bendersGetNJobs(benders, set, &njobs) );
+      njobs = MIN(njobs, nsolveidx);
+
       /* solving each of the subproblems for Benders' decomposition */
       /* TODO: ensure that the each of the subproblems solve and update the parameters with the correct return values
        */
-#ifndef __INTEL_COMPILER
-      #pragma omp parallel for num_threads(numthreads) private(i) reduction(&&:locoptimal) reduction(||:locinfeasible) reduction(+:locnverified) reduction(||:locstopped) reduction(min:retcode)
-#endif
-      for( j = 0; j < nsolveidx; j++ )
+      if( njobs > 1 )
       {
-         SCIP_Bool subinfeas = FALSE;
-         SCIP_Bool convexsub;
-         SCIP_Bool solvesub = TRUE;
-         SCIP_Bool solved;
+         SCIP_BENDERSSUBPROBJOB* jobs;
+         int jobid;
 
-         i = solveidx[j];
-         convexsub = SCIPbendersGetSubproblemType(benders, i) == SCIP_BENDERSSUBTYPE_CONVEXCONT;;
+         /* the jobs read the master solution values from a plain array, since accessing the solution is not thread-safe */
+         assert(benders->mastersolvals == NULL);
+         benders->nmastersolvals = SCIPgetNVars(set->scip);
+         SCIP_CALL( SCIPsetAllocBufferArray(set, &benders->mastersolvals, benders->nmastersolvals) );
+         SCIP_CALL( SCIPgetSolVals(set->scip, sol, benders->nmastersolvals, SCIPgetVars(set->scip),
+               benders->mastersolvals) );
 
-         /* the subproblem is initially flagged as not solved for this solving loop */
-         (*subprobsolved)[i] = FALSE;
+         SCIP_CALL( SCIPsetAllocBufferArray(set, &jobs, njobs) );
 
-         /* setting the subsystem status to UNKNOWN at the start of each solve loop */
-         (*substatus)[i] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
+         jobid = SCIPtpiGetNewJobID();
 
-         /* for the second solving loop, if the problem is an LP, it is not solved again. If the problem is a MIP,
-          * then the subproblem objective function value is set to infinity. However, if the subproblem is proven
-          * infeasible from the LP, then the IP loop is not performed.
-          * If the solve loop is SCIP_BENDERSSOLVELOOP_USERCIP, then nothing is done. It is assumed that the user will
-          * correctly update the objective function within the user-defined solving function.
-          */
-         if( solveloop == SCIP_BENDERSSOLVELOOP_CIP )
+         TPI_PARA
          {
-            if( convexsub || (*substatus)[i] == SCIP_BENDERSSUBSTATUS_INFEAS )
-               solvesub = FALSE;
-            else
+            TPI_SINGLE
             {
-               SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersSubproblem(benders, i) != NULL ?
-                  SCIPinfinity(SCIPbendersSubproblem(benders, i)) : SCIPsetInfinity(set));
-            }
-         }
-
-         /* if the subproblem is independent, then it does not need to be solved. In this case, the nverified flag will
-          * increase by one. When the subproblem is not independent, then it needs to be checked.
-          */
-         if( !subproblemIsActive(benders, i) )
-         {
-            /* NOTE: There is no need to update the optimal flag. This is because optimal is always TRUE until a
-             * non-optimal subproblem is found.
-             */
-            /* if the auxiliary variable value is infinity, then the subproblem has not been solved yet. Currently the
-             * subproblem statue is unknown. */
-            if( SCIPsetIsInfinity(set, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i))
-               || SCIPsetIsInfinity(set, -SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i))
-               || SCIPsetIsInfinity(set, -SCIPbendersGetSubproblemLowerbound(benders, i)) )
-            {
-               SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersSubproblem(benders, i) != NULL ?
-                  SCIPinfinity(SCIPbendersSubproblem(benders, i)) : SCIPsetInfinity(set));
-
-               (*substatus)[i] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
-               locoptimal = FALSE;
-
-               SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, but has not been solved."
-                 " setting status to UNKNOWN\n", i);
-            }
-            else
-            {
-               if( SCIPrelDiff(SCIPbendersGetSubproblemLowerbound(benders, i),
-                     SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i)) < benders->solutiontol )
-               {
-                  SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i));
-                  (*substatus)[i] = SCIP_BENDERSSUBSTATUS_OPTIMAL;
-               }
-               else
+               for( j = 0; j < njobs; j++ )
                {
-                  SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersGetSubproblemLowerbound(benders, i));
-                  (*substatus)[i] = SCIP_BENDERSSUBSTATUS_AUXVIOL;
+                  /* cppcheck-suppress unassignedVariable */
+                  SCIP_JOB* job;
+                  SCIP_SUBMITSTATUS status;
+
+                  jobs[j].benders = benders;
+                  jobs[j].set = set;
+                  jobs[j].sol = sol;
+                  jobs[j].type = type;
+                  jobs[j].solveloop = solveloop;
+                  jobs[j].checkint = checkint;
+                  jobs[j].onlyconvexcheck = onlyconvexcheck;
+                  jobs[j].solveidx = solveidx;
+                  jobs[j].nsolveidx = nsolveidx;
+                  jobs[j].firstidx = j;
+                  jobs[j].njobs = njobs;
+                  jobs[j].subprobsolved = *subprobsolved;
+                  jobs[j].substatus = *substatus;
+                  jobs[j].nverified = 0;
+                  jobs[j].infeasible = FALSE;
+                  jobs[j].optimal = TRUE;
+                  jobs[j].stopped = FALSE;
+
+                  SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execBendersSubprobJob, (void*) &jobs[j]) );
+                  SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+                  assert(status == SCIP_SUBMIT_SUCCESS);
                }
-
-               SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, setting status to OPTIMAL\n", i);
             }
-
-            (*subprobsolved)[i] = TRUE;
-
-            /* the nverified counter is only increased in the convex solving loop */
-            if( solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX )
-               locnverified++;
          }
-         else if( solvesub )
-         {
-            retcode = SCIPbendersExecSubproblemSolve(benders, set, sol, i, solveloop, FALSE, &solved, &subinfeas, type);
-
-            /* the solution for the subproblem is only processed if the return code is SCIP_OKAY */
-            if( retcode == SCIP_OKAY )
-            {
-#ifdef SCIP_DEBUG
-               if( type == SCIP_BENDERSENFOTYPE_LP )
-               {
-               SCIPsetDebugMsg(set, "Enfo LP: Subproblem %d Type %d (%f < %f)\n", i,
-                  SCIPbendersGetSubproblemType(benders, i), SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i),
-                     SCIPbendersGetSubproblemObjval(benders, i));
-               }
-#endif
-               (*subprobsolved)[i] = solved;
 
-               locinfeasible = locinfeasible || subinfeas;
-               if( subinfeas )
-                  (*substatus)[i] = SCIP_BENDERSSUBSTATUS_INFEAS;
+         /* the smallest return code of all jobs is returned */
+         retcode = SCIPtpiProcessAndCollectJobs(jobid);
 
-               /* if the subproblems are solved to check integer feasibility, then the optimality check must be performed.
-                * This will only be performed if checkint is TRUE and the subproblem was solved. The subproblem may not be
-                * solved if the user has defined a solving function
-                */
-               if( checkint && (*subprobsolved)[i] )
-               {
-                  /* if the subproblem is feasible, then it is necessary to update the value of the auxiliary variable to the
-                   * objective function value of the subproblem.
-                   */
-                  if( !subinfeas )
-                  {
-                     SCIP_Bool subproboptimal;
-
-                     subproboptimal = SCIPbendersSubproblemIsOptimal(benders, set, sol, i);
-
-                     if( subproboptimal )
-                        (*substatus)[i] = SCIP_BENDERSSUBSTATUS_OPTIMAL;
-                     else
-                        (*substatus)[i] = SCIP_BENDERSSUBSTATUS_AUXVIOL;
-
-                     /* It is only possible to determine the optimality of a solution within a given subproblem in four
-                      * different cases:
-                      * i) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is convex.
-                      * ii) solveloop == SCIP_BENDERSOLVELOOP_CONVEX  and only the convex relaxations will be checked.
-                      * iii) solveloop == SCIP_BENDERSSOLVELOOP_USERCIP and the subproblem was solved, since the user has
-                      * defined a solve function, it is expected that the solving is correctly executed.
-                      * iv) solveloop == SCIP_BENDERSSOLVELOOP_CIP and the MIP for the subproblem has been solved.
-                      */
-                     if( convexsub || onlyconvexcheck
-                        || solveloop == SCIP_BENDERSSOLVELOOP_CIP
-                        || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP )
-                        locoptimal = locoptimal && subproboptimal;
+         for( j = 0; j < njobs; j++ )
+         {
+            locnverified += jobs[j].nverified;
+            locinfeasible = locinfeasible || jobs[j].infeasible;
+            locoptimal = locoptimal && jobs[j].optimal;
+            locstopped = locstopped || jobs[j].stopped;
+         }
 
-#ifdef SCIP_DEBUG
-                     if( convexsub || solveloop >= SCIP_BENDERSSOLVELOOP_CIP )
-                     {
-                        if( subproboptimal )
-                        {
-                           SCIPsetDebugMsg(set, "Subproblem %d is Optimal (%f >= %f)\n", i,
-                              SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i), SCIPbendersGetSubproblemObjval(benders, i));
-                        }
-                        else
-                        {
-                           SCIPsetDebugMsg(set, "Subproblem %d is NOT Optimal (%f < %f)\n", i,
-                              SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i), SCIPbendersGetSubproblemObjval(benders, i));
-                        }
-                     }
-#endif
+         SCIPsetFreeBufferArray(set, &jobs);
+         SCIPsetFreeBufferArray(set, &benders->mastersolvals);
+         benders->nmastersolvals = 0;
+      }
+      else
+      {
+         for( j = 0; j < nsolveidx; j++ )
+         {
+            SCIP_RETCODE subretcode;
 
-                     /* the nverified variable is only incremented when the original form of the subproblem has been solved.
-                      * What is meant by "original" is that the LP relaxation of CIPs are solved to generate valid cuts. So
-                      * if the subproblem is defined as a CIP, then it is only classified as checked if the CIP is solved.
-                      * There are three cases where the "original" form is solved are:
-                      * i) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is an LP
-                      *    - the original form has been solved.
-                      * ii) solveloop == SCIP_BENDERSSOLVELOOP_CIP or USERCIP and the CIP for the subproblem has been
-                      *    solved.
-                      * iii) or, only a convex check is performed.
-                      */
-                     if( ((solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX)
-                           && convexsub)
-                        || ((solveloop == SCIP_BENDERSSOLVELOOP_CIP || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP)
-                           && !convexsub)
-                        || onlyconvexcheck )
-                        locnverified++;
-                  }
-               }
-            }
+            subretcode = solveBendersSubproblemInLoop(benders, set, sol, type, solveloop, checkint, onlyconvexcheck,
+               solveidx[j], *subprobsolved, *substatus, &locnverified, &locinfeasible, &locoptimal, &locstopped);
+            retcode = MIN(retcode, subretcode);
          }
-
-         /* checking whether the limits have been exceeded in the master problem */
-         locstopped = SCIPisStopped(set->scip);
       }
    }
 
@@ -4432,7 +4666,7 @@ SCIP_RETCODE SCIPbendersSetupSubproblem(
           * are used to ensure that the bounds are not exceeded when applying the fixings for the Benders'
           * decomposition subproblems
           */
-         solval = SCIPgetSolVal(set->scip, sol, mastervar);
+         solval = getMasterVarSolVal(benders, set, sol, mastervar);
          if( !SCIPisLT(set->scip, solval, SCIPvarGetUbLocal(vars[i])) )
             solval = SCIPvarGetUbLocal(vars[i]);
          else if( !SCIPisGT(set->scip, solval, SCIPvarGetLbLocal(vars[i])) )
@@ -5122,7 +5356,7 @@ SCIP_Real SCIPbendersGetAuxiliaryVarVal(
    auxiliaryvar = SCIPbendersGetAuxiliaryVar(benders, probnumber);
    assert(auxiliaryvar != NULL);
 
-   return SCIPgetSolVal(set->scip, sol, auxiliaryvar);
+   return getMasterVarSolVal(benders, set, sol, auxiliaryvar);
 }
 
 /** Solves an independent subproblem to identify its lower bound. The lower bound is then used to update the bound on
@@ -64,6 +64,8 @@
 #define DEFAULT_PROBINGBOUNDS    TRUE        /**< should valid bounds be identified in a probing-like fashion during strong
                                               *   branching (only with propagation)? */
 #define DEFAULT_FORCESTRONGBRANCH FALSE      /**< should strong branching be applied even if there is just a single candidate? */
+#define DEFAULT_SBBATCHSIZE         1        /**< number of candidates evaluated together in one batched strong branching call of
+                                              *   the LP interface (1: evaluate candidates one at a time) */
 
 
 /** branching rule data */
@@ -76,6 +78,8 @@ struct SCIP_BranchruleData
    SCIP_Bool             probingbounds;      /**< should valid bounds be identified in a probing-like fashion during strong
                                               *   branching (only with propagation)? */
    SCIP_Bool             forcestrongbranch;  /**< should strong branching be applied even if there is just a single candidate? */
+   int                   sbbatchsize;        /**< number of candidates evaluated together in one batched strong branching call
+                                              *   of the LP interface (1: evaluate candidates one at a time) */
    int                   lastcand;           /**< last evaluated candidate of last branching rule execution */
    int                   skipsize;           /**< size of skipdown and skipup array */
    SCIP_Bool*            skipdown;           /**< should be branching on down child be skipped? */
@@ -159,6 +163,124 @@ SCIP_DECL_BRANCHEXIT(branchExitFullstrong)
    return SCIP_OKAY;
 }
 
+/** evaluates strong branching for the next candidates in one batched call of the LP interface
+ *
+ *  Starting at position @p pos of the cyclic candidate order beginning at @p start, up to @p batchsize candidates that
+ *  have not been evaluated at the current node are collected and passed to SCIPgetVarsStrongbranchesFrac(). The results
+ *  are stored per candidate, such that the caller can process them in the same order and with the same outcome as if
+ *  the candidates were evaluated one at a time.
+ */
+static
+SCIP_RETCODE prefetchStrongbranches(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            lpcands,            /**< branching candidates */
+   int                   nlpcands,           /**< number of branching candidates */
+   int                   start,              /**< starting index in lpcands of the cyclic candidate order */
+   int                   pos,                /**< position in the cyclic candidate order of the first candidate to evaluate */
+   int                   endpos,             /**< position in the cyclic candidate order after the last candidate to evaluate */
+   int                   batchsize,          /**< maximal number of candidates to evaluate */
+   SCIP_Longint          nodenum,            /**< number of the current node */
+   SCIP_Longint          reevalage,          /**< number of intermediate LPs solved to trigger reevaluation */
+   SCIP_Bool*            sbprefetched,       /**< array to mark candidates with stored strong branching results */
+   SCIP_Real*            sbdown,             /**< array to store dual bounds after branching candidates down */
+   SCIP_Real*            sbup,               /**< array to store dual bounds after branching candidates up */
+   SCIP_Bool*            sbdownvalid,        /**< array to store whether the down values are valid dual bounds */
+   SCIP_Bool*            sbupvalid,          /**< array to store whether the up values are valid dual bounds */
+   SCIP_Bool*            sbdowninf,          /**< array to store whether the downward branches are infeasible */
+   SCIP_Bool*            sbupinf,            /**< array to store whether the upward branches are infeasible */
+   SCIP_Bool*            sbdownconflict,     /**< array to store whether conflicts were created for infeasible downward branches */
+   SCIP_Bool*            sbupconflict,       /**< array to store whether conflicts were created for infeasible upward branches */
+   SCIP_Bool*            lperror             /**< pointer to store whether an unresolved LP error occurred */
+   )
+{
+   SCIP_VAR** batchvars;
+   SCIP_Real* batchdown;
+   SCIP_Real* batchup;
+   SCIP_Bool* batchdownvalid;
+   SCIP_Bool* batchupvalid;
+   SCIP_Bool* batchdowninf;
+   SCIP_Bool* batchupinf;
+   SCIP_Bool* batchdownconflict;
+   SCIP_Bool* batchupconflict;
+   int* batchidx;
+   int nbatch;
+   int i;
+   int c;
+
+   assert(scip != NULL);
+   assert(lpcands != NULL);
+   assert(sbprefetched != NULL);
+   assert(lperror != NULL);
+   assert(batchsize > 1);
+   assert(0 <= pos && pos < endpos && endpos <= nlpcands);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchvars, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchidx, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchdown, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchup, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchdownvalid, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchupvalid, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchdowninf, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchupinf, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchdownconflict, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchupconflict, batchsize) );
+
+   /* collect candidates in the order in which the caller will process them, skipping those with recent results */
+   nbatch = 0;
+   for( i = pos; i < endpos && nbatch < batchsize; ++i )
+   {
+      c = (start + i) % nlpcands;
+
+      if( sbprefetched[c] )
+         continue;
+
+      if( i > pos && SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
+         && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage )
+         continue;
+
+      batchvars[nbatch] = lpcands[c];
+      batchidx[nbatch] = c;
+      ++nbatch;
+   }
+   assert(nbatch >= 1);
+
+   SCIPdebugMsg(scip, "applying batched strong branching on %d variables\n", nbatch);
+
+   SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, batchvars, nbatch, INT_MAX, batchdown, batchup, batchdownvalid,
+         batchupvalid, batchdowninf, batchupinf, batchdownconflict, batchupconflict, lperror) );
+
+   if( !(*lperror) )
+   {
+      for( i = 0; i < nbatch; ++i )
+      {
+         c = batchidx[i];
+
+         sbprefetched[c] = TRUE;
+         sbdown[c] = batchdown[i];
+         sbup[c] = batchup[i];
+         sbdownvalid[c] = batchdownvalid[i];
+         sbupvalid[c] = batchupvalid[i];
+         sbdowninf[c] = batchdowninf[i];
+         sbupinf[c] = batchupinf[i];
+         sbdownconflict[c] = batchdownconflict[i];
+         sbupconflict[c] = batchupconflict[i];
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &batchupconflict);
+   SCIPfreeBufferArray(scip, &batchdownconflict);
+   SCIPfreeBufferArray(scip, &batchupinf);
+   SCIPfreeBufferArray(scip, &batchdowninf);
+   SCIPfreeBufferArray(scip, &batchupvalid);
+   SCIPfreeBufferArray(scip, &batchdownvalid);
+   SCIPfreeBufferArray(scip, &batchup);
+   SCIPfreeBufferArray(scip, &batchdown);
+   SCIPfreeBufferArray(scip, &batchidx);
+   SCIPfreeBufferArray(scip, &batchvars);
+
+   return SCIP_OKAY;
+}
+
 /**
  * Selects a variable from a set of candidates by strong branching
  *
@@ -196,6 +318,15 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
    SCIP_VAR** vars = NULL;
    SCIP_Real* newlbs = NULL;
    SCIP_Real* newubs = NULL;
+   SCIP_Real* sbdown = NULL;
+   SCIP_Real* sbup = NULL;
+   SCIP_Bool* sbprefetched = NULL;
+   SCIP_Bool* sbdownvalid = NULL;
+   SCIP_Bool* sbupvalid = NULL;
+   SCIP_Bool* sbdowninf = NULL;
+   SCIP_Bool* sbupinf = NULL;
+   SCIP_Bool* sbdownconflict = NULL;
+   SCIP_Bool* sbupconflict = NULL;
    SCIP_BRANCHRULE* branchrule;
    SCIP_BRANCHRULEDATA* branchruledata;
    SCIP_Longint reevalage;
@@ -217,6 +348,7 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
    SCIP_Bool upconflict;
    SCIP_Bool bothgains;
    SCIP_Bool propagate;
+   SCIP_Bool batched;
    int nvars = 0;
    int nsbcalls;
    int i;
@@ -297,6 +429,24 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
       SCIP_CALL( SCIPallocBufferArray(scip, &newubs, nvars) );
    }
 
+   /* batched strong branching is only available without propagation; the results of each batch are stored per candidate
+    * and processed in the usual candidate order, such that the selected variable does not depend on the batch size
+    */
+   batched = (!propagate && branchruledata->sbbatchsize > 1 && MIN(nlpcands, ncomplete) > 1);
+
+   if( batched )
+   {
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &sbprefetched, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbdown, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbup, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbdownvalid, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbupvalid, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbdowninf, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbupinf, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbdownconflict, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbupconflict, nlpcands) );
+   }
+
     /* initialize strong branching */
    SCIP_CALL( SCIPstartStrongbranch(scip, propagate) );
 
@@ -313,7 +463,7 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
       /* don't use strong branching on variables that have already been initialized at the current node,
        * and that were evaluated not too long ago
        */
-      if( SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
+      if( (!batched || !sbprefetched[c]) && SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
          && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage )
       {
          SCIP_Real lastlpobjval;
@@ -351,6 +501,32 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
             SCIPdebugMsg(scip, "-> down=%.9g (gain=%.9g, valid=%u, inf=%u, conflict=%u), up=%.9g (gain=%.9g, valid=%u, inf=%u, conflict=%u)\n",
                down, down - lpobjval, downvalid, downinf, downconflict, up, up - lpobjval, upvalid, upinf, upconflict);
          }
+         else if( batched && i < ncomplete )
+         {
+            lperror = FALSE;
+
+            /* evaluate this and the following candidates together, unless it was already part of an earlier batch */
+            if( !sbprefetched[c] )
+            {
+               SCIP_CALL( prefetchStrongbranches(scip, lpcands, nlpcands, *start, i, MIN(nlpcands, ncomplete),
+                     branchruledata->sbbatchsize, nodenum, reevalage, sbprefetched, sbdown, sbup, sbdownvalid, sbupvalid,
+                     sbdowninf, sbupinf, sbdownconflict, sbupconflict, &lperror) );
+            }
+
+            if( !lperror )
+            {
+               assert(sbprefetched[c]);
+
+               down = sbdown[c];
+               up = sbup[c];
+               downvalid = sbdownvalid[c];
+               upvalid = sbupvalid[c];
+               downinf = sbdowninf[c];
+               upinf = sbupinf[c];
+               downconflict = sbdownconflict[c];
+               upconflict = sbupconflict[c];
+            }
+         }
          else
          {
             SCIP_CALL( SCIPgetVarStrongbranchFrac(scip, lpcands[c], INT_MAX, FALSE,
@@ -526,6 +702,19 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
 
    *start = c;
 
+   if( batched )
+   {
+      SCIPfreeBufferArray(scip, &sbupconflict);
+      SCIPfreeBufferArray(scip, &sbdownconflict);
+      SCIPfreeBufferArray(scip, &sbupinf);
+      SCIPfreeBufferArray(scip, &sbdowninf);
+      SCIPfreeBufferArray(scip, &sbupvalid);
+      SCIPfreeBufferArray(scip, &sbdownvalid);
+      SCIPfreeBufferArray(scip, &sbup);
+      SCIPfreeBufferArray(scip, &sbdown);
+      SCIPfreeBufferArray(scip, &sbprefetched);
+   }
+
    if( probingbounds )
    {
       assert(newlbs != NULL);
@@ -666,6 +855,7 @@ SCIP_RETCODE SCIPincludeBranchruleFullstrong(
    /* create fullstrong branching rule data */
    SCIP_CALL( SCIPallocBlockMemory(scip, &branchruledata) );
    branchruledata->lastcand = 0;
+   branchruledata->sbbatchsize = DEFAULT_SBBATCHSIZE;
    branchruledata->skipsize = 0;
    branchruledata->skipup = NULL;
    branchruledata->skipdown = NULL;
@@ -700,6 +890,10 @@ SCIP_RETCODE SCIPincludeBranchruleFullstrong(
          "branching/fullstrong/forcestrongbranch",
          "should strong branching be applied even if there is just a single candidate?",
          &branchruledata->forcestrongbranch, TRUE, DEFAULT_FORCESTRONGBRANCH, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "branching/fullstrong/sbbatchsize",
+         "number of candidates evaluated together in one batched strong branching call of the LP interface, only used without propagation, no speedup unless the LP interface batches strong branching (1: evaluate candidates one at a time)",
+         &branchruledata->sbbatchsize, TRUE, DEFAULT_SBBATCHSIZE, 1, INT_MAX, NULL, NULL) );
 
    return SCIP_OKAY;
 }
@@ -105,6 +105,8 @@
 #define DEFAULT_DYNAMICWEIGHTS   TRUE        /**< should the weights of the branching rule be adjusted dynamically during solving based
                                               *   infeasible and objective leaf counters? */
 #define DEFAULT_DEGENERACYAWARE  1           /**< should degeneracy be taken into account to update weights and skip strong branching? (0: off, 1: after root, 2: always)*/
+#define DEFAULT_SBBATCHSIZE      1           /**< number of candidates evaluated together in one batched strong branching call of
+                                              *   the LP interface (1: evaluate candidates one at a time) */
 
 /* symmetry handling */
 #define DEFAULT_FILTERCANDSSYM   FALSE       /**< Use symmetry to filter branching candidates? */
@@ -147,6 +149,8 @@ struct SCIP_BranchruleData
                                               *   solving based on objective and infeasible leaf counters? */
    int                   degeneracyaware;    /**< should degeneracy be taken into account to update weights and skip strong branching? (0: off, 1: after root, 2: always) */
    int                   confidencelevel;    /**< The confidence level for statistical methods, between 0 (Min) and 4 (Max). */
+   int                   sbbatchsize;        /**< number of candidates evaluated together in one batched strong branching call
+                                              *   of the LP interface (1: evaluate candidates one at a time) */
    int*                  nlcount;            /**< array to store nonlinear count values */
    int                   nlcountsize;        /**< length of nlcount array */
    int                   nlcountmax;         /**< maximum entry in nlcount array or 1 if NULL */
@@ -764,6 +768,107 @@ SCIP_RETCODE applyBdchgs(
    return SCIP_OKAY;
 }
 
+/** evaluates strong branching for the next initialization candidates in one batched call of the LP interface
+ *
+ *  Up to @p batchsize candidates of the initialization order, starting at position @p pos, are passed to
+ *  SCIPgetVarsStrongbranchesFrac(). The results are stored per candidate, such that the reliability loop processes
+ *  them in the same order as if the candidates were evaluated one at a time.
+ */
+static
+SCIP_RETCODE prefetchStrongbranches(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            branchcands,        /**< branching candidates */
+   int*                  initcands,          /**< candidates to initialize with strong branching, in order */
+   int                   ninitcands,         /**< number of candidates to initialize */
+   int                   pos,                /**< position in initcands of the first candidate to evaluate */
+   int                   batchsize,          /**< maximal number of candidates to evaluate */
+   int                   itlim,              /**< iteration limit for strong branching */
+   SCIP_Bool*            inbatch,            /**< array to mark candidates with stored strong branching results */
+   SCIP_Real*            batchdown,          /**< array to store dual bounds after branching candidates down */
+   SCIP_Real*            batchup,            /**< array to store dual bounds after branching candidates up */
+   SCIP_Bool*            batchdownvalid,     /**< array to store whether the down values are valid dual bounds */
+   SCIP_Bool*            batchupvalid,       /**< array to store whether the up values are valid dual bounds */
+   SCIP_Bool*            batchdowninf,       /**< array to store whether the downward branches are infeasible */
+   SCIP_Bool*            batchupinf,         /**< array to store whether the upward branches are infeasible */
+   SCIP_Bool*            batchdownconflict,  /**< array to store whether conflicts were created for infeasible downward branches */
+   SCIP_Bool*            batchupconflict,    /**< array to store whether conflicts were created for infeasible upward branches */
+   SCIP_Bool*            lperror             /**< pointer to store whether an unresolved LP error occurred */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_Real* down;
+   SCIP_Real* up;
+   SCIP_Bool* downvalid;
+   SCIP_Bool* upvalid;
+   SCIP_Bool* downinf;
+   SCIP_Bool* upinf;
+   SCIP_Bool* downconflict;
+   SCIP_Bool* upconflict;
+   int nvars;
+   int i;
+
+   assert(scip != NULL);
+   assert(branchcands != NULL);
+   assert(initcands != NULL);
+   assert(inbatch != NULL);
+   assert(lperror != NULL);
+   assert(0 <= pos && pos < ninitcands);
+   assert(batchsize > 1);
+
+   nvars = MIN(batchsize, ninitcands - pos);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &down, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &up, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &downvalid, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &upvalid, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &downinf, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &upinf, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &downconflict, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &upconflict, nvars) );
+
+   for( i = 0; i < nvars; ++i )
+   {
+      assert(!inbatch[initcands[pos + i]]);
+      vars[i] = branchcands[initcands[pos + i]];
+   }
+
+   SCIPdebugMsg(scip, "applying batched strong branching on %d variables with %d iterations\n", nvars, itlim);
+
+   SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, vars, nvars, itlim, down, up, downvalid, upvalid, downinf, upinf,
+         downconflict, upconflict, lperror) );
+
+   if( !(*lperror) )
+   {
+      for( i = 0; i < nvars; ++i )
+      {
+         int c = initcands[pos + i];
+
+         inbatch[c] = TRUE;
+         batchdown[c] = down[i];
+         batchup[c] = up[i];
+         batchdownvalid[c] = downvalid[i];
+         batchupvalid[c] = upvalid[i];
+         batchdowninf[c] = downinf[i];
+         batchupinf[c] = upinf[i];
+         batchdownconflict[c] = downconflict[i];
+         batchupconflict[c] = upconflict[i];
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &upconflict);
+   SCIPfreeBufferArray(scip, &downconflict);
+   SCIPfreeBufferArray(scip, &upinf);
+   SCIPfreeBufferArray(scip, &downinf);
+   SCIPfreeBufferArray(scip, &upvalid);
+   SCIPfreeBufferArray(scip, &downvalid);
+   SCIPfreeBufferArray(scip, &up);
+   SCIPfreeBufferArray(scip, &down);
+   SCIPfreeBufferArray(scip, &vars);
+
+   return SCIP_OKAY;
+}
+
 /** execute reliability pseudo cost branching */
 static
 SCIP_RETCODE execRelpscost(
@@ -853,6 +958,15 @@ SCIP_RETCODE execRelpscost(
       SCIP_Real* initcandscores;
       SCIP_Real* newlbs = NULL;
       SCIP_Real* newubs = NULL;
+      SCIP_Real* batchdown = NULL;
+      SCIP_Real* batchup = NULL;
+      SCIP_Bool* inbatch = NULL;
+      SCIP_Bool* batchdownvalid = NULL;
+      SCIP_Bool* batchupvalid = NULL;
+      SCIP_Bool* batchdowninf = NULL;
+      SCIP_Bool* batchupinf = NULL;
+      SCIP_Bool* batchdownconflict = NULL;
+      SCIP_Bool* batchupconflict = NULL;
       SCIP_Real* mingains = NULL;
       SCIP_Real* maxgains = NULL;
       /* scores computed from pseudocost branching */
@@ -886,6 +1000,7 @@ SCIP_RETCODE execRelpscost(
       SCIP_Bool initstrongbranching;
       SCIP_Bool propagate;
       SCIP_Bool probingbounds;
+      SCIP_Bool batched;
       SCIP_Longint nodenum;
       SCIP_Longint nlpiterationsquot;
       SCIP_Longint nsblpiterations;
@@ -956,6 +1071,9 @@ SCIP_RETCODE execRelpscost(
       /* check whether valid bounds should be identified in probing-like fashion */
       probingbounds = propagate && branchruledata->probingbounds;
 
+      /* check whether candidates should be evaluated in batches, which is only possible without propagation */
+      batched = !propagate && branchruledata->sbbatchsize > 1;
+
       /* get maximal number of candidates to initialize with strong branching; if the current solutions is not basic,
        * we cannot warmstart the simplex algorithm and therefore don't initialize any candidates
        */
@@ -1409,6 +1527,20 @@ SCIP_RETCODE execRelpscost(
                SCIP_CALL( SCIPallocBlockMemoryArray(scip, &newlbs, nvars) );
                SCIP_CALL( SCIPallocBlockMemoryArray(scip, &newubs, nvars) );
             }
+
+            /* create arrays for batched strong branching results */
+            if( batched )
+            {
+               SCIP_CALL( SCIPallocClearBufferArray(scip, &inbatch, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdown, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchup, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdownvalid, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchupvalid, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdowninf, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchupinf, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdownconflict, nbranchcands) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchupconflict, nbranchcands) );
+            }
          }
 
          if( propagate )
@@ -1418,6 +1550,37 @@ SCIP_RETCODE execRelpscost(
                   branchruledata->maxproprounds, &down, &up, &downvalid, &upvalid, &ndomredsdown, &ndomredsup, &downinf, &upinf,
                   &downconflict, &upconflict, &lperror, newlbs, newubs) );
          }
+         else if( batched )
+         {
+            lperror = FALSE;
+
+            /* evaluate this and the following candidates together, unless it was already part of an earlier batch;
+             * the iterations for candidates of a batch that are skipped or not reached anymore because the loop
+             * terminates are spent in vain, but still count for the strong branching iteration limit
+             */
+            if( !inbatch[c] )
+            {
+               SCIP_CALL( prefetchStrongbranches(scip, branchcands, initcands, ninitcands, i, branchruledata->sbbatchsize,
+                     inititer, inbatch, batchdown, batchup, batchdownvalid, batchupvalid, batchdowninf, batchupinf,
+                     batchdownconflict, batchupconflict, &lperror) );
+            }
+
+            if( !lperror )
+            {
+               assert(inbatch[c]);
+
+               down = batchdown[c];
+               up = batchup[c];
+               downvalid = batchdownvalid[c];
+               upvalid = batchupvalid[c];
+               downinf = batchdowninf[c];
+               upinf = batchupinf[c];
+               downconflict = batchdownconflict[c];
+               upconflict = batchupconflict[c];
+            }
+
+            ndomredsdown = ndomredsup = 0;
+         }
          else
          {
             /* apply strong branching */
@@ -1704,6 +1867,19 @@ SCIP_RETCODE execRelpscost(
 
       if( initstrongbranching )
       {
+         if( batched )
+         {
+            SCIPfreeBufferArray(scip, &batchupconflict);
+            SCIPfreeBufferArray(scip, &batchdownconflict);
+            SCIPfreeBufferArray(scip, &batchupinf);
+            SCIPfreeBufferArray(scip, &batchdowninf);
+            SCIPfreeBufferArray(scip, &batchupvalid);
+            SCIPfreeBufferArray(scip, &batchdownvalid);
+            SCIPfreeBufferArray(scip, &batchup);
+            SCIPfreeBufferArray(scip, &batchdown);
+            SCIPfreeBufferArray(scip, &inbatch);
+         }
+
          if( probingbounds )
          {
             assert(newlbs != NULL);
@@ -2231,6 +2407,10 @@ SCIP_RETCODE SCIPincludeBranchruleRelpscost(
          "should degeneracy be taken into account to update weights and skip strong branching? (0: off, 1: after root, 2: always)",
          &branchruledata->degeneracyaware, TRUE, DEFAULT_DEGENERACYAWARE, 0, 2,
          NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip, "branching/relpscost/sbbatchsize",
+         "number of candidates evaluated together in one batched strong branching call of the LP interface, only used without propagation, no speedup unless the LP interface batches strong branching (1: evaluate candidates one at a time)",
+         &branchruledata->sbbatchsize, TRUE, DEFAULT_SBBATCHSIZE, 1, INT_MAX,
+         NULL, NULL) );
    SCIP_CALL( SCIPaddIntParam(scip, "branching/relpscost/startrandseed", "start seed for random number generation",
          &branchruledata->startrandseed, TRUE, DEFAULT_STARTRANDSEED, 0, INT_MAX, NULL, NULL) );
 
@@ -727,16 +727,16 @@ SCIP_DECL_CONCSOLVERSYNCREAD(concsolverScipSyncRead)
 
       /* cannot change bounds of multi-aggregated variables so dont pass this bound-change to the propagator */
       if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_MULTAGGR )
-         return SCIP_OKAY;
+         continue;
 
       /* if bound is not better than also don't pass this bound to the propagator and
        * don't waste memory for storing this boundchange
        */
       if( boundtype == SCIP_BOUNDTYPE_LOWER && SCIPisGE(data->solverscip, SCIPvarGetLbGlobal(var), newbound) )
-         return SCIP_OKAY;
+         continue;
 
       if( boundtype == SCIP_BOUNDTYPE_UPPER && SCIPisLE(data->solverscip, SCIPvarGetUbGlobal(var), newbound) )
-         return SCIP_OKAY;
+         continue;
 
       /* bound is better so incremented counters for statistics and pass it to the sync propagator */
       ++(*ntighterbnds);
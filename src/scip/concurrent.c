@@ -462,20 +462,31 @@ SCIP_BOUNDSTORE* SCIPgetConcurrentGlobalBoundChanges(
    return NULL;
 }
 
-/** executes the concurrent solver corresponding to the current thread */
+/** data of a job executing a concurrent solver */
+struct ConcsolverJob
+{
+   SCIP*                 scip;               /**< SCIP data structure */
+   int                   idx;                /**< index of the concurrent solver */
+};
+typedef struct ConcsolverJob CONCSOLVERJOB;
+
+/** executes the concurrent solver of the given job */
 static
 SCIP_RETCODE execConcsolver(
-   void*                 args                /**< SCIP data structure passed in as a void pointer */
+   void*                 args                /**< the job data */
    )
 {
+   CONCSOLVERJOB* job;
    SCIP* scip;
 
-   assert(args != NULL);
+   job = (CONCSOLVERJOB*) args;
+   assert(job != NULL);
 
-   scip = (SCIP*) args;
+   scip = job->scip;
+   assert(job->idx >= 0 && job->idx < scip->set->nconcsolvers);
 
-   SCIP_CALL( SCIPconcsolverExec(scip->set->concsolvers[SCIPtpiGetThreadNum()]) );
-   SCIP_CALL( SCIPconcsolverSync(scip->set->concsolvers[SCIPtpiGetThreadNum()], scip->set) );
+   SCIP_CALL( SCIPconcsolverExec(scip->set->concsolvers[job->idx]) );
+   SCIP_CALL( SCIPconcsolverSync(scip->set->concsolvers[job->idx], scip->set) );
 
    return SCIP_OKAY;
 }
@@ -486,6 +497,7 @@ SCIP_RETCODE SCIPconcurrentSolve(
    )
 {
    SCIP_SYNCSTORE*   syncstore;
+   CONCSOLVERJOB*    jobs;
    int               idx;
    int               jobid;
    int               i;
@@ -503,6 +515,15 @@ SCIP_RETCODE SCIPconcurrentSolve(
    assert(SCIPsyncstoreGetNSolvers(syncstore) == nconcsolvers);
 
    SCIPsyncstoreSetSolveIsStopped(syncstore, FALSE);
+
+   /* the solvers are passed by index, since the thread that executes a job is not known in advance */
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, nconcsolvers) );
+   for( i = 0; i < nconcsolvers; ++i )
+   {
+      jobs[i].scip = scip;
+      jobs[i].idx = i;
+   }
+
    jobid = SCIPtpiGetNewJobID();
 
    TPI_PARA
@@ -515,7 +536,7 @@ SCIP_RETCODE SCIPconcurrentSolve(
             SCIP_JOB*         job;
             SCIP_SUBMITSTATUS status;
 
-            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execConcsolver, scip) );
+            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execConcsolver, (void*) &jobs[i]) );
             SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
 
             assert(status == SCIP_SUBMIT_SUCCESS);
@@ -524,6 +545,8 @@ SCIP_RETCODE SCIPconcurrentSolve(
    }
 
    retcode = SCIPtpiCollectJobs(jobid);
+   SCIPfreeBufferArray(scip, &jobs);
+
    idx = SCIPsyncstoreGetWinner(syncstore);
    assert(idx >= 0 && idx < nconcsolvers);
 
@@ -731,9 +754,12 @@ SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    target->stat->nnodesaboverefbound = source->stat->nnodesaboverefbound;
    target->stat->nbacktracks = source->stat->nbacktracks;
    target->stat->ndelayedcutoffs = source->stat->ndelayedcutoffs;
+   target->stat->nlpstates = source->stat->nlpstates;
+   target->stat->lpstatebytes = source->stat->lpstatebytes;
    target->stat->nreprops = source->stat->nreprops;
    target->stat->nrepropboundchgs = source->stat->nrepropboundchgs;
    target->stat->nrepropcutoffs = source->stat->nrepropcutoffs;
+   target->stat->npropagationrounds = source->stat->npropagationrounds;
    target->stat->nlpsolsfound = source->stat->nlpsolsfound;
    target->stat->npssolsfound = source->stat->npssolsfound;
    target->stat->nsbsolsfound = source->stat->nsbsolsfound;
@@ -852,6 +878,10 @@ SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    tmptime += SCIPgetClockTime(source, source->stat->strongpropclock);
    SCIP_CALL( SCIPsetClockTime(target, target->stat->strongpropclock, tmptime) );
 
+   tmptime = SCIPgetClockTime(target, target->stat->proproundtime);
+   tmptime += SCIPgetClockTime(source, source->stat->proproundtime);
+   SCIP_CALL( SCIPsetClockTime(target, target->stat->proproundtime, tmptime) );
+
    tmptime = SCIPgetClockTime(target, target->stat->reoptupdatetime);
    tmptime += SCIPgetClockTime(source, source->stat->reoptupdatetime);
    SCIP_CALL( SCIPsetClockTime(target, target->stat->reoptupdatetime, tmptime) );
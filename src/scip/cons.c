@@ -764,6 +764,38 @@ void conshdlrUnmarkConsPropagate(
    checkConssArrays(conshdlr);
 }
 
+/** sorts the constraints marked to be propagated by decreasing number of markings since they were last unmarked, which
+ *  is the number of changes that were reported to them
+ */
+static
+SCIP_RETCODE conshdlrSortMarkedPropConss(
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int* npropmarks;
+   int c;
+
+   assert(conshdlr != NULL);
+   assert(!conshdlrAreUpdatesDelayed(conshdlr));
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &npropmarks, conshdlr->nmarkedpropconss) );
+
+   for( c = 0; c < conshdlr->nmarkedpropconss; ++c )
+      npropmarks[c] = conshdlr->propconss[c]->npropmarks;
+
+   SCIPsortDownIntPtr(npropmarks, (void**)conshdlr->propconss, conshdlr->nmarkedpropconss);
+
+   for( c = 0; c < conshdlr->nmarkedpropconss; ++c )
+      conshdlr->propconss[c]->propconsspos = c;
+
+   SCIPsetFreeBufferArray(set, &npropmarks);
+
+   checkConssArrays(conshdlr);
+
+   return SCIP_OKAY;
+}
+
 
 /** adds constraint to the conss array of constraint handler */
 static
@@ -2230,6 +2262,7 @@ SCIP_RETCODE doConshdlrCreate(
    (*conshdlr)->delayupdatecount = 0;
    (*conshdlr)->ageresetavg = AGERESETAVG_INIT;
    (*conshdlr)->needscons = needscons;
+   (*conshdlr)->propworklist = FALSE;
    (*conshdlr)->sepalpwasdelayed = FALSE;
    (*conshdlr)->sepasolwasdelayed = FALSE;
    (*conshdlr)->propwasdelayed = FALSE;
@@ -3855,6 +3888,7 @@ SCIP_RETCODE SCIPconshdlrPropagate(
       /* check, if propagation method should be delayed */
       if( !conshdlr->delayprop || execdelayed )
       {
+         SCIP_Bool callprop;
          int nconss;
          int nusefulconss;
          int nmarkedpropconss;
@@ -3884,8 +3918,17 @@ SCIP_RETCODE SCIPconshdlrPropagate(
          nmarkedpropconss = conshdlr->nmarkedpropconss;
 
          /* constraint handlers without constraints should only be called once */
-         if( nconss > 0 || fullpropagation
-            || (!conshdlr->needscons && conshdlr->lastpropdomchgcount != stat->domchgcount) )
+         callprop = (nconss > 0 || fullpropagation
+            || (!conshdlr->needscons && conshdlr->lastpropdomchgcount != stat->domchgcount));
+
+         /* constraint handlers that only propagate marked constraints have nothing to do if no constraint is marked */
+         if( callprop && nmarkedpropconss == 0 && conshdlr->propworklist && set->prop_worklist )
+         {
+            SCIPsetDebugMsg(set, "skipping propagation of constraint handler <%s>: no constraint is marked\n", conshdlr->name);
+            callprop = FALSE;
+         }
+
+         if( callprop )
          {
             SCIP_CONS** conss;
             SCIP_Longint oldndomchgs;
@@ -3912,6 +3955,13 @@ SCIP_RETCODE SCIPconshdlrPropagate(
                || (conshdlr->eagerfreq > 0 && conshdlr->npropcalls % conshdlr->eagerfreq == 0) )
                nusefulconss = nconss;
 
+            /* propagate the marked constraints with the most changes first */
+            if( nmarkedpropconss > 1 && conshdlr->propworklist && set->prop_worklist && set->prop_sortworklist )
+            {
+               assert(firstcons == 0);
+               SCIP_CALL( conshdlrSortMarkedPropConss(conshdlr, set) );
+            }
+
             /* because during constraint processing, constraints of this handler may be deleted, activated, deactivated,
              * enabled, disabled, marked obsolete or useful, which would change the conss array given to the
              * external method; to avoid this, these changes will be buffered and processed after the method call
@@ -5267,6 +5317,31 @@ void SCIPconshdlrSetPropTiming(
    conshdlr->proptiming = proptiming;
 }
 
+/** returns whether the propagation method of the constraint handler only processes constraints marked to be propagated */
+SCIP_Bool SCIPconshdlrHasPropWorklist(
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   )
+{
+   assert(conshdlr != NULL);
+
+   return conshdlr->propworklist;
+}
+
+/** sets whether the propagation method of the constraint handler can only process constraints marked to be propagated;
+ *  if propagating/worklist is set, the propagation method is then not called if no constraint of the handler is marked,
+ *  and the marked constraints can be sorted by their number of markings before the call, see propagating/sortworklist
+ *  and SCIPisPropWorklistUsed()
+ */
+void SCIPconshdlrSetPropWorklist(
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_Bool             propworklist        /**< does the propagation method only process marked constraints? */
+   )
+{
+   assert(conshdlr != NULL);
+
+   conshdlr->propworklist = propworklist;
+}
+
 
 /** returns the timing mask of the presolving method of the constraint handler */
 SCIP_PRESOLTIMING SCIPconshdlrGetPresolTiming(
@@ -5937,6 +6012,7 @@ SCIP_RETCODE SCIPconsCreate(
    (*cons)->validdepth = (local ? -1 : 0);
    (*cons)->age = 0.0;
    (*cons)->nuses = 0;
+   (*cons)->npropmarks = 0;
    (*cons)->nupgradelocks = 0;
    (*cons)->initial = initial;
    (*cons)->separate = separate;
@@ -7137,6 +7213,10 @@ SCIP_RETCODE SCIPconsMarkPropagate(
    assert(set != NULL);
    assert(cons->scip == set->scip);
 
+   /* count the markings, which indicate how many changes the constraint has to propagate */
+   if( cons->npropmarks < INT_MAX )
+      ++cons->npropmarks;
+
    if( cons->updatemarkpropagate || (cons->markpropagate && !cons->updateunmarkpropagate) )
          return SCIP_OKAY;
 
@@ -7167,6 +7247,8 @@ SCIP_RETCODE SCIPconsUnmarkPropagate(
    assert(set != NULL);
    assert(cons->scip == set->scip);
 
+   cons->npropmarks = 0;
+
    if( cons->updateunmarkpropagate || (!cons->markpropagate && !cons->updatemarkpropagate) )
       return SCIP_OKAY;
 
@@ -2859,7 +2859,7 @@ SCIP_RETCODE cliquePresolve(
 	 if( var1 == var2 )
 	    continue;
 
-	 if( SCIPvarsHaveCommonClique(var1, value1, var2, value2, TRUE) )
+	 if( SCIPhaveVarsCommonClique(scip, var1, value1, var2, value2, TRUE) )
 	 {
 	    SCIP_CONS* cliquecons;
 	    SCIP_VAR* consvars[2];
@@ -3071,7 +3071,7 @@ SCIP_RETCODE cliquePresolve(
       /* due to SCIPvarsHaveCommonClique() returns on two negated variables that they are not in a clique, we need to
        * handle it explicitly
        */
-      if( (var1 == var2 && value1 != value2) || SCIPvarsHaveCommonClique(var1, value1, var2, value2, TRUE) )
+      if( (var1 == var2 && value1 != value2) || SCIPhaveVarsCommonClique(scip, var1, value1, var2, value2, TRUE) )
       {
 	 SCIPdebugMsg(scip, "in constraint <%s> the resultant <%s> can be fixed to 0 because it is in a clique with operand <%s>\n",
 	    SCIPconsGetName(cons), SCIPvarGetName(var1), SCIPvarGetName(var2));
@@ -3193,7 +3193,7 @@ SCIP_RETCODE cliquePresolve(
 	 if( var1 == var2 && value1 != value2 )
 	    continue;
 
-	 if( !SCIPvarsHaveCommonClique(var1, value1, var2, value2, TRUE) )
+	 if( !SCIPhaveVarsCommonClique(scip, var1, value1, var2, value2, TRUE) )
 	    break;
       }
 
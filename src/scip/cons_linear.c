@@ -175,6 +175,8 @@
 
 #define MAXVALRECOMP                1e+06 /**< maximal abolsute value we trust without recomputing the activity */
 #define MINVALRECOMP                1e-05 /**< minimal abolsute value we trust without recomputing the activity */
+#define ACTIVITYCHUNKSIZE              64 /**< number of variables whose contributions are computed at once when
+                                              *   recomputing an activity */
 
 
 #define NONLINCONSUPGD_PRIORITY   1000000 /**< priority of the constraint handler for upgrading of expressions constraints */
@@ -1308,25 +1310,100 @@ SCIP_Real consdataComputePseudoActivity(
    return pseudoactivity;
 }
 
-/** recompute the minactivity of a constraint */
+/** recomputes the finite part of the minimal or maximal local or global activity of a constraint from scratch, i.e., the
+ *  sum of all contributions of the variables that are neither infinite nor huge
+ *
+ *  The variables are processed in chunks: the relevant bounds of a chunk are gathered into a contiguous array first, such
+ *  that the contributions are computed and classified in a loop without branches or pointer dereferences, which the
+ *  compiler can vectorize. The contributions are summed up in quad precision in the same order as the variables are
+ *  processed, such that the result does not depend on the chunk size.
+ */
 static
-void consdataRecomputeMinactivity(
+void consdataRecomputeActivity(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_CONSDATA*        consdata            /**< linear constraint data */
+   SCIP_CONSDATA*        consdata,           /**< linear constraint data */
+   SCIP_Bool             minact,             /**< should the minimal activity be recomputed (or the maximal one)? */
+   SCIP_Bool             global              /**< should the global activity be recomputed (or the local one)? */
    )
 {
+   SCIP_Real bounds[ACTIVITYCHUNKSIZE];
+   SCIP_Real contribs[ACTIVITYCHUNKSIZE];
+   SCIP_Real QUAD(activity);
+   SCIP_Real infinity;
+   SCIP_Real hugeval;
+   int end;
    int i;
-   SCIP_Real bound;
 
-   QUAD_ASSIGN(consdata->minactivity, 0.0);
+   assert(scip != NULL);
+   assert(consdata != NULL);
 
-   for( i = consdata->nvars - 1; i >= 0; --i )
+   infinity = SCIPinfinity(scip);
+   hugeval = SCIPgetHugeValue(scip);
+
+   QUAD_ASSIGN(activity, 0.0);
+
+   /* the variables are summed up from the last to the first one */
+   for( end = consdata->nvars; end > 0; end -= ACTIVITYCHUNKSIZE )
+   {
+      SCIP_VAR** vars;
+      SCIP_Real* vals;
+      int nchunkvars;
+
+      nchunkvars = MIN(end, ACTIVITYCHUNKSIZE);
+      vars = &consdata->vars[end - nchunkvars];
+      vals = &consdata->vals[end - nchunkvars];
+
+      /* gather the bounds that determine the activity: the lower bound for positive coefficients in the minimal
+       * activity and for negative coefficients in the maximal activity, the upper bound otherwise
+       */
+      if( global )
+      {
+         for( i = 0; i < nchunkvars; ++i )
+            bounds[i] = ((vals[i] > 0.0) == minact) ? SCIPvarGetLbGlobal(vars[i]) : SCIPvarGetUbGlobal(vars[i]);
+      }
+      else
+      {
+         for( i = 0; i < nchunkvars; ++i )
+            bounds[i] = ((vals[i] > 0.0) == minact) ? SCIPvarGetLbLocal(vars[i]) : SCIPvarGetUbLocal(vars[i]);
+      }
+
+      /* compute the contributions; infinite and huge contributions are counted separately and not part of the sum */
+      for( i = 0; i < nchunkvars; ++i )
+      {
+         SCIP_Real contrib;
+
+         contrib = vals[i] * bounds[i];
+         contribs[i] = (REALABS(bounds[i]) < infinity && REALABS(contrib) < hugeval) ? contrib : 0.0;
+      }
+
+      for( i = nchunkvars - 1; i >= 0; --i )
+         SCIPquadprecSumQD(activity, activity, contribs[i]);
+   }
+
+   if( minact )
+   {
+      if( global )
+         QUAD_ASSIGN_Q(consdata->glbminactivity, activity);
+      else
+         QUAD_ASSIGN_Q(consdata->minactivity, activity);
+   }
+   else
    {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetLbLocal(consdata->vars[i]) : SCIPvarGetUbLocal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->minactivity, consdata->minactivity, consdata->vals[i] * bound);
+      if( global )
+         QUAD_ASSIGN_Q(consdata->glbmaxactivity, activity);
+      else
+         QUAD_ASSIGN_Q(consdata->maxactivity, activity);
    }
+}
+
+/** recompute the minactivity of a constraint */
+static
+void consdataRecomputeMinactivity(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata            /**< linear constraint data */
+   )
+{
+   consdataRecomputeActivity(scip, consdata, TRUE, FALSE);
 
    /* the activity was just computed from scratch and is valid now */
    consdata->validminact = TRUE;
@@ -1342,18 +1419,7 @@ void consdataRecomputeMaxactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
-   SCIP_Real bound;
-
-   QUAD_ASSIGN(consdata->maxactivity, 0.0);
-
-   for( i = consdata->nvars - 1; i >= 0; --i )
-   {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetUbLocal(consdata->vars[i]) : SCIPvarGetLbLocal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->maxactivity, consdata->maxactivity, consdata->vals[i] * bound);
-   }
+   consdataRecomputeActivity(scip, consdata, FALSE, FALSE);
 
    /* the activity was just computed from scratch and is valid now */
    consdata->validmaxact = TRUE;
@@ -1369,18 +1435,7 @@ void consdataRecomputeGlbMinactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
-   SCIP_Real bound;
-
-   QUAD_ASSIGN(consdata->glbminactivity, 0.0);
-
-   for( i = consdata->nvars - 1; i >= 0; --i )
-   {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetLbGlobal(consdata->vars[i]) : SCIPvarGetUbGlobal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->glbminactivity, consdata->glbminactivity, consdata->vals[i] * bound);
-   }
+   consdataRecomputeActivity(scip, consdata, TRUE, TRUE);
 
    /* the activity was just computed from scratch and is valid now */
    consdata->validglbminact = TRUE;
@@ -1396,18 +1451,7 @@ void consdataRecomputeGlbMaxactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
-   SCIP_Real bound;
-
-   QUAD_ASSIGN(consdata->glbmaxactivity, 0.0);
-
-   for( i = consdata->nvars - 1; i >= 0; --i )
-   {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetUbGlobal(consdata->vars[i]) : SCIPvarGetLbGlobal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->glbmaxactivity, consdata->glbmaxactivity, consdata->vals[i] * bound);
-   }
+   consdataRecomputeActivity(scip, consdata, FALSE, TRUE);
 
    /* the activity was just computed from scratch and is valid now */
    consdata->validglbmaxact = TRUE;
@@ -17327,20 +17371,23 @@ SCIP_DECL_CONSGETSIGNEDPERMSYMGRAPH(consGetSignedPermsymGraphLinear)
  * Callback methods of event handler
  */
 
-/** execution method of event handler */
+/** processes a change of the local lower or upper bound of a variable in a linear constraint */
 static
-SCIP_DECL_EVENTEXEC(eventExecLinear)
-{  /*lint --e{715}*/
+SCIP_RETCODE processBoundChange(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EVENTDATA*       eventdata,          /**< event data of the variable in the constraint */
+   SCIP_VAR*             var,                /**< variable whose bound changed */
+   SCIP_EVENTTYPE        eventtype,          /**< type of the bound change event */
+   SCIP_Real             oldbound,           /**< old bound of the variable */
+   SCIP_Real             newbound            /**< new bound of the variable */
+   )
+{
    SCIP_CONS* cons;
    SCIP_CONSDATA* consdata;
-   SCIP_VAR* var;
-   SCIP_EVENTTYPE eventtype;
+   SCIP_Real val;
+   int varpos;
 
-   assert(scip != NULL);
-   assert(eventhdlr != NULL);
    assert(eventdata != NULL);
-   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
-   assert(event != NULL);
 
    cons = eventdata->cons;
    assert(cons != NULL);
@@ -17351,97 +17398,143 @@ SCIP_DECL_EVENTEXEC(eventExecLinear)
    if( SCIPconsIsDeleted(cons) )
       return SCIP_OKAY;
 
-   eventtype = SCIPeventGetType(event);
-   var = SCIPeventGetVar(event);
+   varpos = eventdata->varpos;
+   assert(0 <= varpos && varpos < consdata->nvars);
+   assert(var != NULL);
+   assert(consdata->vars[varpos] == var);
+   val = consdata->vals[varpos];
 
-   if( (eventtype & SCIP_EVENTTYPE_BOUNDCHANGED) != 0 )
+   /* we only need to update the activities if the constraint is active,
+    * otherwise we mark them to be invalid
+    */
+   if( SCIPconsIsActive(cons) )
    {
-      SCIP_Real oldbound;
-      SCIP_Real newbound;
-      SCIP_Real val;
-      int varpos;
+      /* update the activity values */
+      if( (eventtype & SCIP_EVENTTYPE_LBCHANGED) != 0 )
+         consdataUpdateActivitiesLb(scip, consdata, var, oldbound, newbound, val, TRUE);
+      else
+      {
+         assert((eventtype & SCIP_EVENTTYPE_UBCHANGED) != 0);
+         consdataUpdateActivitiesUb(scip, consdata, var, oldbound, newbound, val, TRUE);
+      }
+   }
+   else
+      consdataInvalidateActivities(consdata);
 
-      varpos = eventdata->varpos;
-      assert(0 <= varpos && varpos < consdata->nvars);
-      oldbound = SCIPeventGetOldbound(event);
-      newbound = SCIPeventGetNewbound(event);
-      assert(var != NULL);
-      assert(consdata->vars[varpos] == var);
-      val = consdata->vals[varpos];
+   consdata->presolved = FALSE;
+   consdata->rangedrowpropagated = 0;
 
-      /* we only need to update the activities if the constraint is active,
-       * otherwise we mark them to be invalid
-       */
-      if( SCIPconsIsActive(cons) )
+   /* bound change can turn the constraint infeasible or redundant only if it was a tightening */
+   if( (eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED) != 0 )
+   {
+      SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+
+      /* reset maximal activity delta, so that it will be recalculated on the next real propagation */
+      if( consdata->maxactdeltavar == var )
       {
-         /* update the activity values */
-         if( (eventtype & SCIP_EVENTTYPE_LBCHANGED) != 0 )
-            consdataUpdateActivitiesLb(scip, consdata, var, oldbound, newbound, val, TRUE);
-         else
+         consdata->maxactdelta = SCIP_INVALID;
+         consdata->maxactdeltavar = NULL;
+      }
+
+      /* check whether bound tightening might now be successful */
+      if( consdata->boundstightened > 0)
+      {
+         switch( eventtype )
          {
-            assert((eventtype & SCIP_EVENTTYPE_UBCHANGED) != 0);
-            consdataUpdateActivitiesUb(scip, consdata, var, oldbound, newbound, val, TRUE);
+         case SCIP_EVENTTYPE_LBTIGHTENED:
+            if( (val > 0.0 ? !SCIPisInfinity(scip, consdata->rhs) : !SCIPisInfinity(scip, -consdata->lhs)) )
+               consdata->boundstightened = 0;
+            break;
+         case SCIP_EVENTTYPE_UBTIGHTENED:
+            if( (val > 0.0 ? !SCIPisInfinity(scip, -consdata->lhs) : !SCIPisInfinity(scip, consdata->rhs)) )
+               consdata->boundstightened = 0;
+            break;
+         default:
+            SCIPerrorMessage("invalid event type %" SCIP_EVENTTYPE_FORMAT "\n", eventtype);
+            return SCIP_INVALIDDATA;
          }
       }
-      else
-         consdataInvalidateActivities(consdata);
+   }
+   /* update maximal activity delta if a bound was relaxed */
+   else if( !SCIPisInfinity(scip, consdata->maxactdelta) )
+   {
+      SCIP_Real lb;
+      SCIP_Real ub;
+      SCIP_Real domain;
+      SCIP_Real delta;
 
-      consdata->presolved = FALSE;
-      consdata->rangedrowpropagated = 0;
+      assert((eventtype & SCIP_EVENTTYPE_BOUNDRELAXED) != 0);
 
-      /* bound change can turn the constraint infeasible or redundant only if it was a tightening */
-      if( (eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED) != 0 )
-      {
-         SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+      lb = SCIPvarGetLbLocal(var);
+      ub = SCIPvarGetUbLocal(var);
 
-         /* reset maximal activity delta, so that it will be recalculated on the next real propagation */
-         if( consdata->maxactdeltavar == var )
-         {
-            consdata->maxactdelta = SCIP_INVALID;
-            consdata->maxactdeltavar = NULL;
-         }
+      domain = ub - lb;
+      delta = REALABS(val) * domain;
 
-         /* check whether bound tightening might now be successful */
-         if( consdata->boundstightened > 0)
-         {
-            switch( eventtype )
-            {
-            case SCIP_EVENTTYPE_LBTIGHTENED:
-               if( (val > 0.0 ? !SCIPisInfinity(scip, consdata->rhs) : !SCIPisInfinity(scip, -consdata->lhs)) )
-                  consdata->boundstightened = 0;
-               break;
-            case SCIP_EVENTTYPE_UBTIGHTENED:
-               if( (val > 0.0 ? !SCIPisInfinity(scip, -consdata->lhs) : !SCIPisInfinity(scip, consdata->rhs)) )
-                  consdata->boundstightened = 0;
-               break;
-            default:
-               SCIPerrorMessage("invalid event type %" SCIP_EVENTTYPE_FORMAT "\n", eventtype);
-               return SCIP_INVALIDDATA;
-            }
-         }
-      }
-      /* update maximal activity delta if a bound was relaxed */
-      else if( !SCIPisInfinity(scip, consdata->maxactdelta) )
+      if( delta > consdata->maxactdelta )
       {
-         SCIP_Real lb;
-         SCIP_Real ub;
-         SCIP_Real domain;
-         SCIP_Real delta;
+         consdata->maxactdelta = delta;
+         consdata->maxactdeltavar = var;
+      }
+   }
 
-         assert((eventtype & SCIP_EVENTTYPE_BOUNDRELAXED) != 0);
+   return SCIP_OKAY;
+}
 
-         lb = SCIPvarGetLbLocal(var);
-         ub = SCIPvarGetUbLocal(var);
+/** batched execution method of event handler for local bound changes
+ *
+ *  The bound changes are processed one after another, exactly as by the execution method; the activity updates are
+ *  incremental and depend on the order of the bound changes, so they are not combined per constraint.
+ */
+static
+SCIP_DECL_EVENTEXECBATCH(eventExecBatchLinear)
+{  /*lint --e{715}*/
+   int i;
 
-         domain = ub - lb;
-         delta = REALABS(val) * domain;
+   assert(scip != NULL);
+   assert(eventhdlr != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+   assert(nevents == 0 || (vars != NULL && oldbounds != NULL && newbounds != NULL && eventtypes != NULL && eventdatas != NULL));
 
-         if( delta > consdata->maxactdelta )
-         {
-            consdata->maxactdelta = delta;
-            consdata->maxactdeltavar = var;
-         }
-      }
+   for( i = 0; i < nevents; ++i )
+   {
+      SCIP_CALL( processBoundChange(scip, eventdatas[i], vars[i], eventtypes[i], oldbounds[i], newbounds[i]) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution method of event handler */
+static
+SCIP_DECL_EVENTEXEC(eventExecLinear)
+{  /*lint --e{715}*/
+   SCIP_CONS* cons;
+   SCIP_CONSDATA* consdata;
+   SCIP_VAR* var;
+   SCIP_EVENTTYPE eventtype;
+
+   assert(scip != NULL);
+   assert(eventhdlr != NULL);
+   assert(eventdata != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+   assert(event != NULL);
+
+   cons = eventdata->cons;
+   assert(cons != NULL);
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+
+   /* we can skip events droped for deleted constraints */
+   if( SCIPconsIsDeleted(cons) )
+      return SCIP_OKAY;
+
+   eventtype = SCIPeventGetType(event);
+   var = SCIPeventGetVar(event);
+
+   if( (eventtype & SCIP_EVENTTYPE_BOUNDCHANGED) != 0 )
+   {
+      SCIP_CALL( processBoundChange(scip, eventdata, var, eventtype, SCIPeventGetOldbound(event),
+            SCIPeventGetNewbound(event)) );
    }
    else if( (eventtype & SCIP_EVENTTYPE_VARFIXED) != 0 )
    {
@@ -17688,6 +17781,7 @@ SCIP_RETCODE SCIPincludeConshdlrLinear(
    /* create event handler for bound change events */
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
          eventExecLinear, NULL) );
+   SCIP_CALL( SCIPsetEventhdlrExecBatch(scip, eventhdlr, eventExecBatchLinear) );
 
    /* create conflict handler for linear constraints */
    SCIP_CALL( SCIPincludeConflicthdlrBasic(scip, &conflicthdlr, CONFLICTHDLR_NAME, CONFLICTHDLR_DESC, CONFLICTHDLR_PRIORITY,
@@ -17724,6 +17818,7 @@ SCIP_RETCODE SCIPincludeConshdlrLinear(
    SCIP_CALL( SCIPsetConshdlrPrint(scip, conshdlr, consPrintLinear) );
    SCIP_CALL( SCIPsetConshdlrProp(scip, conshdlr, consPropLinear, CONSHDLR_PROPFREQ, CONSHDLR_DELAYPROP,
          CONSHDLR_PROP_TIMING) );
+   SCIPconshdlrSetPropWorklist(conshdlr, TRUE);
    SCIP_CALL( SCIPsetConshdlrResprop(scip, conshdlr, consRespropLinear) );
    SCIP_CALL( SCIPsetConshdlrSepa(scip, conshdlr, consSepalpLinear, consSepasolLinear, CONSHDLR_SEPAFREQ,
          CONSHDLR_SEPAPRIORITY, CONSHDLR_DELAYSEPA) );
@@ -597,6 +597,10 @@ SCIP_RETCODE delCoefPos(
    consdata->validsignature = FALSE;
 
    SCIP_CALL( SCIPenableConsPropagation(scip, cons) );
+   if( SCIPisPropWorklistUsed(scip, SCIPconsGetHdlr(cons)) )
+   {
+      SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+   }
 
    return SCIP_OKAY;
 }
@@ -4587,13 +4591,30 @@ SCIP_DECL_CONSPROP(consPropLogicor)
    cutoff = FALSE;
    reduceddom = FALSE;
 
-   /* propagate all useful logic or constraints */
-   for( c = 0; c < nusefulconss && !cutoff; ++c )
+   /* with a worklist, only the marked logic or constraints are propagated; a constraint is marked whenever one of its
+    * watched variables changes
+    */
+   if( SCIPisPropWorklistUsed(scip, conshdlr) )
    {
-      assert(inpresolve || !(SCIPconsGetData(conss[c])->existmultaggr));
+      for( c = 0; c < nmarkedconss && !cutoff; ++c )
+      {
+         assert(inpresolve || !(SCIPconsGetData(conss[c])->existmultaggr));
 
-      SCIPdebugMsg(scip, " propagate constraint %s\n", SCIPconsGetName(conss[c]));
-      SCIP_CALL( processWatchedVars(scip, conss[c], conshdlrdata->eventhdlr, &cutoff, &reduceddom, &addcut, &mustcheck) );
+         SCIPdebugMsg(scip, " propagate constraint %s\n", SCIPconsGetName(conss[c]));
+         SCIP_CALL( processWatchedVars(scip, conss[c], conshdlrdata->eventhdlr, &cutoff, &reduceddom, &addcut, &mustcheck) );
+         SCIP_CALL( SCIPunmarkConsPropagate(scip, conss[c]) );
+      }
+   }
+   else
+   {
+      /* propagate all useful logic or constraints */
+      for( c = 0; c < nusefulconss && !cutoff; ++c )
+      {
+         assert(inpresolve || !(SCIPconsGetData(conss[c])->existmultaggr));
+
+         SCIPdebugMsg(scip, " propagate constraint %s\n", SCIPconsGetName(conss[c]));
+         SCIP_CALL( processWatchedVars(scip, conss[c], conshdlrdata->eventhdlr, &cutoff, &reduceddom, &addcut, &mustcheck) );
+      }
    }
 
    /* return the correct result */
@@ -4661,6 +4682,10 @@ SCIP_DECL_CONSPRESOL(consPresolLogicor)
       if( nrounds == 0 )
       {
          SCIP_CALL( SCIPenableConsPropagation(scip, cons) );
+         if( SCIPisPropWorklistUsed(scip, conshdlr) )
+         {
+            SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+         }
       }
 
       redundant = FALSE;
@@ -5198,10 +5223,20 @@ SCIP_DECL_EVENTEXEC(eventExecLogicor)
 
       SCIP_CALL( SCIPenableCons(scip, (SCIP_CONS*)eventdata) );
       SCIP_CALL( SCIPenableConsPropagation(scip, (SCIP_CONS*)eventdata) );
+
+      /* with a worklist, the constraint is only propagated again if it is marked */
+      if( SCIPisPropWorklistUsed(scip, SCIPconsGetHdlr((SCIP_CONS*)eventdata)) )
+      {
+         SCIP_CALL( SCIPmarkConsPropagate(scip, (SCIP_CONS*)eventdata) );
+      }
    }
    else if( SCIPeventGetType(event) == SCIP_EVENTTYPE_UBTIGHTENED )
    {
       SCIP_CALL( SCIPenableConsPropagation(scip, (SCIP_CONS*)eventdata) );
+      if( SCIPisPropWorklistUsed(scip, SCIPconsGetHdlr((SCIP_CONS*)eventdata)) )
+      {
+         SCIP_CALL( SCIPmarkConsPropagate(scip, (SCIP_CONS*)eventdata) );
+      }
    }
 
    if( SCIPeventGetType(event) == SCIP_EVENTTYPE_VARFIXED )
@@ -5361,6 +5396,7 @@ SCIP_RETCODE SCIPincludeConshdlrLogicor(
    SCIP_CALL( SCIPsetConshdlrPrint(scip, conshdlr, consPrintLogicor) );
    SCIP_CALL( SCIPsetConshdlrProp(scip, conshdlr, consPropLogicor, CONSHDLR_PROPFREQ, CONSHDLR_DELAYPROP,
          CONSHDLR_PROP_TIMING) );
+   SCIPconshdlrSetPropWorklist(conshdlr, TRUE);
    SCIP_CALL( SCIPsetConshdlrResprop(scip, conshdlr, consRespropLogicor) );
    SCIP_CALL( SCIPsetConshdlrSepa(scip, conshdlr, consSepalpLogicor, consSepasolLogicor, CONSHDLR_SEPAFREQ,
          CONSHDLR_SEPAPRIORITY, CONSHDLR_DELAYSEPA) );
@@ -202,6 +202,7 @@ struct SCIP_ConsData
 {
    /* data that defines the constraint: expression and sides */
    SCIP_EXPR*            expr;               /**< expression that represents this constraint */
+   SCIP_EXPRPROG*        exprprog;           /**< expression program of expr, or NULL if not created */
    SCIP_Real             lhs;                /**< left-hand side */
    SCIP_Real             rhs;                /**< right-hand side */
 
@@ -283,6 +284,7 @@ struct SCIP_ConshdlrData
    /* parameters */
    int                   maxproprounds;      /**< limit on number of propagation rounds for a set of constraints within one round of SCIP propagation */
    SCIP_Bool             propauxvars;        /**< whether to check bounds of all auxiliary variable to seed reverse propagation */
+   SCIP_Bool             exprprogs;          /**< whether to evaluate and propagate expressions of constraints via expression programs in the solving stage */
    char                  varboundrelax;      /**< strategy on how to relax variable bounds during bound tightening */
    SCIP_Real             varboundrelaxamount; /**< by how much to relax variable bounds during bound tightening */
    SCIP_Real             conssiderelaxamount; /**< by how much to relax constraint sides during bound tightening */
@@ -372,6 +374,7 @@ SCIP_RETCODE forwardPropExpr(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
    SCIP_EXPR*            rootexpr,           /**< expression */
+   SCIP_EXPRPROG*        prog,               /**< expression program of rootexpr, or NULL to walk the expression */
    SCIP_Bool             tightenauxvars,     /**< should the bounds of auxiliary variables be tightened? */
    SCIP_Bool*            infeasible,         /**< buffer to store whether the problem is infeasible (NULL if not needed) */
    int*                  ntightenings        /**< buffer to store the number of auxiliary variable tightenings (NULL if not needed) */
@@ -585,7 +588,7 @@ SCIP_DECL_EXPR_OWNEREVALACTIVITY(exprownerEvalactivity)
    if( SCIPexprGetActivityTag(expr) < conshdlrdata->curboundstag )
    {
       /* update activity of expression */
-      SCIP_CALL( forwardPropExpr(scip, ownerdata->conshdlr, expr, FALSE, NULL, NULL) );
+      SCIP_CALL( forwardPropExpr(scip, ownerdata->conshdlr, expr, NULL, FALSE, NULL, NULL) );
 
       assert(SCIPexprGetActivityTag(expr) == conshdlrdata->curboundstag);
    }
@@ -1528,6 +1531,35 @@ SCIP_Real getExprAbsAuxViolation(
    return 0.0;
 }
 
+/** ensures that the expression program of a constraint is available, if expression programs are enabled
+ *
+ * Programs are created in the solving stage only, since expressions are still modified during presolve.
+ */
+static
+SCIP_RETCODE ensureExprprog(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons                /**< constraint */
+   )
+{
+   SCIP_CONSDATA* consdata;
+
+   assert(scip != NULL);
+   assert(cons != NULL);
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+
+   if( consdata->exprprog != NULL || SCIPgetStage(scip) != SCIP_STAGE_SOLVING )
+      return SCIP_OKAY;
+
+   if( !SCIPconshdlrGetData(SCIPconsGetHdlr(cons))->exprprogs )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPcreateExprprog(scip, &consdata->exprprog, consdata->expr) );
+
+   return SCIP_OKAY;
+}
+
 /** computes violation of a constraint */
 static
 SCIP_RETCODE computeViolation(
@@ -1546,7 +1578,15 @@ SCIP_RETCODE computeViolation(
    consdata = SCIPconsGetData(cons);
    assert(consdata != NULL);
 
-   SCIP_CALL( SCIPevalExpr(scip, consdata->expr, sol, soltag) );
+   SCIP_CALL( ensureExprprog(scip, cons) );
+   if( consdata->exprprog != NULL )
+   {
+      SCIP_CALL( SCIPevalExprprog(scip, consdata->exprprog, sol, soltag) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPevalExpr(scip, consdata->expr, sol, soltag) );
+   }
    activity = SCIPexprGetEvalValue(consdata->expr);
 
    /* consider constraint as violated if it is undefined in the current point */
@@ -1652,7 +1692,15 @@ SCIP_RETCODE getConsRelViolation(
       consdata->gradnorm = 0.0;
 
       /* compute gradient */
-      SCIP_CALL( SCIPevalExprGradient(scip, consdata->expr, sol, soltag) );
+      SCIP_CALL( ensureExprprog(scip, cons) );
+      if( consdata->exprprog != NULL )
+      {
+         SCIP_CALL( SCIPevalExprprogGradient(scip, consdata->exprprog, sol, soltag) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPevalExprGradient(scip, consdata->expr, sol, soltag) );
+      }
 
       /* gradient evaluation error -> no scaling */
       if( SCIPexprGetDerivative(consdata->expr) != SCIP_INVALID )
@@ -2155,14 +2203,217 @@ SCIP_RETCODE tightenAuxVarBounds(
    return SCIP_OKAY;
 }
 
+/** updates the activity of an expression from the activities of its children
+ *  and tries to tighten the bounds of the auxiliary variable of the expression accordingly
+ *
+ *  The activity of the expression must not be up to date, but the activities of all its children must be.
+ */
+static
+SCIP_RETCODE forwardPropSubexpr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_EXPR*            expr,               /**< expression */
+   SCIP_Bool             tightenauxvars,     /**< should the bounds of auxiliary variables be tightened? */
+   SCIP_Bool*            infeasible,         /**< buffer to store whether the problem is infeasible (NULL if not needed) */
+   int*                  ntightenings        /**< buffer to store the number of auxiliary variable tightenings (NULL if not needed) */
+   )
+{
+   SCIP_EXPR_OWNERDATA* ownerdata;
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_INTERVAL activity;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   /* we should not have entered this expression if its activity was already up to date */
+   assert(SCIPexprGetActivityTag(expr) < conshdlrdata->curboundstag);
+
+   ownerdata = SCIPexprGetOwnerData(expr);
+   assert(ownerdata != NULL);
+
+   /* for var exprs where varevents are catched, activity is updated immediately when the varbound has been changed
+    * so we can assume that the activity is up to date for all these variables
+    * UNLESS we changed the method used to evaluate activity of variable expressions
+    *   or we currently use global bounds (varevents are catched for local bound changes only)
+    */
+   if( SCIPisExprVar(scip, expr) && ownerdata->filterpos >= 0 &&
+       SCIPexprGetActivityTag(expr) >= conshdlrdata->lastvaractivitymethodchange && !conshdlrdata->globalbounds )
+   {
+#ifndef NDEBUG
+      SCIP_INTERVAL exprhdlrinterval;
+
+      SCIP_CALL( SCIPcallExprInteval(scip, expr, &exprhdlrinterval, conshdlrdata->intevalvar, conshdlrdata) );
+      assert(SCIPisRelEQ(scip, exprhdlrinterval.inf, SCIPexprGetActivity(expr).inf));
+      assert(SCIPisRelEQ(scip, exprhdlrinterval.sup, SCIPexprGetActivity(expr).sup));
+#endif
+#ifdef DEBUG_PROP
+      SCIPdebugMsg(scip, "skip interval evaluation of expr for var <%s> [%g,%g]\n", SCIPvarGetName(SCIPgetVarExprVar(expr)), SCIPexprGetActivity(expr).inf, SCIPexprGetActivity(expr).sup);
+#endif
+      SCIPexprSetActivity(expr, SCIPexprGetActivity(expr), conshdlrdata->curboundstag);
+
+      return SCIP_OKAY;
+   }
+
+   if( SCIPexprGetActivityTag(expr) < conshdlrdata->lastboundrelax )
+   {
+      /* start with entire activity if current one is invalid */
+      SCIPintervalSetEntire(SCIP_INTERVAL_INFINITY, &activity);
+   }
+   else if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, SCIPexprGetActivity(expr)) )
+   {
+      /* If already empty, then don't try to compute even better activity.
+       * If cons_nonlinear were alone, then we should have noted that we are infeasible
+       * so an assert(infeasible == NULL || *infeasible) should work here.
+       * However, after reporting a cutoff due to expr->activity being empty,
+       * SCIP may wander to a different node and call propagation again.
+       * If no bounds in a nonlinear constraint have been relaxed when switching nodes
+       * (so expr->activitytag >= conshdlrdata->lastboundrelax), then
+       * we will still have expr->activity being empty, but will have forgotten
+       * that we found infeasibility here before (!2221#note_134120).
+       * Therefore we just set *infeasibility=TRUE here and stop.
+       */
+      if( infeasible != NULL )
+         *infeasible = TRUE;
+      SCIPdebugMsg(scip, "expr %p already has empty activity -> cutoff\n", (void*)expr);
+      return SCIP_OKAY;
+   }
+   else
+   {
+      /* start with current activity, since it is valid */
+      activity = SCIPexprGetActivity(expr);
+   }
+
+   /* if activity of expr is not used, but expr participated in detect (nenfos >= 0), then do nothing */
+   if( ownerdata->nenfos >= 0 && ownerdata->nactivityusesprop == 0 && ownerdata->nactivityusessepa == 0 && !conshdlrdata->indetect )
+   {
+#ifdef DEBUG_PROP
+      SCIPdebugMsg(scip, "expr %p activity is not used but enfo initialized, skip inteval\n", (void*)expr);
+#endif
+      return SCIP_OKAY;
+   }
+
+#ifdef DEBUG_PROP
+   SCIPdebugMsg(scip, "interval evaluation of expr %p ", (void*)expr);
+   SCIP_CALL( SCIPprintExpr(scip, expr, NULL) );
+   SCIPdebugMsgPrint(scip, ", current activity = [%.20g, %.20g]\n", SCIPexprGetActivity(expr).inf, SCIPexprGetActivity(expr).sup);
+#endif
+
+   /* run interval eval of nonlinear handlers or expression handler */
+   if( ownerdata->nenfos > 0 )
+   {
+      SCIP_NLHDLR* nlhdlr;
+      SCIP_INTERVAL nlhdlrinterval;
+      int e;
+
+      /* for expressions with enforcement, nlhdlrs take care of interval evaluation */
+      for( e = 0; e < ownerdata->nenfos && !SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, activity); ++e )
+      {
+         /* skip nlhdlr if it does not want to participate in activity computation */
+         if( (ownerdata->enfos[e]->nlhdlrparticipation & SCIP_NLHDLR_METHOD_ACTIVITY) == 0 )
+            continue;
+
+         nlhdlr = ownerdata->enfos[e]->nlhdlr;
+         assert(nlhdlr != NULL);
+
+         /* skip nlhdlr if it does not provide interval evaluation (so it may only provide reverse propagation) */
+         if( !SCIPnlhdlrHasIntEval(nlhdlr) )
+            continue;
+
+         /* let nlhdlr evaluate current expression */
+         nlhdlrinterval = activity;
+         SCIP_CALL( SCIPnlhdlrInteval(scip, nlhdlr, expr, ownerdata->enfos[e]->nlhdlrexprdata,
+            &nlhdlrinterval, conshdlrdata->intevalvar, conshdlrdata) );
+#ifdef DEBUG_PROP
+         SCIPdebugMsg(scip, " nlhdlr <%s>::inteval = [%.20g, %.20g]", SCIPnlhdlrGetName(nlhdlr), nlhdlrinterval.inf, nlhdlrinterval.sup);
+#endif
+
+         /* update activity by intersecting with computed activity */
+         SCIPintervalIntersectEps(&activity, SCIPepsilon(scip), activity, nlhdlrinterval);
+#ifdef DEBUG_PROP
+         SCIPdebugMsgPrint(scip, " -> new activity: [%.20g, %.20g]\n", activity.inf, activity.sup);
+#endif
+      }
+   }
+   else
+   {
+      /* for node without enforcement (before or during detect), call the callback of the exprhdlr directly */
+      SCIP_INTERVAL exprhdlrinterval = activity;
+      SCIP_CALL( SCIPcallExprInteval(scip, expr, &exprhdlrinterval, conshdlrdata->intevalvar, conshdlrdata) );
+#ifdef DEBUG_PROP
+      SCIPdebugMsg(scip, " exprhdlr <%s>::inteval = [%.20g, %.20g]", SCIPexprhdlrGetName(SCIPexprGetHdlr(expr)), exprhdlrinterval.inf, exprhdlrinterval.sup);
+#endif
+
+      /* update expr->activity by intersecting with computed activity */
+      SCIPintervalIntersectEps(&activity, SCIPepsilon(scip), activity, exprhdlrinterval);
+#ifdef DEBUG_PROP
+      SCIPdebugMsgPrint(scip, " -> new activity: [%.20g, %.20g]\n", activity.inf, activity.sup);
+#endif
+   }
+
+   /* if expression is integral, then we try to tighten the interval bounds a bit
+    * this should undo the addition of some unnecessary safety added by use of nextafter() in interval arithmetics, e.g., when doing pow()
+    * it would be ok to use ceil() and floor(), but for safety we use SCIPceil and SCIPfloor for now
+    * do this only if using boundtightening-inteval and not in redundancy check (there we really want to relax all variables)
+    * boundtightening-inteval does not relax integer variables, so can omit expressions without children
+    * (constants should be ok, too)
+    */
+   if( SCIPexprIsIntegral(expr) && conshdlrdata->intevalvar == intEvalVarBoundTightening && SCIPexprGetNChildren(expr) > 0 )
+   {
+      if( activity.inf > -SCIP_INTERVAL_INFINITY )
+         activity.inf = SCIPceil(scip, activity.inf);
+      if( activity.sup <  SCIP_INTERVAL_INFINITY )
+         activity.sup = SCIPfloor(scip, activity.sup);
+#ifdef DEBUG_PROP
+      SCIPdebugMsg(scip, " applying integrality: [%.20g, %.20g]\n", activity.inf, activity.sup);
+#endif
+   }
+
+   /* mark the current node to be infeasible if either the lower/upper bound is above/below +/- SCIPinfinity()
+    * TODO this is a problem if dual-presolve fixed a variable to +/- infinity
+    */
+   if( SCIPisInfinity(scip, activity.inf) || SCIPisInfinity(scip, -activity.sup) )
+   {
+      SCIPdebugMsg(scip, "cut off due to activity [%g,%g] beyond infinity\n", activity.inf, activity.sup);
+      SCIPintervalSetEmpty(&activity);
+   }
+
+   /* now finally store activity in expr */
+   SCIPexprSetActivity(expr, activity, conshdlrdata->curboundstag);
+
+   if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, activity) )
+   {
+      if( infeasible != NULL )
+         *infeasible = TRUE;
+   }
+   else if( tightenauxvars && ownerdata->auxvar != NULL )
+   {
+      SCIP_Bool tighteninfeasible;
+
+      SCIP_CALL( tightenAuxVarBounds(scip, conshdlr, expr, activity, &tighteninfeasible, ntightenings) );
+      if( tighteninfeasible )
+      {
+         if( infeasible != NULL )
+            *infeasible = TRUE;
+         SCIPintervalSetEmpty(&activity);
+         SCIPexprSetActivity(expr, activity, conshdlrdata->curboundstag);
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** propagate bounds of the expressions in a given expression tree (that is, updates activity intervals)
  *  and tries to tighten the bounds of the auxiliary variables accordingly
+ *
+ *  If an expression program is given, then the subexpressions are updated in the order of the program.
+ *  Otherwise, the expression is walked with an expression iterator.
  */
 static
 SCIP_RETCODE forwardPropExpr(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
    SCIP_EXPR*            rootexpr,           /**< expression */
+   SCIP_EXPRPROG*        prog,               /**< expression program of rootexpr, or NULL to walk the expression */
    SCIP_Bool             tightenauxvars,     /**< should the bounds of auxiliary variables be tightened? */
    SCIP_Bool*            infeasible,         /**< buffer to store whether the problem is infeasible (NULL if not needed) */
    int*                  ntightenings        /**< buffer to store the number of auxiliary variable tightenings (NULL if not needed) */
@@ -2225,6 +2476,69 @@ SCIP_RETCODE forwardPropExpr(
       return SCIP_OKAY;
    }
 
+   if( prog != NULL )
+   {
+      SCIP_EXPR** exprs;
+      SCIP_Bool* visit;
+      int* childpos;
+      int nexprs;
+      int i;
+      int c;
+
+      exprs = SCIPexprprogGetExprs(prog);
+      nexprs = SCIPexprprogGetNExprs(prog);
+      assert(exprs[nexprs-1] == rootexpr);
+
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &visit, nexprs) );
+
+      /* mark the subexpressions that a walk would visit: the root and all children of visited subexpressions,
+       * except for those children whose activity is up to date already
+       */
+      visit[nexprs-1] = TRUE;
+      for( i = nexprs-1; i >= 0; --i )
+      {
+         if( !visit[i] )
+            continue;
+
+         if( SCIPexprGetActivityTag(exprs[i]) == conshdlrdata->curboundstag )
+         {
+            if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, SCIPexprGetActivity(exprs[i])) && infeasible != NULL )
+               *infeasible = TRUE;
+
+            visit[i] = FALSE;
+            continue;
+         }
+
+         childpos = SCIPexprprogGetChildPos(prog, i);
+         for( c = 0; c < SCIPexprGetNChildren(exprs[i]); ++c )
+            visit[childpos[c]] = TRUE;
+      }
+
+      /* since children come before their parents in the program, the children of a subexpression are up to date
+       * when it is reached; the activity of a variable expression may have been updated meanwhile by a bound
+       * tightening on an auxiliary variable
+       */
+      for( i = 0; i < nexprs; ++i )
+      {
+         if( !visit[i] )
+            continue;
+
+         if( SCIPexprGetActivityTag(exprs[i]) == conshdlrdata->curboundstag )
+         {
+            if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, SCIPexprGetActivity(exprs[i])) && infeasible != NULL )
+               *infeasible = TRUE;
+
+            continue;
+         }
+
+         SCIP_CALL( forwardPropSubexpr(scip, conshdlr, exprs[i], tightenauxvars, infeasible, ntightenings) );
+      }
+
+      SCIPfreeBufferArray(scip, &visit);
+
+      return SCIP_OKAY;
+   }
+
    SCIP_CALL( SCIPcreateExpriter(scip, &it) );
    SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, TRUE) );
    SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_VISITINGCHILD | SCIP_EXPRITER_LEAVEEXPR);
@@ -2253,182 +2567,7 @@ SCIP_RETCODE forwardPropExpr(
 
          case SCIP_EXPRITER_LEAVEEXPR :
          {
-            SCIP_INTERVAL activity;
-
-            /* we should not have entered this expression if its activity was already up to date */
-            assert(SCIPexprGetActivityTag(expr) < conshdlrdata->curboundstag);
-
-            ownerdata = SCIPexprGetOwnerData(expr);
-            assert(ownerdata != NULL);
-
-            /* for var exprs where varevents are catched, activity is updated immediately when the varbound has been changed
-             * so we can assume that the activity is up to date for all these variables
-             * UNLESS we changed the method used to evaluate activity of variable expressions
-             *   or we currently use global bounds (varevents are catched for local bound changes only)
-             */
-            if( SCIPisExprVar(scip, expr) && ownerdata->filterpos >= 0 &&
-                SCIPexprGetActivityTag(expr) >= conshdlrdata->lastvaractivitymethodchange && !conshdlrdata->globalbounds )
-            {
-#ifndef NDEBUG
-               SCIP_INTERVAL exprhdlrinterval;
-
-               SCIP_CALL( SCIPcallExprInteval(scip, expr, &exprhdlrinterval, conshdlrdata->intevalvar, conshdlrdata) );
-               assert(SCIPisRelEQ(scip, exprhdlrinterval.inf, SCIPexprGetActivity(expr).inf));
-               assert(SCIPisRelEQ(scip, exprhdlrinterval.sup, SCIPexprGetActivity(expr).sup));
-#endif
-#ifdef DEBUG_PROP
-               SCIPdebugMsg(scip, "skip interval evaluation of expr for var <%s> [%g,%g]\n", SCIPvarGetName(SCIPgetVarExprVar(expr)), SCIPexprGetActivity(expr).inf, SCIPexprGetActivity(expr).sup);
-#endif
-               SCIPexprSetActivity(expr, SCIPexprGetActivity(expr), conshdlrdata->curboundstag);
-
-               break;
-            }
-
-            if( SCIPexprGetActivityTag(expr) < conshdlrdata->lastboundrelax )
-            {
-               /* start with entire activity if current one is invalid */
-               SCIPintervalSetEntire(SCIP_INTERVAL_INFINITY, &activity);
-            }
-            else if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, SCIPexprGetActivity(expr)) )
-            {
-               /* If already empty, then don't try to compute even better activity.
-                * If cons_nonlinear were alone, then we should have noted that we are infeasible
-                * so an assert(infeasible == NULL || *infeasible) should work here.
-                * However, after reporting a cutoff due to expr->activity being empty,
-                * SCIP may wander to a different node and call propagation again.
-                * If no bounds in a nonlinear constraint have been relaxed when switching nodes
-                * (so expr->activitytag >= conshdlrdata->lastboundrelax), then
-                * we will still have expr->activity being empty, but will have forgotten
-                * that we found infeasibility here before (!2221#note_134120).
-                * Therefore we just set *infeasibility=TRUE here and stop.
-                */
-               if( infeasible != NULL )
-                  *infeasible = TRUE;
-               SCIPdebugMsg(scip, "expr %p already has empty activity -> cutoff\n", (void*)expr);
-               break;
-            }
-            else
-            {
-               /* start with current activity, since it is valid */
-               activity = SCIPexprGetActivity(expr);
-            }
-
-            /* if activity of expr is not used, but expr participated in detect (nenfos >= 0), then do nothing */
-            if( ownerdata->nenfos >= 0 && ownerdata->nactivityusesprop == 0 && ownerdata->nactivityusessepa == 0 && !conshdlrdata->indetect )
-            {
-#ifdef DEBUG_PROP
-               SCIPdebugMsg(scip, "expr %p activity is not used but enfo initialized, skip inteval\n", (void*)expr);
-#endif
-               break;
-            }
-
-#ifdef DEBUG_PROP
-            SCIPdebugMsg(scip, "interval evaluation of expr %p ", (void*)expr);
-            SCIP_CALL( SCIPprintExpr(scip, expr, NULL) );
-            SCIPdebugMsgPrint(scip, ", current activity = [%.20g, %.20g]\n", SCIPexprGetActivity(expr).inf, SCIPexprGetActivity(expr).sup);
-#endif
-
-            /* run interval eval of nonlinear handlers or expression handler */
-            if( ownerdata->nenfos > 0 )
-            {
-               SCIP_NLHDLR* nlhdlr;
-               SCIP_INTERVAL nlhdlrinterval;
-               int e;
-
-               /* for expressions with enforcement, nlhdlrs take care of interval evaluation */
-               for( e = 0; e < ownerdata->nenfos && !SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, activity); ++e )
-               {
-                  /* skip nlhdlr if it does not want to participate in activity computation */
-                  if( (ownerdata->enfos[e]->nlhdlrparticipation & SCIP_NLHDLR_METHOD_ACTIVITY) == 0 )
-                     continue;
-
-                  nlhdlr = ownerdata->enfos[e]->nlhdlr;
-                  assert(nlhdlr != NULL);
-
-                  /* skip nlhdlr if it does not provide interval evaluation (so it may only provide reverse propagation) */
-                  if( !SCIPnlhdlrHasIntEval(nlhdlr) )
-                     continue;
-
-                  /* let nlhdlr evaluate current expression */
-                  nlhdlrinterval = activity;
-                  SCIP_CALL( SCIPnlhdlrInteval(scip, nlhdlr, expr, ownerdata->enfos[e]->nlhdlrexprdata,
-                     &nlhdlrinterval, conshdlrdata->intevalvar, conshdlrdata) );
-#ifdef DEBUG_PROP
-                  SCIPdebugMsg(scip, " nlhdlr <%s>::inteval = [%.20g, %.20g]", SCIPnlhdlrGetName(nlhdlr), nlhdlrinterval.inf, nlhdlrinterval.sup);
-#endif
-
-                  /* update activity by intersecting with computed activity */
-                  SCIPintervalIntersectEps(&activity, SCIPepsilon(scip), activity, nlhdlrinterval);
-#ifdef DEBUG_PROP
-                  SCIPdebugMsgPrint(scip, " -> new activity: [%.20g, %.20g]\n", activity.inf, activity.sup);
-#endif
-               }
-            }
-            else
-            {
-               /* for node without enforcement (before or during detect), call the callback of the exprhdlr directly */
-               SCIP_INTERVAL exprhdlrinterval = activity;
-               SCIP_CALL( SCIPcallExprInteval(scip, expr, &exprhdlrinterval, conshdlrdata->intevalvar, conshdlrdata) );
-#ifdef DEBUG_PROP
-               SCIPdebugMsg(scip, " exprhdlr <%s>::inteval = [%.20g, %.20g]", SCIPexprhdlrGetName(SCIPexprGetHdlr(expr)), exprhdlrinterval.inf, exprhdlrinterval.sup);
-#endif
-
-               /* update expr->activity by intersecting with computed activity */
-               SCIPintervalIntersectEps(&activity, SCIPepsilon(scip), activity, exprhdlrinterval);
-#ifdef DEBUG_PROP
-               SCIPdebugMsgPrint(scip, " -> new activity: [%.20g, %.20g]\n", activity.inf, activity.sup);
-#endif
-            }
-
-            /* if expression is integral, then we try to tighten the interval bounds a bit
-             * this should undo the addition of some unnecessary safety added by use of nextafter() in interval arithmetics, e.g., when doing pow()
-             * it would be ok to use ceil() and floor(), but for safety we use SCIPceil and SCIPfloor for now
-             * do this only if using boundtightening-inteval and not in redundancy check (there we really want to relax all variables)
-             * boundtightening-inteval does not relax integer variables, so can omit expressions without children
-             * (constants should be ok, too)
-             */
-            if( SCIPexprIsIntegral(expr) && conshdlrdata->intevalvar == intEvalVarBoundTightening && SCIPexprGetNChildren(expr) > 0 )
-            {
-               if( activity.inf > -SCIP_INTERVAL_INFINITY )
-                  activity.inf = SCIPceil(scip, activity.inf);
-               if( activity.sup <  SCIP_INTERVAL_INFINITY )
-                  activity.sup = SCIPfloor(scip, activity.sup);
-#ifdef DEBUG_PROP
-               SCIPdebugMsg(scip, " applying integrality: [%.20g, %.20g]\n", activity.inf, activity.sup);
-#endif
-            }
-
-            /* mark the current node to be infeasible if either the lower/upper bound is above/below +/- SCIPinfinity()
-             * TODO this is a problem if dual-presolve fixed a variable to +/- infinity
-             */
-            if( SCIPisInfinity(scip, activity.inf) || SCIPisInfinity(scip, -activity.sup) )
-            {
-               SCIPdebugMsg(scip, "cut off due to activity [%g,%g] beyond infinity\n", activity.inf, activity.sup);
-               SCIPintervalSetEmpty(&activity);
-            }
-
-            /* now finally store activity in expr */
-            SCIPexprSetActivity(expr, activity, conshdlrdata->curboundstag);
-
-            if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, activity) )
-            {
-               if( infeasible != NULL )
-                  *infeasible = TRUE;
-            }
-            else if( tightenauxvars && ownerdata->auxvar != NULL )
-            {
-               SCIP_Bool tighteninfeasible;
-
-               SCIP_CALL( tightenAuxVarBounds(scip, conshdlr, expr, activity, &tighteninfeasible, ntightenings) );
-               if( tighteninfeasible )
-               {
-                  if( infeasible != NULL )
-                     *infeasible = TRUE;
-                  SCIPintervalSetEmpty(&activity);
-                  SCIPexprSetActivity(expr, activity, conshdlrdata->curboundstag);
-               }
-            }
-
+            SCIP_CALL( forwardPropSubexpr(scip, conshdlr, expr, tightenauxvars, infeasible, ntightenings) );
             break;
          }
 
@@ -2753,7 +2892,8 @@ SCIP_RETCODE propConss(
          SCIPdebugPrintCons(scip, conss[i], NULL);
 
          ntightenings = 0;
-         SCIP_CALL( forwardPropExpr(scip, conshdlr, consdata->expr, TRUE, &cutoff, &ntightenings) );
+         SCIP_CALL( ensureExprprog(scip, conss[i]) );
+         SCIP_CALL( forwardPropExpr(scip, conshdlr, consdata->expr, consdata->exprprog, TRUE, &cutoff, &ntightenings) );
          assert(cutoff || !SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, SCIPexprGetActivity(consdata->expr)));
 
          if( cutoff )
@@ -3727,8 +3867,9 @@ SCIP_RETCODE deinitSolve(
          /* remove nonlinear handlers in expression and their data and auxiliary variables; reset activityusage count */
          SCIP_CALL( freeEnfoData(scip, expr, TRUE) );
 
-         /* remove quadratic info */
+         /* remove quadratic info and batch evaluation data */
          SCIPfreeExprQuadratic(scip, expr);
+         SCIPfreeExprBatch(scip, expr);
 
          if( rootactivityvalid )
          {
@@ -5316,7 +5457,8 @@ SCIP_RETCODE presolveRedundantConss(
       SCIPdebugMsg(scip, "call forwardPropExpr() for constraint <%s>: ", SCIPconsGetName(conss[i]));
       SCIPdebugPrintCons(scip, conss[i], NULL);
 
-      SCIP_CALL( forwardPropExpr(scip, conshdlr, consdata->expr, FALSE, cutoff, NULL) );
+      SCIP_CALL( ensureExprprog(scip, conss[i]) );
+      SCIP_CALL( forwardPropExpr(scip, conshdlr, consdata->expr, consdata->exprprog, FALSE, cutoff, NULL) );
       assert(*cutoff || !SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, SCIPexprGetActivity(consdata->expr)));
 
       /* it is unlikely that we detect infeasibility by doing forward propagation */
@@ -7621,7 +7763,8 @@ SCIP_RETCODE enforceConstraint(
       SCIP_Bool infeasible;
       int ntightenings;
 
-      SCIP_CALL( forwardPropExpr(scip, conshdlr, consdata->expr, inenforcement, &infeasible, &ntightenings) );
+      SCIP_CALL( ensureExprprog(scip, cons) );
+      SCIP_CALL( forwardPropExpr(scip, conshdlr, consdata->expr, consdata->exprprog, inenforcement, &infeasible, &ntightenings) );
       if( infeasible )
       {
          *result = SCIP_CUTOFF;
@@ -9345,8 +9488,236 @@ SCIP_RETCODE computeVertexPolyhedralFacetBivariate(
    return SCIP_OKAY;
 }
 
-/** ensures that we can store information about open expressions (i.e., not fully encoded in the symmetry detection
- *  graph yet) in an array
+/** computes a facet of the convex or concave envelope of a vertex polyhedral function
+ *
+ * The function is evaluated in the corners of the box either one by one via function or all at once via functionbatch.
+ */
+static
+SCIP_RETCODE computeFacetVertexPolyhedral(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< nonlinear constraint handler */
+   SCIP_Bool             overestimate,       /**< whether to compute facet of concave (TRUE) or convex (FALSE) envelope */
+   SCIP_DECL_VERTEXPOLYFUN((*function)),     /**< pointer to vertex polyhedral function, or NULL if functionbatch is given */
+   SCIP_DECL_VERTEXPOLYFUNBATCH((*functionbatch)), /**< pointer to batched vertex polyhedral function, or NULL if function is given */
+   void*                 fundata,            /**< data for function evaluation (can be NULL) */
+   SCIP_Real*            xstar,              /**< point to be separated */
+   SCIP_Real*            box,                /**< box where to compute facet: should be lb_1, ub_1, lb_2, ub_2... */
+   int                   nallvars,           /**< half of the length of box */
+   SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
+   SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an array of length at least nallvars */
+   SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
+   )
+{
+   SCIP_Real* corner;
+   SCIP_Real* corners = NULL;
+   SCIP_Real* funvals;
+   int* nonfixedpos;
+   SCIP_Real maxfaceterror;
+   int nvars; /* number of nonfixed variables */
+   unsigned int ncorners;
+   unsigned int i;
+   int j;
+
+   assert(scip != NULL);
+   assert(conshdlr != NULL);
+   assert((function != NULL) != (functionbatch != NULL));
+   assert(xstar != NULL);
+   assert(box != NULL);
+   assert(success != NULL);
+   assert(facetcoefs != NULL);
+   assert(facetconstant != NULL);
+
+   *success = FALSE;
+
+   /* identify fixed variables */
+   SCIP_CALL( SCIPallocBufferArray(scip, &nonfixedpos, nallvars) );
+   nvars = 0;
+   for( j = 0; j < nallvars; ++j )
+   {
+      if( SCIPisRelEQ(scip, box[2 * j], box[2 * j + 1]) )
+         continue;
+      nonfixedpos[nvars] = j;
+      nvars++;
+   }
+
+   /* if all variables are fixed, then we could provide something trivial, but that wouldn't be the job of separation
+    * if too many variables are not fixed, then we do nothing currently
+    */
+   if( nvars == 0 || nvars > SCIP_MAXVERTEXPOLYDIM )
+   {
+      SCIPwarningMessage(scip, "SCIPcomputeFacetVertexPolyhedralNonlinear() called with %d nonfixed variables. Must be between [1,%d].\n", nvars, SCIP_MAXVERTEXPOLYDIM);
+      SCIPfreeBufferArray(scip, &nonfixedpos);
+      return SCIP_OKAY;
+   }
+
+   /* compute f(v^i) for each corner v^i of [l,u] */
+   ncorners = POWEROFTWO(nvars);
+   SCIP_CALL( SCIPallocBufferArray(scip, &funvals, ncorners) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &corner, nallvars) );
+   if( functionbatch != NULL )
+   {
+      /* the corners are stored column-wise, i.e., corners[j*ncorners+i] is the value of variable j in corner i */
+      SCIP_CALL( SCIPallocBufferArray(scip, &corners, (size_t)nallvars * ncorners) );
+   }
+   for( j = 0; j < nallvars; ++j )
+   {
+      if( SCIPisRelEQ(scip, box[2 * j], box[2 * j + 1]) )
+         corner[j] = (box[2 * j] + box[2 * j + 1]) / 2.0;
+   }
+   for( i = 0; i < ncorners; ++i )
+   {
+      SCIPdebugMsg(scip, "corner %u: ", i);
+      for( j = 0; j < nvars; ++j )
+      {
+         int varpos = nonfixedpos[j];
+         /* if j'th bit of row index i is set, then take upper bound on var j, otherwise lower bound var j
+          * we check this by shifting i for j positions to the right and checking whether the last bit is set
+          */
+         if( (i >> j) & 0x1 )
+            corner[varpos] = box[2 * varpos + 1]; /* ub of var */
+         else
+            corner[varpos] = box[2 * varpos ]; /* lb of var */
+         SCIPdebugMsgPrint(scip, "%g, ", corner[varpos]);
+         assert(!SCIPisInfinity(scip, REALABS(corner[varpos])));
+      }
+
+      if( functionbatch != NULL )
+      {
+         SCIPdebugMsgPrint(scip, "\n");
+         for( j = 0; j < nallvars; ++j )
+            corners[(size_t)j * ncorners + i] = corner[j];
+         continue;
+      }
+
+      funvals[i] = function(corner, nallvars, fundata);
+
+      SCIPdebugMsgPrint(scip, "obj = %e\n", funvals[i]);
+
+      if( funvals[i] == SCIP_INVALID || SCIPisInfinity(scip, REALABS(funvals[i])) )
+      {
+         SCIPdebugMsg(scip, "cannot compute underestimator; function value at corner is too large %g\n", funvals[i]);
+         goto CLEANUP;
+      }
+   }
+
+   if( functionbatch != NULL )
+   {
+      SCIP_CALL( functionbatch(corners, nallvars, (int)ncorners, funvals, fundata) );
+
+      for( i = 0; i < ncorners; ++i )
+      {
+         SCIPdebugMsg(scip, "corner %u: obj = %e\n", i, funvals[i]);
+
+         if( funvals[i] == SCIP_INVALID || SCIPisInfinity(scip, REALABS(funvals[i])) )
+         {
+            SCIPdebugMsg(scip, "cannot compute underestimator; function value at corner is too large %g\n", funvals[i]);
+            goto CLEANUP;
+         }
+      }
+   }
+
+   /* clear coefs array; below we only fill in coefs for nonfixed variables */
+   BMSclearMemoryArray(facetcoefs, nallvars);
+
+   if( nvars == 1 )
+   {
+      SCIP_CALL( computeVertexPolyhedralFacetUnivariate(scip, box[2 * nonfixedpos[0]], box[2 * nonfixedpos[0] + 1], funvals[0], funvals[1], success, &facetcoefs[nonfixedpos[0]], facetconstant) );
+
+      /* check whether target has been missed */
+      if( *success && overestimate == (*facetconstant + facetcoefs[nonfixedpos[0]] * xstar[nonfixedpos[0]] > targetvalue) )
+      {
+         SCIPdebugMsg(scip, "computed secant, but missed target %g (facetvalue=%g, overestimate=%u)\n", targetvalue, *facetconstant + facetcoefs[nonfixedpos[0]] * xstar[nonfixedpos[0]], overestimate);
+         *success = FALSE;
+      }
+   }
+   else if( nvars == 2 && SCIPlapackIsAvailable() )
+   {
+      int idx1 = nonfixedpos[0];
+      int idx2 = nonfixedpos[1];
+      SCIP_Real p1[2] = { box[2*idx1],   box[2*idx2]   }; /* corner 0: 0>>0 & 0x1 = 0, 0>>1 & 0x1 = 0 */
+      SCIP_Real p2[2] = { box[2*idx1+1], box[2*idx2]   }; /* corner 1: 1>>0 & 0x1 = 1, 1>>1 & 0x1 = 0 */
+      SCIP_Real p3[2] = { box[2*idx1],   box[2*idx2+1] }; /* corner 2: 2>>0 & 0x1 = 0, 2>>1 & 0x1 = 1 */
+      SCIP_Real p4[2] = { box[2*idx1+1], box[2*idx2+1] }; /* corner 3: 3>>0 & 0x1 = 1, 3>>1 & 0x1 = 1 */
+      SCIP_Real xstar2[2] = { xstar[idx1], xstar[idx2] };
+      SCIP_Real coefs[2] = { 0.0, 0.0 };
+
+      SCIP_CALL( computeVertexPolyhedralFacetBivariate(scip, overestimate, p1, p2, p3, p4, funvals[0], funvals[1], funvals[2], funvals[3], xstar2, targetvalue, success, coefs, facetconstant) );
+
+      facetcoefs[idx1] = coefs[0];
+      facetcoefs[idx2] = coefs[1];
+   }
+   else
+   {
+      SCIP_CALL( computeVertexPolyhedralFacetLP(scip, conshdlr, overestimate, xstar, box, nallvars, nonfixedpos, funvals, nvars, targetvalue, success, facetcoefs, facetconstant) );
+   }
+   if( !*success )
+   {
+      SCIPdebugMsg(scip, "no success computing facet, %d vars\n", nvars);
+      goto CLEANUP;
+   }
+
+   /*
+    *  check and adjust facet with the algorithm of Rikun et al.
+    */
+
+   maxfaceterror = computeVertexPolyhedralMaxFacetError(scip, overestimate, funvals, box, nallvars, nvars, nonfixedpos, facetcoefs, *facetconstant);
+
+   /* adjust constant part of the facet by maxerror to make it a valid over/underestimator (not facet though) */
+   if( maxfaceterror > 0.0 )
+   {
+      SCIP_CONSHDLRDATA* conshdlrdata;
+      SCIP_Real midval;
+      SCIP_Real feastol;
+
+      feastol = SCIPgetStage(scip) == SCIP_STAGE_SOLVING ? SCIPgetLPFeastol(scip) : SCIPfeastol(scip);
+
+      /* evaluate function in middle point to get some idea for a scaling */
+      for( j = 0; j < nvars; ++j )
+         corner[nonfixedpos[j]] = (box[2 * nonfixedpos[j]] + box[2 * nonfixedpos[j] + 1]) / 2.0;
+      if( functionbatch != NULL )
+      {
+         SCIP_CALL( functionbatch(corner, nallvars, 1, &midval, fundata) );
+      }
+      else
+         midval = function(corner, nallvars, fundata);
+      if( midval == SCIP_INVALID )
+         midval = 1.0;
+
+      conshdlrdata = SCIPconshdlrGetData(conshdlr);
+      assert(conshdlrdata != NULL);
+
+      /* there seem to be numerical problems if the error is too large; in this case we reject the facet */
+      if( maxfaceterror > conshdlrdata->vp_adjfacetthreshold * feastol * fabs(midval) )
+      {
+         SCIPdebugMsg(scip, "ignoring facet due to instability, it cuts off a vertex by %g (midval=%g).\n", maxfaceterror, midval);
+         *success = FALSE;
+         goto CLEANUP;
+      }
+
+      SCIPdebugMsg(scip, "maximum facet error %g (midval=%g), adjust constant to make cut valid!\n", maxfaceterror, midval);
+
+      if( overestimate )
+         *facetconstant += maxfaceterror;
+      else
+         *facetconstant -= maxfaceterror;
+   }
+
+   /* if we made it until here, then we have a nice facet */
+   assert(*success);
+
+CLEANUP:
+   /* free allocated memory */
+   SCIPfreeBufferArrayNull(scip, &corners);
+   SCIPfreeBufferArray(scip, &corner);
+   SCIPfreeBufferArray(scip, &funvals);
+   SCIPfreeBufferArray(scip, &nonfixedpos);
+
+   return SCIP_OKAY;
+}
+
+/** ensures that we can store information about open expressions (i.e., not fully encoded in the symmetry detection
+ *  graph yet) in an array
  */
 static
 SCIP_RETCODE ensureOpenArraySizeSymdetect(
@@ -10860,9 +11231,21 @@ static
 SCIP_DECL_CONSEXITSOL(consExitsolNonlinear)
 {  /*lint --e{715}*/
    SCIP_CONSHDLRDATA* conshdlrdata;
+   int c;
 
    SCIP_CALL( deinitSolve(scip, conshdlr, conss, nconss) );
 
+   /* free expression programs, as expressions may be modified when presolving again after a restart */
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_CONSDATA* consdata;
+
+      consdata = SCIPconsGetData(conss[c]);
+      assert(consdata != NULL);
+
+      SCIPfreeExprprog(scip, &consdata->exprprog);
+   }
+
    conshdlrdata = SCIPconshdlrGetData(conshdlr);
    assert(conshdlrdata != NULL);
 
@@ -10903,6 +11286,7 @@ SCIP_DECL_CONSDELETE(consDeleteNonlinear)
    /* free variable expressions */
    SCIP_CALL( freeVarExprs(scip, *consdata) );
 
+   SCIPfreeExprprog(scip, &(*consdata)->exprprog);
    SCIP_CALL( SCIPreleaseExpr(scip, &(*consdata)->expr) );
 
    /* free nonlinear row representation */
@@ -11404,6 +11788,9 @@ SCIP_DECL_CONSACTIVE(consActiveNonlinear)
    consdata = SCIPconsGetData(cons);
    assert(consdata != NULL);
 
+   /* the expression may be modified below */
+   SCIPfreeExprprog(scip, &consdata->exprprog);
+
    /* simplify root expression if the constraint has been added after presolving */
    if( SCIPgetStage(scip) > SCIP_STAGE_EXITPRESOLVE )
    {
@@ -12002,6 +12389,10 @@ SCIP_RETCODE SCIPincludeConshdlrNonlinear(
          "whether to check bounds of all auxiliary variable to seed reverse propagation",
          &conshdlrdata->propauxvars, TRUE, TRUE, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/exprprogs",
+         "whether to evaluate and propagate expressions of constraints via expression programs in the solving stage",
+         &conshdlrdata->exprprogs, TRUE, FALSE, NULL, NULL) );
+
    SCIP_CALL( SCIPaddCharParam(scip, "constraints/" CONSHDLR_NAME "/varboundrelax",
          "strategy on how to relax variable bounds during bound tightening: relax (n)ot, relax by (a)bsolute value, relax always by a(b)solute value, relax by (r)relative value",
          &conshdlrdata->varboundrelax, TRUE, 'r', "nabr", NULL, NULL) );
@@ -13197,173 +13588,38 @@ SCIP_RETCODE SCIPcomputeFacetVertexPolyhedralNonlinear(
    SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
    )
 {
-   SCIP_Real* corner;
-   SCIP_Real* funvals;
-   int* nonfixedpos;
-   SCIP_Real maxfaceterror;
-   int nvars; /* number of nonfixed variables */
-   unsigned int ncorners;
-   unsigned int i;
-   int j;
-
-   assert(scip != NULL);
-   assert(conshdlr != NULL);
    assert(function != NULL);
-   assert(xstar != NULL);
-   assert(box != NULL);
-   assert(success != NULL);
-   assert(facetcoefs != NULL);
-   assert(facetconstant != NULL);
-
-   *success = FALSE;
-
-   /* identify fixed variables */
-   SCIP_CALL( SCIPallocBufferArray(scip, &nonfixedpos, nallvars) );
-   nvars = 0;
-   for( j = 0; j < nallvars; ++j )
-   {
-      if( SCIPisRelEQ(scip, box[2 * j], box[2 * j + 1]) )
-         continue;
-      nonfixedpos[nvars] = j;
-      nvars++;
-   }
-
-   /* if all variables are fixed, then we could provide something trivial, but that wouldn't be the job of separation
-    * if too many variables are not fixed, then we do nothing currently
-    */
-   if( nvars == 0 || nvars > SCIP_MAXVERTEXPOLYDIM )
-   {
-      SCIPwarningMessage(scip, "SCIPcomputeFacetVertexPolyhedralNonlinear() called with %d nonfixed variables. Must be between [1,%d].\n", nvars, SCIP_MAXVERTEXPOLYDIM);
-      SCIPfreeBufferArray(scip, &nonfixedpos);
-      return SCIP_OKAY;
-   }
-
-   /* compute f(v^i) for each corner v^i of [l,u] */
-   ncorners = POWEROFTWO(nvars);
-   SCIP_CALL( SCIPallocBufferArray(scip, &funvals, ncorners) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &corner, nallvars) );
-   for( j = 0; j < nallvars; ++j )
-   {
-      if( SCIPisRelEQ(scip, box[2 * j], box[2 * j + 1]) )
-         corner[j] = (box[2 * j] + box[2 * j + 1]) / 2.0;
-   }
-   for( i = 0; i < ncorners; ++i )
-   {
-      SCIPdebugMsg(scip, "corner %u: ", i);
-      for( j = 0; j < nvars; ++j )
-      {
-         int varpos = nonfixedpos[j];
-         /* if j'th bit of row index i is set, then take upper bound on var j, otherwise lower bound var j
-          * we check this by shifting i for j positions to the right and checking whether the last bit is set
-          */
-         if( (i >> j) & 0x1 )
-            corner[varpos] = box[2 * varpos + 1]; /* ub of var */
-         else
-            corner[varpos] = box[2 * varpos ]; /* lb of var */
-         SCIPdebugMsgPrint(scip, "%g, ", corner[varpos]);
-         assert(!SCIPisInfinity(scip, REALABS(corner[varpos])));
-      }
-
-      funvals[i] = function(corner, nallvars, fundata);
-
-      SCIPdebugMsgPrint(scip, "obj = %e\n", funvals[i]);
-
-      if( funvals[i] == SCIP_INVALID || SCIPisInfinity(scip, REALABS(funvals[i])) )
-      {
-         SCIPdebugMsg(scip, "cannot compute underestimator; function value at corner is too large %g\n", funvals[i]);
-         goto CLEANUP;
-      }
-   }
-
-   /* clear coefs array; below we only fill in coefs for nonfixed variables */
-   BMSclearMemoryArray(facetcoefs, nallvars);
-
-   if( nvars == 1 )
-   {
-      SCIP_CALL( computeVertexPolyhedralFacetUnivariate(scip, box[2 * nonfixedpos[0]], box[2 * nonfixedpos[0] + 1], funvals[0], funvals[1], success, &facetcoefs[nonfixedpos[0]], facetconstant) );
-
-      /* check whether target has been missed */
-      if( *success && overestimate == (*facetconstant + facetcoefs[nonfixedpos[0]] * xstar[nonfixedpos[0]] > targetvalue) )
-      {
-         SCIPdebugMsg(scip, "computed secant, but missed target %g (facetvalue=%g, overestimate=%u)\n", targetvalue, *facetconstant + facetcoefs[nonfixedpos[0]] * xstar[nonfixedpos[0]], overestimate);
-         *success = FALSE;
-      }
-   }
-   else if( nvars == 2 && SCIPlapackIsAvailable() )
-   {
-      int idx1 = nonfixedpos[0];
-      int idx2 = nonfixedpos[1];
-      SCIP_Real p1[2] = { box[2*idx1],   box[2*idx2]   }; /* corner 0: 0>>0 & 0x1 = 0, 0>>1 & 0x1 = 0 */
-      SCIP_Real p2[2] = { box[2*idx1+1], box[2*idx2]   }; /* corner 1: 1>>0 & 0x1 = 1, 1>>1 & 0x1 = 0 */
-      SCIP_Real p3[2] = { box[2*idx1],   box[2*idx2+1] }; /* corner 2: 2>>0 & 0x1 = 0, 2>>1 & 0x1 = 1 */
-      SCIP_Real p4[2] = { box[2*idx1+1], box[2*idx2+1] }; /* corner 3: 3>>0 & 0x1 = 1, 3>>1 & 0x1 = 1 */
-      SCIP_Real xstar2[2] = { xstar[idx1], xstar[idx2] };
-      SCIP_Real coefs[2] = { 0.0, 0.0 };
-
-      SCIP_CALL( computeVertexPolyhedralFacetBivariate(scip, overestimate, p1, p2, p3, p4, funvals[0], funvals[1], funvals[2], funvals[3], xstar2, targetvalue, success, coefs, facetconstant) );
-
-      facetcoefs[idx1] = coefs[0];
-      facetcoefs[idx2] = coefs[1];
-   }
-   else
-   {
-      SCIP_CALL( computeVertexPolyhedralFacetLP(scip, conshdlr, overestimate, xstar, box, nallvars, nonfixedpos, funvals, nvars, targetvalue, success, facetcoefs, facetconstant) );
-   }
-   if( !*success )
-   {
-      SCIPdebugMsg(scip, "no success computing facet, %d vars\n", nvars);
-      goto CLEANUP;
-   }
 
-   /*
-    *  check and adjust facet with the algorithm of Rikun et al.
-    */
-
-   maxfaceterror = computeVertexPolyhedralMaxFacetError(scip, overestimate, funvals, box, nallvars, nvars, nonfixedpos, facetcoefs, *facetconstant);
-
-   /* adjust constant part of the facet by maxerror to make it a valid over/underestimator (not facet though) */
-   if( maxfaceterror > 0.0 )
-   {
-      SCIP_CONSHDLRDATA* conshdlrdata;
-      SCIP_Real midval;
-      SCIP_Real feastol;
-
-      feastol = SCIPgetStage(scip) == SCIP_STAGE_SOLVING ? SCIPgetLPFeastol(scip) : SCIPfeastol(scip);
+   SCIP_CALL( computeFacetVertexPolyhedral(scip, conshdlr, overestimate, function, NULL, fundata, xstar, box, nallvars,
+         targetvalue, success, facetcoefs, facetconstant) );
 
-      /* evaluate function in middle point to get some idea for a scaling */
-      for( j = 0; j < nvars; ++j )
-         corner[nonfixedpos[j]] = (box[2 * nonfixedpos[j]] + box[2 * nonfixedpos[j] + 1]) / 2.0;
-      midval = function(corner, nallvars, fundata);
-      if( midval == SCIP_INVALID )
-         midval = 1.0;
-
-      conshdlrdata = SCIPconshdlrGetData(conshdlr);
-      assert(conshdlrdata != NULL);
-
-      /* there seem to be numerical problems if the error is too large; in this case we reject the facet */
-      if( maxfaceterror > conshdlrdata->vp_adjfacetthreshold * feastol * fabs(midval) )
-      {
-         SCIPdebugMsg(scip, "ignoring facet due to instability, it cuts off a vertex by %g (midval=%g).\n", maxfaceterror, midval);
-         *success = FALSE;
-         goto CLEANUP;
-      }
-
-      SCIPdebugMsg(scip, "maximum facet error %g (midval=%g), adjust constant to make cut valid!\n", maxfaceterror, midval);
-
-      if( overestimate )
-         *facetconstant += maxfaceterror;
-      else
-         *facetconstant -= maxfaceterror;
-   }
+   return SCIP_OKAY;
+}
 
-   /* if we made it until here, then we have a nice facet */
-   assert(*success);
+/** computes a facet of the convex or concave envelope of a vertex polyhedral function that is evaluated in all corners at once
+ *
+ * Does the same as SCIPcomputeFacetVertexPolyhedralNonlinear(), but passes all corners of the box to one call of the
+ * evaluation callback.
+ */
+SCIP_RETCODE SCIPcomputeFacetVertexPolyhedralNonlinearBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< nonlinear constraint handler */
+   SCIP_Bool             overestimate,       /**< whether to compute facet of concave (TRUE) or convex (FALSE) envelope */
+   SCIP_DECL_VERTEXPOLYFUNBATCH((*function)), /**< pointer to batched vertex polyhedral function */
+   void*                 fundata,            /**< data for function evaluation (can be NULL) */
+   SCIP_Real*            xstar,              /**< point to be separated */
+   SCIP_Real*            box,                /**< box where to compute facet: should be lb_1, ub_1, lb_2, ub_2... */
+   int                   nallvars,           /**< half of the length of box */
+   SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
+   SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an array of length at least nallvars */
+   SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
+   )
+{
+   assert(function != NULL);
 
-CLEANUP:
-   /* free allocated memory */
-   SCIPfreeBufferArray(scip, &corner);
-   SCIPfreeBufferArray(scip, &funvals);
-   SCIPfreeBufferArray(scip, &nonfixedpos);
+   SCIP_CALL( computeFacetVertexPolyhedral(scip, conshdlr, overestimate, NULL, function, fundata, xstar, box, nallvars,
+         targetvalue, success, facetcoefs, facetconstant) );
 
    return SCIP_OKAY;
 }
@@ -101,6 +101,16 @@ typedef struct SCIP_ConsNonlinear_BilinTerm SCIP_CONSNONLINEAR_BILINTERM; /**< b
  */
 #define SCIP_DECL_VERTEXPOLYFUN(f) SCIP_Real f (SCIP_Real* args, int nargs, void* funcdata)
 
+/** evaluation callback for (vertex-polyhedral) functions in several points at once
+ *
+ * \param[in] args     the points to be evaluated, column-wise, i.e., `args[j*npoints+k]` is argument j of point k
+ * \param[in] nargs    the number of arguments of the function
+ * \param[in] npoints  the number of points
+ * \param[out] vals    buffer to store the value of the function in each point, or SCIP_INVALID if it could not be evaluated
+ * \param[in] funcdata user-data of function evaluation callback
+ */
+#define SCIP_DECL_VERTEXPOLYFUNBATCH(f) SCIP_RETCODE f (SCIP_Real* args, int nargs, int npoints, SCIP_Real* vals, void* funcdata)
+
 /** maximum dimension of vertex-polyhedral function for which we can try to compute a facet of its convex or concave envelope */
 #define SCIP_MAXVERTEXPOLYDIM 14
 
@@ -549,6 +559,27 @@ SCIP_RETCODE SCIPcomputeFacetVertexPolyhedralNonlinear(
    SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
    );
 
+/** computes a facet of the convex or concave envelope of a vertex polyhedral function that is evaluated in all corners at once
+ *
+ * Does the same as SCIPcomputeFacetVertexPolyhedralNonlinear(), but passes all corners of the box to one call of the
+ * evaluation callback.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeFacetVertexPolyhedralNonlinearBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< nonlinear constraint handler */
+   SCIP_Bool             overestimate,       /**< whether to compute facet of concave (TRUE) or convex (FALSE) envelope */
+   SCIP_DECL_VERTEXPOLYFUNBATCH((*function)), /**< pointer to batched vertex polyhedral function */
+   void*                 fundata,            /**< data for function evaluation (can be NULL) */
+   SCIP_Real*            xstar,              /**< point to be separated */
+   SCIP_Real*            box,                /**< box where to compute facet: should be lb_1, ub_1, lb_2, ub_2... */
+   int                   nallvars,           /**< half of the length of box */
+   SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
+   SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an array of length at least nallvars */
+   SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
+   );
+
 
 /* Nonlinear Constraint Methods */
 
@@ -120,6 +120,8 @@
 #define DEFAULT_CLIQUESHRINKING    TRUE /**< should we try to shrink the number of variables in a clique constraints, by
 					 *   replacing more than one variable by only one
 					 */
+#define DEFAULT_WATCHEDVARS       FALSE /**< should fixings to zero be detected by two watched variables during the solving
+                                         *   process instead of catching the upper bound events of all variables? */
 
 /* @todo maybe use event SCIP_EVENTTYPE_VARUNLOCKED to decide for another dual-presolving run on a constraint */
 
@@ -155,6 +157,9 @@ struct SCIP_ConshdlrData
    SCIP_Bool             presolpairwise;     /**< should pairwise constraint comparison be performed in presolving? */
    SCIP_Bool             presolusehashing;   /**< should hash table be used for detecting redundant constraints in advance */
    SCIP_Bool             dualpresolving;     /**< should dual presolving steps be performed? */
+   SCIP_Bool             watchedvars;        /**< should fixings to zero be detected by two watched variables during the
+                                              *   solving process instead of catching the upper bound events of all
+                                              *   variables? */
 };
 
 /** constraint data for set partitioning / packing / covering constraints */
@@ -164,9 +169,14 @@ struct SCIP_ConsData
    SCIP_ROW*             row;                /**< LP row, if constraint is already stored in LP row format */
    SCIP_NLROW*           nlrow;              /**< NLP row, if constraint has been added to NLP relaxation */
    SCIP_VAR**            vars;               /**< variables of the constraint */
+   SCIP_VAR*             watchedvar1;        /**< first watched variable in watched mode, or NULL */
+   SCIP_VAR*             watchedvar2;        /**< second watched variable in watched mode, or NULL */
+   int                   filterpos1;         /**< event filter position of first watched variable */
+   int                   filterpos2;         /**< event filter position of second watched variable */
    int                   varssize;           /**< size of vars array */
    int                   nvars;              /**< number of variables in the constraint */
-   int                   nfixedzeros;        /**< current number of variables fixed to zero in the constraint */
+   int                   nfixedzeros;        /**< current number of variables fixed to zero in the constraint (not
+                                              *   counted in watched mode) */
    int                   nfixedones;         /**< current number of variables fixed to one in the constraint */
    unsigned int          setppctype:2;       /**< type of constraint: set partitioning, packing or covering */
    unsigned int          sorted:1;           /**< are the constraint's variables sorted? */
@@ -178,6 +188,8 @@ struct SCIP_ConsData
    unsigned int          presolpropagated:1; /**< was the constraint already propagated in presolving w.r.t. the current domains? */
    unsigned int          existmultaggr:1;    /**< does this constraint contain aggregations */
    unsigned int          catchevents:1;      /**< are events installed for this constraint? */
+   unsigned int          watched:1;          /**< are fixings to zero detected by the watched variables instead of
+                                              *   being counted? */
 };
 
 
@@ -584,6 +596,11 @@ SCIP_RETCODE consdataCreate(
    (*consdata)->nlrow = NULL;
    (*consdata)->existmultaggr = FALSE;
    (*consdata)->catchevents = FALSE;
+   (*consdata)->watched = FALSE;
+   (*consdata)->watchedvar1 = NULL;
+   (*consdata)->watchedvar2 = NULL;
+   (*consdata)->filterpos1 = -1;
+   (*consdata)->filterpos2 = -1;
    (*consdata)->nfixedzeros = 0;
    (*consdata)->nfixedones = 0;
 
@@ -903,6 +920,93 @@ SCIP_RETCODE setSetppcType(
    return SCIP_OKAY;
 }
 
+/** sets the watched variables of a set partitioning or covering constraint in watched mode; the upper bound events of
+ *  the old watched variables are dropped and the ones of the new watched variables are caught
+ */
+static
+SCIP_RETCODE switchWatchedvars(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< set partitioning / packing / covering constraint */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler to call for the event processing */
+   SCIP_VAR*             watchedvar1,        /**< new first watched variable, or NULL */
+   SCIP_VAR*             watchedvar2         /**< new second watched variable, or NULL */
+   )
+{
+   SCIP_CONSDATA* consdata;
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+   assert(watchedvar1 == NULL || watchedvar1 != watchedvar2);
+   assert(watchedvar1 != NULL || watchedvar2 == NULL);
+
+   /* if one watched variable is equal to the old other watched variable, just switch positions */
+   if( (watchedvar1 != NULL && watchedvar1 == consdata->watchedvar2)
+      || (watchedvar2 != NULL && watchedvar2 == consdata->watchedvar1) )
+   {
+      SCIP_VAR* tmpvar;
+      int tmp;
+
+      tmpvar = consdata->watchedvar1;
+      consdata->watchedvar1 = consdata->watchedvar2;
+      consdata->watchedvar2 = tmpvar;
+      tmp = consdata->filterpos1;
+      consdata->filterpos1 = consdata->filterpos2;
+      consdata->filterpos2 = tmp;
+   }
+
+   /* drop events on old watched variables */
+   if( consdata->watchedvar1 != NULL && consdata->watchedvar1 != watchedvar1 )
+   {
+      assert(consdata->filterpos1 != -1);
+      SCIP_CALL( SCIPdropVarEvent(scip, consdata->watchedvar1, SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr,
+            (SCIP_EVENTDATA*)cons, consdata->filterpos1) );
+      consdata->filterpos1 = -1;
+   }
+   if( consdata->watchedvar2 != NULL && consdata->watchedvar2 != watchedvar2 )
+   {
+      assert(consdata->filterpos2 != -1);
+      SCIP_CALL( SCIPdropVarEvent(scip, consdata->watchedvar2, SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr,
+            (SCIP_EVENTDATA*)cons, consdata->filterpos2) );
+      consdata->filterpos2 = -1;
+   }
+
+   /* catch events on new watched variables */
+   if( watchedvar1 != NULL && watchedvar1 != consdata->watchedvar1 )
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, watchedvar1, SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr, (SCIP_EVENTDATA*)cons,
+            &consdata->filterpos1) );
+   }
+   if( watchedvar2 != NULL && watchedvar2 != consdata->watchedvar2 )
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, watchedvar2, SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr, (SCIP_EVENTDATA*)cons,
+            &consdata->filterpos2) );
+   }
+
+   /* set the new watched variables */
+   consdata->watchedvar1 = watchedvar1;
+   consdata->watchedvar2 = watchedvar2;
+
+   return SCIP_OKAY;
+}
+
+/** returns whether a watched variable of a set partitioning or covering constraint in watched mode is missing or fixed
+ *  to zero, such that the constraint has to be propagated
+ */
+static
+SCIP_Bool isWatchedvarFixed(
+   SCIP_CONSDATA*        consdata            /**< set partitioning / packing / covering constraint data */
+   )
+{
+   assert(consdata != NULL);
+   assert(consdata->watched);
+
+   if( consdata->setppctype == SCIP_SETPPCTYPE_PACKING ) /*lint !e641*/
+      return FALSE;
+
+   return consdata->watchedvar1 == NULL || SCIPvarGetUbLocal(consdata->watchedvar1) < 0.5
+      || consdata->watchedvar2 == NULL || SCIPvarGetUbLocal(consdata->watchedvar2) < 0.5;
+}
+
 /** catches events for variable at given position */
 static
 SCIP_RETCODE catchEvent(
@@ -936,8 +1040,14 @@ SCIP_RETCODE catchEvent(
     *                            detected to be equal or a negated variable of on other variable. in case of a negation
     *                            this could lead to a redundant constraint if the (other) active variable is also part
     *                            of the constraint.
+    *
+    * In watched mode, only the lower bound changes are caught to count the variables fixed to one; fixings to zero are
+    * detected by the upper bound events of the watched variables, see switchWatchedvars().
     */
-   eventtype =  SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   if( consdata->watched )
+      eventtype = SCIP_EVENTTYPE_LBCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   else
+      eventtype = SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
 
    /* catch bound change events on variable */
    SCIP_CALL( SCIPcatchVarEvent(scip, var, eventtype, eventhdlr, (SCIP_EVENTDATA*)cons, NULL) );
@@ -945,17 +1055,22 @@ SCIP_RETCODE catchEvent(
    /* update the fixed variables counters for this variable */
    if( SCIPisEQ(scip, SCIPvarGetUbLocal(var), 0.0) )
    {
-      consdata->nfixedzeros++;
-
-      /* during presolving, we may fix the last unfixed variable or do an aggregation if there are two unfixed variables */
-      if( SCIPconsIsActive(cons) && ((SCIPgetStage(scip) < SCIP_STAGE_INITSOLVE) && (consdata->nfixedzeros >= consdata->nvars - 2)) )
+      if( !consdata->watched )
       {
-         consdata->presolpropagated = FALSE;
+         consdata->nfixedzeros++;
 
-         /* during solving, we only propagate again if there is only one unfixed variable left */
-         if( consdata->nfixedzeros >= consdata->nvars - 1 )
+         /* during presolving, we may fix the last unfixed variable or do an aggregation if there are two unfixed
+          * variables
+          */
+         if( SCIPconsIsActive(cons) && ((SCIPgetStage(scip) < SCIP_STAGE_INITSOLVE) && (consdata->nfixedzeros >= consdata->nvars - 2)) )
          {
-            SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+            consdata->presolpropagated = FALSE;
+
+            /* during solving, we only propagate again if there is only one unfixed variable left */
+            if( consdata->nfixedzeros >= consdata->nvars - 1 )
+            {
+               SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+            }
          }
       }
    }
@@ -995,21 +1110,44 @@ SCIP_RETCODE dropEvent(
    var = consdata->vars[pos];
    assert(var != NULL);
 
-   eventtype =  SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   if( consdata->watched )
+   {
+      /* the variable is not watched anymore */
+      if( var == consdata->watchedvar1 )
+      {
+         SCIP_CALL( switchWatchedvars(scip, cons, eventhdlr, consdata->watchedvar2, NULL) );
+      }
+      else if( var == consdata->watchedvar2 )
+      {
+         SCIP_CALL( switchWatchedvars(scip, cons, eventhdlr, consdata->watchedvar1, NULL) );
+      }
+
+      eventtype = SCIP_EVENTTYPE_LBCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   }
+   else
+      eventtype = SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
 
    /* drop events on variable */
    SCIP_CALL( SCIPdropVarEvent(scip, var, eventtype, eventhdlr, (SCIP_EVENTDATA*)cons, -1) );
 
    /* update the fixed variables counters for this variable */
    if( SCIPisEQ(scip, SCIPvarGetUbLocal(var), 0.0) )
-      consdata->nfixedzeros--;
+   {
+      if( !consdata->watched )
+         consdata->nfixedzeros--;
+   }
    else if( SCIPisEQ(scip, SCIPvarGetLbLocal(var), 1.0) )
       consdata->nfixedones--;
 
    return SCIP_OKAY;
 }
 
-/** catches bound change events for all variables in transformed setppc constraint */
+/** catches bound change events for all variables in transformed setppc constraint
+ *
+ *  During the solving process, unmodifiable constraints switch to watched mode if constraints/setppc/watchedvars is
+ *  set: the upper bound events are only caught for two watched variables of set partitioning and covering constraints
+ *  and for no variable of set packing constraints, since a set packing constraint does not propagate fixings to zero.
+ */
 static
 SCIP_RETCODE catchAllEvents(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -1017,6 +1155,7 @@ SCIP_RETCODE catchAllEvents(
    SCIP_EVENTHDLR*       eventhdlr           /**< event handler to call for the event processing */
    )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata;
    int i;
 
@@ -1026,6 +1165,14 @@ SCIP_RETCODE catchAllEvents(
    if( consdata->catchevents == TRUE )
       return SCIP_OKAY;
 
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert(conshdlrdata != NULL);
+
+   assert(!consdata->watched);
+   assert(consdata->watchedvar1 == NULL && consdata->watchedvar2 == NULL);
+   consdata->watched = conshdlrdata->watchedvars && !SCIPconsIsModifiable(cons)
+      && (SCIPgetStage(scip) == SCIP_STAGE_INITSOLVE || SCIPgetStage(scip) == SCIP_STAGE_SOLVING);
+
    /* catch event for every single variable */
    for( i = 0; i < consdata->nvars; ++i )
    {
@@ -1034,6 +1181,32 @@ SCIP_RETCODE catchAllEvents(
 
    consdata->catchevents = TRUE;
 
+   /* watch the first two unfixed variables */
+   if( consdata->watched && consdata->setppctype != SCIP_SETPPCTYPE_PACKING ) /*lint !e641*/
+   {
+      SCIP_VAR* watchedvar1 = NULL;
+      SCIP_VAR* watchedvar2 = NULL;
+
+      for( i = 0; i < consdata->nvars && watchedvar2 == NULL; ++i )
+      {
+         if( SCIPvarGetUbLocal(consdata->vars[i]) < 0.5 || consdata->vars[i] == watchedvar1 )
+            continue;
+
+         if( watchedvar1 == NULL )
+            watchedvar1 = consdata->vars[i];
+         else
+            watchedvar2 = consdata->vars[i];
+      }
+
+      SCIP_CALL( switchWatchedvars(scip, cons, eventhdlr, watchedvar1, watchedvar2) );
+
+      /* with less than two unfixed variables, the constraint has to be propagated */
+      if( watchedvar2 == NULL && SCIPconsIsActive(cons) )
+      {
+         SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+      }
+   }
+
    return SCIP_OKAY;
 }
 
@@ -1054,6 +1227,12 @@ SCIP_RETCODE dropAllEvents(
    if( consdata->catchevents == FALSE )
       return SCIP_OKAY;
 
+   /* drop the events of the watched variables */
+   if( consdata->watched )
+   {
+      SCIP_CALL( switchWatchedvars(scip, cons, eventhdlr, NULL, NULL) );
+   }
+
    /* drop event of every single variable */
    for( i = 0; i < consdata->nvars; ++i )
    {
@@ -1061,6 +1240,7 @@ SCIP_RETCODE dropAllEvents(
    }
 
    consdata->catchevents = FALSE;
+   consdata->watched = FALSE;
 
    return SCIP_OKAY;
 }
@@ -2152,6 +2332,111 @@ SCIP_RETCODE analyzeConflictOne(
    return SCIP_OKAY;
 }
 
+/** checks a set partitioning or covering constraint in watched mode without variables fixed to one for violation only
+ *  looking at the watched variables, and fixes the last unfixed variable to one if possible
+ */
+static
+SCIP_RETCODE processWatchedVars(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< set partitioning / covering constraint to be processed */
+   SCIP_Bool*            cutoff,             /**< pointer to store TRUE, if the node can be cut off */
+   int*                  nfixedvars,         /**< pointer to count number of fixings */
+   SCIP_Bool*            mustcheck           /**< pointer to store whether this constraint must be checked for feasibility */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSDATA* consdata;
+   SCIP_VAR* watchedvar1;
+   SCIP_VAR* watchedvar2;
+   int v;
+
+   assert(cons != NULL);
+   assert(cutoff != NULL);
+   assert(nfixedvars != NULL);
+   assert(mustcheck != NULL);
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+   assert(consdata->watched);
+   assert(consdata->nfixedones == 0);
+   assert(consdata->setppctype != SCIP_SETPPCTYPE_PACKING); /*lint !e641*/
+   assert(!SCIPconsIsModifiable(cons));
+
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert(conshdlrdata != NULL);
+
+   /* keep the watched variables that are still unfixed */
+   watchedvar1 = NULL;
+   watchedvar2 = NULL;
+   if( consdata->watchedvar1 != NULL && SCIPvarGetUbLocal(consdata->watchedvar1) > 0.5 )
+      watchedvar1 = consdata->watchedvar1;
+   if( consdata->watchedvar2 != NULL && SCIPvarGetUbLocal(consdata->watchedvar2) > 0.5 )
+   {
+      if( watchedvar1 == NULL )
+         watchedvar1 = consdata->watchedvar2;
+      else
+         watchedvar2 = consdata->watchedvar2;
+   }
+
+   /* search for new watched variables */
+   for( v = 0; v < consdata->nvars && watchedvar2 == NULL; ++v )
+   {
+      if( SCIPvarGetUbLocal(consdata->vars[v]) < 0.5 || consdata->vars[v] == watchedvar1 )
+         continue;
+
+      if( watchedvar1 == NULL )
+         watchedvar1 = consdata->vars[v];
+      else
+         watchedvar2 = consdata->vars[v];
+   }
+
+   if( watchedvar1 == NULL )
+   {
+      /* all variables are fixed to zero: the constraint is infeasible */
+      SCIPdebugMsg(scip, " -> set covering/partitioning constraint <%s> is infeasible\n", SCIPconsGetName(cons));
+
+      SCIP_CALL( SCIPresetConsAge(scip, cons) );
+
+      /* use conflict analysis to get a conflict constraint out of the conflicting assignment */
+      SCIP_CALL( analyzeConflictZero(scip, cons) );
+
+      *cutoff = TRUE;
+      *mustcheck = FALSE;
+   }
+   else if( watchedvar2 == NULL )
+   {
+      SCIP_Bool infeasible;
+      SCIP_Bool tightened;
+
+      /* all variables except one are fixed to zero: fix the remaining variable to one and disable the constraint; make
+       * sure, the fixed-to-one variable is watched
+       */
+      SCIPdebugMsg(scip, " -> fixing remaining variable <%s> to one in set covering/partitioning constraint <%s>\n",
+         SCIPvarGetName(watchedvar1), SCIPconsGetName(cons));
+
+      SCIP_CALL( SCIPinferBinvarCons(scip, watchedvar1, TRUE, cons, 0, &infeasible, &tightened) );
+      assert(!infeasible);
+      assert(tightened);
+      ++(*nfixedvars);
+
+      SCIP_CALL( SCIPresetConsAge(scip, cons) );
+      if( watchedvar1 != consdata->watchedvar1 && watchedvar1 != consdata->watchedvar2 )
+      {
+         SCIP_CALL( switchWatchedvars(scip, cons, conshdlrdata->eventhdlr, watchedvar1, consdata->watchedvar1) );
+      }
+
+      SCIP_CALL( SCIPdelConsLocal(scip, cons) );
+      *mustcheck = FALSE;
+   }
+   else
+   {
+      /* there are at least two unfixed variables */
+      SCIP_CALL( switchWatchedvars(scip, cons, conshdlrdata->eventhdlr, watchedvar1, watchedvar2) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** checks constraint for violation only looking at the fixed variables, applies further fixings if possible */
 static
 SCIP_RETCODE processFixings(
@@ -2294,6 +2579,14 @@ SCIP_RETCODE processFixings(
       }
       *mustcheck = FALSE;
    }
+   else if( consdata->watched )
+   {
+      /* in watched mode, the fixings to zero are not counted but detected by the watched variables */
+      if( consdata->nfixedones == 0 && consdata->setppctype != SCIP_SETPPCTYPE_PACKING ) /*lint !e641*/
+      {
+         SCIP_CALL( processWatchedVars(scip, cons, cutoff, nfixedvars, mustcheck) );
+      }
+   }
    else if( consdata->nfixedzeros == consdata->nvars )
    {
       /* all variables are fixed to zero:
@@ -4858,7 +5151,7 @@ SCIP_RETCODE liftCliqueVariables(
 	       var = SCIPvarGetNegationVar(vars[k]);
 	    }
 
-	    if( !SCIPvarsHaveCommonClique(var1, value, var, (*cliquevalues)[k], TRUE) )
+	    if( !SCIPhaveVarsCommonClique(scip, var1, value, var, (*cliquevalues)[k], TRUE) )
 	       break;
 	 }
       }
@@ -7560,6 +7853,31 @@ SCIP_DECL_CONSEXITPRE(consExitpreSetppc)
 static
 SCIP_DECL_CONSINITSOL(consInitsolSetppc)
 {  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   /* switch the unmodifiable constraints to watched mode by catching their events again */
+   if( conshdlrdata->watchedvars )
+   {
+      int c;
+
+      for( c = 0; c < nconss; ++c )
+      {
+         SCIP_CONSDATA* consdata;
+
+         consdata = SCIPconsGetData(conss[c]);
+         assert(consdata != NULL);
+
+         if( consdata->catchevents && !consdata->watched && !SCIPconsIsModifiable(conss[c]) )
+         {
+            SCIP_CALL( dropAllEvents(scip, conss[c], conshdlrdata->eventhdlr) );
+            SCIP_CALL( catchAllEvents(scip, conss[c], conshdlrdata->eventhdlr) );
+         }
+      }
+   }
+
    /* add nlrow representation to NLP, if NLP had been constructed */
    if( SCIPisNLPConstructed(scip) )
    {
@@ -7586,6 +7904,18 @@ SCIP_DECL_CONSEXITSOL(consExitsolSetppc)
       consdata = SCIPconsGetData(conss[c]);
       assert(consdata != NULL);
 
+      /* count the fixed variables again for presolving after a restart */
+      if( consdata->watched )
+      {
+         SCIP_CONSHDLRDATA* conshdlrdata;
+
+         conshdlrdata = SCIPconshdlrGetData(conshdlr);
+         assert(conshdlrdata != NULL);
+
+         SCIP_CALL( dropAllEvents(scip, conss[c], conshdlrdata->eventhdlr) );
+         SCIP_CALL( catchAllEvents(scip, conss[c], conshdlrdata->eventhdlr) );
+      }
+
       if( consdata->row != NULL )
       {
          SCIP_CALL( SCIPreleaseRow(scip, &consdata->row) );
@@ -8240,8 +8570,10 @@ SCIP_DECL_CONSPROP(consPropSetppc)
    SCIP_Bool addcut;
    SCIP_Bool mustcheck;
    SCIP_Bool inpresolve;
+   SCIP_Bool sorted;
    int nfixedvars = 0;
    int c;
+   int i;
 
    assert(conshdlr != NULL);
    assert(strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0);
@@ -8255,9 +8587,13 @@ SCIP_DECL_CONSPROP(consPropSetppc)
    cutoff = FALSE;
    inpresolve = (SCIPgetStage(scip) < SCIP_STAGE_INITSOLVE);
 
-   /* propagate all marked set partitioning / packing / covering constraints */
-   for( c = nmarkedconss - 1; c >= 0 && !cutoff; --c )
+   /* propagate all marked set partitioning / packing / covering constraints; if they are sorted by their number of
+    * markings, the most often marked ones are propagated first, otherwise they are processed from the back
+    */
+   sorted = SCIPisPropWorklistSorted(scip, conshdlr);
+   for( i = 0; i < nmarkedconss && !cutoff; ++i )
    {
+      c = sorted ? i : nmarkedconss - 1 - i;
       assert(SCIPconsGetData(conss[c]) != NULL);
 
       /* during presolving, we do not want to propagate constraints with multiaggregated variables. After presolving,
@@ -8717,7 +9053,8 @@ SCIP_DECL_CONSACTIVE(consActiveSetppc)
       SCIP_CONSDATA* consdata = SCIPconsGetData(cons);
       assert(consdata != NULL);
 
-      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1 )
+      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1
+         || (consdata->watched && isWatchedvarFixed(consdata)) )
       {
          SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
       }
@@ -9050,9 +9387,12 @@ SCIP_DECL_EVENTEXEC(eventExecSetppc)
       consdata->nfixedones--;
       break;
    case SCIP_EVENTTYPE_UBTIGHTENED:
-      consdata->nfixedzeros++;
+      /* in watched mode, only the watched variables are caught, and fixings to zero are not counted */
+      if( !consdata->watched )
+         consdata->nfixedzeros++;
       break;
    case SCIP_EVENTTYPE_UBRELAXED:
+      assert(!consdata->watched);
       consdata->nfixedzeros--;
       break;
    case SCIP_EVENTTYPE_VARDELETED:
@@ -9090,7 +9430,8 @@ SCIP_DECL_EVENTEXEC(eventExecSetppc)
 
    if( eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED )
    {
-      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1 )
+      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1
+         || (consdata->watched && eventtype == SCIP_EVENTTYPE_UBTIGHTENED) )
       {
          consdata->presolpropagated = FALSE;
          SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
@@ -9290,6 +9631,7 @@ SCIP_RETCODE SCIPincludeConshdlrSetppc(
    SCIP_CALL( SCIPsetConshdlrPrint(scip, conshdlr, consPrintSetppc) );
    SCIP_CALL( SCIPsetConshdlrProp(scip, conshdlr, consPropSetppc, CONSHDLR_PROPFREQ, CONSHDLR_DELAYPROP,
          CONSHDLR_PROP_TIMING) );
+   SCIPconshdlrSetPropWorklist(conshdlr, TRUE);
    SCIP_CALL( SCIPsetConshdlrResprop(scip, conshdlr, consRespropSetppc) );
    SCIP_CALL( SCIPsetConshdlrSepa(scip, conshdlr, consSepalpSetppc, consSepasolSetppc, CONSHDLR_SEPAFREQ,
          CONSHDLR_SEPAPRIORITY, CONSHDLR_DELAYSEPA) );
@@ -9340,6 +9682,10 @@ SCIP_RETCODE SCIPincludeConshdlrSetppc(
          "constraints/" CONSHDLR_NAME "/cliqueshrinking",
          "should we try to shrink the number of variables in a clique constraints, by replacing more than one variable by only one",
          &conshdlrdata->cliqueshrinking, TRUE, DEFAULT_CLIQUESHRINKING, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "constraints/" CONSHDLR_NAME "/watchedvars",
+         "should fixings to zero be detected by two watched variables during the solving process instead of catching the upper bound events of all variables?",
+         &conshdlrdata->watchedvars, TRUE, DEFAULT_WATCHEDVARS, NULL, NULL) );
 
    return SCIP_OKAY;
 }
@@ -9730,6 +10076,21 @@ int SCIPgetNFixedzerosSetppc(
    consdata = SCIPconsGetData(cons);
    assert(consdata != NULL);
 
+   /* in watched mode, the fixings to zero are not counted */
+   if( consdata->watched )
+   {
+      int nfixedzeros = 0;
+      int v;
+
+      for( v = 0; v < consdata->nvars; ++v )
+      {
+         if( SCIPvarGetUbLocal(consdata->vars[v]) < 0.5 )
+            ++nfixedzeros;
+      }
+
+      return nfixedzeros;
+   }
+
    return consdata->nfixedzeros;
 }
 
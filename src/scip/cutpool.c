@@ -47,8 +47,13 @@
 #include "scip/cutpool.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
+#include "scip/scip_solve.h"
 
 #include "scip/struct_cutpool.h"
+#include "tpi/tpi.h"
+#include "tpi/def_openmp.h"
+
+#define CUTPOOL_JOBMINROWS   2000            /**< minimal number of cuts whose efficacies are computed by one parallel job */
 
 
 
@@ -419,6 +424,138 @@ SCIP_Real SCIPcutGetLPActivityQuot(
    return (nlpsaftercreation > 0 ? activeinlpcounter / (SCIP_Real)nlpsaftercreation : 0.0);
 }
 
+/*
+ * Parallel computation of efficacies
+ */
+
+/** data of a job computing the LP efficacies of a range of cuts */
+struct EfficacyJob
+{
+   SCIP_ROW**            rows;               /**< rows of the cuts */
+   SCIP_Real*            efficacies;         /**< array to store the efficacies of the rows */
+   int                   nrows;              /**< number of rows */
+   SCIP_SET*             set;                /**< global SCIP settings */
+   SCIP_STAT*            stat;               /**< problem statistics data */
+   SCIP_LP*              lp;                 /**< current LP data */
+};
+typedef struct EfficacyJob EFFICACYJOB;
+
+/** job function computing the LP efficacies of a range of cuts; each row belongs to one job only */
+static
+SCIP_RETCODE execEfficacyJob(
+   void*                 args                /**< the job data */
+   )
+{
+   EFFICACYJOB* job;
+
+   job = (EFFICACYJOB*) args;
+   assert(job != NULL);
+
+   SCIProwsGetLPEfficacies(job->rows, job->nrows, job->set, job->stat, job->lp, job->efficacies);
+
+   return SCIP_OKAY;
+}
+
+/** returns whether the LP efficacies of the cuts are computed in parallel through the task processing interface
+ *
+ *  The efficacies are computed sequentially if no thread pool is available, see SCIPacquireTPI().
+ */
+static
+SCIP_RETCODE cutpoolUseTPI(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Bool*            usetpi              /**< pointer to store whether the efficacies are computed in parallel */
+   )
+{
+   assert(cutpool != NULL);
+   assert(set != NULL);
+   assert(usetpi != NULL);
+
+   *usetpi = FALSE;
+
+   if( set->sepa_poolnthreads <= 1 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPacquireTPI(set->scip, usetpi) );
+
+   return SCIP_OKAY;
+}
+
+/** computes the LP efficacies of the given rows in parallel
+ *
+ *  The rows are split into one consecutive range per thread given by separating/poolnthreads with at least
+ *  CUTPOOL_JOBMINROWS rows each. The jobs only update the cached activities of their own rows, so that the results are
+ *  identical to the sequential computation.
+ */
+static
+SCIP_RETCODE computeLPEfficaciesParallel(
+   SCIP_ROW**            rows,               /**< rows of the cuts */
+   int                   nrows,              /**< number of rows */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_Real*            efficacies          /**< array to store the efficacies of the rows */
+   )
+{
+   EFFICACYJOB* jobs;
+   SCIP_RETCODE retcode;
+   int jobsize;
+   int njobs;
+   int jobid;
+   int j;
+
+   njobs = MIN(set->sepa_poolnthreads, nrows / CUTPOOL_JOBMINROWS);
+   if( njobs <= 1 )
+   {
+      SCIProwsGetLPEfficacies(rows, nrows, set, stat, lp, efficacies);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &jobs, njobs) );
+
+   jobsize = (nrows + njobs - 1) / njobs;
+   for( j = 0; j < njobs; ++j )
+   {
+      int first;
+
+      first = j * jobsize;
+      jobs[j].rows = &rows[first];
+      jobs[j].efficacies = &efficacies[first];
+      jobs[j].nrows = MIN(jobsize, nrows - first);
+      jobs[j].set = set;
+      jobs[j].stat = stat;
+      jobs[j].lp = lp;
+   }
+
+   jobid = SCIPtpiGetNewJobID();
+
+   TPI_PARA
+   {
+      TPI_SINGLE
+      {
+         for( j = 0; j < njobs; ++j )
+         {
+            /* cppcheck-suppress unassignedVariable */
+            SCIP_JOB* job;
+            SCIP_SUBMITSTATUS status;
+
+            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execEfficacyJob, (void*) &jobs[j]) );
+            SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+            assert(status == SCIP_SUBMIT_SUCCESS);
+         }
+      }
+   }
+
+   /* the smallest return code of all jobs is returned */
+   retcode = SCIPtpiProcessAndCollectJobs(jobid);
+
+   SCIPsetFreeBufferArray(set, &jobs);
+
+   return retcode;
+}
+
+
 /*
  * Cutpool methods
  */
@@ -848,10 +985,16 @@ SCIP_RETCODE SCIPcutpoolSeparate(
    )
 {
    SCIP_CUT* cut;
+   SCIP_ROW** batchrows;
+   SCIP_Real* batchefficacies;
    SCIP_Bool found;
    SCIP_Bool cutoff;
    SCIP_Real minefficacy;
    SCIP_Bool retest;
+   SCIP_Bool usetpi;
+   int* batchidx;
+   int nbatchpos;
+   int nbatchrows;
    int firstunproc;
    int oldncutsadded;
    int oldncutsfound;
@@ -920,6 +1063,54 @@ SCIP_RETCODE SCIPcutpoolSeparate(
    oldncutsadded = SCIPsepastoreGetNCutsAdded(sepastore);
    nefficaciouscuts = 0;
 
+   /* compute the efficacies w.r.t. the given solution of all cuts to be tested in one batch, such that the solution
+    * value of each variable is looked up only once and not once per cut it appears in; the efficacies w.r.t. the LP
+    * solution are computed in one batch if they are computed in parallel
+    */
+   batchrows = NULL;
+   batchefficacies = NULL;
+   batchidx = NULL;
+   nbatchpos = 0;
+   nbatchrows = 0;
+   usetpi = FALSE;
+   if( sol == NULL && cutpool->ncuts - firstunproc >= 2 * CUTPOOL_JOBMINROWS )
+   {
+      SCIP_CALL( cutpoolUseTPI(cutpool, set, &usetpi) );
+   }
+
+   if( (sol != NULL && cutpool->ncuts - firstunproc > 1) || usetpi )
+   {
+      nbatchpos = cutpool->ncuts - firstunproc;
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &batchidx, nbatchpos) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &batchrows, nbatchpos) );
+
+      for( c = 0; c < nbatchpos; ++c )
+      {
+         SCIP_ROW* row;
+
+         cut = cutpool->cuts[firstunproc + c];
+         row = cut->row;
+         batchidx[c] = -1;
+
+         if( (retest || (sol == NULL ? cut->processedlp : cut->processedlpsol) < stat->lpcount) && !SCIProwIsInLP(row)
+            && (SCIProwIsModifiable(row) || SCIProwGetNNonz(row) != 1) )
+         {
+            batchidx[c] = nbatchrows;
+            batchrows[nbatchrows++] = row;
+         }
+      }
+
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &batchefficacies, MAX(nbatchrows, 1)) );
+      if( sol == NULL )
+      {
+         SCIP_CALL( computeLPEfficaciesParallel(batchrows, nbatchrows, set, stat, lp, batchefficacies) );
+      }
+      else
+      {
+         SCIP_CALL( SCIProwsGetSolEfficacies(batchrows, nbatchrows, set, stat, sol, batchefficacies) );
+      }
+   }
+
    /* process all unprocessed cuts in the pool */
    cutoff = FALSE;
    for( c = firstunproc; c < cutpool->ncuts; ++c )
@@ -966,7 +1157,14 @@ SCIP_RETCODE SCIPcutpoolSeparate(
                continue;
             }
 
-            efficacy = sol == NULL ? SCIProwGetLPEfficacy(row, set, stat, lp) : SCIProwGetSolEfficacy(row, set, stat, sol);
+            /* cuts may have been moved by deletions, so only use the batch efficacy if the row still matches */
+            if( c - firstunproc < nbatchpos && batchidx[c - firstunproc] >= 0
+               && batchrows[batchidx[c - firstunproc]] == row )
+               efficacy = batchefficacies[batchidx[c - firstunproc]];
+            else if( sol == NULL )
+               efficacy = SCIProwGetLPEfficacy(row, set, stat, lp);
+            else
+               efficacy = SCIProwGetSolEfficacy(row, set, stat, sol);
             if( SCIPsetIsFeasPositive(set, efficacy) )
                ++nefficaciouscuts;
 
@@ -1016,6 +1214,13 @@ SCIP_RETCODE SCIPcutpoolSeparate(
       }
    }
 
+   if( batchidx != NULL )
+   {
+      SCIPsetFreeBufferArray(set, &batchefficacies);
+      SCIPsetFreeBufferArray(set, &batchrows);
+      SCIPsetFreeBufferArray(set, &batchidx);
+   }
+
    if ( sol == NULL )
    {
       cutpool->processedlp = stat->lpcount;
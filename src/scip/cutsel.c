@@ -32,12 +32,16 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include <assert.h>
+#include <limits.h>
 
 #include "scip/set.h"
 #include "scip/clock.h"
 #include "scip/paramset.h"
 #include "scip/scip.h"
 #include "scip/cutsel.h"
+#include "scip/pub_lp.h"
+#include "scip/pub_misc_sort.h"
+#include "scip/pub_var.h"
 
 #include "scip/struct_cutsel.h"
 
@@ -656,3 +660,196 @@ SCIP_DECL_SORTPTRCOMP(SCIPcutselComp)
 {  /*lint --e{715}*/
    return ((SCIP_CUTSEL*)elem2)->priority - ((SCIP_CUTSEL*)elem1)->priority;
 }
+
+/** creates the column index of the given cuts */
+SCIP_RETCODE SCIPcutselindexCreate(
+   SCIP_CUTSELINDEX**    cutselindex,        /**< pointer to store the column index */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_ROW**            cuts,               /**< array with cuts */
+   int                   ncuts,              /**< number of cuts */
+   int                   nvars               /**< number of problem variables */
+   )
+{
+   SCIP_CUTSELINDEX* index;
+   int nnonz;
+   int c;
+   int i;
+
+   assert(cutselindex != NULL);
+   assert(blkmem != NULL);
+   assert(cuts != NULL || ncuts == 0);
+   assert(ncuts >= 0);
+   assert(nvars >= 0);
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, cutselindex) );
+   index = *cutselindex;
+
+   index->ncuts = ncuts;
+   index->nvars = nvars;
+   index->curmark = 0;
+
+   SCIP_ALLOC( BMSallocClearBlockMemoryArray(blkmem, &index->colbeg, nvars + 1) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &index->cutpos, ncuts) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &index->poscut, ncuts) );
+   SCIP_ALLOC( BMSallocClearBlockMemoryArray(blkmem, &index->marks, ncuts) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &index->cands, ncuts) );
+
+   /* count the cuts of each variable */
+   nnonz = 0;
+   for( c = 0; c < ncuts; ++c )
+   {
+      SCIP_COL** cols;
+      int len;
+
+      index->cutpos[c] = c;
+      index->poscut[c] = c;
+
+      cols = SCIProwGetCols(cuts[c]);
+      len = SCIProwGetNNonz(cuts[c]);
+      for( i = 0; i < len; ++i )
+      {
+         int probindex;
+
+         probindex = SCIPvarGetProbindex(SCIPcolGetVar(cols[i]));
+         assert(0 <= probindex && probindex < nvars);
+         ++index->colbeg[probindex + 1];
+      }
+      nnonz += len;
+   }
+
+   for( i = 0; i < nvars; ++i )
+      index->colbeg[i + 1] += index->colbeg[i];
+   assert(index->colbeg[nvars] == nnonz);
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &index->colcuts, MAX(nnonz, 1)) );
+
+   /* fill the cuts of each variable, using colbeg as insertion position and shifting it back afterwards */
+   for( c = 0; c < ncuts; ++c )
+   {
+      SCIP_COL** cols;
+      int len;
+
+      cols = SCIProwGetCols(cuts[c]);
+      len = SCIProwGetNNonz(cuts[c]);
+      for( i = 0; i < len; ++i )
+         index->colcuts[index->colbeg[SCIPvarGetProbindex(SCIPcolGetVar(cols[i]))]++] = c;
+   }
+
+   for( i = nvars; i > 0; --i )
+      index->colbeg[i] = index->colbeg[i - 1];
+   index->colbeg[0] = 0;
+
+   return SCIP_OKAY;
+}
+
+/** frees the column index of cuts */
+void SCIPcutselindexFree(
+   SCIP_CUTSELINDEX**    cutselindex,        /**< pointer to the column index */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   SCIP_CUTSELINDEX* index;
+
+   assert(cutselindex != NULL);
+   assert(*cutselindex != NULL);
+
+   index = *cutselindex;
+
+   BMSfreeBlockMemoryArray(blkmem, &index->colcuts, MAX(index->colbeg[index->nvars], 1));
+   BMSfreeBlockMemoryArray(blkmem, &index->cands, index->ncuts);
+   BMSfreeBlockMemoryArray(blkmem, &index->marks, index->ncuts);
+   BMSfreeBlockMemoryArray(blkmem, &index->poscut, index->ncuts);
+   BMSfreeBlockMemoryArray(blkmem, &index->cutpos, index->ncuts);
+   BMSfreeBlockMemoryArray(blkmem, &index->colbeg, index->nvars + 1);
+   BMSfreeBlockMemory(blkmem, cutselindex);
+}
+
+/** records that the cuts at the given positions of the cuts array were swapped */
+void SCIPcutselindexSwap(
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of cuts */
+   int                   pos1,               /**< first position */
+   int                   pos2                /**< second position */
+   )
+{
+   int cut1;
+   int cut2;
+
+   assert(cutselindex != NULL);
+   assert(0 <= pos1 && pos1 < cutselindex->ncuts);
+   assert(0 <= pos2 && pos2 < cutselindex->ncuts);
+
+   cut1 = cutselindex->poscut[pos1];
+   cut2 = cutselindex->poscut[pos2];
+
+   cutselindex->poscut[pos1] = cut2;
+   cutselindex->poscut[pos2] = cut1;
+   cutselindex->cutpos[cut1] = pos2;
+   cutselindex->cutpos[cut2] = pos1;
+}
+
+/** gets the positions of the cuts that share at least one column with the given cut
+ *
+ *  Only positions in the range [firstpos, firstpos + npos) are considered. The positions are returned relative to
+ *  firstpos in decreasing order. All other cuts of the range have a scalar product of zero with the given cut, so that
+ *  their parallelism to the cut is zero.
+ *
+ *  @note The returned array is owned by the index and is overwritten by the next call.
+ */
+void SCIPcutselindexGetCands(
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of cuts */
+   SCIP_ROW*             cut,                /**< cut to find the candidates for */
+   int                   firstpos,           /**< first position of the range */
+   int                   npos,               /**< number of positions of the range */
+   int**                 cands,              /**< pointer to store the positions of the candidates */
+   int*                  ncands              /**< pointer to store the number of candidates */
+   )
+{
+   SCIP_COL** cols;
+   int len;
+   int i;
+
+   assert(cutselindex != NULL);
+   assert(cut != NULL);
+   assert(0 <= firstpos && npos >= 0 && firstpos + npos <= cutselindex->ncuts);
+   assert(cands != NULL);
+   assert(ncands != NULL);
+
+   *cands = cutselindex->cands;
+   *ncands = 0;
+
+   /* restart the marks before the counter overflows */
+   if( cutselindex->curmark == INT_MAX )
+   {
+      BMSclearMemoryArray(cutselindex->marks, cutselindex->ncuts);
+      cutselindex->curmark = 0;
+   }
+   ++cutselindex->curmark;
+
+   cols = SCIProwGetCols(cut);
+   len = SCIProwGetNNonz(cut);
+   for( i = 0; i < len; ++i )
+   {
+      int probindex;
+      int j;
+
+      probindex = SCIPvarGetProbindex(SCIPcolGetVar(cols[i]));
+      assert(0 <= probindex && probindex < cutselindex->nvars);
+
+      for( j = cutselindex->colbeg[probindex]; j < cutselindex->colbeg[probindex + 1]; ++j )
+      {
+         int c;
+         int pos;
+
+         c = cutselindex->colcuts[j];
+         if( cutselindex->marks[c] == cutselindex->curmark )
+            continue;
+         cutselindex->marks[c] = cutselindex->curmark;
+
+         pos = cutselindex->cutpos[c] - firstpos;
+         if( 0 <= pos && pos < npos )
+            cutselindex->cands[(*ncands)++] = pos;
+      }
+   }
+
+   SCIPsortDownInt(cutselindex->cands, *ncands);
+}
@@ -162,6 +162,21 @@ void SCIPcutselSetPriority(
    int                   priority            /**< new priority of the cut selector */
    );
 
+/** creates the column index of the given cuts */
+SCIP_RETCODE SCIPcutselindexCreate(
+   SCIP_CUTSELINDEX**    cutselindex,        /**< pointer to store the column index */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_ROW**            cuts,               /**< array with cuts */
+   int                   ncuts,              /**< number of cuts */
+   int                   nvars               /**< number of problem variables */
+   );
+
+/** frees the column index of cuts */
+void SCIPcutselindexFree(
+   SCIP_CUTSELINDEX**    cutselindex,        /**< pointer to the column index */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -331,7 +331,9 @@ static
 void selectBestCut(
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
-   int                   ncuts               /**< number of cuts in given array */
+   int                   ncuts,              /**< number of cuts in given array */
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of the cuts, or NULL */
+   int                   offset              /**< position of the given array in the array of the column index */
 )
 {
    int bestpos;
@@ -355,27 +357,40 @@ void selectBestCut(
 
    SCIPswapPointers((void**) &cuts[bestpos], (void**) &cuts[0]);
    SCIPswapReals(&scores[bestpos], &scores[0]);
+   if( cutselindex != NULL )
+      SCIPcutselindexSwap(cutselindex, offset + bestpos, offset);
 }
 
 /** filters the given array of cuts to enforce a maximum parallelism constraint
- *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
+ *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts
+ *
+ *  Only the cuts that share a column with the given cut are compared; all other cuts have parallelism zero.
+ */
 static
 int filterWithParallelism(
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
    int                   ncuts,              /**< number of cuts in given array */
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of the cuts */
+   int                   offset,             /**< position of the given array in the array of the column index */
    SCIP_Real             maxparallel         /**< maximal parallelism for all cuts that are not good */
 )
 {
+   int* cands;
+   int ncands;
 
    assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( maxparallel >= 0.0 );
 
-   for( int i = ncuts - 1; i >= 0; --i )
+   SCIPcutselindexGetCands(cutselindex, cut, offset, ncuts, &cands, &ncands);
+
+   for( int c = 0; c < ncands; ++c )
    {
       SCIP_Real thisparallel;
+      int i = cands[c];
 
       thisparallel = SCIProwGetParallelism(cut, cuts[i], 'e');
 
@@ -384,13 +399,17 @@ int filterWithParallelism(
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
          SCIPswapReals(&scores[i], &scores[ncuts]);
+         SCIPcutselindexSwap(cutselindex, offset + i, offset + ncuts);
       }
    }
 
    return ncuts;
 }
 
-/** penalises any cut too parallel to cut by reducing the parallel cut's score. */
+/** penalises any cut too parallel to cut by reducing the parallel cut's score.
+ *
+ *  Only the cuts that share a column with the given cut are compared; all other cuts have parallelism zero.
+ */
 static
 int penaliseWithParallelism(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -398,18 +417,26 @@ int penaliseWithParallelism(
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
    int                   ncuts,              /**< number of cuts in given array */
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of the cuts */
+   int                   offset,             /**< position of the given array in the array of the column index */
    SCIP_Real             maxparallel,        /**< maximal parallelism for all cuts that are not good */
    SCIP_Real             paralpenalty        /**< penalty for weaker of two parallel cuts if penalising parallel cuts */
 )
 {
+   int* cands;
+   int ncands;
 
    assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( maxparallel >= 0.0 );
 
-   for( int i = ncuts - 1; i >= 0; --i )
+   SCIPcutselindexGetCands(cutselindex, cut, offset, ncuts, &cands, &ncands);
+
+   for( int c = 0; c < ncands; ++c )
    {
       SCIP_Real thisparallel;
+      int i = cands[c];
 
       thisparallel = SCIProwGetParallelism(cut, cuts[i], 'e');
 
@@ -419,6 +446,7 @@ int penaliseWithParallelism(
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
          SCIPswapReals(&scores[i], &scores[ncuts]);
+         SCIPcutselindexSwap(cutselindex, offset + i, offset + ncuts);
       }
       else if( thisparallel > maxparallel )
       {
@@ -436,7 +464,9 @@ int filterWithDensity(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real             maxdensity,         /**< maximum density s.t. a cut is not filtered */
-   int                   ncuts               /**< number of cuts in given array */
+   int                   ncuts,              /**< number of cuts in given array */
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of the cuts, or NULL */
+   int                   offset              /**< position of the given array in the array of the column index */
 )
 {
    SCIP_Real ncols;
@@ -455,6 +485,8 @@ int filterWithDensity(
       {
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
+         if( cutselindex != NULL )
+            SCIPcutselindexSwap(cutselindex, offset + i, offset + ncuts);
       }
    }
 
@@ -729,6 +761,7 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
    int*                  nselectedcuts       /**< pointer to return number of selected cuts from cuts array */
 )
 {
+   SCIP_CUTSELINDEX* cutselindex = NULL;
    SCIP_Real* scores;
    SCIP_Real* origscoresptr;
    SCIP_Real nonzerobudget;
@@ -745,7 +778,7 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
    /* filter dense cuts */
    if( cutseldata->filterdensecuts )
    {
-      ncuts = filterWithDensity(scip, cuts, cutseldata->maxcutdensity, ncuts);
+      ncuts = filterWithDensity(scip, cuts, cutseldata->maxcutdensity, ncuts, NULL, 0);
       if( ncuts == 0 )
          return SCIP_OKAY;
    }
@@ -759,13 +792,20 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
 
    /* perform cut selection algorithm for the cuts */
 
+   /* index the columns of the cuts, so that only cuts sharing a column are compared for parallelism */
+   if( cutseldata->filterparalcuts || cutseldata->penaliseparalcuts )
+   {
+      SCIP_CALL( SCIPcreateCutselIndex(scip, &cutselindex, cuts, ncuts) );
+   }
+
    /* forced cuts are going to be selected so use them to filter cuts */
    for( int i = 0; i < nforcedcuts && ncuts > 0; ++i )
    {
       if( cutseldata->filterparalcuts )
-         ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, cutseldata->maxparal);
+         ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, cutselindex, 0, cutseldata->maxparal);
       else if( cutseldata->penaliseparalcuts )
-         ncuts = penaliseWithParallelism(scip, forcedcuts[i], cuts, scores, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
+         ncuts = penaliseWithParallelism(scip, forcedcuts[i], cuts, scores, ncuts, cutselindex, 0, cutseldata->maxparal,
+               cutseldata->paralpenalty);
    }
 
    /* Get the budget depending on if we are the root or not */
@@ -776,7 +816,7 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
    {
       SCIP_ROW* selectedcut;
 
-      selectBestCut(cuts, scores, ncuts);
+      selectBestCut(cuts, scores, ncuts, cutselindex, *nselectedcuts);
       selectedcut = cuts[0];
 
       /* if the best cut of the remaining cuts is considered bad, we discard it and all remaining cuts */
@@ -798,16 +838,19 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
       --ncuts;
 
       if( cutseldata->filterparalcuts && ncuts > 0)
-         ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, cutseldata->maxparal);
+         ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, cutselindex, *nselectedcuts, cutseldata->maxparal);
       else if( cutseldata->penaliseparalcuts && ncuts > 0 )
-         ncuts = penaliseWithParallelism(scip, selectedcut, cuts, scores, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
+         ncuts = penaliseWithParallelism(scip, selectedcut, cuts, scores, ncuts, cutselindex, *nselectedcuts,
+               cutseldata->maxparal, cutseldata->paralpenalty);
 
       /* Filter out all remaining cuts that would go over the non-zero budget threshold */
       if( nonzerobudget - budgettaken < 1 && ncuts > 0 )
-         ncuts = filterWithDensity(scip, cuts, nonzerobudget - budgettaken, ncuts);
+         ncuts = filterWithDensity(scip, cuts, nonzerobudget - budgettaken, ncuts, cutselindex, *nselectedcuts);
 
    }
 
+   if( cutselindex != NULL )
+      SCIPfreeCutselIndex(scip, &cutselindex);
    SCIPfreeBufferArray(scip, &origscoresptr);
 
    return SCIP_OKAY;
@@ -201,7 +201,9 @@ static
 void selectBestCut(
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
-   int                   ncuts               /**< number of cuts in given array */
+   int                   ncuts,              /**< number of cuts in given array */
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of the cuts */
+   int                   offset              /**< position of the given array in the array of the column index */
    )
 {
    int i;
@@ -226,31 +228,47 @@ void selectBestCut(
 
    SCIPswapPointers((void**) &cuts[bestpos], (void**) &cuts[0]);
    SCIPswapReals(&scores[bestpos], &scores[0]);
+   SCIPcutselindexSwap(cutselindex, offset + bestpos, offset);
 }
 
 /** filters the given array of cuts to enforce a maximum parallelism constraint
- *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
+ *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts
+ *
+ *  Only the cuts that share a column with the given cut are compared; all other cuts have parallelism zero. They are
+ *  visited in the same order as by a scan from the back of the array, so the result is the same.
+ */
 static
 int filterWithParallelism(
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
    int                   ncuts,              /**< number of cuts in given array */
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of the cuts */
+   int                   offset,             /**< position of the given array in the array of the column index */
    SCIP_Real             goodscore,          /**< threshold for the score to be considered a good cut */
    SCIP_Real             goodmaxparall,      /**< maximal parallelism for good cuts */
    SCIP_Real             maxparall           /**< maximal parallelism for all cuts that are not good */
    )
 {
-   int i;
+   int* cands;
+   int ncands;
+   int c;
 
    assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( goodmaxparall >= 0.0 && maxparall >= 0.0 );
 
-   for( i = ncuts - 1; i >= 0; --i )
+   SCIPcutselindexGetCands(cutselindex, cut, offset, ncuts, &cands, &ncands);
+
+   for( c = 0; c < ncands; ++c )
    {
       SCIP_Real thisparall;
       SCIP_Real thismaxparall;
+      int i;
+
+      i = cands[c];
+      assert(i < ncuts);
 
       thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
       thismaxparall = scores[i] >= goodscore ? goodmaxparall : maxparall;
@@ -260,6 +278,7 @@ int filterWithParallelism(
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
          SCIPswapReals(&scores[i], &scores[ncuts]);
+         SCIPcutselindexSwap(cutselindex, offset + i, offset + ncuts);
       }
    }
 
@@ -456,6 +475,7 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    int*                  nselectedcuts       /**< pointer to return number of selected cuts from cuts array */
    )
 {
+   SCIP_CUTSELINDEX* cutselindex;
    SCIP_Real* scores;
    SCIP_Real* scoresptr;
    SCIP_Real maxforcedscores;
@@ -484,10 +504,13 @@ SCIP_RETCODE SCIPselectCutsHybrid(
 
    /* perform cut selection algorithm for the cuts */
 
+   /* index the columns of the cuts, so that only cuts sharing a column are compared when filtering */
+   SCIP_CALL( SCIPcreateCutselIndex(scip, &cutselindex, cuts, ncuts) );
+
    /* forced cuts are going to be selected so use them to filter cuts */
    for( i = 0; i < nforcedcuts && ncuts > 0; ++i )
    {
-      ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, cutselindex, 0, goodscore, goodmaxparall, maxparall);
    }
 
    /* now greedily select the remaining cuts */
@@ -496,7 +519,7 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    {
       SCIP_ROW* selectedcut;
 
-      selectBestCut(cuts, scores, ncuts);
+      selectBestCut(cuts, scores, ncuts, cutselindex, *nselectedcuts);
       selectedcut = cuts[0];
 
       /* if the best cut of the remaining cuts is considered bad, we discard it and all remaining cuts */
@@ -514,9 +537,11 @@ SCIP_RETCODE SCIPselectCutsHybrid(
       ++scores;
       --ncuts;
 
-      ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, cutselindex, *nselectedcuts, goodscore,
+            goodmaxparall, maxparall);
    }
 
+   SCIPfreeCutselIndex(scip, &cutselindex);
    SCIPfreeBufferArray(scip, &scoresptr);
 
    return SCIP_OKAY;
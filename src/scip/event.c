@@ -145,6 +145,110 @@ SCIP_RETCODE SCIPeventhdlrCreate(
    return SCIP_OKAY;
 }
 
+/** appends a local bound change event to the batch of the event handler */
+static
+SCIP_RETCODE eventhdlrAddToBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EVENT*           event,              /**< bound change event */
+   SCIP_EVENTDATA*       eventdata           /**< user data for the issued event */
+   )
+{
+   int pos;
+
+   assert(eventhdlr != NULL);
+   assert(eventhdlr->batching);
+   assert(eventhdlr->eventexecbatch != NULL);
+   assert(event != NULL);
+   assert((event->eventtype & SCIP_EVENTTYPE_BOUNDCHANGED) != 0);
+
+   if( eventhdlr->nbatch == eventhdlr->batchsize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, eventhdlr->nbatch + 1);
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batchvars, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batcholdbounds, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batchnewbounds, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batcheventtypes, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batcheventdatas, newsize) );
+      eventhdlr->batchsize = newsize;
+   }
+
+   pos = eventhdlr->nbatch;
+   eventhdlr->batchvars[pos] = event->data.eventbdchg.var;
+   eventhdlr->batcholdbounds[pos] = event->data.eventbdchg.oldbound;
+   eventhdlr->batchnewbounds[pos] = event->data.eventbdchg.newbound;
+   eventhdlr->batcheventtypes[pos] = event->eventtype;
+   eventhdlr->batcheventdatas[pos] = eventdata;
+   ++eventhdlr->nbatch;
+
+   return SCIP_OKAY;
+}
+
+/** removes the bound changes of the given event filter and event data from the batch of the event handler */
+static
+void eventhdlrRemoveFromBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_EVENTFILTER*     eventfilter,        /**< event filter of the variable whose events are dropped */
+   SCIP_EVENTDATA*       eventdata           /**< event data of the dropped events */
+   )
+{
+   int nbatch;
+   int i;
+
+   assert(eventhdlr != NULL);
+
+   nbatch = 0;
+   for( i = 0; i < eventhdlr->nbatch; ++i )
+   {
+      if( eventhdlr->batcheventdatas[i] == eventdata && eventhdlr->batchvars[i]->eventfilter == eventfilter )
+         continue;
+
+      eventhdlr->batchvars[nbatch] = eventhdlr->batchvars[i];
+      eventhdlr->batcholdbounds[nbatch] = eventhdlr->batcholdbounds[i];
+      eventhdlr->batchnewbounds[nbatch] = eventhdlr->batchnewbounds[i];
+      eventhdlr->batcheventtypes[nbatch] = eventhdlr->batcheventtypes[i];
+      eventhdlr->batcheventdatas[nbatch] = eventhdlr->batcheventdatas[i];
+      ++nbatch;
+   }
+   eventhdlr->nbatch = nbatch;
+}
+
+/** passes the collected bound changes to the batched execution method of the event handler and clears the batch */
+static
+SCIP_RETCODE eventhdlrExecBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   assert(eventhdlr != NULL);
+   assert(eventhdlr->eventexecbatch != NULL);
+   assert(!eventhdlr->batching);
+
+   if( eventhdlr->nbatch == 0 )
+      return SCIP_OKAY;
+
+   SCIPsetDebugMsg(set, "execute batch of %d bound changes of handler <%s>\n", eventhdlr->nbatch, eventhdlr->name);
+
+#ifdef TIMEEVENTEXEC
+   /* start timing */
+   SCIPclockStart(eventhdlr->eventtime, set);
+#endif
+
+   SCIP_CALL( eventhdlr->eventexecbatch(set->scip, eventhdlr, eventhdlr->batchvars, eventhdlr->batcholdbounds,
+         eventhdlr->batchnewbounds, eventhdlr->batcheventtypes, eventhdlr->batcheventdatas, eventhdlr->nbatch) );
+
+#ifdef TIMEEVENTEXEC
+   /* stop timing */
+   SCIPclockStop(eventhdlr->eventtime, set);
+#endif
+
+   eventhdlr->nbatch = 0;
+
+   return SCIP_OKAY;
+}
+
 /** calls destructor and frees memory of event handler */
 SCIP_RETCODE SCIPeventhdlrFree(
    SCIP_EVENTHDLR**      eventhdlr,          /**< pointer to event handler data structure */
@@ -165,6 +269,14 @@ SCIP_RETCODE SCIPeventhdlrFree(
       SCIP_CALL( (*eventhdlr)->eventfree(set->scip, *eventhdlr) );
    }
 
+   /* free batch of bound changes */
+   assert((*eventhdlr)->nbatch == 0);
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batcheventdatas);
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batcheventtypes);
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batchnewbounds);
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batcholdbounds);
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batchvars);
+
    /* free clocks */
    SCIPclockFree(&(*eventhdlr)->eventtime);
    SCIPclockFree(&(*eventhdlr)->setuptime);
@@ -303,6 +415,13 @@ SCIP_RETCODE SCIPeventhdlrExec(
    assert(set != NULL);
    assert(event != NULL);
 
+   /* local bound changes are collected while the event handler processes them in batches */
+   if( eventhdlr->batching && (event->eventtype & SCIP_EVENTTYPE_BOUNDCHANGED) != 0 )
+   {
+      SCIP_CALL( eventhdlrAddToBatch(eventhdlr, set, event, eventdata) );
+      return SCIP_OKAY;
+   }
+
    SCIPsetDebugMsg(set, "execute event of handler <%s> with event %p of type 0x%" SCIP_EVENTTYPE_FORMAT "\n", eventhdlr->name, (void*)event, event->eventtype);
 
 #ifdef TIMEEVENTEXEC
@@ -428,6 +547,18 @@ void SCIPeventhdlrSetDelete(
    eventhdlr->eventdelete = eventdelete;
 }
 
+/** sets batched execution method of this event handler for local bound changes */
+void SCIPeventhdlrSetExecBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method for local bound changes */
+   )
+{
+   assert(eventhdlr != NULL);
+   assert(!eventhdlr->batching);
+
+   eventhdlr->eventexecbatch = eventexecbatch;
+}
+
 /** is event handler initialized? */
 SCIP_Bool SCIPeventhdlrIsInitialized(
    SCIP_EVENTHDLR*       eventhdlr           /**< event handler */
@@ -2008,6 +2139,10 @@ SCIP_RETCODE SCIPeventfilterDel(
    assert(eventfilter->eventdata[filterpos] == eventdata);
    assert(eventfilter->nextpos[filterpos] == -2);
 
+   /* bound changes collected for the dropped event data must not be passed to the event handler anymore */
+   if( eventhdlr->nbatch > 0 && (eventtype & SCIP_EVENTTYPE_BOUNDCHANGED) != 0 )
+      eventhdlrRemoveFromBatch(eventhdlr, eventfilter, eventdata);
+
    /* if updates are delayed, insert entry into the list of delayed deletions;
     * otherwise, delete the entry from the filter directly and add the slot to the free list
     */
@@ -2511,6 +2646,16 @@ SCIP_RETCODE SCIPeventqueueProcess(
 
    SCIPsetDebugMsg(set, "processing %d queued events\n", eventqueue->nevents);
 
+   /* collect the local bound changes for event handlers that process them in batches */
+   for( i = 0; i < set->neventhdlrs; ++i )
+   {
+      if( set->eventhdlrs[i]->eventexecbatch != NULL )
+      {
+         assert(set->eventhdlrs[i]->nbatch == 0);
+         set->eventhdlrs[i]->batching = TRUE;
+      }
+   }
+
    /* pass events to the responsible event filters
     * During event processing, new events may be raised. We have to loop to the mutable eventqueue->nevents.
     * A loop to something like "nevents = eventqueue->nevents; for(...; i < nevents; ...)" would miss the
@@ -2561,6 +2706,16 @@ SCIP_RETCODE SCIPeventqueueProcess(
    eventqueue->nevents = 0;
    eventqueue->delayevents = FALSE;
 
+   /* pass the collected bound changes; events raised from now on are processed immediately */
+   for( i = 0; i < set->neventhdlrs; ++i )
+   {
+      if( set->eventhdlrs[i]->eventexecbatch != NULL )
+      {
+         set->eventhdlrs[i]->batching = FALSE;
+         SCIP_CALL( eventhdlrExecBatch(set->eventhdlrs[i], set) );
+      }
+   }
+
    return SCIP_OKAY;
 }
 
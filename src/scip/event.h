@@ -166,6 +166,12 @@ void SCIPeventhdlrSetDelete(
    SCIP_DECL_EVENTDELETE ((*eventdelete))    /**< callback to free specific event data */
    );
 
+/** sets batched execution method of this event handler for local bound changes */
+void SCIPeventhdlrSetExecBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method for local bound changes */
+   );
+
 /** enables or disables all clocks of \p eventhdlr, depending on the value of the flag */
 void SCIPeventhdlrEnableOrDisableClocks(
    SCIP_EVENTHDLR*       eventhdlr,          /**< the event handler for which all clocks should be enabled or disabled */
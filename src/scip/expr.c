@@ -80,6 +80,7 @@ SCIP_RETCODE freeExpr(
    assert(*expr != NULL);
    assert((*expr)->nuses == 1);
    assert((*expr)->quaddata == NULL);
+   assert((*expr)->batchdata == NULL);
    assert((*expr)->ownerdata == NULL);
 
    /* free children array, if any */
@@ -266,6 +267,7 @@ SCIP_RETCODE evalAndDiff(
 #undef SCIPexprhdlrSetCompare
 #undef SCIPexprhdlrSetDiff
 #undef SCIPexprhdlrSetIntEval
+#undef SCIPexprhdlrSetEvalBatch
 #undef SCIPexprhdlrSetSimplify
 #undef SCIPexprhdlrSetReverseProp
 #undef SCIPexprhdlrSetEstimate
@@ -278,6 +280,7 @@ SCIP_RETCODE evalAndDiff(
 #undef SCIPexprhdlrHasBwdiff
 #undef SCIPexprhdlrHasFwdiff
 #undef SCIPexprhdlrHasIntEval
+#undef SCIPexprhdlrHasEvalBatch
 #undef SCIPexprhdlrHasEstimate
 #undef SCIPexprhdlrHasInitEstimates
 #undef SCIPexprhdlrHasSimplify
@@ -495,6 +498,17 @@ void SCIPexprhdlrSetIntEval(
    exprhdlr->inteval = inteval;
 }
 
+/** set the batch evaluation callback of an expression handler */
+void SCIPexprhdlrSetEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
+   SCIP_DECL_EXPREVALBATCH((*evalbatch))     /**< batch evaluation callback (can be NULL) */
+   )
+{
+   assert(exprhdlr != NULL);
+
+   exprhdlr->evalbatch = evalbatch;
+}
+
 /** set the simplify callback of an expression handler */
 void SCIPexprhdlrSetSimplify(
    SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
@@ -621,6 +635,16 @@ SCIP_Bool SCIPexprhdlrHasIntEval(
    return exprhdlr->inteval != NULL;
 }
 
+/** returns whether expression handler implements the batch evaluation callback */
+SCIP_Bool SCIPexprhdlrHasEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
+   )
+{
+   assert(exprhdlr != NULL);
+
+   return exprhdlr->evalbatch != NULL;
+}
+
 /** returns whether expression handler implements the estimator callback */
 SCIP_Bool SCIPexprhdlrHasEstimate(
    SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
@@ -1257,6 +1281,96 @@ SCIP_RETCODE SCIPexprhdlrEvalExpr(
    return SCIP_OKAY;
 }
 
+/** calls the batch evaluation callback of an expression handler
+ *
+ * The method evaluates an expression in several points by taking the values of its children in these points into
+ * account. If the expression handler does not implement the batch evaluation callback, the expression is evaluated
+ * point by point via the point evaluation callback.
+ *
+ * @see SCIP_DECL_EXPREVALBATCH
+ */
+SCIP_RETCODE SCIPexprhdlrEvalBatchExpr(
+   SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   npoints,            /**< number of points */
+   SCIP_Real**           childrenvals,       /**< values of children in all points, childrenvals[i][k] is the value of
+                                              *   the i-th child in the k-th point */
+   SCIP_Real*            vals                /**< buffer to store values of expression in all points */
+   )
+{
+   int c;
+   int k;
+
+   assert(exprhdlr != NULL);
+   assert(set != NULL);
+   assert(bufmem != NULL);
+   assert(expr != NULL);
+   assert(expr->exprhdlr == exprhdlr);
+   assert(npoints >= 0);
+   assert(childrenvals != NULL || expr->nchildren == 0);
+   assert(vals != NULL);
+
+   if( exprhdlr->evalbatch != NULL )
+   {
+      SCIP_CALL( exprhdlr->evalbatch(set->scip, expr, npoints, childrenvals, vals) );
+
+      /* disregard points where a child could not be evaluated and catch evaluation errors (e.g., overflow) */
+      for( k = 0; k < npoints; ++k )
+      {
+         if( !SCIPisFinite(vals[k]) )
+            vals[k] = SCIP_INVALID;
+      }
+      for( c = 0; c < expr->nchildren; ++c )
+      {
+         for( k = 0; k < npoints; ++k )
+         {
+            if( childrenvals[c][k] == SCIP_INVALID ) /*lint !e777*/
+               vals[k] = SCIP_INVALID;
+         }
+      }
+
+      return SCIP_OKAY;
+   }
+
+   /* evaluate point by point */
+   if( expr->nchildren == 0 )
+   {
+      for( k = 0; k < npoints; ++k )
+      {
+         SCIP_CALL( SCIPexprhdlrEvalExpr(exprhdlr, set, bufmem, expr, &vals[k], NULL, NULL) );
+      }
+   }
+   else
+   {
+      SCIP_Real* pointvals;
+
+      SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &pointvals, expr->nchildren) );
+
+      for( k = 0; k < npoints; ++k )
+      {
+         for( c = 0; c < expr->nchildren; ++c )
+         {
+            pointvals[c] = childrenvals[c][k];
+            if( pointvals[c] == SCIP_INVALID ) /*lint !e777*/
+               break;
+         }
+
+         if( c < expr->nchildren )
+            vals[k] = SCIP_INVALID;
+         else
+         {
+            SCIP_CALL( SCIPexprhdlrEvalExpr(exprhdlr, set, bufmem, expr, &vals[k], pointvals, NULL) );
+         }
+      }
+
+      BMSfreeBufferMemoryArray(bufmem, &pointvals);
+   }
+
+   return SCIP_OKAY;
+}
+
 /** calls the backward derivative evaluation callback of an expression handler
  *
  * The method should compute the partial derivative of expr w.r.t its child at childidx.
@@ -2104,8 +2218,9 @@ SCIP_RETCODE SCIPexprRelease(
       assert((*rootexpr)->ownerdata == NULL);
    }
 
-   /* free quadratic info */
+   /* free quadratic info and batch evaluation data */
    SCIPexprFreeQuadratic(blkmem, *rootexpr);
+   SCIPexprFreeBatch(blkmem, *rootexpr);
 
    /* free expression data */
    if( (*rootexpr)->exprdata != NULL )
@@ -2153,8 +2268,9 @@ SCIP_RETCODE SCIPexprRelease(
                assert(child->ownerdata == NULL);
             }
 
-            /* free quadratic info */
+            /* free quadratic info and batch evaluation data */
             SCIPexprFreeQuadratic(blkmem, child);
+            SCIPexprFreeBatch(blkmem, child);
 
             /* free expression data */
             if( child->exprdata != NULL )
@@ -3074,6 +3190,348 @@ SCIP_RETCODE SCIPexprEvalActivity(
    return SCIP_OKAY;
 }
 
+/** creates an expression program for an expression
+ *
+ * The program lists all subexpressions of the expression in topological order, that is,
+ * each subexpression appears once and after all its children, with the expression itself last.
+ * The subexpressions are not captured. The program becomes invalid if the expression is freed
+ * or the children of any of its subexpressions are changed.
+ */
+SCIP_RETCODE SCIPexprprogCreate(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRPROG**       prog,               /**< buffer to store expression program */
+   SCIP_EXPR*            rootexpr            /**< expression */
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_EXPRITER_USERDATA iterdata;
+   SCIP_EXPR* expr;
+   int nexprs;
+   int nchildpos;
+   int c;
+
+   assert(blkmem != NULL);
+   assert(stat != NULL);
+   assert(prog != NULL);
+   assert(rootexpr != NULL);
+
+   SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
+
+   /* count the subexpressions and the arcs to their children */
+   nexprs = 0;
+   nchildpos = 0;
+   SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, FALSE) );
+   SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_LEAVEEXPR);
+   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+   {
+      ++nexprs;
+      nchildpos += expr->nchildren;
+   }
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, prog) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*prog)->exprs, nexprs) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*prog)->childbegin, nexprs + 1) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*prog)->childpos, MAX(nchildpos, 1)) );
+   (*prog)->nexprs = nexprs;
+
+   /* with a DFS, an expression is left after all its children have been left, which gives a topological order
+    * the position of each subexpression in the program is stored in the iterator data, so that it is available
+    * when its parents are left
+    */
+   nexprs = 0;
+   nchildpos = 0;
+   SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, FALSE) );
+   SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_LEAVEEXPR);
+   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+   {
+      assert(nexprs < (*prog)->nexprs);
+
+      (*prog)->exprs[nexprs] = expr;
+      (*prog)->childbegin[nexprs] = nchildpos;
+      for( c = 0; c < expr->nchildren; ++c )
+         (*prog)->childpos[nchildpos++] = SCIPexpriterGetExprUserData(it, expr->children[c]).intval;
+
+      iterdata.intval = nexprs++;
+      SCIPexpriterSetCurrentUserData(it, iterdata);
+   }
+   assert(nexprs == (*prog)->nexprs);
+   assert((*prog)->exprs[nexprs-1] == rootexpr);
+   (*prog)->childbegin[nexprs] = nchildpos;
+
+   SCIPexpriterFree(&it);
+
+   return SCIP_OKAY;
+}
+
+/** frees an expression program */
+void SCIPexprprogFree(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPRPROG**       prog                /**< pointer to expression program */
+   )
+{
+   assert(blkmem != NULL);
+   assert(prog != NULL);
+
+   if( *prog == NULL )
+      return;
+
+   BMSfreeBlockMemoryArray(blkmem, &(*prog)->childpos, MAX((*prog)->childbegin[(*prog)->nexprs], 1));
+   BMSfreeBlockMemoryArray(blkmem, &(*prog)->childbegin, (*prog)->nexprs + 1);
+   BMSfreeBlockMemoryArray(blkmem, &(*prog)->exprs, (*prog)->nexprs);
+   BMSfreeBlockMemory(blkmem, prog);
+}
+
+/** gives the expression program of an expression and the positions of its variable expressions in a variables array
+ *
+ * The program is created on the first call and stored in the expression, see SCIPexprFreeBatch().
+ * The positions are only recomputed if the variables differ from those of the previous call.
+ */
+SCIP_RETCODE SCIPexprGetBatch(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            expr,               /**< expression */
+   int                   nvars,              /**< number of variables */
+   SCIP_VAR**            vars,               /**< variables, including all variables of the expression */
+   SCIP_EXPRPROG**       prog,               /**< buffer to store expression program */
+   int**                 varidx              /**< buffer to store position in vars of each variable expression of the
+                                              *   program, -1 for other subexpressions */
+   )
+{
+   SCIP_EXPRBATCH* batchdata;
+   SCIP_HASHMAP* var2idx;
+   SCIP_Bool samevars;
+   int i;
+   int j;
+
+   assert(set != NULL);
+   assert(blkmem != NULL);
+   assert(expr != NULL);
+   assert(nvars >= 0);
+   assert(vars != NULL || nvars == 0);
+   assert(prog != NULL);
+   assert(varidx != NULL);
+
+   if( expr->batchdata == NULL )
+   {
+      SCIP_ALLOC( BMSallocClearBlockMemory(blkmem, &expr->batchdata) );
+      SCIP_CALL( SCIPexprprogCreate(blkmem, stat, &expr->batchdata->prog, expr) );
+      SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &expr->batchdata->varidx, expr->batchdata->prog->nexprs) );
+      expr->batchdata->nvars = -1;
+   }
+   batchdata = expr->batchdata;
+
+   *prog = batchdata->prog;
+   *varidx = batchdata->varidx;
+
+   /* the positions are still valid if the same variables are given as before */
+   samevars = (batchdata->nvars == nvars);
+   for( j = 0; j < nvars && samevars; ++j )
+      samevars = (batchdata->vars[j] == vars[j]);  /*lint !e613*/
+
+   if( samevars )
+      return SCIP_OKAY;
+
+   batchdata->nvars = -1;
+
+   SCIP_CALL( SCIPhashmapCreate(&var2idx, blkmem, MAX(nvars, 1)) );
+   for( j = 0; j < nvars; ++j )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(var2idx, (void*)vars[j], j) );  /*lint !e613*/
+   }
+
+   for( i = 0; i < batchdata->prog->nexprs; ++i )
+   {
+      SCIP_EXPR* subexpr = batchdata->prog->exprs[i];
+
+      batchdata->varidx[i] = -1;
+
+      if( !SCIPexprIsVar(set, subexpr) )
+         continue;
+
+      if( !SCIPhashmapExists(var2idx, (void*)SCIPgetVarExprVar(subexpr)) )
+      {
+         SCIPerrorMessage("variable <%s> of expression not given in batch evaluation\n",
+            SCIPvarGetName(SCIPgetVarExprVar(subexpr)));
+         SCIPhashmapFree(&var2idx);
+
+         return SCIP_INVALIDDATA;
+      }
+
+      batchdata->varidx[i] = SCIPhashmapGetImageInt(var2idx, (void*)SCIPgetVarExprVar(subexpr));
+   }
+
+   SCIPhashmapFree(&var2idx);
+
+   if( batchdata->varssize < nvars )
+   {
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &batchdata->vars, batchdata->varssize, nvars) );
+      batchdata->varssize = nvars;
+   }
+   if( nvars > 0 )
+   {
+      BMScopyMemoryArray(batchdata->vars, vars, nvars);
+   }
+   batchdata->nvars = nvars;
+
+   return SCIP_OKAY;
+}
+
+/** frees the data that SCIPexprGetBatch() stored in an expression
+ *
+ * Before changing the children of the expression or of any of its subexpressions, this function needs to be called.
+ */
+void SCIPexprFreeBatch(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   assert(blkmem != NULL);
+   assert(expr != NULL);
+
+   if( expr->batchdata == NULL )
+      return;
+
+   BMSfreeBlockMemoryArrayNull(blkmem, &expr->batchdata->vars, expr->batchdata->varssize);
+   BMSfreeBlockMemoryArray(blkmem, &expr->batchdata->varidx, expr->batchdata->prog->nexprs);
+   SCIPexprprogFree(blkmem, &expr->batchdata->prog);
+   BMSfreeBlockMemory(blkmem, &expr->batchdata);
+}
+
+/** evaluates the expression of an expression program in a point
+ *
+ * Gives the same values as SCIPexprEval() for the root expression of the program,
+ * but runs over the subexpressions in the order of the program instead of doing an expression walk.
+ */
+SCIP_RETCODE SCIPexprprogEval(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   SCIP_EXPR* rootexpr;
+   SCIP_EXPR* expr;
+   int i;
+
+   assert(set != NULL);
+   assert(prog != NULL);
+   assert(prog->nexprs > 0);
+
+   rootexpr = prog->exprs[prog->nexprs-1];
+
+   /* if value is up-to-date, then nothing to do */
+   if( soltag != 0 && rootexpr->evaltag == soltag )
+      return SCIP_OKAY;
+
+   /* since children come before their parents, all children are up-to-date when an expression is evaluated */
+   for( i = 0; i < prog->nexprs; ++i )
+   {
+      expr = prog->exprs[i];
+
+      if( soltag == 0 || expr->evaltag != soltag )
+      {
+         SCIP_CALL( SCIPexprhdlrEvalExpr(expr->exprhdlr, set, NULL, expr, &expr->evalvalue, NULL, sol) );
+         expr->evaltag = soltag;
+      }
+
+      /* stop at a domain error, as SCIPexprEval() does */
+      if( expr->evalvalue == SCIP_INVALID )
+      {
+         rootexpr->evalvalue = SCIP_INVALID;
+         rootexpr->evaltag = soltag;
+         break;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the gradient of the expression of an expression program in a point
+ *
+ * Gives the same partial derivatives w.r.t. variable expressions as SCIPexprEvalGradient(),
+ * but accumulates the derivatives in reverse order of the program instead of doing an expression walk.
+ * For each other subexpression, the stored derivative is the partial derivative of the root expression
+ * w.r.t. this subexpression, summed over all its parents.
+ */
+SCIP_RETCODE SCIPexprprogEvalGradient(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   SCIP_EXPR* rootexpr;
+   SCIP_EXPR* expr;
+   SCIP_EXPR* child;
+   SCIP_Real derivative;
+   SCIP_Longint difftag;
+   int i;
+   int c;
+
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(prog != NULL);
+   assert(prog->nexprs > 0);
+
+   rootexpr = prog->exprs[prog->nexprs-1];
+
+   /* ensure expression is evaluated */
+   SCIP_CALL( SCIPexprprogEval(set, prog, sol, soltag) );
+
+   /* check if expression could not be evaluated */
+   if( rootexpr->evalvalue == SCIP_INVALID )
+   {
+      rootexpr->derivative = SCIP_INVALID;
+      return SCIP_OKAY;
+   }
+
+   if( SCIPexprIsValue(set, rootexpr) )
+   {
+      rootexpr->derivative = 0.0;
+      return SCIP_OKAY;
+   }
+
+   difftag = ++(stat->exprlastdifftag);
+
+   for( i = 0; i < prog->nexprs; ++i )
+   {
+      prog->exprs[i]->derivative = 0.0;
+      prog->exprs[i]->difftag = difftag;
+   }
+   rootexpr->derivative = 1.0;
+
+   /* since parents come after their children, the derivative of an expression is complete when it is reached */
+   for( i = prog->nexprs - 1; i >= 0; --i )
+   {
+      expr = prog->exprs[i];
+      assert(expr->evalvalue != SCIP_INVALID);
+
+      for( c = 0; c < expr->nchildren; ++c )
+      {
+         child = expr->children[c];
+
+         if( SCIPexprIsValue(set, child) )
+            continue;
+
+         derivative = SCIP_INVALID;
+         SCIP_CALL( SCIPexprhdlrBwDiffExpr(expr->exprhdlr, set, NULL, expr, c, &derivative, NULL, 0.0) );
+
+         if( derivative == SCIP_INVALID )
+         {
+            rootexpr->derivative = SCIP_INVALID;
+            return SCIP_OKAY;
+         }
+
+         child->derivative += expr->derivative * derivative;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** compare expressions
  *
  * @return -1, 0 or 1 if expr1 <, =, > expr2, respectively
@@ -3838,6 +4296,9 @@ CLEANUP:
 #undef SCIPexprIsIntegral
 #undef SCIPexprSetIntegrality
 #undef SCIPexprAreQuadraticExprsVariables
+#undef SCIPexprprogGetNExprs
+#undef SCIPexprprogGetExprs
+#undef SCIPexprprogGetChildPos
 #endif
 
 /** gets the number of times the expression is currently captured */
@@ -4296,4 +4757,40 @@ SCIP_RETCODE SCIPexprGetMonomialData(
    return SCIP_OKAY;
 }
 
+/** gives the number of subexpressions in an expression program */
+int SCIPexprprogGetNExprs(
+   SCIP_EXPRPROG*        prog                /**< expression program */
+   )
+{
+   assert(prog != NULL);
+
+   return prog->nexprs;
+}
+
+/** gives the subexpressions of an expression program in topological order, with the root expression last */
+SCIP_EXPR** SCIPexprprogGetExprs(
+   SCIP_EXPRPROG*        prog                /**< expression program */
+   )
+{
+   assert(prog != NULL);
+
+   return prog->exprs;
+}
+
+/** gives the positions in the program of the children of the subexpression at a given position
+ *
+ * The length of the returned array is the number of children of the subexpression.
+ */
+int* SCIPexprprogGetChildPos(
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   int                   pos                 /**< position of subexpression in program */
+   )
+{
+   assert(prog != NULL);
+   assert(pos >= 0);
+   assert(pos < prog->nexprs);
+
+   return &prog->childpos[prog->childbegin[pos]];
+}
+
 /**@} */
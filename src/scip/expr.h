@@ -205,6 +205,25 @@ SCIP_RETCODE SCIPexprhdlrEvalExpr(
    SCIP_SOL*             sol                 /**< solution that is evaluated (can be NULL) */
    );
 
+/** calls the batch evaluation callback of an expression handler
+ *
+ * The method evaluates an expression in several points by taking the values of its children in these points into
+ * account. If the expression handler does not implement the batch evaluation callback, the expression is evaluated
+ * point by point via the point evaluation callback.
+ *
+ * @see SCIP_DECL_EXPREVALBATCH
+ */
+SCIP_RETCODE SCIPexprhdlrEvalBatchExpr(
+   SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   npoints,            /**< number of points */
+   SCIP_Real**           childrenvals,       /**< values of children in all points, childrenvals[i][k] is the value of
+                                              *   the i-th child in the k-th point */
+   SCIP_Real*            vals                /**< buffer to store values of expression in all points */
+   );
+
 /** calls the backward derivative evaluation callback of an expression handler
  *
  * The method should compute the partial derivative of expr w.r.t its child at childidx.
@@ -605,6 +624,79 @@ SCIP_RETCODE SCIPexprEvalHessianDir(
    SCIP_SOL*             direction           /**< direction */
    );
 
+/** creates an expression program for an expression
+ *
+ * The program lists all subexpressions of the expression in topological order, that is,
+ * each subexpression appears once and after all its children, with the expression itself last.
+ * The subexpressions are not captured. The program becomes invalid if the expression is freed
+ * or the children of any of its subexpressions are changed.
+ */
+SCIP_RETCODE SCIPexprprogCreate(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRPROG**       prog,               /**< buffer to store expression program */
+   SCIP_EXPR*            rootexpr            /**< expression */
+   );
+
+/** frees an expression program */
+void SCIPexprprogFree(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPRPROG**       prog                /**< pointer to expression program */
+   );
+
+/** gives the expression program of an expression and the positions of its variable expressions in a variables array
+ *
+ * The program is created on the first call and stored in the expression, see SCIPexprFreeBatch().
+ * The positions are only recomputed if the variables differ from those of the previous call.
+ */
+SCIP_RETCODE SCIPexprGetBatch(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            expr,               /**< expression */
+   int                   nvars,              /**< number of variables */
+   SCIP_VAR**            vars,               /**< variables, including all variables of the expression */
+   SCIP_EXPRPROG**       prog,               /**< buffer to store expression program */
+   int**                 varidx              /**< buffer to store position in vars of each variable expression of the
+                                              *   program, -1 for other subexpressions */
+   );
+
+/** frees the data that SCIPexprGetBatch() stored in an expression
+ *
+ * Before changing the children of the expression or of any of its subexpressions, this function needs to be called.
+ */
+void SCIPexprFreeBatch(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            expr                /**< expression */
+   );
+
+/** evaluates the expression of an expression program in a point
+ *
+ * Gives the same values as SCIPexprEval() for the root expression of the program,
+ * but runs over the subexpressions in the order of the program instead of doing an expression walk.
+ */
+SCIP_RETCODE SCIPexprprogEval(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
+/** evaluates the gradient of the expression of an expression program in a point
+ *
+ * Gives the same partial derivatives w.r.t. variable expressions as SCIPexprEvalGradient(),
+ * but accumulates the derivatives in reverse order of the program instead of doing an expression walk.
+ * For each other subexpression, the stored derivative is the partial derivative of the root expression
+ * w.r.t. this subexpression, summed over all its parents.
+ */
+SCIP_RETCODE SCIPexprprogEvalGradient(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
 /** possibly reevaluates and then returns the activity of the expression
  *
  * Reevaluate activity if currently stored is no longer uptodate.
@@ -269,6 +269,24 @@ SCIP_DECL_EXPREVAL(evalExp)
    return SCIP_OKAY;
 }
 
+/** expression batch evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchExp)
+{  /*lint --e{715}*/
+   SCIP_Real* childvals;
+   int k;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+
+   childvals = childrenvals[0];
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = exp(childvals[k]);
+
+   return SCIP_OKAY;
+}
+
 /** expression derivative evaluation callback */
 static
 SCIP_DECL_EXPRBWDIFF(bwdiffExp)
@@ -496,6 +514,7 @@ SCIP_RETCODE SCIPincludeExprhdlrExp(
    SCIPexprhdlrSetSimplify(exprhdlr, simplifyExp);
    SCIPexprhdlrSetParse(exprhdlr, parseExp);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalExp);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchExp);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesExp, estimateExp);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropExp);
    SCIPexprhdlrSetHash(exprhdlr, hashExp);
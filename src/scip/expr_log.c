@@ -300,6 +300,24 @@ SCIP_DECL_EXPREVAL(evalLog)
    return SCIP_OKAY;
 }
 
+/** expression batch evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchLog)
+{  /*lint --e{715}*/
+   SCIP_Real* childvals;
+   int k;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+
+   childvals = childrenvals[0];
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = childvals[k] <= 0.0 ? SCIP_INVALID : log(childvals[k]);
+
+   return SCIP_OKAY;
+}
+
 /** expression derivative evaluation callback */
 static
 SCIP_DECL_EXPRBWDIFF(bwdiffLog)
@@ -611,6 +629,7 @@ SCIP_RETCODE SCIPincludeExprhdlrLog(
    SCIPexprhdlrSetSimplify(exprhdlr, simplifyLog);
    SCIPexprhdlrSetParse(exprhdlr, parseLog);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalLog);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchLog);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesLog, estimateLog);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropLog);
    SCIPexprhdlrSetHash(exprhdlr, hashLog);
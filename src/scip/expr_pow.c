@@ -1909,6 +1909,28 @@ SCIP_DECL_EXPREVAL(evalPow)
    return SCIP_OKAY;
 }
 
+/** expression batch evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchPow)
+{  /*lint --e{715}*/
+   SCIP_Real* childvals;
+   SCIP_Real exponent;
+   int k;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+
+   exponent = SCIPgetExponentExprPow(expr);
+   childvals = childrenvals[0];
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = pow(childvals[k], exponent);
+
+   /* domain, pole, and range errors (NaN, infinity, HUGE_VAL) are turned into SCIP_INVALID by the caller */
+
+   return SCIP_OKAY;
+}
+
 /** derivative evaluation callback
  *
  * computes <gradient, children.dot>
@@ -3134,6 +3156,7 @@ SCIP_RETCODE SCIPincludeExprhdlrPow(
    SCIPexprhdlrSetSimplify(exprhdlr, simplifyPow);
    SCIPexprhdlrSetPrint(exprhdlr, printPow);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalPow);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchPow);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesPow, estimatePow);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropPow);
    SCIPexprhdlrSetHash(exprhdlr, hashPow);
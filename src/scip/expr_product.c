@@ -1671,6 +1671,34 @@ SCIP_DECL_EXPREVAL(evalProduct)
    return SCIP_OKAY;
 }
 
+/** expression batch evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchProduct)
+{  /*lint --e{715}*/
+   SCIP_EXPRDATA* exprdata;
+   int c;
+   int k;
+
+   assert(expr != NULL);
+
+   exprdata = SCIPexprGetData(expr);
+   assert(exprdata != NULL);
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = exprdata->coefficient;
+
+   /* unlike evalProduct(), the multiplication is not stopped once a factor is zero, so that the loops stay simple */
+   for( c = 0; c < SCIPexprGetNChildren(expr); ++c )
+   {
+      SCIP_Real* childvals = childrenvals[c];
+
+      for( k = 0; k < npoints; ++k )
+         vals[k] *= childvals[k];
+   }
+
+   return SCIP_OKAY;
+}
+
 /** derivative evaluation callback computing <gradient, children.dot>
  *
  * If expr is \f$\prod_i x_i\f$, then computes \f$\sum_j \prod_{i\neq j} x_i x^{\text{dot}}_j\f$.
@@ -2255,6 +2283,7 @@ SCIP_RETCODE SCIPincludeExprhdlrProduct(
    SCIPexprhdlrSetCompare(exprhdlr, compareProduct);
    SCIPexprhdlrSetPrint(exprhdlr, printProduct);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalProduct);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchProduct);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesProduct, estimateProduct);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropProduct);
    SCIPexprhdlrSetHash(exprhdlr, hashProduct);
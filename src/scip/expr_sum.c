@@ -797,6 +797,34 @@ SCIP_DECL_EXPREVAL(evalSum)
    return SCIP_OKAY;
 }
 
+/** expression batch evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchSum)
+{  /*lint --e{715}*/
+   SCIP_EXPRDATA* exprdata;
+   int c;
+   int k;
+
+   assert(expr != NULL);
+
+   exprdata = SCIPexprGetData(expr);
+   assert(exprdata != NULL);
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = exprdata->constant;
+
+   for( c = 0; c < SCIPexprGetNChildren(expr); ++c )
+   {
+      SCIP_Real coef = exprdata->coefficients[c];
+      SCIP_Real* childvals = childrenvals[c];
+
+      for( k = 0; k < npoints; ++k )
+         vals[k] += coef * childvals[k];
+   }
+
+   return SCIP_OKAY;
+}
+
 /** expression forward derivative evaluation callback */
 static
 SCIP_DECL_EXPRFWDIFF(fwdiffSum)
@@ -852,7 +880,10 @@ static
 SCIP_DECL_EXPRINTEVAL(intevalSum)
 {  /*lint --e{715}*/
    SCIP_EXPRDATA* exprdata;
+   SCIP_EXPR** children;
    SCIP_INTERVAL suminterval;
+   SCIP_ROUNDMODE roundmode;
+   int nchildren;
    int c;
 
    assert(expr != NULL);
@@ -860,34 +891,66 @@ SCIP_DECL_EXPRINTEVAL(intevalSum)
    exprdata = SCIPexprGetData(expr);
    assert(exprdata != NULL);
 
+   children = SCIPexprGetChildren(expr);
+   nchildren = SCIPexprGetNChildren(expr);
+
    SCIPintervalSet(interval, exprdata->constant);
 
-   SCIPdebugMsg(scip, "inteval %p with %d children: %.20g", (void*)expr, SCIPexprGetNChildren(expr), exprdata->constant);
+   SCIPdebugMsg(scip, "inteval %p with %d children: %.20g", (void*)expr, nchildren, exprdata->constant);
 
-   for( c = 0; c < SCIPexprGetNChildren(expr); ++c )
+   for( c = 0; c < nchildren; ++c )
    {
       SCIP_INTERVAL childinterval;
 
-      childinterval = SCIPexprGetActivity(SCIPexprGetChildren(expr)[c]);
+      childinterval = SCIPexprGetActivity(children[c]);
       if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, childinterval) )
       {
+         SCIPdebugMsgPrint(scip, " %+.20g*[empty]\n", exprdata->coefficients[c]);
          SCIPintervalSetEmpty(interval);
-         break;
+         return SCIP_OKAY;
       }
 
-      /* compute coefficients[c] * childinterval and add the result to the so far computed interval */
-      if( exprdata->coefficients[c] == 1.0 )
-      {
-         SCIPintervalAdd(SCIP_INTERVAL_INFINITY, interval, *interval, childinterval);
-      }
+      SCIPdebugMsgPrint(scip, " %+.20g*[%.20g,%.20g]", exprdata->coefficients[c], childinterval.inf, childinterval.sup);
+   }
+
+   /* compute coefficients[c] * childinterval and add the result to the so far computed interval;
+    * infimum and supremum are computed in one loop each, such that the rounding mode is switched only twice,
+    * with the same result as SCIPintervalMulScalar() and SCIPintervalAdd() for each child
+    */
+   roundmode = SCIPintervalGetRoundingMode();
+
+   SCIPintervalSetRoundingModeDownwards();
+   for( c = 0; c < nchildren; ++c )
+   {
+      SCIP_INTERVAL childinterval = SCIPexprGetActivity(children[c]);
+      SCIP_Real coef = exprdata->coefficients[c];
+
+      if( coef == 1.0 )
+         suminterval.inf = childinterval.inf;
+      else if( coef == -1.0 )
+         suminterval.inf = -childinterval.sup;
       else
-      {
-         SCIPintervalMulScalar(SCIP_INTERVAL_INFINITY, &suminterval, childinterval, exprdata->coefficients[c]);
-         SCIPintervalAdd(SCIP_INTERVAL_INFINITY, interval, *interval, suminterval);
-      }
+         SCIPintervalMulScalarInf(SCIP_INTERVAL_INFINITY, &suminterval, childinterval, coef);
+      SCIPintervalAddInf(SCIP_INTERVAL_INFINITY, interval, *interval, suminterval);
+   }
 
-      SCIPdebugMsgPrint(scip, " %+.20g*[%.20g,%.20g]", exprdata->coefficients[c], childinterval.inf, childinterval.sup);
+   SCIPintervalSetRoundingModeUpwards();
+   for( c = 0; c < nchildren; ++c )
+   {
+      SCIP_INTERVAL childinterval = SCIPexprGetActivity(children[c]);
+      SCIP_Real coef = exprdata->coefficients[c];
+
+      if( coef == 1.0 )
+         suminterval.sup = childinterval.sup;
+      else if( coef == -1.0 )
+         suminterval.sup = -childinterval.inf;
+      else
+         SCIPintervalMulScalarSup(SCIP_INTERVAL_INFINITY, &suminterval, childinterval, coef);
+      SCIPintervalAddSup(SCIP_INTERVAL_INFINITY, interval, *interval, suminterval);
    }
+
+   SCIPintervalSetRoundingMode(roundmode);
+
    SCIPdebugMsgPrint(scip, " = [%.20g,%.20g]\n", interval->inf, interval->sup);
 
    return SCIP_OKAY;
@@ -1098,6 +1161,7 @@ SCIP_RETCODE SCIPincludeExprhdlrSum(
    SCIPexprhdlrSetCompare(exprhdlr, compareSum);
    SCIPexprhdlrSetPrint(exprhdlr, printSum);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalSum);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchSum);
    SCIPexprhdlrSetEstimate(exprhdlr, initEstimatesSum, estimateSum);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropSum);
    SCIPexprhdlrSetHash(exprhdlr, hashSum);
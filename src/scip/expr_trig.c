@@ -865,6 +865,24 @@ SCIP_DECL_EXPREVAL(evalSin)
    return SCIP_OKAY;
 }
 
+/** expression batch evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchSin)
+{  /*lint --e{715}*/
+   SCIP_Real* childvals;
+   int k;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+
+   childvals = childrenvals[0];
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = sin(childvals[k]);
+
+   return SCIP_OKAY;
+}
+
 /** expression derivative evaluation callback */
 static
 SCIP_DECL_EXPRBWDIFF(bwdiffSin)
@@ -1175,6 +1193,24 @@ SCIP_DECL_EXPREVAL(evalCos)
    return SCIP_OKAY;
 }
 
+/** expression batch evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchCos)
+{  /*lint --e{715}*/
+   SCIP_Real* childvals;
+   int k;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+
+   childvals = childrenvals[0];
+
+   for( k = 0; k < npoints; ++k )
+      vals[k] = cos(childvals[k]);
+
+   return SCIP_OKAY;
+}
+
 /** expression derivative evaluation callback */
 static
 SCIP_DECL_EXPRBWDIFF(bwdiffCos)
@@ -1391,6 +1427,7 @@ SCIP_RETCODE SCIPincludeExprhdlrSin(
    SCIPexprhdlrSetSimplify(exprhdlr, simplifySin);
    SCIPexprhdlrSetParse(exprhdlr, parseSin);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalSin);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchSin);
    SCIPexprhdlrSetEstimate(exprhdlr, initEstimatesSin, estimateSin);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropSin);
    SCIPexprhdlrSetHash(exprhdlr, hashSin);
@@ -1416,6 +1453,7 @@ SCIP_RETCODE SCIPincludeExprhdlrCos(
    SCIPexprhdlrSetSimplify(exprhdlr, simplifyCos);
    SCIPexprhdlrSetParse(exprhdlr, parseCos);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalCos);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchCos);
    SCIPexprhdlrSetEstimate(exprhdlr, initEstimatesCos, estimateCos);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropCos);
    SCIPexprhdlrSetHash(exprhdlr, hashCos);
@@ -43,6 +43,8 @@
 #include <cmath>
 #include <cstring>
 #include <algorithm>
+#include <map>
+#include <string>
 #include <vector>
 using std::vector;
 
@@ -66,6 +68,20 @@ using std::vector;
  */
 #define NO_CPPAD_USER_ATOMIC
 
+/* defining NO_CPPAD_TAPECACHE disables the cache of recorded and optimized tapes
+ * with the cache, expressions of the same structure (e.g., the same constraint in a sub-SCIP) are taped only once
+ * since our user-atomic functions and atomic_userexpr store pointers to expressions in the tape, the cache is only
+ * used if these are not needed
+ */
+// #define NO_CPPAD_TAPECACHE
+
+#if !defined(NO_CPPAD_USER_ATOMIC) || defined(EVAL_USE_EXPRHDLR_ALWAYS)
+#define NO_CPPAD_TAPECACHE
+#endif
+
+/* maximal number of tapes in the tape cache of a thread; if exceeded, the cache is emptied */
+#define TAPECACHE_MAXSIZE 1000
+
 /* fallback to non-thread-safe version if C++ is too old to have std::atomic */
 #if __cplusplus < 201103L && defined(SCIP_THREADSAFE)
 #undef SCIP_THREADSAFE
@@ -111,10 +127,48 @@ using std::vector;
 #ifdef SCIP_THREADSAFE
 
 #include <atomic>
+#include <mutex>
 
 /** currently registered number of threads */
 static std::atomic_size_t ncurthreads{0};
-static thread_local int thread_number{-1};
+
+/** mutex that protects the thread numbers in use */
+static std::mutex threadnummutex;
+
+/** whether a thread number is in use by a running thread */
+static bool threadnumused[CPPAD_MAX_NUM_THREADS];
+
+/** thread number of a thread
+ *
+ * CppAD supports only CPPAD_MAX_NUM_THREADS different thread numbers, but worker threads of the task processing
+ * interface are started again for every thread pool. Therefore, a thread gives its number back when it exits, after
+ * returning the memory that CppAD keeps available for this thread to the system.
+ */
+class ThreadNumber
+{
+public:
+   /** constructor */
+   ThreadNumber()
+      : number(-1)
+   { }
+
+   /** destructor */
+   ~ThreadNumber()
+   {
+      if( number == -1 )
+         return;
+
+      CppAD::thread_alloc::free_available(static_cast<size_t>(number));
+
+      std::lock_guard<std::mutex> lock(threadnummutex);
+      threadnumused[number] = false;
+      --ncurthreads;
+   }
+
+   int number;                               /**< thread number, or -1 if not assigned yet */
+};
+
+static thread_local ThreadNumber thread_number;
 
 /** CppAD callback function that indicates whether we are running in parallel mode */
 static
@@ -132,14 +186,23 @@ size_t thread_num(void)
 {
    size_t threadnum;
 
-   /* if no thread_number for this thread yet, then assign a new thread number to the current thread
+   /* if no thread_number for this thread yet, then assign the smallest free thread number to the current thread
     */
-   if( thread_number == -1 )
+   if( thread_number.number == -1 )
    {
-      thread_number = static_cast<int>(ncurthreads.fetch_add(1, std::memory_order_relaxed));
+      std::lock_guard<std::mutex> lock(threadnummutex);
+      int number = 0;
+
+      while( number < CPPAD_MAX_NUM_THREADS - 1 && threadnumused[number] )
+         ++number;
+      assert(!threadnumused[number]);
+
+      threadnumused[number] = true;
+      thread_number.number = number;
+      ++ncurthreads;
    }
 
-   threadnum = static_cast<size_t>(thread_number);
+   threadnum = static_cast<size_t>(thread_number.number);
 
    return threadnum;
 }
@@ -206,6 +269,7 @@ public:
    }
 
    vector< int >         varidxs;            /**< variable indices used in expression (unique and sorted) */
+   std::string           tapekey;            /**< structure of expression to look up its tape in the tape cache, or empty if not cacheable */
    vector< AD<double> >  X;                  /**< vector of dependent variables (same size as varidxs) */
    vector< AD<double> >  Y;                  /**< result vector (size 1) */
    CppAD::ADFun<double>  f;                  /**< the function to evaluate as CppAD object */
@@ -1452,6 +1516,176 @@ SCIP_RETCODE eval(
    return SCIP_OKAY;
 }
 
+#ifndef NO_CPPAD_TAPECACHE
+
+/** cache of recorded and optimized tapes, indexed by the structure of the taped expression
+ *
+ * Tapes are only read from the cache by copying them into the function object of the interpreter data, which then
+ * holds the Taylor coefficients and sparsity patterns for the evaluations of this expression.
+ */
+class TapeCache
+{
+public:
+   /** constructor */
+   TapeCache()
+   {
+#ifdef SCIP_THREADSAFE
+      /* register the thread with CppAD before the cache is constructed, such that the thread gives its number back
+       * only after the tapes of the cache have been freed when the thread exits
+       */
+      (void) CppAD::thread_alloc::thread_num();
+#endif
+   }
+
+   /** destructor */
+   ~TapeCache()
+   {
+      clear();
+   }
+
+   /** copies the tape for an expression structure into a function object, if in the cache
+    *
+    * @return whether the tape was found
+    */
+   bool get(
+      const std::string& key,                /**< structure of expression */
+      CppAD::ADFun<double>& f                /**< function object to store tape */
+      ) const
+   {
+      std::map<std::string, CppAD::ADFun<double>*>::const_iterator it(tapes.find(key));
+
+      if( it == tapes.end() )
+         return false;
+
+      f = *it->second;
+
+      return true;
+   }
+
+   /** stores a copy of the tape of a function object for an expression structure */
+   void insert(
+      const std::string& key,                /**< structure of expression */
+      const CppAD::ADFun<double>& f          /**< function object with tape */
+      )
+   {
+      if( tapes.size() >= TAPECACHE_MAXSIZE )
+         clear();
+
+      CppAD::ADFun<double>* tape = new CppAD::ADFun<double>();
+      *tape = f;
+
+      if( !tapes.insert(std::make_pair(key, tape)).second )
+         delete tape;
+   }
+
+private:
+   /** removes all tapes from the cache */
+   void clear()
+   {
+      for( std::map<std::string, CppAD::ADFun<double>*>::iterator it(tapes.begin()); it != tapes.end(); ++it )
+         delete it->second;
+      tapes.clear();
+   }
+
+   std::map<std::string, CppAD::ADFun<double>*> tapes; /**< tapes by structure of expression */
+};
+
+/** gives the tape cache of the current thread
+ *
+ * The cache is shared by all SCIP instances of a thread, in particular by a SCIP and the sub-SCIPs of its heuristics.
+ * Since the memory allocator of CppAD requires that memory is freed by the thread that allocated it, each thread
+ * has its own cache.
+ */
+static
+TapeCache& getTapeCache(void)
+{
+#ifdef SCIP_THREADSAFE
+   static thread_local TapeCache tapecache;
+#else
+   static TapeCache tapecache;
+#endif
+
+   return tapecache;
+}
+
+/** appends data as bytes to the key of a tape */
+template<class T>
+static
+void appendTapeKeyData(
+   std::string&          key,                /**< key of tape */
+   const T&              data                /**< data to append */
+   )
+{
+   key.append(reinterpret_cast<const char*>(&data), sizeof(T));
+}
+
+/** appends the structure of an expression to the key of its tape
+ *
+ * The key holds everything that eval() puts onto the tape: the expression handlers, the number of children, the
+ * constants, coefficients, and exponents, and the positions of the variables in the varidxs vector.
+ *
+ * @return whether the tape can be cached, i.e., no expression needs to be evaluated via atomic_userexpr
+ */
+static
+bool appendTapeKey(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr,               /**< expression */
+   SCIP_EXPRINTDATA*     exprintdata,        /**< interpreter data for root expression */
+   std::string&          key                 /**< key of tape */
+   )
+{
+   const char* name = SCIPexprhdlrGetName(SCIPexprGetHdlr(expr));
+   int nchildren = SCIPexprGetNChildren(expr);
+
+   key.append(name, strlen(name) + 1);
+   appendTapeKeyData(key, nchildren);
+
+   if( SCIPisExprVaridx(scip, expr) )
+   {
+      appendTapeKeyData(key, exprintdata->getVarPos(SCIPgetIndexExprVaridx(expr)));
+      return true;
+   }
+
+   if( SCIPisExprValue(scip, expr) )
+   {
+      appendTapeKeyData(key, SCIPgetValueExprValue(expr));
+      return true;
+   }
+
+   if( SCIPisExprSum(scip, expr) )
+   {
+      appendTapeKeyData(key, SCIPgetConstantExprSum(expr));
+      for( int i = 0; i < nchildren; ++i )
+         appendTapeKeyData(key, SCIPgetCoefsExprSum(expr)[i]);
+   }
+   else if( SCIPisExprProduct(scip, expr) )
+   {
+      appendTapeKeyData(key, SCIPgetCoefExprProduct(expr));
+   }
+   else if( SCIPisExprPower(scip, expr) || SCIPisExprSignpower(scip, expr) )
+   {
+      appendTapeKeyData(key, SCIPgetExponentExprPow(expr));
+   }
+   else if( !SCIPisExprExp(scip, expr) &&
+      !SCIPisExprLog(scip, expr) &&
+      strcmp(name, "abs") != 0 &&
+      strcmp(name, "sin") != 0 &&
+      strcmp(name, "cos") != 0 &&
+      strcmp(name, "entropy") != 0 &&
+      strcmp(name, "erf") != 0 )
+   {
+      return false;
+   }
+
+   for( int i = 0; i < nchildren; ++i )
+      if( !appendTapeKey(scip, SCIPexprGetChildren(expr)[i], exprintdata, key) )
+         return false;
+
+   return true;
+}
+
+#endif // NO_CPPAD_TAPECACHE
+
 /** replacement for CppAD's default error handler
  *
  *  In debug mode, CppAD gives an error when an evaluation contains a nan.
@@ -1608,6 +1842,17 @@ SCIP_RETCODE SCIPexprintCompile(
    (*exprintdata)->x.resize(n);
    (*exprintdata)->Y.resize(1);
 
+#ifndef NO_CPPAD_TAPECACHE
+   /* remember the structure of the expression to look up its tape in the tape cache */
+   (*exprintdata)->tapekey.clear();
+   if( n > 0 )
+   {
+      appendTapeKeyData((*exprintdata)->tapekey, n);
+      if( !appendTapeKey(scip, rootexpr, *exprintdata, (*exprintdata)->tapekey) )
+         (*exprintdata)->tapekey.clear();
+   }
+#endif
+
    // check whether we are quadratic (or linear), so we can save on Hessian time (so
    // assumes simplified and skips over x^2 and x*y cases
    // not using SCIPcheckExprQuadratic(), because we don't need the quadratic form
@@ -1720,20 +1965,35 @@ SCIP_RETCODE SCIPexprintEval(
          delete *it;
       exprintdata->userexprs.clear();
 
-      CppAD::Independent(exprintdata->X);
+#ifndef NO_CPPAD_TAPECACHE
+      if( !exprintdata->tapekey.empty() && getTapeCache().get(exprintdata->tapekey, exprintdata->f) )
+      {
+         exprintdata->val = exprintdata->f.Forward(0, exprintdata->x)[0];
+         SCIPdebugMessage("Eval copied tape from cache and computed value %g\n", exprintdata->val);
+      }
+      else
+#endif
+      {
+         CppAD::Independent(exprintdata->X);
+
+         SCIP_CALL( eval(scip, expr, exprintdata, exprintdata->X, exprintdata->Y[0]) );
 
-      SCIP_CALL( eval(scip, expr, exprintdata, exprintdata->X, exprintdata->Y[0]) );
+         exprintdata->f.Dependent(exprintdata->X, exprintdata->Y);
 
-      exprintdata->f.Dependent(exprintdata->X, exprintdata->Y);
+         exprintdata->val = Value(exprintdata->Y[0]);
+         SCIPdebugMessage("Eval retaped and computed value %g\n", exprintdata->val);
 
-      exprintdata->val = Value(exprintdata->Y[0]);
-      SCIPdebugMessage("Eval retaped and computed value %g\n", exprintdata->val);
+         // the following is required if the gradient shall be computed by a reverse sweep later
+         // exprintdata->val = exprintdata->f.Forward(0, exprintdata->x)[0];
 
-      // the following is required if the gradient shall be computed by a reverse sweep later
-      // exprintdata->val = exprintdata->f.Forward(0, exprintdata->x)[0];
+         // https://coin-or.github.io/CppAD/doc/optimize.htm
+         exprintdata->f.optimize();
 
-      // https://coin-or.github.io/CppAD/doc/optimize.htm
-      exprintdata->f.optimize();
+#ifndef NO_CPPAD_TAPECACHE
+         if( !exprintdata->tapekey.empty() )
+            getTapeCache().insert(exprintdata->tapekey, exprintdata->f);
+#endif
+      }
 
       exprintdata->need_retape = false;
    }
@@ -37,6 +37,8 @@
 
 
 #define BUFFER_LEN 8192
+#define STREAM_BUFFER_LEN 131072             /**< size of the buffer of opened streams; large buffers save system calls
+                                              *   and decompression calls when reading big files */
 
 #ifdef SCIP_WITH_ZLIB
 
@@ -45,7 +47,16 @@
 
 SCIP_FILE* SCIPfopen(const char *path, const char *mode)
 {
-   return (SCIP_FILE*)gzopen(path, mode);
+   gzFile file;
+
+   file = gzopen(path, mode);
+
+#if ZLIB_VERNUM >= 0x1240
+   if( file != NULL )
+      (void) gzbuffer(file, STREAM_BUFFER_LEN);
+#endif
+
+   return (SCIP_FILE*)file;
 }
 
 SCIP_FILE* SCIPfdopen(int fildes, const char *mode)
@@ -152,7 +163,14 @@ int SCIPfclose(SCIP_FILE *fp)
 
 SCIP_FILE* SCIPfopen(const char *path, const char *mode)
 {
-   return (SCIP_FILE*)fopen(path, mode);
+   FILE* file;
+
+   file = fopen(path, mode);
+
+   if( file != NULL )
+      (void) setvbuf(file, NULL, _IOFBF, STREAM_BUFFER_LEN);
+
+   return (SCIP_FILE*)file;
 }
 
 SCIP_FILE* SCIPfdopen(int fildes, const char *mode)
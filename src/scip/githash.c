@@ -0,0 +1 @@
+#define SCIP_GITHASH "c034405"
@@ -878,6 +878,33 @@ SCIP_RETCODE SCIPdivesetIsAvailable(
 
 
 
+/** frees the cached sub-SCIP of the heuristic, if existing */
+static
+SCIP_RETCODE heurFreeSubscipCache(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   SCIP_SUBSCIPCACHE* cache;
+
+   assert(heur != NULL);
+
+   cache = heur->subscipcache;
+   if( cache == NULL )
+      return SCIP_OKAY;
+
+   assert(!cache->inuse);
+
+   if( cache->subscip != NULL )
+   {
+      SCIP_CALL( SCIPfree(&cache->subscip) );
+   }
+   BMSfreeMemoryArrayNull(&cache->subvars);
+   BMSfreeMemoryArrayNull(&cache->sourcevars);
+   BMSfreeMemory(&heur->subscipcache);
+
+   return SCIP_OKAY;
+}
+
 /** copies the given primal heuristic to a new scip */
 SCIP_RETCODE SCIPheurCopyInclude(
    SCIP_HEUR*            heur,               /**< primal heuristic */
@@ -956,9 +983,14 @@ SCIP_RETCODE doHeurCreate(
    (*heur)->heurdata = heurdata;
    SCIP_CALL( SCIPclockCreate(&(*heur)->setuptime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*heur)->heurclock, SCIP_CLOCKTYPE_DEFAULT) );
+   SCIP_CALL( SCIPclockCreate(&(*heur)->subscipcopytime, SCIP_CLOCKTYPE_DEFAULT) );
+   SCIP_CALL( SCIPclockCreate(&(*heur)->subscipresettime, SCIP_CLOCKTYPE_DEFAULT) );
+   (*heur)->subscipcache = NULL;
    (*heur)->ncalls = 0;
    (*heur)->nsolsfound = 0;
    (*heur)->nbestsolsfound = 0;
+   (*heur)->nsubsciphits = 0;
+   (*heur)->nsubscipmisses = 0;
    (*heur)->initialized = FALSE;
    (*heur)->divesets = NULL;
    (*heur)->ndivesets = 0;
@@ -1051,6 +1083,9 @@ SCIP_RETCODE SCIPheurFree(
       divesetFree(&((*heur)->divesets[d]), blkmem);
    }
    BMSfreeMemoryArrayNull(&(*heur)->divesets);
+   SCIP_CALL( heurFreeSubscipCache(*heur) );
+   SCIPclockFree(&(*heur)->subscipresettime);
+   SCIPclockFree(&(*heur)->subscipcopytime);
    SCIPclockFree(&(*heur)->heurclock);
    SCIPclockFree(&(*heur)->setuptime);
    BMSfreeMemoryArrayNull(&(*heur)->name);
@@ -1080,11 +1115,15 @@ SCIP_RETCODE SCIPheurInit(
    {
       SCIPclockReset(heur->setuptime);
       SCIPclockReset(heur->heurclock);
+      SCIPclockReset(heur->subscipcopytime);
+      SCIPclockReset(heur->subscipresettime);
 
       heur->delaypos = -1;
       heur->ncalls = 0;
       heur->nsolsfound = 0;
       heur->nbestsolsfound = 0;
+      heur->nsubsciphits = 0;
+      heur->nsubscipmisses = 0;
 
       set->heurssorted = FALSE;
       set->heursnamesorted = FALSE;
@@ -1194,6 +1233,9 @@ SCIP_RETCODE SCIPheurExitsol(
       SCIPclockStop(heur->setuptime, set);
    }
 
+   /* the cached sub-SCIP refers to transformed variables of the current run */
+   SCIP_CALL( heurFreeSubscipCache(heur) );
+
    return SCIP_OKAY;
 }
 
@@ -1625,6 +1667,64 @@ void SCIPheurEnableOrDisableClocks(
 
    SCIPclockEnableOrDisable(heur->setuptime, enable);
    SCIPclockEnableOrDisable(heur->heurclock, enable);
+   SCIPclockEnableOrDisable(heur->subscipcopytime, enable);
+   SCIPclockEnableOrDisable(heur->subscipresettime, enable);
+}
+
+/** gets the sub-SCIP cache of the heuristic, which is created empty if it does not exist yet */
+SCIP_RETCODE SCIPheurGetSubscipCache(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SUBSCIPCACHE**   cache               /**< pointer to store the sub-SCIP cache */
+   )
+{
+   assert(heur != NULL);
+   assert(cache != NULL);
+
+   if( heur->subscipcache == NULL )
+   {
+      SCIP_ALLOC( BMSallocClearMemory(&heur->subscipcache) );
+   }
+   *cache = heur->subscipcache;
+
+   return SCIP_OKAY;
+}
+
+/** starts the clock for copying or for resetting the cached sub-SCIP of the heuristic */
+void SCIPheurStartSubscipClock(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Bool             copy                /**< start the copying clock instead of the resetting clock? */
+   )
+{
+   assert(heur != NULL);
+
+   SCIPclockStart(copy ? heur->subscipcopytime : heur->subscipresettime, set);
+}
+
+/** stops the clock for copying or for resetting the cached sub-SCIP of the heuristic */
+void SCIPheurStopSubscipClock(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Bool             copy                /**< stop the copying clock instead of the resetting clock? */
+   )
+{
+   assert(heur != NULL);
+
+   SCIPclockStop(copy ? heur->subscipcopytime : heur->subscipresettime, set);
+}
+
+/** counts a call of the heuristic that reused its cached sub-SCIP or had to copy a new one */
+void SCIPheurCountSubscipCall(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_Bool             created             /**< did the call copy a new sub-SCIP? */
+   )
+{
+   assert(heur != NULL);
+
+   if( created )
+      ++heur->nsubscipmisses;
+   else
+      ++heur->nsubsciphits;
 }
 
 /** gets time in seconds used in this heuristic for setting up for next stages */
@@ -1647,6 +1747,46 @@ SCIP_Real SCIPheurGetTime(
    return SCIPclockGetTime(heur->heurclock);
 }
 
+/** gets the number of calls that reused the cached sub-SCIP of this heuristic */
+SCIP_Longint SCIPheurGetNSubscipHits(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   assert(heur != NULL);
+
+   return heur->nsubsciphits;
+}
+
+/** gets the number of calls that had to copy a new sub-SCIP for the sub-SCIP cache of this heuristic */
+SCIP_Longint SCIPheurGetNSubscipMisses(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   assert(heur != NULL);
+
+   return heur->nsubscipmisses;
+}
+
+/** gets time in seconds used for copying the cached sub-SCIP of this heuristic */
+SCIP_Real SCIPheurGetSubscipCopyTime(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   assert(heur != NULL);
+
+   return SCIPclockGetTime(heur->subscipcopytime);
+}
+
+/** gets time in seconds used for resetting the cached sub-SCIP of this heuristic for reuse */
+SCIP_Real SCIPheurGetSubscipResetTime(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   assert(heur != NULL);
+
+   return SCIPclockGetTime(heur->subscipresettime);
+}
+
 /** returns array of divesets of this primal heuristic, or NULL if it has no divesets */
 SCIP_DIVESET** SCIPheurGetDivesets(
    SCIP_HEUR*            heur                /**< primal heuristic */
@@ -258,6 +258,32 @@ void SCIPheurEnableOrDisableClocks(
    SCIP_Bool             enable              /**< should the clocks of the heuristic be enabled? */
    );
 
+/** gets the sub-SCIP cache of the heuristic, which is created empty if it does not exist yet */
+SCIP_RETCODE SCIPheurGetSubscipCache(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SUBSCIPCACHE**   cache               /**< pointer to store the sub-SCIP cache */
+   );
+
+/** starts the clock for copying or for resetting the cached sub-SCIP of the heuristic */
+void SCIPheurStartSubscipClock(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Bool             copy                /**< start the copying clock instead of the resetting clock? */
+   );
+
+/** stops the clock for copying or for resetting the cached sub-SCIP of the heuristic */
+void SCIPheurStopSubscipClock(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Bool             copy                /**< stop the copying clock instead of the resetting clock? */
+   );
+
+/** counts a call of the heuristic that reused its cached sub-SCIP or had to copy a new one */
+void SCIPheurCountSubscipCall(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_Bool             created             /**< did the call copy a new sub-SCIP? */
+   );
+
 #ifdef __cplusplus
 }
 #endif
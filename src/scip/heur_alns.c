@@ -33,6 +33,7 @@
 #include "blockmemshell/memory.h"
 #include "scip/cons_linear.h"
 #include "scip/heur_alns.h"
+#include "scip/heur_trysol.h"
 #include "scip/heuristics.h"
 #include "scip/pub_bandit_epsgreedy.h"
 #include "scip/pub_bandit_exp3.h"
@@ -69,6 +70,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -129,6 +131,7 @@
 #define DEFAULT_UNFIXTOL       0.1  /**< tolerance by which the fixing rate may be exceeded without generic unfixing */
 #define DEFAULT_USELOCALREDCOST FALSE /**< should local reduced costs be used for generic (un)fixing? */
 #define DEFAULT_BETA           0.0  /**< default reward offset between 0 and 1 at every observation for exp3 */
+#define DEFAULT_SCALEBYTIME    FALSE /**< should the effort be measured by the solving time instead of the nodes of the sub-SCIP? */
 
 /*
  * the following 3 parameters have been tuned by a simulation experiment
@@ -151,6 +154,7 @@
 #define DEFAULT_USESUBSCIPHEURS  FALSE /**< should the heuristic activate other sub-SCIP heuristics during its search?  */
 #define DEFAULT_COPYCUTS         FALSE /**< should cutting planes be copied to the sub-SCIP? */
 #define DEFAULT_REWARDFILENAME   "-"   /**< file name to store all rewards and the selection of the bandit */
+#define DEFAULT_NBACKGROUND      0     /**< maximal number of sub-SCIPs solved in the background (0: solve synchronously) */
 
 /* individual random seeds */
 #define DEFAULT_SEED 113
@@ -212,6 +216,9 @@
 #define EVENTHDLR_NAME         "Alns"
 #define EVENTHDLR_DESC         "LP event handler for " HEUR_NAME " heuristic"
 #define SCIP_EVENTTYPE_ALNS (SCIP_EVENTTYPE_LPSOLVED | SCIP_EVENTTYPE_SOLFOUND | SCIP_EVENTTYPE_BESTSOLFOUND)
+#define SCIP_EVENTTYPE_ALNSBACKGROUND (SCIP_EVENTTYPE_ALNS | SCIP_EVENTTYPE_PRESOLVEROUND | SCIP_EVENTTYPE_NODEFOCUSED)
+#define EVENTHDLR_BG_NAME      "Alnsbackground"
+#define EVENTHDLR_BG_DESC      "node event handler collecting the sub-SCIPs that " HEUR_NAME " solves in the background"
 
 /* properties of the ALNS neighborhood statistics table */
 #define TABLE_NAME_NEIGHBORHOOD                  "neighborhood"
@@ -251,6 +258,8 @@ typedef struct NH_Stats NH_STATS; /**< neighborhood statistics data structure */
 
 typedef struct Nh NH;             /**< neighborhood data structure */
 
+typedef struct BackgroundJob BACKGROUNDJOB; /**< sub-SCIP solved in the background */
+
 
 /*
  * variable priorization data structure for sorting
@@ -353,6 +362,7 @@ struct NH_Stats
    SCIP_Longint          nsolsfound;         /**< the total number of solutions found */
    SCIP_Longint          nbestsolsfound;     /**< the total number of improving solutions found */
    int                   nfixings;           /**< the number of fixings in one run */
+   SCIP_Real             solvingtime;        /**< the solving time of the sub-SCIP in one run */
    int                   statushist[NHISTENTRIES]; /**< array to count sub-SCIP statuses */
 };
 
@@ -446,6 +456,17 @@ struct SCIP_HeurData
    SCIP_Real             rewardbaseline;     /**< the reward baseline to separate successful and failed calls */
    SCIP_Real             fixtol;             /**< tolerance by which the fixing rate may be missed without generic fixing */
    SCIP_Real             unfixtol;           /**< tolerance by which the fixing rate may be exceeded without generic unfixing */
+   SCIP_Real             subsciptime;        /**< total solving time of all timed sub-SCIP runs */
+   BACKGROUNDJOB*        bgjobs;             /**< slots for sub-SCIPs solved in the background */
+   SCIP_EVENTHDLR*       bgeventhdlr;        /**< node event handler collecting the sub-SCIPs solved in the background */
+   int                   nbgjobs;            /**< number of slots for sub-SCIPs solved in the background */
+   int                   bgfilterpos;        /**< filter position of the node event collecting background jobs, or -1 */
+   int                   nbackground;        /**< maximal number of sub-SCIPs solved in the background (0: solve synchronously) */
+   int                   nbglaunched;        /**< number of sub-SCIPs started in the background in the current run */
+   int                   nbgcollected;       /**< number of background sub-SCIPs whose results were collected in the current run */
+   int                   nbgdiscarded;       /**< number of background sub-SCIPs whose results were discarded in the current run */
+   int                   nbgsols;            /**< number of solutions of background sub-SCIPs transferred to the main SCIP */
+   int                   nsubsciptimes;      /**< number of timed sub-SCIP runs */
    int                   nneighborhoods;     /**< number of neighborhoods */
    int                   nactiveneighborhoods;/**< number of active neighborhoods */
    int                   ninitneighborhoods; /**< neighborhoods that were used at least one time */
@@ -469,6 +490,7 @@ struct SCIP_HeurData
    SCIP_Bool             resetweights;       /**< should the bandit algorithms be reset when a new problem is read? */
    SCIP_Bool             subsciprandseeds;   /**< should random seeds of sub-SCIPs be altered to increase diversification? */
    SCIP_Bool             scalebyeffort;      /**< should the reward be scaled by the effort? */
+   SCIP_Bool             scalebytime;        /**< should the effort be measured by the solving time instead of the nodes of the sub-SCIP? */
    SCIP_Bool             copycuts;           /**< should cutting planes be copied to the sub-SCIP? */
    SCIP_Bool             uselocalredcost;    /**< should local reduced costs be used for generic (un)fixing? */
    SCIP_Bool             initduringroot;     /**< should the heuristic be executed multiple times during the root node? */
@@ -484,9 +506,33 @@ struct SCIP_EventData
    SCIP_Longint          nodelimit;          /**< node limit of the run */
    SCIP_Real             lplimfac;           /**< limit fraction of LPs per node to interrupt sub-SCIP */
    NH_STATS*             runstats;           /**< run statistics for the current neighborhood */
+   BACKGROUNDJOB*        bgjob;              /**< background job solving the sub-SCIP, or NULL if it is solved synchronously */
    SCIP_Bool             allrewardsmode;     /**< true if solutions should only be checked for reward comparisons */
 };
 
+/** sub-SCIP that is solved in the background by a job of the task processing interface
+ *
+ *  The sub-SCIP is created and set up by the main thread. The job only presolves and solves it; solutions, statistics,
+ *  and the reward of the neighborhood are collected by the main thread after the next node or heuristic call once the
+ *  job has finished. The event handler of the sub-SCIP checks the interrupted flag in every presolving round, node, and
+ *  LP solve.
+ */
+struct BackgroundJob
+{
+   SCIP*                 subscip;            /**< sub-SCIP, or NULL if the slot is free */
+   SCIP_VAR**            vars;               /**< main SCIP variables, captured while the job exists */
+   SCIP_VAR**            subvars;            /**< sub-SCIP variables corresponding to vars, or NULL if not copied */
+   SCIP_LOCK*            lock;               /**< lock for the finished and interrupted flags */
+   SCIP_EVENTDATA        eventdata;          /**< data of the event handler in the sub-SCIP */
+   NH_STATS              runstats;           /**< run statistics of the neighborhood */
+   SCIP_Real             targetfixingrate;   /**< target fixing rate of the neighborhood */
+   int                   nvars;              /**< number of entries in vars and subvars */
+   int                   neighborhoodidx;    /**< index of the neighborhood */
+   int                   jobid;              /**< id of the job */
+   SCIP_Bool             finished;           /**< has the job finished? */
+   SCIP_Bool             interrupted;        /**< should the sub-SCIP be interrupted? */
+};
+
 /** represents limits for the sub-SCIP solving process */
 struct SolveLimits
 {
@@ -1008,7 +1054,7 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
    assert(eventdata != NULL);
    assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
    assert(event != NULL);
-   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_ALNS);
+   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_ALNSBACKGROUND);
    assert(eventdata != NULL);
 
    /* treat the different atomic events */
@@ -1016,8 +1062,13 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
    {
    case SCIP_EVENTTYPE_SOLFOUND:
    case SCIP_EVENTTYPE_BESTSOLFOUND:
-      /* try to transfer the solution to the original SCIP */
-      SCIP_CALL( transferSolution(scip, eventdata) );
+      /* try to transfer the solution to the original SCIP; in the background, the main SCIP must not be changed, and
+       * the best solution is transferred after the sub-SCIP finished
+       */
+      if( eventdata->bgjob == NULL )
+      {
+         SCIP_CALL( transferSolution(scip, eventdata) );
+      }
       break;
    case SCIP_EVENTTYPE_LPSOLVED:
       /* interrupt solution process of sub-SCIP */
@@ -1025,6 +1076,24 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
       {
          SCIPdebugMsg(scip, "interrupt after  %" SCIP_LONGINT_FORMAT " LPs\n", SCIPgetNLPs(scip));
          SCIP_CALL( SCIPinterruptSolve(scip) );
+         break;
+      }
+      /*lint -fallthrough*/
+   case SCIP_EVENTTYPE_PRESOLVEROUND:
+   case SCIP_EVENTTYPE_NODEFOCUSED:
+      if( eventdata->bgjob != NULL )
+      {
+         SCIP_Bool interrupted;
+
+         /* the main SCIP requests the interruption through the job, since it must not change the sub-SCIP itself */
+         SCIP_CALL( SCIPtpiAcquireLock(eventdata->bgjob->lock) );
+         interrupted = eventdata->bgjob->interrupted;
+         SCIP_CALL( SCIPtpiReleaseLock(eventdata->bgjob->lock) );
+
+         if( interrupted )
+         {
+            SCIP_CALL( SCIPinterruptSolve(scip) );
+         }
       }
       break;
    default:
@@ -1045,6 +1114,7 @@ void initRunStats(
    stats->nsolsfound = 0;
    stats->usednodes = 0L;
    stats->nfixings = 0;
+   stats->solvingtime = 0.0;
    stats->oldupperbound = SCIPgetUpperbound(scip);
    stats->newupperbound = SCIPgetUpperbound(scip);
 }
@@ -1061,6 +1131,7 @@ void updateRunStats(
       subscip = NULL;
 
    stats->usednodes = subscip != NULL ? SCIPgetNNodes(subscip) : 0L;
+   stats->solvingtime = subscip != NULL ? SCIPgetSolvingTime(subscip) : 0.0;
 }
 
 /** get the histogram index for this status */
@@ -1165,6 +1236,13 @@ void printNeighborhoodStatistics(
       SCIPinfoMessage(scip, file, " %4d", i < heurdata->nactiveneighborhoods ? 1 : 0);
       SCIPinfoMessage(scip, file, "\n");
    }
+
+   if( heurdata->nbglaunched > 0 )
+   {
+      SCIPinfoMessage(scip, file, "Background jobs    : %10s %10s %10s %10s\n", "Launched", "Collected", "Discarded", "Sols");
+      SCIPinfoMessage(scip, file, "  %-17s: %10d %10d %10d %10d\n", "total", heurdata->nbglaunched, heurdata->nbgcollected,
+         heurdata->nbgdiscarded, heurdata->nbgsols);
+   }
 }
 
 /** update the statistics of the neighborhood based on the sub-SCIP run */
@@ -2084,7 +2162,13 @@ SCIP_RETCODE getReward(
    assert(runstats->usednodes >= 0);
    assert(runstats->nfixings >= 0);
 
-   effort = runstats->usednodes / 100.0;
+   /* the effort is measured either in nodes or relative to the average solving time of all sub-SCIPs; the time accounts
+    * for the actual cost of a neighborhood if sub-SCIPs are solved in the background on busy cores
+    */
+   if( heurdata->scalebytime && heurdata->nsubsciptimes > 0 && heurdata->subsciptime > 0.0 )
+      effort = runstats->solvingtime / (heurdata->subsciptime / heurdata->nsubsciptimes);
+   else
+      effort = runstats->usednodes / 100.0;
 
    ndiscretevars = SCIPgetNBinVars(scip) + SCIPgetNIntVars(scip);
    /* assume that every fixed variable linearly reduces the subproblem complexity */
@@ -2320,6 +2404,409 @@ SCIP_RETCODE setupSubScip(
    return SCIP_OKAY;
 }
 
+/** updates the statistics, the fixing rate, the minimum improvement, the target node limit, and the bandit algorithm
+ *  after a neighborhood was run
+ */
+static
+SCIP_RETCODE processRunResults(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   int                   banditidx,          /**< index of the neighborhood that was run */
+   NH_STATS*             runstats,           /**< run statistics */
+   SCIP_STATUS           subscipstatus,      /**< status of the sub-SCIP solve */
+   SCIP_Real             reward,             /**< measured reward */
+   SCIP_Bool             allrewardsmode      /**< are the rewards of all neighborhoods determined? */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   heurdata->usednodes += runstats->usednodes;
+
+   if( runstats->solvingtime > 0.0 )
+   {
+      heurdata->subsciptime += runstats->solvingtime;
+      ++heurdata->nsubsciptimes;
+   }
+
+   /* determine the success of this neighborhood, and update the target fixing rate for the next time */
+   updateNeighborhoodStats(runstats, heurdata->neighborhoods[banditidx], subscipstatus);
+
+   /* adjust the fixing rate for this neighborhood
+    * make no adjustments in all rewards mode, because this only affects 1 of 8 heuristics
+    */
+   if( heurdata->adjustfixingrate && ! allrewardsmode )
+   {
+      SCIPdebugMsg(scip, "Update fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
+      updateFixingRate(heurdata->neighborhoods[banditidx], subscipstatus, runstats);
+      SCIPdebugMsg(scip, "New fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
+   }
+   /* similarly, update the minimum improvement for the ALNS heuristic */
+   if( heurdata->adjustminimprove )
+   {
+      SCIPdebugMsg(scip, "Update Minimum Improvement: %.4f\n", heurdata->minimprove);
+      updateMinimumImprovement(heurdata, subscipstatus, runstats);
+      SCIPdebugMsg(scip, "--> %.4f\n", heurdata->minimprove);
+   }
+
+   /* update the target node limit based on the status of the selected algorithm */
+   if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
+   {
+      updateTargetNodeLimit(heurdata, runstats, subscipstatus);
+   }
+
+   /* update the bandit algorithm by the measured reward */
+   SCIP_CALL( updateBanditAlgorithm(scip, heurdata, reward, banditidx) );
+
+   return SCIP_OKAY;
+}
+
+/** returns whether sub-SCIPs are solved in the background through the task processing interface
+ *
+ *  Jobs must run independently of the main thread, which is only the case for the tinycthread implementation of the task
+ *  processing interface; OpenMP tasks would be finished before the heuristic returns. If no thread pool is available, see
+ *  SCIPacquireTPI(), sub-SCIPs are solved synchronously. Inside of a sub-SCIP, which may itself run in a job and copies
+ *  the parameters of the main SCIP, sub-SCIPs are always solved synchronously.
+ */
+static
+SCIP_RETCODE alnsUseBackground(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS neighborhood */
+   SCIP_Bool*            usebackground       /**< pointer to store whether sub-SCIPs are solved in the background */
+   )
+{
+   assert(heurdata != NULL);
+   assert(usebackground != NULL);
+
+   *usebackground = FALSE;
+
+#ifdef TPI_TNY
+   if( heurdata->nbackground > 0 )
+   {
+      SCIP_CALL( SCIPacquireTPI(scip, usebackground) );
+   }
+#else
+   SCIP_UNUSED(scip);
+#endif
+
+   return SCIP_OKAY;
+}
+
+/** job function presolving and solving a sub-SCIP in the background */
+static
+SCIP_RETCODE execBackgroundJob(
+   void*                 args                /**< the background job */
+   )
+{
+   BACKGROUNDJOB* bgjob;
+   SCIP_RETCODE retcode;
+
+   bgjob = (BACKGROUNDJOB*) args;
+   assert(bgjob != NULL);
+   assert(bgjob->subscip != NULL);
+
+   retcode = SCIPpresolve(bgjob->subscip);
+
+   if( retcode == SCIP_OKAY )
+   {
+      SCIP_Real allfixingrate;
+      SCIP_Bool interrupted;
+
+      /* SCIPsolve() resets the interruption of presolving */
+      SCIP_CALL( SCIPtpiAcquireLock(bgjob->lock) );
+      interrupted = bgjob->interrupted;
+      SCIP_CALL( SCIPtpiReleaseLock(bgjob->lock) );
+
+      /* was presolving successful enough regarding fixings? additional variables added in presolving may lead to the
+       * sub-SCIP having more variables than the original
+       */
+      allfixingrate = (SCIPgetNOrigVars(bgjob->subscip) - SCIPgetNVars(bgjob->subscip)) / (SCIP_Real)SCIPgetNOrigVars(bgjob->subscip);
+      allfixingrate = MAX(allfixingrate, 0.0);
+
+      if( ! interrupted && allfixingrate >= bgjob->targetfixingrate / 2.0 )
+         retcode = SCIPsolve(bgjob->subscip);
+   }
+
+   SCIP_CALL( SCIPtpiAcquireLock(bgjob->lock) );
+   bgjob->finished = TRUE;
+   SCIP_CALL( SCIPtpiReleaseLock(bgjob->lock) );
+
+   return retcode;
+}
+
+/** starts a job solving the given sub-SCIP in the background; the job takes over the sub-SCIP */
+static
+SCIP_RETCODE launchBackgroundJob(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   BACKGROUNDJOB*        bgjob,              /**< free slot for the job */
+   SCIP*                 subscip,            /**< sub-SCIP that has been set up */
+   SCIP_VAR**            vars,               /**< variables of the main SCIP */
+   SCIP_VAR**            subvars,            /**< sub-SCIP variables corresponding to vars */
+   int                   nvars,              /**< number of variables of the main SCIP */
+   NH_STATS*             runstats,           /**< run statistics of the neighborhood */
+   SOLVELIMITS*          solvelimits,        /**< solving limits of the sub-SCIP */
+   int                   neighborhoodidx     /**< index of the neighborhood */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_EVENTHDLR* eventhdlr;
+   SCIP_JOB* job;
+   SCIP_SUBMITSTATUS status;
+   int v;
+
+   assert(bgjob != NULL);
+   assert(bgjob->subscip == NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   /* the sub-SCIP must not print to the message handler of the main SCIP concurrently */
+   SCIP_CALL( SCIPsetMessagehdlr(subscip, NULL) );
+
+   /* the solution is mapped back through the variables themselves, since variables of the main SCIP may be added,
+    * deleted, or reordered while the job runs
+    */
+   bgjob->subscip = subscip;
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &bgjob->vars, vars, nvars) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &bgjob->subvars, subvars, nvars) );
+   bgjob->nvars = nvars;
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPcaptureVar(scip, bgjob->vars[v]) );
+   }
+   bgjob->runstats = *runstats;
+   bgjob->targetfixingrate = heurdata->neighborhoods[neighborhoodidx]->fixingrate.targetfixingrate;
+   bgjob->neighborhoodidx = neighborhoodidx;
+   bgjob->finished = FALSE;
+   bgjob->interrupted = FALSE;
+
+   bgjob->eventdata.nodelimit = solvelimits->nodelimit;
+   bgjob->eventdata.lplimfac = heurdata->lplimfac;
+   bgjob->eventdata.heur = heur;
+   bgjob->eventdata.sourcescip = scip;
+   bgjob->eventdata.subvars = bgjob->subvars;
+   bgjob->eventdata.runstats = &bgjob->runstats;
+   bgjob->eventdata.bgjob = bgjob;
+   bgjob->eventdata.allrewardsmode = FALSE;
+
+   /* include an event handler to interrupt the sub-SCIP */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
+
+   /* transform the problem before catching the events */
+   SCIP_CALL( SCIPtransformProb(subscip) );
+   SCIP_CALL( SCIPcatchEvent(subscip, SCIP_EVENTTYPE_ALNSBACKGROUND, eventhdlr, &bgjob->eventdata, NULL) );
+
+   SCIP_CALL( SCIPtpiInitLock(&bgjob->lock) );
+
+   bgjob->jobid = SCIPtpiGetNewJobID();
+   SCIP_CALL( SCIPtpiCreateJob(&job, bgjob->jobid, execBackgroundJob, (void*) bgjob) );
+   SCIP_CALL( SCIPtpiSubmitJob(job, &status) );
+   assert(status == SCIP_SUBMIT_SUCCESS);
+   ++heurdata->nbglaunched;
+
+   SCIPdebugMsg(scip, "Started '%s' neighborhood %d in the background\n", heurdata->neighborhoods[neighborhoodidx]->name,
+      neighborhoodidx);
+
+   return SCIP_OKAY;
+}
+
+/** waits for a background job, and transfers the best solution of its sub-SCIP and its results to the main SCIP unless
+ *  they should be discarded
+ *
+ *  Inside of an event callback, solutions must not be added to the main SCIP, since that issues events itself; the
+ *  solution is then passed to the trysol heuristic, which tries it at the next node.
+ */
+static
+SCIP_RETCODE collectBackgroundJob(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   SCIP_HEUR*            trysolheur,         /**< trysol heuristic to pass the solution to, or NULL to try it directly */
+   BACKGROUNDJOB*        bgjob,              /**< the background job */
+   SCIP_Bool             discard             /**< should the results of the job be discarded? */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   NH* neighborhood;
+   SCIP_RETCODE retcode;
+   int v;
+
+   assert(bgjob != NULL);
+   assert(bgjob->subscip != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   neighborhood = heurdata->neighborhoods[bgjob->neighborhoodidx];
+
+   retcode = SCIPtpiCollectJobs(bgjob->jobid);
+   SCIPtpiDestroyLock(&bgjob->lock);
+
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPwarningMessage(scip, "Error while solving subproblem in ALNS heuristic in the background; sub-SCIP terminated with code <%d>\n", retcode);
+      discard = TRUE;
+   }
+
+   if( ! discard )
+   {
+      SCIP_Real rewards[NREWARDTYPES];
+      SCIP_SOL* subsol;
+
+      subsol = SCIPgetBestSol(bgjob->subscip);
+
+      if( subsol != NULL )
+      {
+         SCIP_SOL* oldbestsol;
+         SCIP_SOL* newsol;
+         SCIP_Bool success;
+
+         oldbestsol = SCIPgetBestSol(scip);
+
+         /* only active variables are set; the values of variables that were fixed or aggregated in the meantime follow
+          * from them, and variables added in the meantime keep value zero
+          */
+         SCIP_CALL( SCIPcreateSol(scip, &newsol, heur) );
+         for( v = 0; v < bgjob->nvars; ++v )
+         {
+            if( bgjob->subvars[v] != NULL && SCIPvarIsActive(bgjob->vars[v]) )
+            {
+               SCIP_CALL( SCIPsetSolVal(scip, newsol, bgjob->vars[v],
+                     SCIPgetSolVal(bgjob->subscip, subsol, bgjob->subvars[v])) );
+            }
+         }
+
+         if( trysolheur != NULL )
+         {
+            SCIP_Real solobj;
+
+            /* count the solution as if it were accepted, since the trysol heuristic checks it later */
+            solobj = SCIPgetSolTransObj(scip, newsol);
+            bgjob->runstats.nsolsfound++;
+            if( SCIPisLT(scip, solobj, SCIPgetUpperbound(scip)) )
+               bgjob->runstats.nbestsolsfound++;
+            bgjob->runstats.newupperbound = MIN(solobj, SCIPgetUpperbound(scip));
+
+            SCIP_CALL( SCIPheurPassSolTrySol(scip, trysolheur, newsol) );
+            SCIP_CALL( SCIPfreeSol(scip, &newsol) );
+            ++heurdata->nbgsols;
+         }
+         else
+         {
+            SCIP_CALL( SCIPtrySolFree(scip, &newsol, FALSE, FALSE, TRUE, TRUE, TRUE, &success) );
+
+            if( success )
+            {
+               bgjob->runstats.nsolsfound++;
+               if( SCIPgetBestSol(scip) != oldbestsol )
+                  bgjob->runstats.nbestsolsfound++;
+               ++heurdata->nbgsols;
+            }
+            bgjob->runstats.newupperbound = SCIPgetUpperbound(scip);
+         }
+      }
+      else
+         bgjob->runstats.newupperbound = SCIPgetUpperbound(scip);
+
+      updateRunStats(&bgjob->runstats, bgjob->subscip);
+
+      SCIP_CALL( SCIPsetClockTime(scip, neighborhood->stats.submipclock,
+            SCIPgetClockTime(scip, neighborhood->stats.submipclock) + bgjob->runstats.solvingtime) );
+
+      SCIP_CALL( getReward(scip, heurdata, &bgjob->runstats, rewards) );
+
+      /* decrease the number of neighborhoods that have not been initialized */
+      if( neighborhood->stats.nruns == 0 )
+         --heurdata->ninitneighborhoods;
+
+      SCIP_CALL( processRunResults(scip, heur, bgjob->neighborhoodidx, &bgjob->runstats, SCIPgetStatus(bgjob->subscip),
+            rewards[REWARDTYPE_TOTAL], FALSE) );
+
+      SCIPdebugMsg(scip, "Collected '%s' neighborhood %d from the background: status %d, %" SCIP_LONGINT_FORMAT " nodes, %.2f seconds\n",
+         neighborhood->name, bgjob->neighborhoodidx, SCIPgetStatus(bgjob->subscip), bgjob->runstats.usednodes,
+         bgjob->runstats.solvingtime);
+
+      ++heurdata->nbgcollected;
+   }
+   else
+      ++heurdata->nbgdiscarded;
+
+   SCIP_CALL( SCIPfree(&bgjob->subscip) );
+
+   for( v = 0; v < bgjob->nvars; ++v )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &bgjob->vars[v]) );
+   }
+   SCIPfreeBlockMemoryArray(scip, &bgjob->subvars, bgjob->nvars);
+   SCIPfreeBlockMemoryArray(scip, &bgjob->vars, bgjob->nvars);
+
+   return SCIP_OKAY;
+}
+
+/** collects the background jobs that have finished, or waits for all of them and discards their results */
+static
+SCIP_RETCODE collectBackgroundJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   SCIP_HEUR*            trysolheur,         /**< trysol heuristic to pass solutions to, or NULL to try them directly */
+   SCIP_Bool             discard             /**< should all jobs be interrupted and their results be discarded? */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   int j;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   for( j = 0; j < heurdata->nbgjobs; ++j )
+   {
+      BACKGROUNDJOB* bgjob = &heurdata->bgjobs[j];
+      SCIP_Bool finished;
+
+      if( bgjob->subscip == NULL )
+         continue;
+
+      SCIP_CALL( SCIPtpiAcquireLock(bgjob->lock) );
+      finished = bgjob->finished;
+      if( discard )
+         bgjob->interrupted = TRUE;
+      SCIP_CALL( SCIPtpiReleaseLock(bgjob->lock) );
+
+      if( finished || discard )
+      {
+         SCIP_CALL( collectBackgroundJob(scip, heur, trysolheur, bgjob, discard) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution callback of the node event handler in the main SCIP, which collects the finished background jobs */
+static
+SCIP_DECL_EVENTEXEC(eventExecAlnsBackground)
+{
+   SCIP_HEUR* heur;
+   SCIP_HEUR* trysolheur;
+
+   assert(eventhdlr != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_BG_NAME) == 0);
+   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_NODESOLVED);
+
+   heur = SCIPfindHeur(scip, HEUR_NAME);
+   assert(heur != NULL);
+
+   /* without the trysol heuristic, finished jobs are collected by the next call of ALNS */
+   trysolheur = SCIPfindHeur(scip, "trysol");
+   if( trysolheur == NULL )
+      return SCIP_OKAY;
+
+   SCIP_CALL( collectBackgroundJobs(scip, heur, trysolheur, FALSE) );
+
+   return SCIP_OKAY;
+}
+
 /** execution method of primal heuristic */
 static
 SCIP_DECL_HEUREXEC(heurExecAlns)
@@ -2344,6 +2831,8 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
    SCIP_Bool run;
    SCIP_Bool allrewardsmode;
    SCIP_Real rewards[NNEIGHBORHOODS][NREWARDTYPES] = {{0}};
+   BACKGROUNDJOB* bgjob;
+   SCIP_Bool launched;
    int banditidx;
 
    int i;
@@ -2356,6 +2845,12 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
    if( heurdata->nactiveneighborhoods == 0 )
       return SCIP_OKAY;
 
+   /* collect the sub-SCIPs that finished in the background, and add their solutions to the main SCIP */
+   if( heurdata->nbgjobs > 0 )
+   {
+      SCIP_CALL( collectBackgroundJobs(scip, heur, NULL, FALSE) );
+   }
+
    /* we only allow to run multiple times at a node during the root */
    if( (heurtiming & SCIP_HEURTIMING_DURINGLPLOOP) && (SCIPgetDepth(scip) > 0 || !heurdata->initduringroot) )
       return SCIP_OKAY;
@@ -2428,6 +2923,22 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       }
    }
 
+   /* in background mode, a sub-SCIP is only created if a slot for it is free */
+   bgjob = NULL;
+   if( heurdata->nbgjobs > 0 && ! allrewardsmode )
+   {
+      for( i = 0; i < heurdata->nbgjobs && heurdata->bgjobs[i].subscip != NULL; ++i )
+         ;
+
+      if( i == heurdata->nbgjobs )
+      {
+         SCIPdebugMsg(scip, "All %d background jobs are busy\n", heurdata->nbgjobs);
+         return SCIP_OKAY;
+      }
+
+      bgjob = &heurdata->bgjobs[i];
+   }
+
    /* use the neighborhood that requested a delay or select the next neighborhood to run based on the selected bandit algorithm */
    if( heurdata->currneighborhood >= 0 )
    {
@@ -2458,6 +2969,7 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
 
    /* initialize neighborhood statistics for a run */
    ntries = 1;
+   launched = FALSE;
    do
    {
       SCIP_HASHMAP* varmapf;
@@ -2596,6 +3108,19 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       /* set up sub-SCIP parameters */
       SCIP_CALL( setupSubScip(scip, subscip, subvars, &solvelimits, heur, nchgobjs > 0) );
 
+      /* hand the sub-SCIP over to a job that solves it in the background; the results are collected in a later call */
+      if( bgjob != NULL )
+      {
+         SCIP_CALL( launchBackgroundJob(scip, heur, bgjob, subscip, vars, subvars, nvars, &runstats[neighborhoodidx],
+               &solvelimits, neighborhoodidx) );
+         subscip = NULL;
+         launched = TRUE;
+
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+         break;
+      }
+
       /* copy the necessary data into the event data to create new solutions */
       eventdata.nodelimit = solvelimits.nodelimit;  /*lint !e644*/
       eventdata.lplimfac = heurdata->lplimfac;
@@ -2603,6 +3128,7 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       eventdata.sourcescip = scip;
       eventdata.subvars = subvars;
       eventdata.runstats = &runstats[neighborhoodidx];
+      eventdata.bgjob = NULL;
       eventdata.allrewardsmode = allrewardsmode;
 
       /* include an event handler to transfer solutions into the main SCIP */
@@ -2681,42 +3207,18 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
    if( ! allrewardsmode )
       banditidx = neighborhoodidx;
 
-   if( *result != SCIP_DELAYED )
+   if( launched )
+   {
+      resetCurrentNeighborhood(heurdata);
+   }
+   else if( *result != SCIP_DELAYED )
    {
       /* decrease the number of neighborhoods that have not been initialized */
       if( neighborhood->stats.nruns == 0 )
          --heurdata->ninitneighborhoods;
 
-      heurdata->usednodes += runstats[banditidx].usednodes;
-
-      /* determine the success of this neighborhood, and update the target fixing rate for the next time */
-      updateNeighborhoodStats(&runstats[banditidx], heurdata->neighborhoods[banditidx], subscipstatus[banditidx]);
-
-      /* adjust the fixing rate for this neighborhood
-       * make no adjustments in all rewards mode, because this only affects 1 of 8 heuristics
-       */
-      if( heurdata->adjustfixingrate && ! allrewardsmode )
-      {
-         SCIPdebugMsg(scip, "Update fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
-         updateFixingRate(heurdata->neighborhoods[banditidx], subscipstatus[banditidx], &runstats[banditidx]);
-         SCIPdebugMsg(scip, "New fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
-      }
-      /* similarly, update the minimum improvement for the ALNS heuristic */
-      if( heurdata->adjustminimprove )
-      {
-         SCIPdebugMsg(scip, "Update Minimum Improvement: %.4f\n", heurdata->minimprove);
-         updateMinimumImprovement(heurdata, subscipstatus[banditidx], &runstats[banditidx]);
-         SCIPdebugMsg(scip, "--> %.4f\n", heurdata->minimprove);
-      }
-
-      /* update the target node limit based on the status of the selected algorithm */
-      if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
-      {
-         updateTargetNodeLimit(heurdata, &runstats[banditidx], subscipstatus[banditidx]);
-      }
-
-      /* update the bandit algorithm by the measured reward */
-      SCIP_CALL( updateBanditAlgorithm(scip, heurdata, rewards[banditidx][REWARDTYPE_TOTAL], banditidx) );
+      SCIP_CALL( processRunResults(scip, heur, banditidx, &runstats[banditidx], subscipstatus[banditidx],
+            rewards[banditidx][REWARDTYPE_TOTAL], allrewardsmode) );
 
       resetCurrentNeighborhood(heurdata);
    }
@@ -3910,8 +4412,37 @@ SCIP_DECL_HEURINITSOL(heurInitsolAlns)
    }
 
    heurdata->usednodes = 0;
+   heurdata->subsciptime = 0.0;
+   heurdata->nsubsciptimes = 0;
    heurdata->ninitneighborhoods = heurdata->nactiveneighborhoods;
 
+   /* create the slots for sub-SCIPs solved in the background, and collect finished sub-SCIPs after every node */
+   assert(heurdata->bgjobs == NULL);
+   assert(heurdata->bgfilterpos == -1);
+   heurdata->nbgjobs = 0;
+   heurdata->nbglaunched = 0;
+   heurdata->nbgcollected = 0;
+   heurdata->nbgdiscarded = 0;
+   heurdata->nbgsols = 0;
+   if( heurdata->nbackground > 0 && SCIPgetSubscipDepth(scip) == 0 )
+   {
+      SCIP_Bool usebackground;
+
+      SCIP_CALL( alnsUseBackground(scip, heurdata, &usebackground) );
+
+      if( usebackground )
+      {
+         heurdata->nbgjobs = heurdata->nbackground;
+         SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &heurdata->bgjobs, heurdata->nbgjobs) );
+         SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODESOLVED, heurdata->bgeventhdlr, NULL, &heurdata->bgfilterpos) );
+      }
+      else
+      {
+         SCIPwarningMessage(scip, "heuristic <%s> solves its sub-SCIPs synchronously, since no thread pool of the task processing interface is available\n",
+            HEUR_NAME);
+      }
+   }
+
    heurdata->lastcallsol = NULL;
    heurdata->firstcallthissol = 0;
 
@@ -3923,6 +4454,33 @@ SCIP_DECL_HEURINITSOL(heurInitsolAlns)
 }
 
 
+/** solving process deinitialization method of primal heuristic (called before branch and bound process data is freed) */
+static
+SCIP_DECL_HEUREXITSOL(heurExitsolAlns)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(scip != NULL);
+   assert(heur != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   /* solutions cannot be added anymore, so the sub-SCIPs still running in the background are interrupted and discarded */
+   if( heurdata->nbgjobs > 0 )
+   {
+      SCIP_CALL( SCIPdropEvent(scip, SCIP_EVENTTYPE_NODESOLVED, heurdata->bgeventhdlr, NULL, heurdata->bgfilterpos) );
+      heurdata->bgfilterpos = -1;
+
+      SCIP_CALL( collectBackgroundJobs(scip, heur, NULL, TRUE) );
+
+      SCIPfreeBlockMemoryArray(scip, &heurdata->bgjobs, heurdata->nbgjobs);
+      heurdata->nbgjobs = 0;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** deinitialization method of primal heuristic (called before transformed problem is freed) */
 static
 SCIP_DECL_HEUREXIT(heurExitAlns)
@@ -4021,6 +4579,7 @@ SCIP_RETCODE SCIPincludeHeurAlns(
 
    /* TODO make this a user parameter? */
    heurdata->lplimfac = LPLIMFAC;
+   heurdata->bgfilterpos = -1;
 
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &heurdata->neighborhoods, NNEIGHBORHOODS) );
 
@@ -4031,6 +4590,11 @@ SCIP_RETCODE SCIPincludeHeurAlns(
 
    assert(heur != NULL);
 
+   /* include event handler for collecting the sub-SCIPs solved in the background */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &heurdata->bgeventhdlr, EVENTHDLR_BG_NAME, EVENTHDLR_BG_DESC,
+         eventExecAlnsBackground, NULL) );
+   assert(heurdata->bgeventhdlr != NULL);
+
    /* include all neighborhoods */
    SCIP_CALL( includeNeighborhoods(scip, heurdata) );
 
@@ -4039,6 +4603,7 @@ SCIP_RETCODE SCIPincludeHeurAlns(
    SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeAlns) );
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitAlns) );
    SCIP_CALL( SCIPsetHeurInitsol(scip, heur, heurInitsolAlns) );
+   SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolAlns) );
    SCIP_CALL( SCIPsetHeurExit(scip, heur, heurExitAlns) );
 
    SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/shownbstats",
@@ -4168,6 +4733,14 @@ SCIP_RETCODE SCIPincludeHeurAlns(
          "should the reward be scaled by the effort?",
          &heurdata->scalebyeffort, TRUE, DEFAULT_SCALEBYEFFORT, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/scalebytime",
+         "should the effort for scaling the reward be measured by the solving time of the sub-SCIP relative to the average solving time instead of by its nodes?",
+         &heurdata->scalebytime, TRUE, DEFAULT_SCALEBYTIME, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nbackground",
+         "maximal number of sub-SCIPs solved in the background on worker threads, which requires the tinycthread task processing interface (0: solve synchronously)",
+         &heurdata->nbackground, TRUE, DEFAULT_NBACKGROUND, 0, 64, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/copycuts",
          "should cutting planes be copied to the sub-SCIP?",
          &heurdata->copycuts, TRUE, DEFAULT_COPYCUTS, NULL, NULL) );
@@ -245,6 +245,141 @@ SCIP_RETCODE getMinFeas(
    return SCIP_OKAY;
 }
 
+/** computes the minimum feasibilities of several points at once; a negative value means that there is an infeasibility
+ *
+ *  Gives the same feasibilities as getMinFeas(), but evaluates the expression of each nlrow in all points at once.
+ */
+static
+SCIP_RETCODE getMinFeasBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLROW**          nlrows,             /**< array containing all nlrows */
+   int                   nnlrows,            /**< total number of nlrows */
+   SCIP_HASHMAP*         varindex,           /**< maps variables to indicies between 0,..,SCIPgetNVars(scip)-1 */
+   SCIP_SOL**            sols,               /**< solutions */
+   int                   nsols,              /**< number of solutions */
+   SCIP_Real*            minfeas             /**< buffer to store the minimum feasibility of each solution */
+   )
+{
+   SCIP_VAR** exprvars;
+   SCIP_Real* activities;
+   SCIP_Real* exprvals;
+   SCIP_Real* varvals;
+   SCIP_Bool* isexprvar;
+   int nvars;
+   int i;
+   int j;
+   int k;
+
+   assert(scip != NULL);
+   assert(nlrows != NULL);
+   assert(nnlrows > 0);
+   assert(varindex != NULL);
+   assert(sols != NULL);
+   assert(nsols > 0);
+   assert(minfeas != NULL);
+
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &activities, nsols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprvals, nsols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprvars, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varvals, (size_t)nvars * nsols) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &isexprvar, nvars) );
+
+   for( k = 0; k < nsols; ++k )
+      minfeas[k] = SCIPinfinity(scip);
+
+   for( i = 0; i < nnlrows; ++i )
+   {
+      SCIP_NLROW* nlrow = nlrows[i];
+      SCIP_EXPR* expr;
+      SCIP_Real activity;
+      SCIP_Real feasibility;
+
+      assert(nlrow != NULL);
+
+      /* linear part */
+      for( k = 0; k < nsols; ++k )
+         activities[k] = SCIPnlrowGetConstant(nlrow);
+
+      for( j = 0; j < SCIPnlrowGetNLinearVars(nlrow); ++j )
+      {
+         SCIP_VAR* var = SCIPnlrowGetLinearVars(nlrow)[j];
+         SCIP_Real coef = SCIPnlrowGetLinearCoefs(nlrow)[j];
+
+         for( k = 0; k < nsols; ++k )
+            activities[k] += coef * SCIPgetSolVal(scip, sols[k], var);
+      }
+
+      /* expression part */
+      expr = SCIPnlrowGetExpr(nlrow);
+
+      if( expr != NULL )
+      {
+         SCIP_EXPR** varexprs;
+         int nvarexprs;
+         int nexprvars = 0;
+
+         /* collect the variables of the expression, each once */
+         SCIP_CALL( SCIPgetExprNVars(scip, expr, &nvarexprs) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &varexprs, nvarexprs) );
+         SCIP_CALL( SCIPgetExprVarExprs(scip, expr, varexprs, &nvarexprs) );
+
+         for( j = 0; j < nvarexprs; ++j )
+         {
+            SCIP_VAR* var = SCIPgetVarExprVar(varexprs[j]);
+
+            assert(getVarIndex(varindex, var) >= 0 && getVarIndex(varindex, var) < nvars);
+
+            if( !isexprvar[getVarIndex(varindex, var)] )
+            {
+               isexprvar[getVarIndex(varindex, var)] = TRUE;
+               exprvars[nexprvars++] = var;
+            }
+
+            SCIP_CALL( SCIPreleaseExpr(scip, &varexprs[j]) );
+         }
+         SCIPfreeBufferArray(scip, &varexprs);
+
+         for( j = 0; j < nexprvars; ++j )
+         {
+            isexprvar[getVarIndex(varindex, exprvars[j])] = FALSE;
+
+            for( k = 0; k < nsols; ++k )
+               varvals[(size_t)j * nsols + k] = SCIPgetSolVal(scip, sols[k], exprvars[j]);
+         }
+
+         SCIP_CALL( SCIPevalExprBatch(scip, expr, nexprvars, exprvars, nsols, varvals, exprvals, NULL) );
+
+         for( k = 0; k < nsols; ++k )
+         {
+            if( exprvals[k] == SCIP_INVALID ) /*lint !e777*/
+               activities[k] = SCIP_INVALID;
+            else
+               activities[k] += exprvals[k];
+         }
+      }
+
+      /* compute the feasibility as in SCIPgetNlRowSolFeasibility() */
+      for( k = 0; k < nsols; ++k )
+      {
+         activity = MAX(activities[k], -SCIPinfinity(scip)); /*lint !e666*/
+         activity = MIN(activity, SCIPinfinity(scip)); /*lint !e666*/
+
+         feasibility = MIN(SCIPnlrowGetRhs(nlrow) - activity, activity - SCIPnlrowGetLhs(nlrow));
+         minfeas[k] = MIN(minfeas[k], feasibility);
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &isexprvar);
+   SCIPfreeBufferArray(scip, &varvals);
+   SCIPfreeBufferArray(scip, &exprvars);
+   SCIPfreeBufferArray(scip, &exprvals);
+   SCIPfreeBufferArray(scip, &activities);
+
+   return SCIP_OKAY;
+}
+
 /** computes the gradient for a given point and nonlinear row */
 static
 SCIP_RETCODE computeGradient(
@@ -322,7 +457,8 @@ SCIP_RETCODE improvePoint(
    int                   maxiter,            /**< maximum number of iterations */
    SCIP_Real             minimprfac,         /**< minimum required improving factor to proceed in the improvement of a single point */
    int                   minimpriter,        /**< number of iteration when checking the minimum improvement */
-   SCIP_Real*            minfeas,            /**< pointer to store the minimum feasibility */
+   SCIP_Real*            minfeas,            /**< pointer to the minimum feasibility of the starting point, see
+                                              *   getMinFeasBatch(); stores the minimum feasibility of the improved point */
    SCIP_Real*            nlrowgradcosts,     /**< estimated costs for each gradient computation */
    SCIP_Real*            gradcosts           /**< pointer to store the estimated gradient costs */
    )
@@ -347,7 +483,6 @@ SCIP_RETCODE improvePoint(
 
    *gradcosts = 0.0;
 
-   SCIP_CALL( getMinFeas(scip, nlrows, nnlrows, point, minfeas) );
 #ifdef SCIP_DEBUG_IMPROVEPOINT
    printf("start minfeas = %e\n", *minfeas);
 #endif
@@ -819,8 +954,10 @@ SCIP_RETCODE applyHeur(
       goto TERMINATE;
 
    /*
-    * 2. improve points via consensus vectors
+    * 2. improve points via consensus vectors, starting from the feasibilities of all points
     */
+   SCIP_CALL( getMinFeasBatch(scip, nlrows, nnlrows, varindex, points, nrndpoints, feasibilities) );
+
    gradlimit = heurdata->gradlimit == 0.0 ? SCIPinfinity(scip) : heurdata->gradlimit;
    for( npoints = 0; npoints < nrndpoints && gradlimit >= 0 && !SCIPisStopped(scip); ++npoints )
    {
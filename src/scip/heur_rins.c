@@ -81,6 +81,7 @@
                                          * of the original scip be copied to constraints of the subscip
                                          */
 #define DEFAULT_USEUCT        FALSE     /* should uct node selection be used at the beginning of the search?     */
+#define DEFAULT_REUSESUBSCIP  FALSE     /* should the sub-SCIP be kept and reused between calls?                */
 
 /* event handler properties */
 #define EVENTHDLR_NAME         "Rins"
@@ -108,6 +109,7 @@ struct SCIP_HeurData
                                               *   to constraints in subproblem?
                                               */
    SCIP_Bool             useuct;             /**< should uct node selection be used at the beginning of the search?  */
+   SCIP_Bool             reusesubscip;       /**< should the sub-SCIP be kept and reused between calls?               */
 };
 
 /*
@@ -206,6 +208,8 @@ static
 SCIP_RETCODE wrapperRins(
    SCIP*                 scip,               /**< original SCIP data structure                        */
    SCIP*                 subscip,            /**< SCIP structure of the subproblem                    */
+   SCIP_VAR**            cachedsubvars,      /**< variables of a cached subproblem with applied fixings, or NULL if
+                                              *   the problem should be copied into \p subscip */
    SCIP_HEUR*            heur,               /**< Heuristic pointer                                   */
    SCIP_HEURDATA*        heurdata,           /**< Heuristic's data                                    */
    SCIP_VAR**            vars,               /**< original problem's variables                        */
@@ -227,30 +231,38 @@ SCIP_RETCODE wrapperRins(
 
    int i;
 
-   /* create the variable mapping hash map */
-   SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
+   if( cachedsubvars == NULL )
+   {
+      /* create the variable mapping hash map */
+      SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
+
+      /* create a problem copy as sub SCIP */
+      SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rins", fixedvars, fixedvals, nfixedvars,
+         heurdata->uselprows, heurdata->copycuts, &success, NULL) );
+
+      /* copy subproblem variables from map to obtain the same order */
+      SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
+      for( i = 0; i < nvars; i++ )
+         subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
 
-   /* create a problem copy as sub SCIP */
-   SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rins", fixedvars, fixedvals, nfixedvars,
-      heurdata->uselprows, heurdata->copycuts, &success, NULL) );
+      /* free hash map */
+      SCIPhashmapFree(&varmapfw);
+   }
+   else
+      subvars = cachedsubvars;
 
-   eventhdlr = NULL;
-   /* create event handler for LP events */
-   SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecRins, NULL) );
+   /* create event handler for LP events; a cached subproblem already has it from an earlier call */
+   eventhdlr = SCIPfindEventhdlr(subscip, EVENTHDLR_NAME);
+   if( eventhdlr == NULL )
+   {
+      SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecRins, NULL) );
+   }
    if( eventhdlr == NULL )
    {
       SCIPerrorMessage("event handler for " HEUR_NAME " heuristic not found.\n");
       return SCIP_PLUGINNOTFOUND;
    }
 
-   /* copy subproblem variables from map to obtain the same order */
-   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for( i = 0; i < nvars; i++ )
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
-
-   /* free hash map */
-   SCIPhashmapFree(&varmapfw);
-
    /* do not abort subproblem on CTRL-C */
    SCIP_CALL( SCIPsetBoolParam(subscip, "misc/catchctrlc", FALSE) );
 
@@ -359,7 +371,10 @@ SCIP_RETCODE wrapperRins(
       *result = SCIP_FOUNDSOL;
 
    /* free subproblem */
-   SCIPfreeBufferArray(scip, &subvars);
+   if( cachedsubvars == NULL )
+   {
+      SCIPfreeBufferArray(scip, &subvars);
+   }
 
    return SCIP_OKAY;
 }
@@ -560,11 +575,30 @@ SCIP_DECL_HEUREXEC(heurExecRins)
    *result = SCIP_DIDNOTFIND;
 
    SCIPdebugMsg(scip, "RINS heuristic fixes %d out of %d binary+integer variables\n", nfixedvars, nbinvars + nintvars);
-   SCIP_CALL( SCIPcreate(&subscip) );
 
-   retcode = wrapperRins(scip, subscip, heur, heurdata, vars, fixedvars, fixedvals, result, nvars, nfixedvars, nnodes);
+   /* the cached subproblem is a copy of the constraints, so it cannot be used if the LP rows should be copied */
+   if( heurdata->reusesubscip && !heurdata->uselprows )
+   {
+      SCIP_VAR** subvars;
+      SCIP_Bool created;
+
+      SCIP_CALL( SCIPgetCachedSubscip(scip, heur, HEUR_NAME, fixedvars, fixedvals, nfixedvars, heurdata->copycuts,
+            &subscip, &subvars, &created, NULL) );
 
-   SCIP_CALL( SCIPfree(&subscip) );
+      retcode = wrapperRins(scip, subscip, subvars, heur, heurdata, vars, fixedvars, fixedvals, result, nvars,
+         nfixedvars, nnodes);
+
+      SCIP_CALL( SCIPreleaseCachedSubscip(scip, heur, &subscip, retcode != SCIP_OKAY) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPcreate(&subscip) );
+
+      retcode = wrapperRins(scip, subscip, NULL, heur, heurdata, vars, fixedvars, fixedvals, result, nvars,
+         nfixedvars, nnodes);
+
+      SCIP_CALL( SCIPfree(&subscip) );
+   }
 
    SCIP_CALL( retcode );
 
@@ -647,5 +681,9 @@ SCIP_RETCODE SCIPincludeHeurRins(
          "should uct node selection be used at the beginning of the search?",
          &heurdata->useuct, TRUE, DEFAULT_USEUCT, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/reusesubscip",
+         "should the subproblem be kept between calls and only the fixings be changed (only if uselprows == FALSE)?",
+         &heurdata->reusesubscip, TRUE, DEFAULT_REUSESUBSCIP, NULL, NULL) );
+
    return SCIP_OKAY;
 }
@@ -1295,6 +1295,8 @@ void SCIPcliqueDelVar(
    assert(SCIPvarIsBinary(var));
    assert(cliquetable != NULL);
 
+   SCIPcliquetableInvalidateAdjacency(cliquetable);
+
    /* if the clique is the leading clique during the cleanup step, we do not need to insert it again */
    if( cliquetable->incleanup && clique->index == 0 )
       return;
@@ -1780,6 +1782,187 @@ SCIP_DECL_HASHKEYVAL(hashkeyvalClique)
                                                 clique->nvars, 2*clique->values[0] +  clique->values[clique->nvars-1]);
 }
 
+/** returns the literal index of a variable/value pair in the adjacency index */
+#define cliquetableLiteral(var, value) (2 * SCIPvarGetIndex(var) + ((value) ? 1 : 0))
+
+/** frees the adjacency index of the clique table */
+static
+void cliquetableFreeAdjacency(
+   SCIP_CLIQUETABLE*     cliquetable         /**< clique table data structure */
+   )
+{
+   assert(cliquetable != NULL);
+
+   BMSfreeMemoryArrayNull(&cliquetable->adjbeg);
+   BMSfreeMemoryArrayNull(&cliquetable->adjlits);
+   cliquetable->nadjlits = 0;
+   cliquetable->adjvalid = FALSE;
+}
+
+/** invalidates and frees the adjacency index of the clique table after a change of the cliques */
+void SCIPcliquetableInvalidateAdjacency(
+   SCIP_CLIQUETABLE*     cliquetable         /**< clique table data structure */
+   )
+{
+   assert(cliquetable != NULL);
+
+   if( cliquetable->adjvalid )
+   {
+      cliquetableFreeAdjacency(cliquetable);
+      cliquetable->adjqueryeffort = 0;
+   }
+}
+
+/** builds the adjacency index of the clique table, which stores for each variable/value pair the sorted list of the
+ *  pairs sharing a clique with it; if the index would have more entries than allowed by presolving/clqindexfac, no
+ *  index is built
+ */
+static
+SCIP_RETCODE cliquetableBuildAdjacency(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_Longint nlits;
+   int* pos;
+   int nlitidx;
+   int maxindex;
+   int i;
+   int j;
+   int k;
+
+   assert(cliquetable != NULL);
+   assert(!cliquetable->adjvalid);
+
+   /* the effort of the queries is counted again from now on */
+   cliquetable->adjqueryeffort = 0;
+
+   /* count the entries of the index */
+   maxindex = -1;
+   nlits = 0;
+   for( i = 0; i < cliquetable->ncliques; ++i )
+   {
+      SCIP_CLIQUE* clique;
+
+      clique = cliquetable->cliques[i];
+      nlits += (SCIP_Longint)clique->nvars * (clique->nvars - 1);
+
+      for( j = 0; j < clique->nvars; ++j )
+         maxindex = MAX(maxindex, SCIPvarGetIndex(clique->vars[j]));
+   }
+
+   if( nlits > set->presol_clqindexfac * cliquetable->nentries || nlits >= INT_MAX || maxindex >= INT_MAX / 2 - 1 )
+   {
+      SCIPsetDebugMsg(set, "no adjacency index for clique table with %" SCIP_LONGINT_FORMAT " entries: %" SCIP_LONGINT_FORMAT " entries needed\n",
+         cliquetable->nentries, nlits);
+      return SCIP_OKAY;
+   }
+
+   cliquetableFreeAdjacency(cliquetable);
+
+   nlitidx = 2 * (maxindex + 1);
+   SCIP_ALLOC( BMSallocClearMemoryArray(&cliquetable->adjbeg, nlitidx + 1) );
+   if( nlits > 0 )
+   {
+      SCIP_ALLOC( BMSallocMemoryArray(&cliquetable->adjlits, nlits) );
+   }
+
+   /* count the neighbors of each literal and compute the start positions */
+   for( i = 0; i < cliquetable->ncliques; ++i )
+   {
+      SCIP_CLIQUE* clique;
+
+      clique = cliquetable->cliques[i];
+      for( j = 0; j < clique->nvars; ++j )
+         cliquetable->adjbeg[cliquetableLiteral(clique->vars[j], clique->values[j]) + 1] += clique->nvars - 1;
+   }
+   for( k = 0; k < nlitidx; ++k )
+      cliquetable->adjbeg[k + 1] += cliquetable->adjbeg[k];
+   assert(cliquetable->adjbeg[nlitidx] == nlits);
+
+   /* store the neighbors */
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &pos, cliquetable->adjbeg, nlitidx) );
+   for( i = 0; i < cliquetable->ncliques; ++i )
+   {
+      SCIP_CLIQUE* clique;
+
+      clique = cliquetable->cliques[i];
+      for( j = 0; j < clique->nvars; ++j )
+      {
+         int lit;
+
+         lit = cliquetableLiteral(clique->vars[j], clique->values[j]);
+         for( k = 0; k < clique->nvars; ++k )
+         {
+            if( k != j )
+               cliquetable->adjlits[pos[lit]++] = cliquetableLiteral(clique->vars[k], clique->values[k]);
+         }
+      }
+   }
+   SCIPsetFreeBufferArray(set, &pos);
+
+   /* sort the neighbors of each literal and remove duplicates, which come from pairs sharing several cliques */
+   nlits = 0;
+   for( k = 0; k < nlitidx; ++k )
+   {
+      int beg;
+      int end;
+
+      beg = cliquetable->adjbeg[k];
+      end = cliquetable->adjbeg[k + 1];
+      cliquetable->adjbeg[k] = (int)nlits;
+
+      if( beg == end )
+         continue;
+
+      SCIPsortInt(&cliquetable->adjlits[beg], end - beg);
+
+      cliquetable->adjlits[nlits++] = cliquetable->adjlits[beg];
+      for( i = beg + 1; i < end; ++i )
+      {
+         if( cliquetable->adjlits[i] != cliquetable->adjlits[nlits - 1] )
+            cliquetable->adjlits[nlits++] = cliquetable->adjlits[i];
+      }
+   }
+   cliquetable->adjbeg[nlitidx] = (int)nlits;
+   if( nlits > 0 && nlits < cliquetable->adjbeg[nlitidx] )
+   {
+      SCIP_ALLOC( BMSreallocMemoryArray(&cliquetable->adjlits, nlits) );
+   }
+   cliquetable->nadjlitidx = nlitidx;
+   cliquetable->nadjlits = nlits;
+   cliquetable->adjvalid = TRUE;
+
+   SCIPsetDebugMsg(set, "built adjacency index for clique table with %d cliques: %" SCIP_LONGINT_FORMAT " entries\n",
+      cliquetable->ncliques, nlits);
+
+   return SCIP_OKAY;
+}
+
+
+/** builds the adjacency index of the clique table if it is enabled and not up to date, the cliques are cleaned up, and
+ *  the queries without the index since the last change of the cliques took at least as many steps as the clique table
+ *  has entries
+ */
+static
+SCIP_RETCODE cliquetableUpdateAdjacency(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   assert(cliquetable != NULL);
+   assert(set != NULL);
+
+   if( set->presol_clqindexfac > 0.0 && !cliquetable->adjvalid && !cliquetable->incleanup
+      && cliquetable->ndirtycliques == 0 && cliquetable->nentries > 0
+      && cliquetable->adjqueryeffort >= cliquetable->nentries )
+   {
+      SCIP_CALL( cliquetableBuildAdjacency(cliquetable, set) );
+   }
+
+   return SCIP_OKAY;
+}
+
 #define HASHTABLE_CLIQUETABLE_SIZE 100
 
 /** creates a clique table data structure */
@@ -1814,6 +1997,12 @@ SCIP_RETCODE SCIPcliquetableCreate(
    (*cliquetable)->incleanup = FALSE;
    (*cliquetable)->compsfromscratch = FALSE;
    (*cliquetable)->ncliquecomponents = -1;
+   (*cliquetable)->adjbeg = NULL;
+   (*cliquetable)->adjlits = NULL;
+   (*cliquetable)->nadjlits = 0;
+   (*cliquetable)->adjqueryeffort = 0;
+   (*cliquetable)->nadjlitidx = 0;
+   (*cliquetable)->adjvalid = FALSE;
 
    return SCIP_OKAY;
 }
@@ -1843,6 +2032,9 @@ SCIP_RETCODE SCIPcliquetableFree(
    if( (*cliquetable)->varidxtable != NULL )
       SCIPhashmapFree(&(*cliquetable)->varidxtable);
 
+   /* free adjacency index */
+   cliquetableFreeAdjacency(*cliquetable);
+
    /* free clique table data */
    BMSfreeMemoryArrayNull(&(*cliquetable)->cliques);
 
@@ -2344,6 +2536,130 @@ void cliquetableUpdateConnectednessClique(
    }
 }
 
+/** returns whether the given variable/value pairs have a common clique in the clique table; the adjacency index of the
+ *  clique table is used if it is up to date, otherwise the clique lists of the variables are intersected
+ */
+SCIP_Bool SCIPcliquetableHaveCommonClique(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   SCIP_VAR*             var1,               /**< first variable */
+   SCIP_Bool             value1,             /**< value of first variable */
+   SCIP_VAR*             var2,               /**< second variable */
+   SCIP_Bool             value2              /**< value of second variable */
+   )
+{
+   assert(cliquetable != NULL);
+   assert(var1 != NULL);
+   assert(var2 != NULL);
+
+   /* a variable is in a clique with itself if it is in any clique, which the clique lists answer directly */
+   if( cliquetable->adjvalid && var1 != var2 )
+   {
+      int lit1;
+      int lit2;
+      int pos;
+
+      lit1 = cliquetableLiteral(var1, value1);
+      lit2 = cliquetableLiteral(var2, value2);
+
+      /* variables created after building the index are in no clique */
+      if( lit1 >= cliquetable->nadjlitidx || lit2 >= cliquetable->nadjlitidx )
+         return FALSE;
+
+      /* search in the shorter list of neighbors */
+      if( cliquetable->adjbeg[lit1 + 1] - cliquetable->adjbeg[lit1] > cliquetable->adjbeg[lit2 + 1] - cliquetable->adjbeg[lit2] )
+      {
+         int tmp;
+
+         tmp = lit1;
+         lit1 = lit2;
+         lit2 = tmp;
+      }
+
+      return SCIPsortedvecFindInt(&cliquetable->adjlits[cliquetable->adjbeg[lit1]], lit2,
+         cliquetable->adjbeg[lit1 + 1] - cliquetable->adjbeg[lit1], &pos);
+   }
+
+   cliquetable->adjqueryeffort += SCIPvarGetNCliques(var1, value1) + SCIPvarGetNCliques(var2, value2);
+
+   return SCIPvarsHaveCommonClique(var1, value1, var2, value2, FALSE);
+}
+
+/** stores for each of the given variable/value pairs whether it has a common clique with the given variable/value pair
+ *  in the clique table; without an up to date adjacency index, the cliques of the given pair are marked once, such that
+ *  each further pair only needs a pass over its own cliques
+ */
+SCIP_RETCODE SCIPcliquetableHaveCommonCliques(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Bool             value,              /**< value of the variable */
+   SCIP_VAR**            vars,               /**< variables to check */
+   SCIP_Bool*            values,             /**< values of the variables to check */
+   int                   nvars,              /**< number of variables to check */
+   SCIP_Bool*            common              /**< array to store whether each pair has a common clique with the given pair */
+   )
+{
+   SCIP_CLIQUE** cliques;
+   SCIP_Bool* marked;
+   int ncliques;
+   int i;
+   int j;
+
+   assert(cliquetable != NULL);
+   assert(var != NULL);
+   assert(vars != NULL || nvars == 0);
+   assert(values != NULL || nvars == 0);
+   assert(common != NULL || nvars == 0);
+
+   if( cliquetable->adjvalid || cliquetable->incleanup || nvars <= 1 )
+   {
+      for( j = 0; j < nvars; ++j )
+         common[j] = SCIPcliquetableHaveCommonClique(cliquetable, var, value, vars[j], values[j]);
+
+      return SCIP_OKAY;
+   }
+
+   /* mark the cliques of the given pair by their position in the clique table */
+   SCIP_CALL( SCIPsetAllocCleanBufferArray(set, &marked, cliquetable->ncliques) );
+
+   cliques = SCIPvarGetCliques(var, value);
+   ncliques = SCIPvarGetNCliques(var, value);
+   for( i = 0; i < ncliques; ++i )
+   {
+      assert(0 <= cliques[i]->index && cliques[i]->index < cliquetable->ncliques);
+      marked[cliques[i]->index] = TRUE;
+   }
+   cliquetable->adjqueryeffort += 2 * ncliques;
+
+   for( j = 0; j < nvars; ++j )
+   {
+      SCIP_CLIQUE** varcliques;
+      int nvarcliques;
+
+      if( vars[j] == var )
+      {
+         common[j] = SCIPvarsHaveCommonClique(var, value, vars[j], values[j], FALSE);
+         continue;
+      }
+
+      varcliques = SCIPvarGetCliques(vars[j], values[j]);
+      nvarcliques = SCIPvarGetNCliques(vars[j], values[j]);
+
+      common[j] = FALSE;
+      for( i = 0; i < nvarcliques && !common[j]; ++i )
+         common[j] = marked[varcliques[i]->index];
+
+      cliquetable->adjqueryeffort += nvarcliques;
+   }
+
+   for( i = 0; i < ncliques; ++i )
+      marked[cliques[i]->index] = FALSE;
+
+   SCIPsetFreeCleanBufferArray(set, &marked);
+
+   return SCIP_OKAY;
+}
+
 /** returns the index of the connected component of the clique graph that the variable belongs to, or -1  */
 int SCIPcliquetableGetVarComponentIdx(
    SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
@@ -2407,6 +2723,8 @@ SCIP_RETCODE SCIPcliquetableAdd(
 
    SCIPsetDebugMsg(set, "trying to add clique %d with %d vars to clique table\n", cliquetable->ncliques, nvars);
 
+   SCIPcliquetableInvalidateAdjacency(cliquetable);
+
    /* check clique on debugging solution */
    SCIP_CALL( SCIPdebugCheckClique(set, vars, values, nvars) ); /*lint !e506 !e774*/
 
@@ -2943,7 +3261,13 @@ SCIP_RETCODE SCIPcliquetableCleanup(
    if( stat->npresolfixedvars == cliquetable->ncleanupfixedvars
       && stat->npresolaggrvars == cliquetable->ncleanupaggrvars
       && cliquetable->ndirtycliques == 0 )
+   {
+      SCIP_CALL( cliquetableUpdateAdjacency(cliquetable, set) );
+
       return SCIP_OKAY;
+   }
+
+   SCIPcliquetableInvalidateAdjacency(cliquetable);
 
    SCIPsetDebugMsg(set, "cleaning up clique table with %d cliques (with %" SCIP_LONGINT_FORMAT " entries)\n", cliquetable->ncliques, cliquetable->nentries);
 
@@ -3121,6 +3445,11 @@ SCIP_RETCODE SCIPcliquetableCleanup(
    /* process events */
    SCIP_CALL( SCIPeventqueueProcess(eventqueue, blkmem, set, NULL, lp, branchcand, NULL) );
 
+   if( !(*infeasible) )
+   {
+      SCIP_CALL( cliquetableUpdateAdjacency(cliquetable, set) );
+   }
+
    return SCIP_OKAY;
 }
 
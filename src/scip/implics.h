@@ -384,6 +384,37 @@ SCIP_RETCODE SCIPcliquetableComputeCliqueComponents(
    int                   nimplvars           /**< number of implicit integer variables */
    );
 
+/** invalidates and frees the adjacency index of the clique table after a change of the cliques */
+void SCIPcliquetableInvalidateAdjacency(
+   SCIP_CLIQUETABLE*     cliquetable         /**< clique table data structure */
+   );
+
+/** returns whether the given variable/value pairs have a common clique in the clique table; the adjacency index of the
+ *  clique table is used if it is up to date, otherwise the clique lists of the variables are intersected
+ */
+SCIP_Bool SCIPcliquetableHaveCommonClique(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   SCIP_VAR*             var1,               /**< first variable */
+   SCIP_Bool             value1,             /**< value of first variable */
+   SCIP_VAR*             var2,               /**< second variable */
+   SCIP_Bool             value2              /**< value of second variable */
+   );
+
+/** stores for each of the given variable/value pairs whether it has a common clique with the given variable/value pair
+ *  in the clique table; without an up to date adjacency index, the cliques of the given pair are marked once, such that
+ *  each further pair only needs a pass over its own cliques
+ */
+SCIP_RETCODE SCIPcliquetableHaveCommonCliques(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Bool             value,              /**< value of the variable */
+   SCIP_VAR**            vars,               /**< variables to check */
+   SCIP_Bool*            values,             /**< values of the variables to check */
+   int                   nvars,              /**< number of variables to check */
+   SCIP_Bool*            common              /**< array to store whether each pair has a common clique with the given pair */
+   );
+
 /** returns the index of the connected component of the clique graph that the variable belongs to, or -1  */
 int SCIPcliquetableGetVarComponentIdx(
    SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
@@ -999,6 +999,44 @@ void SCIPintervalMul(
    intervalSetRoundingMode(roundmode);
 }
 
+/** multiplies vector operand1 with vector operand2 componentwise and stores result in vector resultant
+ *
+ *  The rounding mode is switched only twice for the whole vector instead of twice per component.
+ *  The resultant array must not overlap with the operand arrays.
+ */
+void SCIPintervalMulVectors(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand1,           /**< array of first operands of operation; can have +/-inf entries */
+   SCIP_INTERVAL*        operand2            /**< array of second operands of operation; can have +/-inf entries */
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+   int i;
+
+   assert(resultant != NULL || length == 0);
+   assert(resultant != operand1 || length == 0);
+   assert(resultant != operand2 || length == 0);
+
+   roundmode = intervalGetRoundingMode();
+
+   /* compute infimums of resultant array */
+   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
+   for( i = 0; i < length; ++i )
+   {
+      SCIPintervalMulInf(infinity, &resultant[i], operand1[i], operand2[i]);
+   }
+   /* compute supremums of resultant array */
+   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
+   for( i = 0; i < length; ++i )
+   {
+      SCIPintervalMulSup(infinity, &resultant[i], operand1[i], operand2[i]);
+   }
+
+   intervalSetRoundingMode(roundmode);
+}
+
 /** multiplies operand1 with scalar operand2 and stores infimum of result in infimum of resultant */
 void SCIPintervalMulScalarInf(
    SCIP_Real             infinity,           /**< value for infinity */
@@ -1150,6 +1188,53 @@ void SCIPintervalMulScalar(
    intervalSetRoundingMode(roundmode);
 }
 
+/** multiplies vector operand1 with vector of scalars operand2 componentwise and stores result in vector resultant
+ *
+ *  Gives the same result as SCIPintervalMulScalar() for each component, but switches the rounding mode only twice for
+ *  the whole vector. The resultant array must not overlap with operand1.
+ */
+void SCIPintervalMulScalarVectors(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand1,           /**< array of first operands of operation */
+   SCIP_Real*            operand2            /**< array of second operands of operation */
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+   int i;
+
+   assert(resultant != NULL || length == 0);
+   assert(resultant != operand1 || length == 0);
+
+   roundmode = intervalGetRoundingMode();
+
+   /* compute infimums of resultant array; multiplication by +/-1 is exact and done as in SCIPintervalMulScalar() */
+   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
+   for( i = 0; i < length; ++i )
+   {
+      if( operand2[i] == 1.0 )
+         resultant[i].inf = operand1[i].inf;
+      else if( operand2[i] == -1.0 )
+         resultant[i].inf = -operand1[i].sup;
+      else
+         SCIPintervalMulScalarInf(infinity, &resultant[i], operand1[i], operand2[i]);
+   }
+   /* compute supremums of resultant array */
+   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
+   for( i = 0; i < length; ++i )
+   {
+      if( operand2[i] == 1.0 )
+         resultant[i].sup = operand1[i].sup;
+      else if( operand2[i] == -1.0 )
+         resultant[i].sup = -operand1[i].inf;
+      else
+         SCIPintervalMulScalarSup(infinity, &resultant[i], operand1[i], operand2[i]);
+   }
+
+   intervalSetRoundingMode(roundmode);
+}
+
 /** divides operand1 by operand2 and stores result in resultant */
 void SCIPintervalDiv(
    SCIP_Real             infinity,           /**< value for infinity */
@@ -1497,6 +1582,62 @@ void SCIPintervalSquare(
    intervalSetRoundingMode(roundmode);
 }
 
+/** squares each entry of vector operand and stores result in vector resultant
+ *
+ *  Gives the same result as SCIPintervalSquare() for each component, but switches the rounding mode only twice for the
+ *  whole vector. The resultant array must not overlap with operand.
+ */
+void SCIPintervalSquareVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+   int i;
+
+   assert(resultant != NULL || length == 0);
+   assert(resultant != operand || length == 0);
+
+   roundmode = intervalGetRoundingMode();
+
+   /* compute infimums of resultant array */
+   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
+   for( i = 0; i < length; ++i )
+   {
+      SCIP_Real inf = operand[i].inf;
+      SCIP_Real sup = operand[i].sup;
+
+      assert(!SCIPintervalIsEmpty(infinity, operand[i]));
+
+      if( sup <= 0.0 )
+         resultant[i].inf = sup <= -infinity ? infinity : sup * sup;
+      else if( inf >= 0.0 )
+         resultant[i].inf = inf >= infinity ? infinity : inf * inf;
+      else
+         resultant[i].inf = 0.0;
+   }
+   /* compute supremums of resultant array */
+   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
+   for( i = 0; i < length; ++i )
+   {
+      SCIP_Real inf = operand[i].inf;
+      SCIP_Real sup = operand[i].sup;
+
+      if( sup <= 0.0 )
+         resultant[i].sup = inf <= -infinity ? infinity : inf * inf;
+      else if( inf >= 0.0 )
+         resultant[i].sup = sup >= infinity ? infinity : sup * sup;
+      else if( inf <= -infinity || sup >= infinity )
+         resultant[i].sup = infinity;
+      else
+         resultant[i].sup = MAX(inf * inf, sup * sup);
+   }
+
+   intervalSetRoundingMode(roundmode);
+}
+
 /** stores (positive part of) square root of operand in resultant
  * @attention we assume a correctly rounded sqrt(double) function when rounding is to nearest
  */
@@ -1557,6 +1698,37 @@ void SCIPintervalSquareRoot(
    }
 }
 
+/** stores (positive part of) square root of each entry of vector operand in vector resultant
+ *
+ *  Gives the same result as SCIPintervalSquareRoot() for each component. These bounds are computed by rounding to nearest and
+ *  moving outwards to the next floating point number, so the rounding mode is set to nearest at most once for the
+ *  whole vector. The resultant array may be the same as operand.
+ */
+void SCIPintervalSquareRootVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+   int i;
+
+   assert(resultant != NULL || length == 0);
+
+   roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_NEAREST )
+      intervalSetRoundingMode(SCIP_ROUND_NEAREST);
+
+   for( i = 0; i < length; ++i )
+   {
+      SCIPintervalSquareRoot(infinity, &resultant[i], operand[i]);
+   }
+
+   if( roundmode != SCIP_ROUND_NEAREST )
+      intervalSetRoundingMode(roundmode);
+}
+
 /** stores operand1 to the power of operand2 in resultant
  * 
  * uses SCIPintervalPowerScalar if operand2 is a scalar, otherwise computes exp(op2*log(op1))
@@ -2556,6 +2728,37 @@ void SCIPintervalExp(
    }
 }
 
+/** stores exponential of each entry of vector operand in vector resultant
+ *
+ *  Gives the same result as SCIPintervalExp() for each component. These bounds are computed by rounding to nearest and
+ *  moving outwards to the next floating point number, so the rounding mode is set to nearest at most once for the
+ *  whole vector. The resultant array may be the same as operand.
+ */
+void SCIPintervalExpVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+   int i;
+
+   assert(resultant != NULL || length == 0);
+
+   roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_NEAREST )
+      intervalSetRoundingMode(SCIP_ROUND_NEAREST);
+
+   for( i = 0; i < length; ++i )
+   {
+      SCIPintervalExp(infinity, &resultant[i], operand[i]);
+   }
+
+   if( roundmode != SCIP_ROUND_NEAREST )
+      intervalSetRoundingMode(roundmode);
+}
+
 /** stores natural logarithm of operand in resultant
  * @attention we assume a correctly rounded log(double) function when rounding is to nearest
  */
@@ -2626,6 +2829,37 @@ void SCIPintervalLog(
    }
 }
 
+/** stores natural logarithm of each entry of vector operand in vector resultant
+ *
+ *  Gives the same result as SCIPintervalLog() for each component. These bounds are computed by rounding to nearest and
+ *  moving outwards to the next floating point number, so the rounding mode is set to nearest at most once for the
+ *  whole vector. The resultant array may be the same as operand.
+ */
+void SCIPintervalLogVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+   int i;
+
+   assert(resultant != NULL || length == 0);
+
+   roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_NEAREST )
+      intervalSetRoundingMode(SCIP_ROUND_NEAREST);
+
+   for( i = 0; i < length; ++i )
+   {
+      SCIPintervalLog(infinity, &resultant[i], operand[i]);
+   }
+
+   if( roundmode != SCIP_ROUND_NEAREST )
+      intervalSetRoundingMode(roundmode);
+}
+
 /** stores minimum of operands in resultant */
 void SCIPintervalMin(
    SCIP_Real             infinity,           /**< value for infinity */
@@ -4664,22 +4898,25 @@ int SCIPintervalPropagateWeightedSum(
 
    SCIPdebugMessage("reverse prop with %d children: %.20g", noperands, constant);
 
-   /* shift coefficients into the intervals of the children (using resultants as working memory)
-    * compute the min and max activities
-    */
    for( c = 0; c < noperands; ++c )
    {
-      childbounds = operands[c];
-      SCIPdebugPrintf(" %+.20g*[%.20g,%.20g]", weights[c], childbounds.inf, childbounds.sup);
-
-      if( SCIPintervalIsEmpty(infinity, childbounds) )
+      if( SCIPintervalIsEmpty(infinity, operands[c]) )
       {
          *infeasible = TRUE;
          c = noperands;  /* signal for terminate code to not copy operands to resultants because we return *infeasible == TRUE */  /*lint !e850*/
          goto TERMINATE;
       }
+   }
 
-      SCIPintervalMulScalar(infinity, &resultants[c], childbounds, weights[c]);
+   /* shift coefficients into the intervals of the children (using resultants as working memory)
+    * this switches the rounding mode twice for all children and restores the rounding mode set on entry, i.e., downward
+    */
+   SCIPintervalMulScalarVectors(infinity, resultants, noperands, operands, weights);
+
+   /* compute the min and max activities */
+   for( c = 0; c < noperands; ++c )
+   {
+      SCIPdebugPrintf(" %+.20g*[%.20g,%.20g]", weights[c], operands[c].inf, operands[c].sup);
 
       if( resultants[c].sup >= infinity )
          ++maxlinactivityinf;
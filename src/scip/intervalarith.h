@@ -356,6 +356,20 @@ void SCIPintervalMul(
    SCIP_INTERVAL         operand2            /**< second operand of operation */
    );
 
+/** multiplies vector operand1 with vector operand2 componentwise and stores result in vector resultant
+ *
+ *  The rounding mode is switched only twice for the whole vector instead of twice per component.
+ *  The resultant array must not overlap with the operand arrays.
+ */
+SCIP_EXPORT
+void SCIPintervalMulVectors(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand1,           /**< array of first operands of operation; can have +/-inf entries */
+   SCIP_INTERVAL*        operand2            /**< array of second operands of operation; can have +/-inf entries */
+   );
+
 /** multiplies operand1 with scalar operand2 and stores infimum of result in infimum of resultant */
 SCIP_EXPORT
 void SCIPintervalMulScalarInf(
@@ -383,6 +397,20 @@ void SCIPintervalMulScalar(
    SCIP_Real             operand2            /**< second operand of operation */
    );
 
+/** multiplies vector operand1 with vector of scalars operand2 componentwise and stores result in vector resultant
+ *
+ *  Gives the same result as SCIPintervalMulScalar() for each component, but switches the rounding mode only twice for
+ *  the whole vector. The resultant array must not overlap with operand1.
+ */
+SCIP_EXPORT
+void SCIPintervalMulScalarVectors(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand1,           /**< array of first operands of operation */
+   SCIP_Real*            operand2            /**< array of second operands of operation */
+   );
+
 /** divides operand1 by operand2 and stores result in resultant */
 SCIP_EXPORT
 void SCIPintervalDiv(
@@ -449,6 +477,19 @@ void SCIPintervalSquare(
    SCIP_INTERVAL         operand             /**< operand of operation */
    );
 
+/** squares each entry of vector operand and stores result in vector resultant
+ *
+ *  Gives the same result as SCIPintervalSquare() for each component, but switches the rounding mode only twice for the
+ *  whole vector. The resultant array must not overlap with operand.
+ */
+SCIP_EXPORT
+void SCIPintervalSquareVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   );
+
 /** stores (positive part of) square root of operand in resultant
  * @attention we assume a correctly rounded sqrt(double) function when rounding is to nearest
  */
@@ -459,6 +500,19 @@ void SCIPintervalSquareRoot(
    SCIP_INTERVAL         operand             /**< operand of operation */
    );
 
+/** stores (positive part of) square root of each entry of vector operand in vector resultant
+ *
+ *  Gives the same result as SCIPintervalSquareRoot() for each component, but sets the rounding mode to nearest at most once for the
+ *  whole vector. The resultant array may be the same as operand.
+ */
+SCIP_EXPORT
+void SCIPintervalSquareRootVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   );
+
 /** stores operand1 to the power of operand2 in resultant
  * 
  * uses SCIPintervalPowerScalar if operand2 is a scalar, otherwise computes exp(op2*log(op1))
@@ -576,6 +630,19 @@ void SCIPintervalExp(
    SCIP_INTERVAL         operand             /**< operand of operation */
    );
 
+/** stores exponential of each entry of vector operand in vector resultant
+ *
+ *  Gives the same result as SCIPintervalExp() for each component, but sets the rounding mode to nearest at most once for the
+ *  whole vector. The resultant array may be the same as operand.
+ */
+SCIP_EXPORT
+void SCIPintervalExpVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   );
+
 /** stores natural logarithm of operand in resultant
  * @attention we assume a correctly rounded log(double) function when rounding is to nearest
  */
@@ -586,6 +653,19 @@ void SCIPintervalLog(
    SCIP_INTERVAL         operand             /**< operand of operation */
    );
 
+/** stores natural logarithm of each entry of vector operand in vector resultant
+ *
+ *  Gives the same result as SCIPintervalLog() for each component, but sets the rounding mode to nearest at most once for the
+ *  whole vector. The resultant array may be the same as operand.
+ */
+SCIP_EXPORT
+void SCIPintervalLogVector(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
+   int                   length,             /**< length of arrays */
+   SCIP_INTERVAL*        operand             /**< array of operands of operation */
+   );
+
 /** stores minimum of operands in resultant */
 SCIP_EXPORT
 void SCIPintervalMin(
@@ -42,6 +42,7 @@
 
 
 #include "lpi/lpi.h"
+#include "scip/bitencode.h"
 #include "scip/clock.h"
 #include "scip/cons.h"
 #include "scip/event.h"
@@ -298,6 +299,18 @@ SCIP_RETCODE ensureSoldirectionSize(
    return SCIP_OKAY;
 }
 
+/** marks the row-wise and column-wise matrix snapshots of the LP to be rebuilt from scratch */
+static
+void lpInvalidateMatrix(
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   assert(lp != NULL);
+
+   lp->matnrows = -1;
+   lp->matcolsvalid = FALSE;
+}
+
 /** ensures, that lazy cols array can store at least num entries */
 static
 SCIP_RETCODE ensureLazycolsSize(
@@ -1640,6 +1653,10 @@ void coefChanged(
    assert(col != NULL);
    assert(lp != NULL);
 
+   /* the matrix snapshots only contain coefficients of LP rows in LP columns */
+   if( row->lppos >= 0 && col->lppos >= 0 )
+      lpInvalidateMatrix(lp);
+
    if( row->lpipos >= 0 && col->lpipos >= 0 )
    {
       assert(row->lpipos < lp->nlpirows);
@@ -6504,6 +6521,113 @@ SCIP_Real SCIProwGetSolActivity(
    return activity;
 }
 
+/** computes the activities of several rows for a given solution
+ *
+ *  The solution values of all columns appearing in the rows are gathered once into a dense array indexed by the
+ *  column indices, such that each value is queried from the solution only once even if the column appears in many
+ *  rows. The rows are then evaluated on their contiguous cols_index and vals arrays. The result for each row is
+ *  identical to the one of SCIProwGetSolActivity().
+ */
+SCIP_RETCODE SCIProwsGetSolActivities(
+   SCIP_ROW**            rows,               /**< LP rows */
+   int                   nrows,              /**< number of LP rows */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_Real*            activities          /**< array to store the activities of the rows */
+   )
+{
+   SCIP_ROW* row;
+   SCIP_COL* col;
+   SCIP_Real* solvals;
+   SCIP_Bool* gathered;
+   int* gatheredidx;
+   SCIP_Real inf;
+   SCIP_Real activity;
+   SCIP_Real solval;
+   int ngathered;
+   int idx;
+   int r;
+   int i;
+
+   assert(rows != NULL || nrows == 0);
+   assert(activities != NULL || nrows == 0);
+   assert(stat != NULL);
+
+   if( nrows == 0 )
+      return SCIP_OKAY;
+
+   /* a single row does not profit from gathering the solution values */
+   if( nrows == 1 )
+   {
+      activities[0] = SCIProwGetSolActivity(rows[0], set, stat, sol);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &solvals, stat->ncolidx) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &gatheredidx, stat->ncolidx) );
+   SCIP_CALL( SCIPsetAllocCleanBufferArray(set, &gathered, stat->ncolidx) );
+
+   /* gather the solution values of all columns in the rows */
+   ngathered = 0;
+   for( r = 0; r < nrows; ++r )
+   {
+      row = rows[r];
+      assert(row != NULL);
+
+      for( i = 0; i < row->len; ++i )
+      {
+         idx = row->cols_index[i];
+         assert(0 <= idx && idx < stat->ncolidx);
+         assert(row->cols[i]->index == idx);
+
+         if( !gathered[idx] )
+         {
+            solvals[idx] = SCIPsolGetVal(sol, set, stat, row->cols[i]->var);
+            gathered[idx] = TRUE;
+            gatheredidx[ngathered++] = idx;
+         }
+      }
+   }
+
+   /* evaluate the rows on the dense solution values */
+   inf = SCIPsetInfinity(set);
+   for( r = 0; r < nrows; ++r )
+   {
+      row = rows[r];
+
+      activity = row->constant;
+      for( i = 0; i < row->len; ++i )
+      {
+         solval = solvals[row->cols_index[i]];
+         if( solval == SCIP_UNKNOWN ) /*lint !e777*/
+         {
+            col = row->cols[i];
+            if( SCIPsetIsInfinity(set, -row->lhs) )
+               solval = (row->vals[i] >= 0.0 ? col->lb : col->ub);
+            else if( SCIPsetIsInfinity(set, row->rhs) )
+               solval = (row->vals[i] >= 0.0 ? col->ub : col->lb);
+            else
+               solval = (col->lb + col->ub)/2.0;
+         }
+         activity += row->vals[i] * solval;
+      }
+
+      activity = MAX(activity, -inf);
+      activities[r] = MIN(activity, +inf);
+   }
+
+   /* reset the clean buffer */
+   for( i = 0; i < ngathered; ++i )
+      gathered[gatheredidx[i]] = FALSE;
+
+   SCIPsetFreeCleanBufferArray(set, &gathered);
+   SCIPsetFreeBufferArray(set, &gatheredidx);
+   SCIPsetFreeBufferArray(set, &solvals);
+
+   return SCIP_OKAY;
+}
+
 /** returns the feasibility of a row for the given solution */
 SCIP_Real SCIProwGetSolFeasibility(
    SCIP_ROW*             row,                /**< LP row */
@@ -6804,18 +6928,16 @@ SCIP_Real SCIProwGetLPSolCutoffDistance(
    return solcutoffdist;
 }
 
-/** returns row's efficacy with respect to the current LP solution: e = -feasibility/norm */
-SCIP_Real SCIProwGetLPEfficacy(
+/** returns the norm of the row used for its efficacy, as given by separating/efficacynorm, but at least sumepsilon */
+static
+SCIP_Real rowGetEfficacyNorm(
    SCIP_ROW*             row,                /**< LP row */
-   SCIP_SET*             set,                /**< global SCIP settings */
-   SCIP_STAT*            stat,               /**< problem statistics data */
-   SCIP_LP*              lp                  /**< current LP data */
+   SCIP_SET*             set                 /**< global SCIP settings */
    )
 {
    SCIP_Real norm;
-   SCIP_Real feasibility;
-   SCIP_Real eps;
 
+   assert(row != NULL);
    assert(set != NULL);
 
    switch( set->sepa_efficacynorm )
@@ -6838,8 +6960,23 @@ SCIP_Real SCIProwGetLPEfficacy(
       norm = 0.0; /*lint !e527*/
    }
 
-   eps = SCIPsetSumepsilon(set);
-   norm = MAX(norm, eps);
+   return MAX(norm, SCIPsetSumepsilon(set));
+}
+
+/** returns row's efficacy with respect to the current LP solution: e = -feasibility/norm */
+SCIP_Real SCIProwGetLPEfficacy(
+   SCIP_ROW*             row,                /**< LP row */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   SCIP_Real norm;
+   SCIP_Real feasibility;
+
+   assert(set != NULL);
+
+   norm = rowGetEfficacyNorm(row, set);
    feasibility = SCIProwGetLPFeasibility(row, set, stat, lp);
 
    return -feasibility / norm;
@@ -6861,6 +6998,30 @@ SCIP_Bool SCIProwIsLPEfficacious(
    return SCIPsetIsEfficacious(set, root, efficacy);
 }
 
+/** computes the efficacies of several rows with respect to the current LP solution; the results are identical to
+ *  calling SCIProwGetLPEfficacy() for each row
+ *
+ *  Only the given rows are modified, by updating their cached activities, so that the method can be called for
+ *  disjoint sets of rows concurrently.
+ */
+void SCIProwsGetLPEfficacies(
+   SCIP_ROW**            rows,               /**< LP rows */
+   int                   nrows,              /**< number of LP rows */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_Real*            efficacies          /**< array to store the efficacies of the rows */
+   )
+{
+   int r;
+
+   assert(rows != NULL || nrows == 0);
+   assert(efficacies != NULL || nrows == 0);
+
+   for( r = 0; r < nrows; ++r )
+      efficacies[r] = SCIProwGetLPEfficacy(rows[r], set, stat, lp);
+}
+
 /** returns row's efficacy with respect to the given primal solution: e = -feasibility/norm */
 SCIP_Real SCIProwGetSolEfficacy(
    SCIP_ROW*             row,                /**< LP row */
@@ -6871,37 +7032,52 @@ SCIP_Real SCIProwGetSolEfficacy(
 {
    SCIP_Real norm;
    SCIP_Real feasibility;
-   SCIP_Real eps;
 
    assert(set != NULL);
 
-   switch( set->sepa_efficacynorm )
-   {
-   case 'e':
-      norm = SCIProwGetNorm(row);
-      break;
-   case 'm':
-      norm = SCIProwGetMaxval(row, set);
-      break;
-   case 's':
-      norm = SCIProwGetSumNorm(row);
-      break;
-   case 'd':
-      norm = (row->len == 0 ? 0.0 : 1.0);
-      break;
-   default:
-      SCIPerrorMessage("invalid efficacy norm parameter '%c'\n", set->sepa_efficacynorm);
-      SCIPABORT();
-      norm = 0.0; /*lint !e527*/
-   }
-
-   eps = SCIPsetSumepsilon(set);
-   norm = MAX(norm, eps);
+   norm = rowGetEfficacyNorm(row, set);
    feasibility = SCIProwGetSolFeasibility(row, set, stat, sol);
 
    return -feasibility / norm;
 }
 
+/** computes the efficacies of several rows with respect to the given primal solution; the activities are computed by
+ *  SCIProwsGetSolActivities(), such that the results are identical to calling SCIProwGetSolEfficacy() for each row
+ */
+SCIP_RETCODE SCIProwsGetSolEfficacies(
+   SCIP_ROW**            rows,               /**< LP rows */
+   int                   nrows,              /**< number of LP rows */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_Real*            efficacies          /**< array to store the efficacies of the rows */
+   )
+{
+   SCIP_ROW* row;
+   SCIP_Real norm;
+   SCIP_Real activity;
+   SCIP_Real feasibility;
+   int r;
+
+   assert(set != NULL);
+   assert(efficacies != NULL || nrows == 0);
+
+   /* compute the activities in place */
+   SCIP_CALL( SCIProwsGetSolActivities(rows, nrows, set, stat, sol, efficacies) );
+
+   for( r = 0; r < nrows; ++r )
+   {
+      row = rows[r];
+
+      norm = rowGetEfficacyNorm(row, set);
+      activity = efficacies[r];
+      feasibility = MIN(row->rhs - activity, activity - row->lhs);
+      efficacies[r] = -feasibility / norm;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** returns whether the row's efficacy with respect to the given primal solution is greater than the minimal cut
  *  efficacy
  */
@@ -6929,32 +7105,10 @@ SCIP_Real SCIProwGetRelaxEfficacy(
 {
    SCIP_Real norm;
    SCIP_Real feasibility;
-   SCIP_Real eps;
 
    assert(set != NULL);
 
-   switch( set->sepa_efficacynorm )
-   {
-   case 'e':
-      norm = SCIProwGetNorm(row);
-      break;
-   case 'm':
-      norm = SCIProwGetMaxval(row, set);
-      break;
-   case 's':
-      norm = SCIProwGetSumNorm(row);
-      break;
-   case 'd':
-      norm = (row->len == 0 ? 0.0 : 1.0);
-      break;
-   default:
-      SCIPerrorMessage("invalid efficacy norm parameter '%c'\n", set->sepa_efficacynorm);
-      SCIPABORT();
-      norm = 0.0; /*lint !e527*/
-   }
-
-   eps = SCIPsetSumepsilon(set);
-   norm = MAX(norm, eps);
+   norm = rowGetEfficacyNorm(row, set);
    feasibility = SCIProwGetRelaxFeasibility(row, set, stat);
 
    return -feasibility / norm;
@@ -6969,32 +7123,10 @@ SCIP_Real SCIProwGetNLPEfficacy(
 {
    SCIP_Real norm;
    SCIP_Real feasibility;
-   SCIP_Real eps;
 
    assert(set != NULL);
 
-   switch( set->sepa_efficacynorm )
-   {
-   case 'e':
-      norm = SCIProwGetNorm(row);
-      break;
-   case 'm':
-      norm = SCIProwGetMaxval(row, set);
-      break;
-   case 's':
-      norm = SCIProwGetSumNorm(row);
-      break;
-   case 'd':
-      norm = (row->len == 0 ? 0.0 : 1.0);
-      break;
-   default:
-      SCIPerrorMessage("invalid efficacy norm parameter '%c'\n", set->sepa_efficacynorm);
-      SCIPABORT();
-      norm = 0.0; /*lint !e527*/
-   }
-
-   eps = SCIPsetSumepsilon(set);
-   norm = MAX(norm, eps);
+   norm = rowGetEfficacyNorm(row, set);
    feasibility = SCIProwGetNLPFeasibility(row, set, stat);
 
    return -feasibility / norm;
@@ -9209,6 +9341,18 @@ SCIP_RETCODE SCIPlpCreate(
    (*lp)->lpitiming = (int) set->time_clocktype;
    (*lp)->lpirandomseed = set->random_randomseed;
    (*lp)->storedsolvals = NULL;
+   (*lp)->matrowbeg = NULL;
+   (*lp)->matrowind = NULL;
+   (*lp)->matrowval = NULL;
+   (*lp)->matcolbeg = NULL;
+   (*lp)->matcolind = NULL;
+   (*lp)->matcolval = NULL;
+   (*lp)->matrowbegsize = 0;
+   (*lp)->matrownnonzsize = 0;
+   (*lp)->matcolbegsize = 0;
+   (*lp)->matcolnnonzsize = 0;
+   (*lp)->matnrows = -1;
+   (*lp)->matcolsvalid = FALSE;
 
    /* allocate arrays for diving */
    SCIP_CALL( allocDiveChgSideArrays(*lp, DIVESTACKINITSIZE) );
@@ -9404,6 +9548,12 @@ SCIP_RETCODE SCIPlpFree(
    BMSfreeMemoryArrayNull(&(*lp)->cols);
    BMSfreeMemoryArrayNull(&(*lp)->rows);
    BMSfreeMemoryArrayNull(&(*lp)->soldirection);
+   BMSfreeMemoryArrayNull(&(*lp)->matrowbeg);
+   BMSfreeMemoryArrayNull(&(*lp)->matrowind);
+   BMSfreeMemoryArrayNull(&(*lp)->matrowval);
+   BMSfreeMemoryArrayNull(&(*lp)->matcolbeg);
+   BMSfreeMemoryArrayNull(&(*lp)->matcolind);
+   BMSfreeMemoryArrayNull(&(*lp)->matcolval);
    BMSfreeMemory(lp);
 
    return SCIP_OKAY;
@@ -9494,6 +9644,9 @@ SCIP_RETCODE SCIPlpAddCol(
    /* mark the current LP unflushed */
    lp->flushed = FALSE;
 
+   /* rows of the LP may already contain the new column */
+   lpInvalidateMatrix(lp);
+
    /* update column arrays of all linked rows */
    colUpdateAddLP(col, set);
 
@@ -9693,6 +9846,8 @@ SCIP_RETCODE SCIPlpShrinkCols(
       /* mark the current LP unflushed */
       lp->flushed = FALSE;
 
+      lpInvalidateMatrix(lp);
+
       checkLazyColArray(lp, set);
       checkLinks(lp);
    }
@@ -9760,6 +9915,13 @@ SCIP_RETCODE SCIPlpShrinkRows(
       /* mark the current LP unflushed */
       lp->flushed = FALSE;
 
+      /* the remaining rows keep their positions, such that the row-wise snapshot only needs to be truncated */
+      if( lp->matnrows > newnrows )
+      {
+         lp->matnrows = newnrows;
+         lp->matcolsvalid = FALSE;
+      }
+
       checkLinks(lp);
    }
    assert(lp->nremovablerows <= lp->nrows);
@@ -10029,6 +10191,212 @@ SCIP_RETCODE SCIPlpSumRows(
    return SCIP_OKAY;
 }
 
+/** brings the row-wise matrix snapshot of the LP up to date; rows that were appended to the LP since the last update
+ *  are appended to the snapshot, all other changes lead to a rebuild from scratch
+ */
+static
+SCIP_RETCODE lpUpdateMatrixRows(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_ROW* row;
+   int nnonz;
+   int pos;
+   int r;
+   int i;
+
+   assert(lp != NULL);
+   assert(lp->matnrows <= lp->nrows);
+
+   if( lp->matnrows == lp->nrows )
+      return SCIP_OKAY;
+
+   if( lp->matnrows < 0 )
+      lp->matnrows = 0;
+
+   if( lp->nrows + 1 > lp->matrowbegsize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, lp->nrows + 1);
+      SCIP_ALLOC( BMSreallocMemoryArray(&lp->matrowbeg, newsize) );
+      lp->matrowbegsize = newsize;
+   }
+   lp->matrowbeg[0] = 0;
+
+   /* count the nonzeros of the new rows in LP columns */
+   nnonz = lp->matrowbeg[lp->matnrows];
+   for( r = lp->matnrows; r < lp->nrows; ++r )
+   {
+      row = lp->rows[r];
+      assert(row != NULL);
+      assert(row->lppos == r);
+
+      for( i = 0; i < row->len; ++i )
+      {
+         if( row->cols[i]->lppos >= 0 )
+            ++nnonz;
+      }
+   }
+
+   if( nnonz > lp->matrownnonzsize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, nnonz);
+      SCIP_ALLOC( BMSreallocMemoryArray(&lp->matrowind, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&lp->matrowval, newsize) );
+      lp->matrownnonzsize = newsize;
+   }
+
+   /* copy the coefficients of the new rows */
+   pos = lp->matrowbeg[lp->matnrows];
+   for( r = lp->matnrows; r < lp->nrows; ++r )
+   {
+      row = lp->rows[r];
+
+      for( i = 0; i < row->len; ++i )
+      {
+         if( row->cols[i]->lppos >= 0 )
+         {
+            assert(row->cols[i]->lppos < lp->ncols);
+            lp->matrowind[pos] = row->cols[i]->lppos;
+            lp->matrowval[pos] = row->vals[i];
+            ++pos;
+         }
+      }
+      lp->matrowbeg[r + 1] = pos;
+   }
+   assert(pos == nnonz);
+
+   lp->matnrows = lp->nrows;
+   lp->matcolsvalid = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** gets the coefficient matrix of the current LP in compressed sparse row format; the arrays are owned by the LP and
+ *  are valid until the next change of the LP rows, the LP columns, or their coefficients
+ *
+ *  The snapshot only contains the coefficients of LP rows in LP columns, the column indices are the LP positions of the
+ *  columns. Row r has the entries rowbeg[r], ..., rowbeg[r+1]-1. The snapshot is built on demand; if only rows were
+ *  added to or removed from the end of the LP since the last call, it is updated incrementally.
+ */
+SCIP_RETCODE SCIPlpGetMatrixRows(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int**                 rowbeg,             /**< pointer to store the start of each row (nrows+1 entries) */
+   int**                 colind,             /**< pointer to store the LP positions of the columns of the entries */
+   SCIP_Real**           vals,               /**< pointer to store the coefficients of the entries */
+   int*                  nnonz               /**< pointer to store the number of entries */
+   )
+{
+   assert(lp != NULL);
+   assert(rowbeg != NULL);
+   assert(colind != NULL);
+   assert(vals != NULL);
+   assert(nnonz != NULL);
+
+   SCIP_CALL( lpUpdateMatrixRows(lp, set) );
+   assert(lp->matnrows == lp->nrows);
+
+   *rowbeg = lp->matrowbeg;
+   *colind = lp->matrowind;
+   *vals = lp->matrowval;
+   *nnonz = lp->matrowbeg == NULL ? 0 : lp->matrowbeg[lp->nrows];
+
+   return SCIP_OKAY;
+}
+
+/** gets the coefficient matrix of the current LP in compressed sparse column format; the arrays are owned by the LP
+ *  and are valid until the next change of the LP rows, the LP columns, or their coefficients
+ *
+ *  The row indices are the LP positions of the rows, column c has the entries colbeg[c], ..., colbeg[c+1]-1 with
+ *  increasing row indices. The snapshot is computed by transposing the row-wise snapshot.
+ */
+SCIP_RETCODE SCIPlpGetMatrixCols(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int**                 colbeg,             /**< pointer to store the start of each column (ncols+1 entries) */
+   int**                 rowind,             /**< pointer to store the LP positions of the rows of the entries */
+   SCIP_Real**           vals,               /**< pointer to store the coefficients of the entries */
+   int*                  nnonz               /**< pointer to store the number of entries */
+   )
+{
+   int nrownnonz;
+   int pos;
+   int r;
+   int c;
+   int i;
+
+   assert(lp != NULL);
+   assert(colbeg != NULL);
+   assert(rowind != NULL);
+   assert(vals != NULL);
+   assert(nnonz != NULL);
+
+   SCIP_CALL( lpUpdateMatrixRows(lp, set) );
+   assert(lp->matnrows == lp->nrows);
+
+   nrownnonz = lp->matrowbeg == NULL ? 0 : lp->matrowbeg[lp->nrows];
+
+   if( !lp->matcolsvalid )
+   {
+      if( lp->ncols + 1 > lp->matcolbegsize )
+      {
+         int newsize;
+
+         newsize = SCIPsetCalcMemGrowSize(set, lp->ncols + 1);
+         SCIP_ALLOC( BMSreallocMemoryArray(&lp->matcolbeg, newsize) );
+         lp->matcolbegsize = newsize;
+      }
+
+      if( nrownnonz > lp->matcolnnonzsize )
+      {
+         int newsize;
+
+         newsize = SCIPsetCalcMemGrowSize(set, nrownnonz);
+         SCIP_ALLOC( BMSreallocMemoryArray(&lp->matcolind, newsize) );
+         SCIP_ALLOC( BMSreallocMemoryArray(&lp->matcolval, newsize) );
+         lp->matcolnnonzsize = newsize;
+      }
+
+      /* count the entries of each column and compute the column starts, shifted by one position */
+      BMSclearMemoryArray(lp->matcolbeg, lp->ncols + 1);
+      for( i = 0; i < nrownnonz; ++i )
+         ++lp->matcolbeg[lp->matrowind[i] + 1];
+      for( c = 0; c < lp->ncols; ++c )
+         lp->matcolbeg[c + 1] += lp->matcolbeg[c];
+
+      /* distribute the entries; matcolbeg[c] is used as insertion position of column c and ends at the start of c+1 */
+      for( r = 0; r < lp->nrows; ++r )
+      {
+         for( i = lp->matrowbeg[r]; i < lp->matrowbeg[r + 1]; ++i )
+         {
+            pos = lp->matcolbeg[lp->matrowind[i]]++;
+            lp->matcolind[pos] = r;
+            lp->matcolval[pos] = lp->matrowval[i];
+         }
+      }
+
+      /* shift the column starts back */
+      for( c = lp->ncols; c > 0; --c )
+         lp->matcolbeg[c] = lp->matcolbeg[c - 1];
+      lp->matcolbeg[0] = 0;
+      assert(lp->matcolbeg[lp->ncols] == nrownnonz);
+
+      lp->matcolsvalid = TRUE;
+   }
+
+   *colbeg = lp->matcolbeg;
+   *rowind = lp->matcolind;
+   *vals = lp->matcolval;
+   *nnonz = nrownnonz;
+
+   return SCIP_OKAY;
+}
+
 /** stores LP state (like basis information) into LP state object */
 SCIP_RETCODE SCIPlpGetState(
    SCIP_LP*              lp,                 /**< LP data */
@@ -10053,6 +10421,20 @@ SCIP_RETCODE SCIPlpGetState(
    return SCIP_OKAY;
 }
 
+/** returns the number of bytes occupied by an LP state object, or 0 if it is NULL */
+SCIP_Longint SCIPlpGetStateSize(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_LPISTATE*        lpistate            /**< LP state information (like basis information), or NULL */
+   )
+{
+   assert(lp != NULL);
+
+   if( lpistate == NULL )
+      return 0;
+
+   return SCIPlpiGetStateSize(lp->lpi, lpistate);
+}
+
 /** loads LP state (like basis information) into solver */
 SCIP_RETCODE SCIPlpSetState(
    SCIP_LP*              lp,                 /**< LP data */
@@ -10113,6 +10495,390 @@ SCIP_RETCODE SCIPlpFreeState(
    return SCIP_OKAY;
 }
 
+/** maximal number of parents of a packed basis; the statuses of a deeper basis are packed completely */
+#define MAXPACKEDBASISDEPTH 16
+
+/** returns the number of packets needed to store the given number of statuses */
+static
+int packedbasisPacketNum(
+   int                   nstats              /**< number of statuses */
+   )
+{
+   return (nstats + (int)SCIP_DUALPACKETSIZE - 1) / (int)SCIP_DUALPACKETSIZE;
+}
+
+/** unpacks the statuses of the columns followed by the statuses of the rows of a packed basis */
+static
+SCIP_RETCODE packedbasisUnpack(
+   SCIP_PACKEDBASIS*     basis,              /**< packed basis */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int*                  stat                /**< array of size ncols + nrows to store the statuses */
+   )
+{
+   SCIP_PACKEDBASIS* parent;
+   int* newstat;
+   int nnewcols;
+   int i;
+
+   assert(basis != NULL);
+   assert(stat != NULL);
+
+   parent = basis->parent;
+
+   if( parent == NULL )
+   {
+      SCIPdecodeDualBit(basis->packed, stat, basis->ncols + basis->nrows);
+      return SCIP_OKAY;
+   }
+
+   assert(parent->ncols <= basis->ncols);
+   assert(parent->nrows <= basis->nrows);
+
+   /* unpack the statuses of the parent and move its rows behind the columns of the basis */
+   SCIP_CALL( packedbasisUnpack(parent, set, stat) );
+
+   nnewcols = basis->ncols - parent->ncols;
+   if( nnewcols > 0 && parent->nrows > 0 )
+   {
+      BMSmoveMemoryArray(&stat[basis->ncols], &stat[parent->ncols], parent->nrows);
+   }
+
+   /* unpack the statuses of the columns and rows that are not in the parent */
+   if( basis->npacked > 0 )
+   {
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &newstat, basis->npacked) );
+
+      SCIPdecodeDualBit(basis->packed, newstat, basis->npacked);
+      BMScopyMemoryArray(&stat[parent->ncols], newstat, nnewcols);
+      BMScopyMemoryArray(&stat[basis->ncols + parent->nrows], &newstat[nnewcols], basis->npacked - nnewcols);
+
+      SCIPsetFreeBufferArray(set, &newstat);
+   }
+
+   /* apply the changes against the parent */
+   for( i = 0; i < basis->nchanges; ++i )
+      stat[basis->changes[i] >> 2] = basis->changes[i] & 3;
+
+   return SCIP_OKAY;
+}
+
+#ifndef NDEBUG
+/** checks whether the columns and rows of the packed basis are the first columns and rows of the LP solver */
+static
+SCIP_Bool packedbasisIsPrefix(
+   SCIP_PACKEDBASIS*     basis,              /**< packed basis */
+   SCIP_LP*              lp                  /**< LP data */
+   )
+{
+   int i;
+
+   if( basis->ncols > lp->nlpicols || basis->nrows > lp->nlpirows )
+      return FALSE;
+
+   for( i = 0; i < basis->ncols; ++i )
+   {
+      if( basis->colidx[i] != lp->lpicols[i]->index )
+         return FALSE;
+   }
+   for( i = 0; i < basis->nrows; ++i )
+   {
+      if( basis->rowidx[i] != lp->lpirows[i]->index )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+#endif
+
+/** stores the current basis of the LP solver in a packed basis
+ *
+ *  If a parent is given, whose columns and rows are the first columns and rows of the current LP, the statuses of these
+ *  columns and rows are stored as changes against the parent, if this needs less memory than packing them. If the LP
+ *  solver has no basis, NULL is returned.
+ */
+SCIP_RETCODE SCIPlpGetPackedBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PACKEDBASIS*     parent,             /**< packed basis of an ancestor node, or NULL */
+   SCIP_PACKEDBASIS**    basis               /**< pointer to store the packed basis */
+   )
+{
+   int* stat;
+   int* parentstat;
+   int* newstat;
+   int nstats;
+   int ncols;
+   int nrows;
+   int nchanges;
+   int npacked;
+   int i;
+
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->solved);
+   assert(blkmem != NULL);
+   assert(basis != NULL);
+
+   *basis = NULL;
+
+   ncols = lp->nlpicols;
+   nrows = lp->nlpirows;
+   nstats = ncols + nrows;
+
+   if( !lp->solisbasic || nstats == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &stat, nstats) );
+   SCIP_CALL( SCIPlpiGetBase(lp->lpi, stat, &stat[ncols]) );
+
+   /* the parent must not be too deep and its LP must be a part of the current LP */
+   if( parent != NULL && (parent->depth >= MAXPACKEDBASISDEPTH || parent->ncols > ncols || parent->nrows > nrows) )
+      parent = NULL;
+   assert(parent == NULL || packedbasisIsPrefix(parent, lp));
+
+   /* count the changes against the parent */
+   parentstat = NULL;
+   nchanges = 0;
+   if( parent != NULL )
+   {
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &parentstat, parent->ncols + parent->nrows) );
+      SCIP_CALL( packedbasisUnpack(parent, set, parentstat) );
+
+      for( i = 0; i < parent->ncols; ++i )
+      {
+         if( stat[i] != parentstat[i] )
+            ++nchanges;
+      }
+      for( i = 0; i < parent->nrows; ++i )
+      {
+         if( stat[ncols + i] != parentstat[parent->ncols + i] )
+            ++nchanges;
+      }
+
+      /* pack all statuses if the changes need more memory */
+      if( (size_t)nchanges * sizeof(int)
+         >= (size_t)packedbasisPacketNum(parent->ncols + parent->nrows) * sizeof(SCIP_DUALPACKET) )
+      {
+         SCIPsetFreeBufferArray(set, &parentstat);
+         parent = NULL;
+      }
+   }
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, basis) );
+   (*basis)->ncols = ncols;
+   (*basis)->nrows = nrows;
+   (*basis)->nuses = 1;
+
+#ifndef NDEBUG
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*basis)->colidx, ncols) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*basis)->rowidx, nrows) );
+   for( i = 0; i < ncols; ++i )
+      (*basis)->colidx[i] = lp->lpicols[i]->index;
+   for( i = 0; i < nrows; ++i )
+      (*basis)->rowidx[i] = lp->lpirows[i]->index;
+#endif
+
+   if( parent != NULL )
+   {
+      int nnewcols;
+      int pos;
+
+      assert(parentstat != NULL);
+
+      (*basis)->parent = parent;
+      (*basis)->depth = parent->depth + 1;
+      (*basis)->nchanges = nchanges;
+      SCIPpackedbasisCapture(parent);
+
+      /* store the changes against the parent */
+      if( nchanges > 0 )
+      {
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*basis)->changes, nchanges) );
+
+         pos = 0;
+         for( i = 0; i < parent->ncols; ++i )
+         {
+            if( stat[i] != parentstat[i] )
+               (*basis)->changes[pos++] = 4 * i + stat[i];
+         }
+         for( i = 0; i < parent->nrows; ++i )
+         {
+            if( stat[ncols + i] != parentstat[parent->ncols + i] )
+               (*basis)->changes[pos++] = 4 * (ncols + i) + stat[ncols + i];
+         }
+         assert(pos == nchanges);
+      }
+      else
+         (*basis)->changes = NULL;
+
+      SCIPsetFreeBufferArray(set, &parentstat);
+
+      /* collect the statuses of the new columns followed by the new rows */
+      nnewcols = ncols - parent->ncols;
+      npacked = nstats - parent->ncols - parent->nrows;
+      newstat = &stat[parent->ncols];
+      if( nnewcols > 0 )
+      {
+         BMSmoveMemoryArray(&newstat[nnewcols], &stat[ncols + parent->nrows], nrows - parent->nrows);
+      }
+      else
+         newstat = &stat[ncols + parent->nrows];
+   }
+   else
+   {
+      (*basis)->parent = NULL;
+      (*basis)->changes = NULL;
+      (*basis)->nchanges = 0;
+      (*basis)->depth = 0;
+      npacked = nstats;
+      newstat = stat;
+   }
+
+   (*basis)->npacked = npacked;
+   if( npacked > 0 )
+   {
+      SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*basis)->packed, packedbasisPacketNum(npacked)) );
+      SCIPencodeDualBit(newstat, (*basis)->packed, npacked);
+   }
+   else
+      (*basis)->packed = NULL;
+
+   SCIPsetFreeBufferArray(set, &stat);
+
+   return SCIP_OKAY;
+}
+
+/** loads a packed basis into the LP solver; columns and rows of the LP that are not in the basis are set to one of
+ *  their bounds or basic, respectively
+ */
+SCIP_RETCODE SCIPlpSetPackedBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_PACKEDBASIS*     basis,              /**< packed basis */
+   SCIP_Bool             wasprimfeas,        /**< primal feasibility when the basis was stored */
+   SCIP_Bool             wasprimchecked,     /**< true if the LP solution has passed the primal feasibility check */
+   SCIP_Bool             wasdualfeas,        /**< dual feasibility when the basis was stored */
+   SCIP_Bool             wasdualchecked      /**< true if the LP solution has passed the dual feasibility check */
+   )
+{
+   int* stat;
+   int i;
+
+   assert(lp != NULL);
+   assert(blkmem != NULL);
+   assert(basis != NULL);
+
+   /* flush changes to the LP solver */
+   SCIP_CALL( SCIPlpFlush(lp, blkmem, set, prob, eventqueue) );
+   assert(lp->flushed);
+
+   if( lp->solved && lp->solisbasic )
+      return SCIP_OKAY;
+
+   assert(basis->ncols <= lp->nlpicols);
+   assert(basis->nrows <= lp->nlpirows);
+   assert(packedbasisIsPrefix(basis, lp));
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &stat, lp->nlpicols + lp->nlpirows) );
+
+   /* unpack the basis and move its rows behind the columns of the LP */
+   SCIP_CALL( packedbasisUnpack(basis, set, stat) );
+   if( basis->ncols < lp->nlpicols && basis->nrows > 0 )
+   {
+      BMSmoveMemoryArray(&stat[lp->nlpicols], &stat[basis->ncols], basis->nrows);
+   }
+
+   /* extend the basis to the columns and rows that were added since it was stored */
+   for( i = basis->ncols; i < lp->nlpicols; ++i )
+   {
+      SCIP_COL* col;
+
+      col = lp->lpicols[i];
+
+      if( !SCIPsetIsInfinity(set, -col->flushedlb) )
+         stat[i] = (int) SCIP_BASESTAT_LOWER;
+      else if( !SCIPsetIsInfinity(set, col->flushedub) )
+         stat[i] = (int) SCIP_BASESTAT_UPPER;
+      else
+         stat[i] = (int) SCIP_BASESTAT_ZERO;
+   }
+   for( i = lp->nlpicols + basis->nrows; i < lp->nlpicols + lp->nlpirows; ++i )
+      stat[i] = (int) SCIP_BASESTAT_BASIC;
+
+   SCIP_CALL( SCIPlpiSetBase(lp->lpi, stat, &stat[lp->nlpicols]) );
+
+   SCIPsetFreeBufferArray(set, &stat);
+
+   lp->solisbasic = TRUE;
+   lp->primalfeasible = wasprimfeas;
+   lp->primalchecked = wasprimchecked;
+   lp->dualfeasible = wasdualfeas;
+   lp->dualchecked = wasdualchecked;
+
+   return SCIP_OKAY;
+}
+
+/** increases the usage counter of a packed basis */
+void SCIPpackedbasisCapture(
+   SCIP_PACKEDBASIS*     basis               /**< packed basis */
+   )
+{
+   assert(basis != NULL);
+   assert(basis->nuses >= 1);
+
+   ++basis->nuses;
+}
+
+/** decreases the usage counter of a packed basis and frees it together with the parents that are not used anymore */
+void SCIPpackedbasisRelease(
+   SCIP_PACKEDBASIS**    basis,              /**< pointer to packed basis */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   assert(basis != NULL);
+   assert(blkmem != NULL);
+
+   while( *basis != NULL )
+   {
+      SCIP_PACKEDBASIS* parent;
+
+      assert((*basis)->nuses >= 1);
+
+      if( --(*basis)->nuses > 0 )
+         break;
+
+      parent = (*basis)->parent;
+
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*basis)->packed, packedbasisPacketNum((*basis)->npacked));
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*basis)->changes, (*basis)->nchanges);
+#ifndef NDEBUG
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*basis)->rowidx, (*basis)->nrows);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*basis)->colidx, (*basis)->ncols);
+#endif
+      BMSfreeBlockMemory(blkmem, basis);
+
+      *basis = parent;
+   }
+
+   *basis = NULL;
+}
+
+/** returns the number of bytes used by a packed basis, not counting its parent */
+SCIP_Longint SCIPpackedbasisGetMemSize(
+   SCIP_PACKEDBASIS*     basis               /**< packed basis */
+   )
+{
+   assert(basis != NULL);
+
+   return (SCIP_Longint) sizeof(SCIP_PACKEDBASIS)
+      + (SCIP_Longint) packedbasisPacketNum(basis->npacked) * (SCIP_Longint) sizeof(SCIP_DUALPACKET)
+      + (SCIP_Longint) basis->nchanges * (SCIP_Longint) sizeof(int);
+}
+
 /** interrupts the currently ongoing lp solve, or disables the interrupt */
 SCIP_RETCODE SCIPlpInterrupt(
    SCIP_LP*              lp,                 /**< LP data */
@@ -15381,6 +16147,7 @@ SCIP_RETCODE lpDelColset(
       assert(lp->flushed);
 
       lp->lpifirstchgcol = lp->nlpicols;
+      lpInvalidateMatrix(lp);
 
       /* mark the current solution invalid */
       lp->solved = FALSE;
@@ -15480,6 +16247,7 @@ SCIP_RETCODE lpDelRowset(
       assert(lp->flushed);
 
       lp->lpifirstchgrow = lp->nlpirows;
+      lpInvalidateMatrix(lp);
 
       /* mark the current solution invalid */
       lp->solved = FALSE;
@@ -599,6 +599,18 @@ SCIP_Real SCIProwGetSolActivity(
    SCIP_SOL*             sol                 /**< primal CIP solution */
    );
 
+/** computes the activities of several rows for a given solution; the solution values of the columns are gathered
+ *  only once for all rows, the results are identical to calling SCIProwGetSolActivity() for each row
+ */
+SCIP_RETCODE SCIProwsGetSolActivities(
+   SCIP_ROW**            rows,               /**< LP rows */
+   int                   nrows,              /**< number of LP rows */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_Real*            activities          /**< array to store the activities of the rows */
+   );
+
 /** returns the feasibility of a row for the given solution */
 SCIP_Real SCIProwGetSolFeasibility(
    SCIP_ROW*             row,                /**< LP row */
@@ -692,6 +704,33 @@ SCIP_Real SCIProwGetSolEfficacy(
    SCIP_SOL*             sol                 /**< primal CIP solution */
    );
 
+/** computes the efficacies of several rows with respect to the current LP solution; the results are identical to
+ *  calling SCIProwGetLPEfficacy() for each row
+ *
+ *  Only the given rows are modified, by updating their cached activities, so that the method can be called for
+ *  disjoint sets of rows concurrently.
+ */
+void SCIProwsGetLPEfficacies(
+   SCIP_ROW**            rows,               /**< LP rows */
+   int                   nrows,              /**< number of LP rows */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_Real*            efficacies          /**< array to store the efficacies of the rows */
+   );
+
+/** computes the efficacies of several rows with respect to the given primal solution; the activities are computed by
+ *  SCIProwsGetSolActivities(), such that the results are identical to calling SCIProwGetSolEfficacy() for each row
+ */
+SCIP_RETCODE SCIProwsGetSolEfficacies(
+   SCIP_ROW**            rows,               /**< LP rows */
+   int                   nrows,              /**< number of LP rows */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_Real*            efficacies          /**< array to store the efficacies of the rows */
+   );
+
 /** returns whether the row's efficacy with respect to the given primal solution is greater than the minimal cut
  *  efficacy
  */
@@ -920,6 +959,30 @@ SCIP_RETCODE SCIPlpSumRows(
    SCIP_Real*            sumrhs              /**< pointer to store the right hand side of the row summation */
    );
 
+/** gets the coefficient matrix of the current LP in compressed sparse row format; the arrays are owned by the LP and
+ *  are valid until the next change of the LP rows, the LP columns, or their coefficients
+ */
+SCIP_RETCODE SCIPlpGetMatrixRows(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int**                 rowbeg,             /**< pointer to store the start of each row (nrows+1 entries) */
+   int**                 colind,             /**< pointer to store the LP positions of the columns of the entries */
+   SCIP_Real**           vals,               /**< pointer to store the coefficients of the entries */
+   int*                  nnonz               /**< pointer to store the number of entries */
+   );
+
+/** gets the coefficient matrix of the current LP in compressed sparse column format; the arrays are owned by the LP
+ *  and are valid until the next change of the LP rows, the LP columns, or their coefficients
+ */
+SCIP_RETCODE SCIPlpGetMatrixCols(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int**                 colbeg,             /**< pointer to store the start of each column (ncols+1 entries) */
+   int**                 rowind,             /**< pointer to store the LP positions of the rows of the entries */
+   SCIP_Real**           vals,               /**< pointer to store the coefficients of the entries */
+   int*                  nnonz               /**< pointer to store the number of entries */
+   );
+
 /** stores LP state (like basis information) into LP state object */
 SCIP_RETCODE SCIPlpGetState(
    SCIP_LP*              lp,                 /**< LP data */
@@ -927,6 +990,12 @@ SCIP_RETCODE SCIPlpGetState(
    SCIP_LPISTATE**       lpistate            /**< pointer to LP state information (like basis information) */
    );
 
+/** returns the number of bytes occupied by an LP state object, or 0 if it is NULL */
+SCIP_Longint SCIPlpGetStateSize(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_LPISTATE*        lpistate            /**< LP state information (like basis information), or NULL */
+   );
+
 /** loads LP state (like basis information) into solver */
 SCIP_RETCODE SCIPlpSetState(
    SCIP_LP*              lp,                 /**< LP data */
@@ -948,6 +1017,52 @@ SCIP_RETCODE SCIPlpFreeState(
    SCIP_LPISTATE**       lpistate            /**< pointer to LP state information (like basis information) */
    );
 
+/** stores the current basis of the LP solver in a packed basis
+ *
+ *  If a parent is given, whose columns and rows are the first columns and rows of the current LP, the statuses of these
+ *  columns and rows are stored as changes against the parent, if this needs less memory than packing them. If the LP
+ *  solver has no basis, NULL is returned.
+ */
+SCIP_RETCODE SCIPlpGetPackedBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PACKEDBASIS*     parent,             /**< packed basis of an ancestor node, or NULL */
+   SCIP_PACKEDBASIS**    basis               /**< pointer to store the packed basis */
+   );
+
+/** loads a packed basis into the LP solver; columns and rows of the LP that are not in the basis are set to one of
+ *  their bounds or basic, respectively
+ */
+SCIP_RETCODE SCIPlpSetPackedBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_PACKEDBASIS*     basis,              /**< packed basis */
+   SCIP_Bool             wasprimfeas,        /**< primal feasibility when the basis was stored */
+   SCIP_Bool             wasprimchecked,     /**< true if the LP solution has passed the primal feasibility check */
+   SCIP_Bool             wasdualfeas,        /**< dual feasibility when the basis was stored */
+   SCIP_Bool             wasdualchecked      /**< true if the LP solution has passed the dual feasibility check */
+   );
+
+/** increases the usage counter of a packed basis */
+void SCIPpackedbasisCapture(
+   SCIP_PACKEDBASIS*     basis               /**< packed basis */
+   );
+
+/** decreases the usage counter of a packed basis and frees it together with the parents that are not used anymore */
+void SCIPpackedbasisRelease(
+   SCIP_PACKEDBASIS**    basis,              /**< pointer to packed basis */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
+/** returns the number of bytes used by a packed basis, not counting its parent */
+SCIP_Longint SCIPpackedbasisGetMemSize(
+   SCIP_PACKEDBASIS*     basis               /**< packed basis */
+   );
+
 /** interrupts the currently ongoing lp solve or disables the interrupt */
 SCIP_RETCODE SCIPlpInterrupt(
    SCIP_LP*              lp,                 /**< LP data */
@@ -62,6 +62,7 @@
 
 #define INITLPMAXVARVAL          1000.0 /**< maximal absolute value of variable for still generating a linearization cut at that point in initlp */
 #define RANDNUMINITSEED          220802 /**< initial seed for random number generator for point perturbation */
+#define NINITLPPOINTS                 5 /**< number of points at which to linearize in initlp */
 
 /*lint -e440*/
 /*lint -e441*/
@@ -106,7 +107,7 @@ struct SCIP_NlhdlrData
 typedef struct
 {
    SCIP_NLHDLREXPRDATA*  nlhdlrexprdata;
-   SCIP_SOL*             evalsol;
+   SCIP_VAR**            leafvars;           /**< variables of the leaf expressions, in the order of the function arguments */
    SCIP*                 scip;
 } VERTEXPOLYFUN_EVALDATA;
 
@@ -216,33 +217,24 @@ SCIP_RETCODE nlhdlrExprGrowChildren(
    return SCIP_OKAY;
 }
 
-/** evaluate expression at solution w.r.t. auxiliary variables */
+/** evaluate expression in several points w.r.t. auxiliary variables */
 static
-SCIP_DECL_VERTEXPOLYFUN(nlhdlrExprEvalConcave)
+SCIP_DECL_VERTEXPOLYFUNBATCH(nlhdlrExprEvalConcave)
 {
    VERTEXPOLYFUN_EVALDATA* evaldata = (VERTEXPOLYFUN_EVALDATA*)funcdata;
-   int i;
 
    assert(args != NULL);
-   assert(nargs == evaldata->nlhdlrexprdata->nleafs);
    assert(evaldata != NULL);
+   assert(nargs == evaldata->nlhdlrexprdata->nleafs);
 
 #ifdef SCIP_MORE_DEBUG
-   SCIPdebugMsg(evaldata->scip, "eval vertexpolyfun at\n");
+   SCIPdebugMsg(evaldata->scip, "eval vertexpolyfun in %d points\n", npoints);
 #endif
-   for( i = 0; i < nargs; ++i )
-   {
-#ifdef SCIP_MORE_DEBUG
-      SCIPdebugMsg(evaldata->scip, "  <%s> = %g\n",
-            SCIPvarGetName(SCIPgetVarExprVar(evaldata->nlhdlrexprdata->leafexprs[i])), args[i]);
-#endif
-      SCIP_CALL_ABORT( SCIPsetSolVal(evaldata->scip, evaldata->evalsol,
-            SCIPgetVarExprVar(evaldata->nlhdlrexprdata->leafexprs[i]), args[i]) );
-   }
 
-   SCIP_CALL_ABORT( SCIPevalExpr(evaldata->scip, evaldata->nlhdlrexprdata->nlexpr, evaldata->evalsol, 0L) );
+   SCIP_CALL( SCIPevalExprBatch(evaldata->scip, evaldata->nlhdlrexprdata->nlexpr, nargs, evaldata->leafvars, npoints,
+         args, vals, NULL) );
 
-   return SCIPexprGetEvalValue(evaldata->nlhdlrexprdata->nlexpr);
+   return SCIP_OKAY;
 }
 
 /** initialize expression stack */
@@ -1364,14 +1356,13 @@ SCIP_RETCODE createNlhdlrExprData(
 
 /** adds an estimator for a vertex-polyhedral (e.g., concave) function to a given rowprep
  *
- * Calls \ref SCIPcomputeFacetVertexPolyhedralNonlinear() for given function and
+ * Calls \ref SCIPcomputeFacetVertexPolyhedralNonlinearBatch() for given function and
  * box set to local bounds of auxiliary variables.
  */
 static
 SCIP_RETCODE estimateVertexPolyhedral(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONSHDLR*        conshdlr,           /**< nonlinear constraint handler */
-   SCIP_NLHDLR*          nlhdlr,             /**< nonlinear handler */
    SCIP_NLHDLREXPRDATA*  nlhdlrexprdata,     /**< nonlinear handler expression data */
    SCIP_SOL*             sol,                /**< solution to use, unless usemidpoint is TRUE */
    SCIP_Bool             usemidpoint,        /**< whether to use the midpoint of the domain instead of sol */
@@ -1381,8 +1372,8 @@ SCIP_RETCODE estimateVertexPolyhedral(
    SCIP_Bool*            success             /**< buffer to store whether successful */
    )
 {
-   SCIP_NLHDLRDATA* nlhdlrdata;
    VERTEXPOLYFUN_EVALDATA evaldata;
+   SCIP_VAR** leafvars;
    SCIP_Real* xstar;
    SCIP_Real* box;
    SCIP_Real facetconstant;
@@ -1391,7 +1382,6 @@ SCIP_RETCODE estimateVertexPolyhedral(
    SCIP_Bool allfixed;
 
    assert(scip != NULL);
-   assert(nlhdlr != NULL);
    assert(nlhdlrexprdata != NULL);
    assert(rowprep != NULL);
    assert(success != NULL);
@@ -1417,27 +1407,22 @@ SCIP_RETCODE estimateVertexPolyhedral(
    }
 #endif
 
-   nlhdlrdata = SCIPnlhdlrGetData(nlhdlr);
-   assert(nlhdlrdata != NULL);
-
-   if( nlhdlrdata->evalsol == NULL )
-   {
-      SCIP_CALL( SCIPcreateSol(scip, &nlhdlrdata->evalsol, NULL) );
-   }
+   SCIP_CALL( SCIPallocBufferArray(scip, &leafvars, nlhdlrexprdata->nleafs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &xstar, nlhdlrexprdata->nleafs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &box, 2*nlhdlrexprdata->nleafs) );
 
    evaldata.nlhdlrexprdata = nlhdlrexprdata;
-   evaldata.evalsol = nlhdlrdata->evalsol;
+   evaldata.leafvars = leafvars;
    evaldata.scip = scip;
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &xstar, nlhdlrexprdata->nleafs) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &box, 2*nlhdlrexprdata->nleafs) );
-
    allfixed = TRUE;
    for( i = 0; i < nlhdlrexprdata->nleafs; ++i )
    {
       var = SCIPgetVarExprVar(nlhdlrexprdata->leafexprs[i]);
       assert(var != NULL);
 
+      leafvars[i] = var;
+
       box[2*i] = SCIPvarGetLbLocal(var);
       if( SCIPisInfinity(scip, -box[2*i]) )
       {
@@ -1471,7 +1456,7 @@ SCIP_RETCODE estimateVertexPolyhedral(
 
    SCIP_CALL( SCIPensureRowprepSize(scip, rowprep, nlhdlrexprdata->nleafs + 1) );
 
-   SCIP_CALL( SCIPcomputeFacetVertexPolyhedralNonlinear(scip, conshdlr, overestimate, nlhdlrExprEvalConcave, (void*)&evaldata,
+   SCIP_CALL( SCIPcomputeFacetVertexPolyhedralNonlinearBatch(scip, conshdlr, overestimate, nlhdlrExprEvalConcave, (void*)&evaldata,
       xstar, box, nlhdlrexprdata->nleafs, targetvalue, success, SCIProwprepGetCoefs(rowprep), &facetconstant) );
 
    if( !*success )
@@ -1495,6 +1480,7 @@ SCIP_RETCODE estimateVertexPolyhedral(
  TERMINATE:
    SCIPfreeBufferArray(scip, &box);
    SCIPfreeBufferArray(scip, &xstar);
+   SCIPfreeBufferArray(scip, &leafvars);
 
    return SCIP_OKAY;
 }
@@ -1571,6 +1557,67 @@ SCIP_RETCODE estimateGradientInner(
    return SCIP_OKAY;
 }
 
+/** adds an estimator computed via the gradient in one point of a batch evaluation to a given rowprep
+ *
+ * Does the same as estimateGradientInner(), but takes the value and gradient of the expression from a
+ * batch evaluation, see SCIPevalExprBatch(), with the leaf variables in the order of the leaf expressions.
+ */
+static
+SCIP_RETCODE estimateGradientBatchPoint(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLHDLREXPRDATA*  nlhdlrexprdata,     /**< nonlinear handler expression data */
+   int                   npoints,            /**< number of points of the batch evaluation */
+   int                   point,              /**< index of the point to use */
+   SCIP_Real*            varvals,            /**< values of the leaf variables in all points, column-wise */
+   SCIP_Real*            vals,               /**< values of the expression in all points */
+   SCIP_Real*            grads,              /**< gradients of the expression in all points, column-wise */
+   SCIP_ROWPREP*         rowprep,            /**< rowprep where to store estimator */
+   SCIP_Bool*            success             /**< buffer to store whether successful */
+   )
+{
+   SCIP_Real QUAD(constant);
+   int i;
+
+   assert(scip != NULL);
+   assert(nlhdlrexprdata != NULL);
+   assert(0 <= point && point < npoints);
+   assert(varvals != NULL);
+   assert(vals != NULL);
+   assert(grads != NULL);
+   assert(rowprep != NULL);
+   assert(success != NULL);
+
+   *success = FALSE;
+
+   /* if gradient evaluation error, then return; in this case, all partial derivatives are invalid */
+   if( vals[point] == SCIP_INVALID || (nlhdlrexprdata->nleafs > 0 && grads[point] == SCIP_INVALID) ) /*lint !e777*/
+   {
+      SCIPdebugMsg(scip, "gradient evaluation error for %p in point %d\n", (void*)nlhdlrexprdata->nlexpr, point);
+      return SCIP_OKAY;
+   }
+
+   /* add gradient underestimator f(x) + (y - x) \nabla f(x) to rowprep, see estimateGradientInner() */
+   QUAD_ASSIGN(constant, vals[point]);
+   for( i = 0; i < nlhdlrexprdata->nleafs; ++i )
+   {
+      SCIP_Real deriv;
+      SCIP_Real varval;
+
+      deriv = grads[(size_t)i * npoints + point];
+      varval = varvals[(size_t)i * npoints + point];
+
+      SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, SCIPgetVarExprVar(nlhdlrexprdata->leafexprs[i]), deriv) );
+      SCIPquadprecSumQD(constant, constant, -deriv * varval);
+   }
+
+   SCIProwprepAddConstant(rowprep, QUAD_TO_DBL(constant));
+   SCIProwprepSetLocal(rowprep, FALSE);
+
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
 /** adds an estimator computed via a gradient to a given rowprep, possibly perturbing solution */
 static
 SCIP_RETCODE estimateGradient(
@@ -1674,17 +1721,17 @@ SCIP_RETCODE estimateGradient(
 static
 SCIP_RETCODE estimateConvexSecant(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_NLHDLR*          nlhdlr,             /**< nonlinear handler */
    SCIP_NLHDLREXPRDATA*  nlhdlrexprdata,     /**< nonlinear handler expression data */
    SCIP_SOL*             sol,                /**< solution to use, unless usemidpoint is TRUE */
    SCIP_ROWPREP*         rowprep,            /**< rowprep where to store estimator */
    SCIP_Bool*            success             /**< buffer to store whether successful */
    )
 {
-   SCIP_NLHDLRDATA* nlhdlrdata;
    SCIP_EXPR* nlexpr;
    SCIP_VAR* var;
    SCIP_Real x;
+   SCIP_Real points[2];
+   SCIP_Real fvals[2];
    SCIP_Real left, right;
    SCIP_Real fleft, fright;
 
@@ -1698,9 +1745,6 @@ SCIP_RETCODE estimateConvexSecant(
 
    *success = FALSE;
 
-   nlhdlrdata = SCIPnlhdlrGetData(nlhdlr);
-   assert(nlhdlrdata != NULL);
-
    var = SCIPgetVarExprVar(nlhdlrexprdata->leafexprs[0]);
    assert(var != NULL);
 
@@ -1736,31 +1780,24 @@ SCIP_RETCODE estimateConvexSecant(
    }
    assert(left != right);
 
-   /* now evaluate at left and right */
-   if( nlhdlrdata->evalsol == NULL )
-   {
-      SCIP_CALL( SCIPcreateSol(scip, &nlhdlrdata->evalsol, NULL) );
-   }
-
-   SCIP_CALL( SCIPsetSolVal(scip, nlhdlrdata->evalsol, var, left) );
-   SCIP_CALL( SCIPevalExpr(scip, nlexpr, nlhdlrdata->evalsol, 0L) );
+   /* now evaluate at left and right; var is the only variable of nlexpr */
+   points[0] = left;
+   points[1] = right;
+   SCIP_CALL( SCIPevalExprBatch(scip, nlexpr, 1, &var, 2, points, fvals, NULL) );
 
    /* evaluation error or a too large constant -> skip */
-   fleft = SCIPexprGetEvalValue(nlexpr);
+   fleft = fvals[0];
    if( SCIPisInfinity(scip, REALABS(fleft)) )
    {
-      SCIPdebugMsg(scip, "evaluation error / too large value (%g) for %p\n", SCIPexprGetEvalValue(nlexpr), (void*)nlexpr);
+      SCIPdebugMsg(scip, "evaluation error / too large value (%g) for %p\n", fleft, (void*)nlexpr);
       return SCIP_OKAY;
    }
 
-   SCIP_CALL( SCIPsetSolVal(scip, nlhdlrdata->evalsol, var, right) );
-   SCIP_CALL( SCIPevalExpr(scip, nlexpr, nlhdlrdata->evalsol, 0L) );
-
    /* evaluation error or a too large constant -> skip */
-   fright = SCIPexprGetEvalValue(nlexpr);
+   fright = fvals[1];
    if( SCIPisInfinity(scip, REALABS(fright)) )
    {
-      SCIPdebugMsg(scip, "evaluation error / too large value (%g) for %p\n", SCIPexprGetEvalValue(nlexpr), (void*)nlexpr);
+      SCIPdebugMsg(scip, "evaluation error / too large value (%g) for %p\n", fright, (void*)nlexpr);
       return SCIP_OKAY;
    }
 
@@ -1956,6 +1993,12 @@ SCIP_DECL_NLHDLRINITSEPA(nlhdlrInitSepaConvex)
    SCIP_Real ub;
    SCIP_Real lambda;
    SCIP_SOL* sol;
+   SCIP_VAR** leafvars;
+   SCIP_Real* points;
+   SCIP_Real* grads;
+   SCIP_Real vals[NINITLPPOINTS];
+   int nleafs;
+   int i;
    int k;
 
    assert(scip != NULL);
@@ -1983,21 +2026,23 @@ SCIP_DECL_NLHDLRINITSEPA(nlhdlrInitSepaConvex)
    /* linearizes at 5 different points obtained as convex combination of the lower and upper bound of the variables
     * present in the convex expression; whether more weight is given to the lower or upper bound of a variable depends
     * on whether the fixing of the variable to that value is better for the objective function
+    * the expression and its gradient are evaluated in all points at once; the points are stored column-wise
     */
-   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
-
-   *infeasible = FALSE;
+   nleafs = nlhdlrexprdata->nleafs;
+   SCIP_CALL( SCIPallocBufferArray(scip, &leafvars, nleafs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &points, nleafs * NINITLPPOINTS) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &grads, nleafs * NINITLPPOINTS) );
 
-   for( k = 0; k < 5; ++k )
+   for( i = 0; i < nleafs; ++i )
    {
-      int i;
-      lambda = 0.1 * (k+1); /* lambda = 0.1, 0.2, 0.3, 0.4, 0.5 */
+      SCIP_VAR* var;
 
-      for( i = 0; i < nlhdlrexprdata->nleafs; ++i )
-      {
-         SCIP_VAR* var;
+      var = SCIPgetVarExprVar(nlhdlrexprdata->leafexprs[i]);
+      leafvars[i] = var;
 
-         var = SCIPgetVarExprVar(nlhdlrexprdata->leafexprs[i]);
+      for( k = 0; k < NINITLPPOINTS; ++k )
+      {
+         lambda = 0.1 * (k+1); /* lambda = 0.1, 0.2, 0.3, 0.4, 0.5 */
 
          lb = SCIPvarGetLbGlobal(var);
          ub = SCIPvarGetUbGlobal(var);
@@ -2015,13 +2060,34 @@ SCIP_DECL_NLHDLRINITSEPA(nlhdlrInitSepaConvex)
             ub = MAX( 10.0, lb + 0.1*REALABS(lb));
 
          if( SCIPvarGetBestBoundType(var) == SCIP_BOUNDTYPE_LOWER )
-            SCIP_CALL( SCIPsetSolVal(scip, sol, var, lambda * ub + (1.0 - lambda) * lb) );
+            points[i * NINITLPPOINTS + k] = lambda * ub + (1.0 - lambda) * lb;
          else
-            SCIP_CALL( SCIPsetSolVal(scip, sol, var, lambda * lb + (1.0 - lambda) * ub) );
+            points[i * NINITLPPOINTS + k] = lambda * lb + (1.0 - lambda) * ub;
       }
+   }
+
+   SCIP_CALL( SCIPevalExprBatch(scip, nlexpr, nleafs, leafvars, NINITLPPOINTS, points, vals, grads) );
 
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   *infeasible = FALSE;
+
+   for( k = 0; k < NINITLPPOINTS; ++k )
+   {
       SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
-      SCIP_CALL( estimateGradient(scip, nlhdlr, nlhdlrexprdata, sol, rowprep, &success) );
+      SCIP_CALL( estimateGradientBatchPoint(scip, nlhdlrexprdata, NINITLPPOINTS, k, points, vals, grads, rowprep,
+            &success) );
+
+      /* if there was an evaluation error, then try again in this point with perturbation */
+      if( !success )
+      {
+         for( i = 0; i < nleafs; ++i )
+         {
+            SCIP_CALL( SCIPsetSolVal(scip, sol, leafvars[i], points[i * NINITLPPOINTS + k]) );
+         }
+
+         SCIP_CALL( estimateGradient(scip, nlhdlr, nlhdlrexprdata, sol, rowprep, &success) );
+      }
       if( !success )
       {
          SCIPdebugMsg(scip, "failed to linearize for k = %d\n", k);
@@ -2059,6 +2125,9 @@ SCIP_DECL_NLHDLRINITSEPA(nlhdlrInitSepaConvex)
    }
 
    SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIPfreeBufferArray(scip, &grads);
+   SCIPfreeBufferArray(scip, &points);
+   SCIPfreeBufferArray(scip, &leafvars);
 
    return SCIP_OKAY;
 }
@@ -2096,7 +2165,7 @@ SCIP_DECL_NLHDLRESTIMATE(nlhdlrEstimateConvex)
 
    if( nlhdlrexprdata->nleafs == 1 && SCIPexprIsIntegral(nlhdlrexprdata->leafexprs[0]) )
    {
-      SCIP_CALL( estimateConvexSecant(scip, nlhdlr, nlhdlrexprdata, sol, rowprep, success) );
+      SCIP_CALL( estimateConvexSecant(scip, nlhdlrexprdata, sol, rowprep, success) );
 
       (void) SCIPsnprintf(SCIProwprepGetName(rowprep), SCIP_MAXSTRLEN, "%sestimate_convexsecant%p_%s%" SCIP_LONGINT_FORMAT,
          overestimate ? "over" : "under",
@@ -2157,7 +2226,7 @@ SCIP_DECL_NLHDLRSOLLINEARIZE(nlhdlrSollinearizeConvex)
 
    if( nlhdlrexprdata->nleafs == 1 && SCIPexprIsIntegral(nlhdlrexprdata->leafexprs[0]) )
    {
-      SCIP_CALL( estimateConvexSecant(scip, nlhdlr, nlhdlrexprdata, sol, rowprep, &success) );
+      SCIP_CALL( estimateConvexSecant(scip, nlhdlrexprdata, sol, rowprep, &success) );
 
       (void) SCIPsnprintf(SCIProwprepGetName(rowprep), SCIP_MAXSTRLEN, "%sestimate_convexsecant%p_sol%dnotify",
          overestimate ? "over" : "under", (void*)expr, SCIPsolGetIndex(sol));
@@ -2419,7 +2488,7 @@ SCIP_DECL_NLHDLRINITSEPA(nlhdlrInitSepaConcave)
 
    /* compute estimator and store in rowprep */
    SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
-   SCIP_CALL( estimateVertexPolyhedral(scip, conshdlr, nlhdlr, nlhdlrexprdata, NULL, TRUE, overestimate,
+   SCIP_CALL( estimateVertexPolyhedral(scip, conshdlr, nlhdlrexprdata, NULL, TRUE, overestimate,
          overestimate ? SCIPinfinity(scip) : -SCIPinfinity(scip), rowprep, &success) );
    if( !success )
    {
@@ -2483,7 +2552,7 @@ SCIP_DECL_NLHDLRESTIMATE(nlhdlrEstimateConcave)
 
    SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
 
-   SCIP_CALL( estimateVertexPolyhedral(scip, conshdlr, nlhdlr, nlhdlrexprdata, sol, FALSE, overestimate, targetvalue, rowprep, success) );
+   SCIP_CALL( estimateVertexPolyhedral(scip, conshdlr, nlhdlrexprdata, sol, FALSE, overestimate, targetvalue, rowprep, success) );
 
    if( *success )
    {
@@ -219,6 +219,8 @@ void SCIPnlpiInit(
    SCIPclockReset(nlpi->problemtime);
    nlpi->solvetime = 0.0;
    nlpi->evaltime = 0.0;
+   nlpi->jacevaltime = 0.0;
+   nlpi->hesevaltime = 0.0;
    nlpi->niter = 0L;
    BMSclearMemoryArray(nlpi->ntermstat, (int)SCIP_NLPTERMSTAT_OTHER+1);
    BMSclearMemoryArray(nlpi->nsolstat, (int)SCIP_NLPSOLSTAT_UNKNOWN+1);
@@ -609,9 +611,15 @@ SCIP_RETCODE SCIPnlpiSolve(
    /* coverity[overrun] */
    ++nlpi->nsolstat[nlpi->nlpigetsolstat(set->scip, nlpi, problem)];
 
+   /* the evaluation times were added later to the statistics, so they may not be set by all NLP solvers */
+   stats.jacevaltime = 0.0;
+   stats.hesevaltime = 0.0;
+
    SCIP_CALL( nlpi->nlpigetstatistics(set->scip, nlpi, problem, &stats) );
    nlpi->solvetime += stats.totaltime;
    nlpi->evaltime += stats.evaltime;
+   nlpi->jacevaltime += stats.jacevaltime;
+   nlpi->hesevaltime += stats.hesevaltime;
    nlpi->niter += stats.niterations;
 
    return SCIP_OKAY;
@@ -703,6 +711,8 @@ SCIP_RETCODE SCIPnlpiGetStatistics(
 #undef SCIPnlpiGetNSolves
 #undef SCIPnlpiGetSolveTime
 #undef SCIPnlpiGetEvalTime
+#undef SCIPnlpiGetJacobianEvalTime
+#undef SCIPnlpiGetHessianEvalTime
 #undef SCIPnlpiGetNIterations
 #undef SCIPnlpiGetNTermStat
 #undef SCIPnlpiGetNSolStat
@@ -800,6 +810,30 @@ SCIP_Real SCIPnlpiGetEvalTime(
    return nlpi->evaltime;
 }
 
+/** gives total time spend in evaluation of Jacobians during NLP solves
+ *
+ * If parameter `timing/nlpieval` is off (the default), depending on the NLP solver, this may just return 0.
+ */
+SCIP_Real SCIPnlpiGetJacobianEvalTime(
+   SCIP_NLPI*            nlpi                /**< NLP interface structure */
+   )
+{
+   assert(nlpi != NULL);
+   return nlpi->jacevaltime;
+}
+
+/** gives total time spend in evaluation of Hessians of the Lagrangian during NLP solves
+ *
+ * If parameter `timing/nlpieval` is off (the default), depending on the NLP solver, this may just return 0.
+ */
+SCIP_Real SCIPnlpiGetHessianEvalTime(
+   SCIP_NLPI*            nlpi                /**< NLP interface structure */
+   )
+{
+   assert(nlpi != NULL);
+   return nlpi->hesevaltime;
+}
+
 /** gives total number of iterations spend by NLP solver so far */
 SCIP_Longint SCIPnlpiGetNIterations(
    SCIP_NLPI*            nlpi                /**< NLP interface structure */
@@ -846,6 +880,8 @@ void SCIPnlpiMergeStatistics(
    SCIPclockSetTime(targetnlpi->problemtime, SCIPclockGetTime(targetnlpi->problemtime) + SCIPclockGetTime(sourcenlpi->problemtime));
    targetnlpi->solvetime += sourcenlpi->solvetime;
    targetnlpi->evaltime += sourcenlpi->evaltime;
+   targetnlpi->jacevaltime += sourcenlpi->jacevaltime;
+   targetnlpi->hesevaltime += sourcenlpi->hesevaltime;
    targetnlpi->niter += sourcenlpi->niter;
 
    for( i = (int)SCIP_NLPTERMSTAT_OKAY; i <= (int)SCIP_NLPTERMSTAT_OTHER; ++i )
@@ -860,6 +896,8 @@ void SCIPnlpiMergeStatistics(
       SCIPclockReset(sourcenlpi->problemtime);
       sourcenlpi->solvetime = 0.0;
       sourcenlpi->evaltime = 0.0;
+      sourcenlpi->jacevaltime = 0.0;
+      sourcenlpi->hesevaltime = 0.0;
       sourcenlpi->niter = 0;
 
       for( i = (int)SCIP_NLPTERMSTAT_OKAY; i <= (int)SCIP_NLPTERMSTAT_OTHER; ++i )
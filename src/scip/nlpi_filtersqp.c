@@ -1789,6 +1789,8 @@ SCIP_DECL_NLPIGETSTATISTICS(nlpiGetStatisticsFilterSQP)
    statistics->niterations = problem->niterations;
    statistics->totaltime = problem->solvetime;
    statistics->evaltime = SCIPnlpiOracleGetEvalTime(scip, problem->oracle);
+   statistics->jacevaltime = SCIPnlpiOracleGetJacobianEvalTime(scip, problem->oracle);
+   statistics->hesevaltime = SCIPnlpiOracleGetHessianLagEvalTime(scip, problem->oracle);
    statistics->consviol = problem->rstat[4];
    statistics->boundviol = 0.0;
 
@@ -1720,6 +1720,8 @@ SCIP_DECL_NLPIGETSTATISTICS(nlpiGetStatisticsIpopt)
    statistics->niterations = problem->lastniter;
    statistics->totaltime = problem->lasttime;
    statistics->evaltime = SCIPnlpiOracleGetEvalTime(scip, problem->oracle);
+   statistics->jacevaltime = SCIPnlpiOracleGetJacobianEvalTime(scip, problem->oracle);
+   statistics->hesevaltime = SCIPnlpiOracleGetHessianLagEvalTime(scip, problem->oracle);
    statistics->consviol = problem->solconsviol;
    statistics->boundviol = problem->solboundviol;
 
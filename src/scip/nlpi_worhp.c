@@ -1577,6 +1577,8 @@ SCIP_DECL_NLPIGETSTATISTICS(nlpiGetStatisticsWorhp)
    statistics->niterations = problem->lastniter;
    statistics->totaltime = problem->lasttime;
    statistics->evaltime = SCIPnlpiOracleGetEvalTime(scip, problem->oracle);
+   statistics->jacevaltime = SCIPnlpiOracleGetJacobianEvalTime(scip, problem->oracle);
+   statistics->hesevaltime = SCIPnlpiOracleGetHessianLagEvalTime(scip, problem->oracle);
    statistics->consviol = problem->wsp->FeasOrigMax;
    statistics->boundviol = 0.0;
 
@@ -37,9 +37,13 @@
 #include "scip/exprinterpret.h"
 #include "scip/expr_pow.h"
 #include "scip/expr_varidx.h"
+#include "tpi/tpi.h"
+#include "tpi/def_openmp.h"
 
 #include <string.h> /* for strlen */
 
+#define ORACLE_JOBMINCONSS  100              /**< minimal number of constraints evaluated by one parallel job */
+
 /**@name NLPI Oracle data structures */
 /**@{ */
 
@@ -55,6 +59,8 @@ struct SCIP_NlpiOracleCons
 
    SCIP_EXPR*            expr;               /**< expression for nonlinear part, or NULL if none */
    SCIP_EXPRINTDATA*     exprintdata;        /**< expression interpret data for expression, or NULL if no expr or not compiled yet */
+   int*                  heslagpos;          /**< positions of the Hessian entries of expr in the sparsity pattern of the Hessian of the Lagrangian, or NULL if not known yet */
+   int                   nheslagpos;         /**< length of heslagpos array */
 
    char*                 name;               /**< name of constraint */
 };
@@ -86,6 +92,12 @@ struct SCIP_NlpiOracle
 
    SCIP_EXPRINT*         exprinterpreter;    /**< interpreter for expressions: evaluation and derivatives */
    SCIP_CLOCK*           evalclock;          /**< clock measuring evaluation time */
+   SCIP_CLOCK*           jacclock;           /**< clock measuring time for evaluating the Jacobian */
+   SCIP_CLOCK*           hesclock;           /**< clock measuring time for evaluating the Hessian of the Lagrangian */
+
+   int                   nthreads;           /**< number of threads for evaluating the Jacobian and the Hessian of the Lagrangian (1: sequential) */
+   SCIP_Bool             jacparallel;        /**< can the Jacobian be evaluated in parallel, i.e., has it been evaluated once sequentially? */
+   SCIP_Bool             hesparallel;        /**< can the Hessian of the Lagrangian be evaluated in parallel, i.e., have the Hessians of all constraints been evaluated once sequentially? */
 };
 
 /**@} */
@@ -203,6 +215,9 @@ void invalidateJacobiSparsity(
 
    SCIPdebugMessage("%p invalidate jacobian sparsity\n", (void*)oracle);
 
+   /* constraints may have been added or changed, so they have to be evaluated sequentially once again */
+   oracle->jacparallel = FALSE;
+
    if( oracle->jacoffsets == NULL )
    { /* nothing to do */
       assert(oracle->jaccols == NULL);
@@ -223,10 +238,14 @@ void invalidateHessianLagSparsity(
    SCIP_NLPIORACLE*      oracle              /**< pointer to store NLPIORACLE data structure */
    )
 {
+   int i;
+
    assert(oracle != NULL);
 
    SCIPdebugMessage("%p invalidate hessian lag sparsity\n", (void*)oracle);
 
+   oracle->hesparallel = FALSE;
+
    if( oracle->heslagoffsets == NULL )
    { /* nothing to do */
       assert(oracle->heslagcols == NULL);
@@ -234,6 +253,16 @@ void invalidateHessianLagSparsity(
    }
 
    assert(oracle->heslagcols != NULL);
+
+   /* the positions of the Hessian entries of the expressions refer to the sparsity pattern */
+   SCIPfreeBlockMemoryArrayNull(scip, &oracle->objective->heslagpos, oracle->objective->nheslagpos);
+   oracle->objective->nheslagpos = 0;
+   for( i = 0; i < oracle->nconss; ++i )
+   {
+      SCIPfreeBlockMemoryArrayNull(scip, &oracle->conss[i]->heslagpos, oracle->conss[i]->nheslagpos);
+      oracle->conss[i]->nheslagpos = 0;
+   }
+
    SCIPfreeBlockMemoryArray(scip, &oracle->heslagcols,    oracle->heslagoffsets[oracle->nvars]);
    SCIPfreeBlockMemoryArray(scip, &oracle->heslagoffsets, oracle->nvars + 1);
 }
@@ -418,6 +447,7 @@ SCIP_RETCODE freeConstraint(
 
    SCIPfreeBlockMemoryArrayNull(scip, &(*cons)->linidxs, (*cons)->linsize);
    SCIPfreeBlockMemoryArrayNull(scip, &(*cons)->lincoefs, (*cons)->linsize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*cons)->heslagpos, (*cons)->nheslagpos);
 
    if( (*cons)->expr != NULL )
    {
@@ -786,18 +816,19 @@ SCIP_RETCODE hessLagSparsitySetNzFlagForExpr(
    return SCIP_OKAY;
 }
 
-/** adds hessian of an expression into hessian structure */
+/** adds hessian of the expression of a constraint into hessian structure
+ *
+ * The positions of the Hessian entries of the expression in the Hessian structure are looked up at the first call and
+ * stored in the constraint, so that later calls only scatter the values.
+ */
 static
 SCIP_RETCODE hessLagAddExpr(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_NLPIORACLE*      oracle,             /**< oracle */
+   SCIP_NLPIORACLECONS*  cons,               /**< oracle constraint or objective with expression */
    SCIP_Real             weight,             /**< weight of quadratic part */
    const SCIP_Real*      x,                  /**< point for which hessian should be returned */
    SCIP_Bool             new_x,              /**< whether point has been evaluated before */
-   SCIP_EXPR*            expr,               /**< expression */
-   SCIP_EXPRINTDATA*     exprintdata,        /**< expression interpreter data for expression */
-   int*                  hesoffset,          /**< row offsets in sparse matrix that is to be filled */
-   int*                  hescol,             /**< column indices in sparse matrix that is to be filled */
    SCIP_Real*            values              /**< buffer for values of sparse matrix that is to be filled */
    )
 {
@@ -814,19 +845,43 @@ SCIP_RETCODE hessLagAddExpr(
    SCIPdebugMessage("%p hess lag add expr\n", (void*)oracle);
 
    assert(oracle != NULL);
+   assert(cons != NULL);
    assert(x != NULL || new_x == FALSE);
-   assert(expr != NULL);
-   assert(hesoffset != NULL);
-   assert(hescol != NULL);
+   assert(cons->expr != NULL);
+   assert(oracle->heslagoffsets != NULL);
+   assert(oracle->heslagcols != NULL);
    assert(values != NULL);
 
-   SCIP_CALL( SCIPexprintHessian(scip, oracle->exprinterpreter, expr, exprintdata, (SCIP_Real*)x, new_x, &val, &rowidxs, &colidxs, &h, &nnz) );
+   SCIP_CALL( SCIPexprintHessian(scip, oracle->exprinterpreter, cons->expr, cons->exprintdata, (SCIP_Real*)x, new_x, &val, &rowidxs, &colidxs, &h, &nnz) );
    if( !SCIPisFinite(val) )
    {
       SCIPdebugMessage("hessian evaluation yield invalid function value %g\n", val);
       return SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
    }
 
+   if( cons->heslagpos == NULL && nnz > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cons->heslagpos, nnz) );
+      cons->nheslagpos = nnz;
+
+      for( i = 0; i < nnz; ++i )
+      {
+         row = rowidxs[i];
+         col = colidxs[i];
+
+         if( !SCIPsortedvecFindInt(&oracle->heslagcols[oracle->heslagoffsets[row]], col, oracle->heslagoffsets[row+1] - oracle->heslagoffsets[row], &pos) )
+         {
+            SCIPerrorMessage("Could not find entry (%d, %d) in hessian sparsity\n", row, col);
+            SCIPfreeBlockMemoryArray(scip, &cons->heslagpos, cons->nheslagpos);
+            cons->nheslagpos = 0;
+            return SCIP_ERROR;
+         }
+
+         cons->heslagpos[i] = oracle->heslagoffsets[row] + pos;
+      }
+   }
+   assert(cons->nheslagpos == nnz);
+
    for( i = 0; i < nnz; ++i )
    {
       if( !SCIPisFinite(h[i]) )
@@ -835,24 +890,417 @@ SCIP_RETCODE hessLagAddExpr(
          return SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
       }
 
-      if( h[i] == 0.0 )
+      values[cons->heslagpos[i]] += weight * h[i];
+   }
+
+   return SCIP_OKAY;
+}
+
+/** computes the value and the gradient of one constraint and stores the gradient in the Jacobian
+ *
+ * The array grad must be clean, i.e., all zero, and is clean again on return.
+ *
+ * @return SCIP_INVALIDDATA, if the function or its gradient could not be evaluated (domain error, etc.)
+ */
+static
+SCIP_RETCODE evalJacobianRow(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
+   int                   considx,            /**< index of constraint */
+   const SCIP_Real*      x,                  /**< point where to evaluate */
+   SCIP_Bool             isnewx,             /**< has the point x changed since the last call to some evaluation function? */
+   SCIP_Real*            convals,            /**< pointer to store constraint values, can be NULL */
+   SCIP_Real*            jacobi,             /**< pointer to store sparse jacobian values */
+   SCIP_Real*            grad                /**< clean working array of length nvars */
+   )
+{
+   SCIP_NLPIORACLECONS* cons;
+   SCIP_Real nlval;
+   int j;
+   int l;
+
+   cons = oracle->conss[considx];
+   assert(cons != NULL);
+
+   if( cons->expr == NULL )
+   {
+      if( convals != NULL )
+         convals[considx] = 0.0;
+
+      /* for a linear constraint, we can just copy the linear coefs from the constraint into the jacobian */
+      if( cons->nlinidxs > 0 )
+      {
+         assert(oracle->jacoffsets[considx+1] - oracle->jacoffsets[considx] == cons->nlinidxs);
+         BMScopyMemoryArray(&jacobi[oracle->jacoffsets[considx]], cons->lincoefs, cons->nlinidxs);
+         if( convals != NULL )
+            for( l = 0; l < cons->nlinidxs; ++l )
+               convals[considx] += cons->lincoefs[l] * x[cons->linidxs[l]];
+      }
+      return SCIP_OKAY;
+   }
+
+   /* eval grad for nonlinear and add to jacobi */
+   SCIPdebugMsg(scip, "eval gradient of ");
+   SCIPdebug( if( isnewx ) {printf("\nx ="); for( l = 0; l < oracle->nvars; ++l) printf(" %g", x[l]); printf("\n");} )
+
+   SCIP_CALL( SCIPexprintGrad(scip, oracle->exprinterpreter, cons->expr, cons->exprintdata, (SCIP_Real*)x, isnewx, &nlval, grad) );
+
+   SCIPdebug( printf("g ="); for( l = oracle->jacoffsets[considx]; l < oracle->jacoffsets[considx+1]; ++l) printf(" %g", grad[oracle->jaccols[l]]); printf("\n"); )
+
+   if( !SCIPisFinite(nlval) || SCIPisInfinity(scip, ABS(nlval)) )
+   {
+      SCIPdebugMessage("gradient evaluation yield invalid function value %g\n", nlval);
+      BMSclearMemoryArray(grad, oracle->nvars);
+      return SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
+   }
+   if( convals != NULL )
+      convals[considx] = nlval;
+
+   /* add linear part to grad */
+   for( l = 0; l < cons->nlinidxs; ++l )
+   {
+      if( convals != NULL )
+         convals[considx] += cons->lincoefs[l] * x[cons->linidxs[l]];
+      /* if grad[cons->linidxs[l]] is not finite, then adding a finite value doesn't change that, so don't check that here */
+      grad[cons->linidxs[l]] += cons->lincoefs[l];
+   }
+
+   /* store complete gradient (linear + nonlinear) in jacobi
+    * use the already evaluated sparsity pattern to pick only elements from grad that could have been set
+    */
+   for( j = oracle->jacoffsets[considx]; j < oracle->jacoffsets[considx+1]; ++j )
+   {
+      if( !SCIPisFinite(grad[oracle->jaccols[j]]) )
+      {
+         SCIPdebugMessage("gradient evaluation yield invalid gradient value %g\n", grad[oracle->jaccols[j]]);
+         BMSclearMemoryArray(grad, oracle->nvars);
+         return SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
+      }
+      jacobi[j] = grad[oracle->jaccols[j]];
+      /* reset to 0 for next constraint */
+      grad[oracle->jaccols[j]] = 0.0;
+   }
+
+#ifndef NDEBUG
+   /* check that exprint really wrote only into expected elements of grad
+    * TODO remove after some testing for better performance of debug runs */
+   for( l = 0; l < oracle->nvars; ++l )
+      assert(grad[l] == 0.0);
+#endif
+
+   return SCIP_OKAY;
+}
+
+/*
+ * Parallel evaluation of derivatives
+ */
+
+/** checks whether the derivatives of all constraints can be evaluated in parallel
+ *
+ * This is the case if the expression interpreter evaluates all expressions without calling the expression handlers and
+ * every expression has a variable. Otherwise, evaluations may use the buffer memory of SCIP, which is not thread-safe.
+ */
+static
+SCIP_RETCODE oracleCanEvalParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
+   SCIP_Bool*            canparallel         /**< pointer to store whether evaluations can be done in parallel */
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_EXPR* expr;
+   int i;
+
+   assert(oracle != NULL);
+   assert(canparallel != NULL);
+
+   *canparallel = TRUE;
+
+   SCIP_CALL( SCIPcreateExpriter(scip, &it) );
+   SCIP_CALL( SCIPexpriterInit(it, NULL, SCIP_EXPRITER_DFS, FALSE) );
+
+   for( i = 0; i < oracle->nconss && *canparallel; ++i )
+   {
+      if( oracle->conss[i]->expr == NULL )
          continue;
 
-      row = rowidxs[i];
-      col = colidxs[i];
+      if( SCIPexprintGetExprCapability(scip, oracle->exprinterpreter, oracle->conss[i]->expr, oracle->conss[i]->exprintdata) != SCIP_EXPRINTCAPABILITY_ALL )
+      {
+         *canparallel = FALSE;
+         break;
+      }
 
-      if( !SCIPsortedvecFindInt(&hescol[hesoffset[row]], col, hesoffset[row+1] - hesoffset[row], &pos) )
+      *canparallel = FALSE;
+      for( expr = SCIPexpriterRestartDFS(it, oracle->conss[i]->expr); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
       {
-         SCIPerrorMessage("Could not find entry (%d, %d) in hessian sparsity\n", row, col);
-         return SCIP_ERROR;
+         if( SCIPisExprVaridx(scip, expr) )
+         {
+            *canparallel = TRUE;
+            break;
+         }
       }
+   }
 
-      values[hesoffset[row] + pos] += weight * h[i];
+   SCIPfreeExpriter(&it);
+
+   return SCIP_OKAY;
+}
+
+/** returns whether derivatives are evaluated in parallel through the task processing interface
+ *
+ *  The derivatives are evaluated sequentially if no thread pool is available, see SCIPacquireTPI().
+ */
+static
+SCIP_RETCODE oracleUseTPI(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
+   SCIP_Bool*            usetpi              /**< pointer to store whether the derivatives are evaluated in parallel */
+   )
+{
+   assert(oracle != NULL);
+   assert(usetpi != NULL);
+
+   *usetpi = FALSE;
+
+   if( oracle->nthreads <= 1 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPacquireTPI(scip, usetpi) );
+
+   return SCIP_OKAY;
+}
+
+/** submits jobs and waits until all of them have finished
+ *
+ * @return the smallest return code of all jobs
+ */
+static
+SCIP_RETCODE oracleRunJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args), /**< function to execute by each job */
+   void*                 jobs,               /**< array of job data */
+   size_t                jobsize,            /**< size of the data of one job */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   int jobid;
+   int j;
+
+   jobid = SCIPtpiGetNewJobID();
+
+   TPI_PARA
+   {
+      TPI_SINGLE
+      {
+         for( j = 0; j < njobs; ++j )
+         {
+            /* cppcheck-suppress unassignedVariable */
+            SCIP_JOB* job;
+            SCIP_SUBMITSTATUS status;
+
+            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, jobfunc, (void*) ((char*)jobs + j * jobsize)) );
+            SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+            assert(status == SCIP_SUBMIT_SUCCESS);
+         }
+      }
+   }
+
+   return SCIPtpiProcessAndCollectJobs(jobid);
+}
+
+/** data of a job evaluating the Jacobian for a range of constraints */
+struct JacobianJob
+{
+   SCIP*                 scip;               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle;             /**< NLPI oracle */
+   const SCIP_Real*      x;                  /**< point where to evaluate */
+   SCIP_Bool             isnewx;             /**< has the point x changed since the last call to some evaluation function? */
+   SCIP_Real*            convals;            /**< array to store constraint values, or NULL */
+   SCIP_Real*            jacobi;             /**< array to store sparse jacobian values */
+   SCIP_Real*            grad;               /**< clean working array of length nvars of this job */
+   int                   firstcons;          /**< index of first constraint of the job */
+   int                   lastcons;           /**< index after the last constraint of the job */
+};
+typedef struct JacobianJob JACOBIANJOB;
+
+/** job function evaluating the Jacobian for a range of constraints; each constraint belongs to one job only */
+static
+SCIP_RETCODE execJacobianJob(
+   void*                 args                /**< the job data */
+   )
+{
+   JACOBIANJOB* job;
+   int i;
+
+   job = (JACOBIANJOB*) args;
+   assert(job != NULL);
+
+   for( i = job->firstcons; i < job->lastcons; ++i )
+   {
+      SCIP_RETCODE retcode;
+
+      retcode = evalJacobianRow(job->scip, job->oracle, i, job->x, job->isnewx, job->convals, job->jacobi, job->grad);
+      if( retcode != SCIP_OKAY )
+         return retcode;
    }
 
    return SCIP_OKAY;
 }
 
+/** evaluates the Jacobian in parallel
+ *
+ * The constraints are split into one consecutive range per thread. Each job evaluates the gradients of its own
+ * constraints only, so that the results are identical to the sequential evaluation.
+ *
+ * @return SCIP_INVALIDDATA, if the Jacobian could not be evaluated (domain error, etc.)
+ */
+static
+SCIP_RETCODE evalJacobianParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
+   const SCIP_Real*      x,                  /**< point where to evaluate */
+   SCIP_Bool             isnewx,             /**< has the point x changed since the last call to some evaluation function? */
+   SCIP_Real*            convals,            /**< pointer to store constraint values, can be NULL */
+   SCIP_Real*            jacobi,             /**< pointer to store sparse jacobian values */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   JACOBIANJOB* jobs;
+   SCIP_RETCODE retcode;
+   int jobsize;
+   int j;
+
+   assert(njobs > 1);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, njobs) );
+
+   jobsize = (oracle->nconss + njobs - 1) / njobs;
+   for( j = 0; j < njobs; ++j )
+   {
+      jobs[j].scip = scip;
+      jobs[j].oracle = oracle;
+      jobs[j].x = x;
+      jobs[j].isnewx = isnewx;
+      jobs[j].convals = convals;
+      jobs[j].jacobi = jacobi;
+      jobs[j].firstcons = j * jobsize;
+      jobs[j].lastcons = MIN((j+1) * jobsize, oracle->nconss);
+      SCIP_CALL( SCIPallocCleanBufferArray(scip, &jobs[j].grad, oracle->nvars) );
+   }
+
+   retcode = oracleRunJobs(execJacobianJob, (void*) jobs, sizeof(JACOBIANJOB), njobs);
+
+   for( j = njobs - 1; j >= 0; --j )
+   {
+      SCIPfreeCleanBufferArray(scip, &jobs[j].grad);
+   }
+   SCIPfreeBufferArray(scip, &jobs);
+
+   return retcode;
+}
+
+/** data of a job evaluating the Hessian of the Lagrangian for a range of constraints */
+struct HessianJob
+{
+   SCIP*                 scip;               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle;             /**< NLPI oracle */
+   const SCIP_Real*      x;                  /**< point where to evaluate */
+   SCIP_Bool             isnewx;             /**< has the point x changed since the last call to the constraint evaluation function? */
+   const SCIP_Real*      lambda;             /**< weights (Lagrangian multipliers) for the constraints */
+   SCIP_Real*            values;             /**< array to store the sum of the weighted Hessians of the constraints of this job */
+   int                   firstcons;          /**< index of first constraint of the job */
+   int                   lastcons;           /**< index after the last constraint of the job */
+};
+typedef struct HessianJob HESSIANJOB;
+
+/** job function evaluating the weighted sum of the Hessians for a range of constraints */
+static
+SCIP_RETCODE execHessianJob(
+   void*                 args                /**< the job data */
+   )
+{
+   HESSIANJOB* job;
+   int i;
+
+   job = (HESSIANJOB*) args;
+   assert(job != NULL);
+
+   for( i = job->firstcons; i < job->lastcons; ++i )
+   {
+      SCIP_RETCODE retcode;
+
+      if( job->lambda[i] == 0.0 || job->oracle->conss[i]->expr == NULL )
+         continue;
+
+      retcode = hessLagAddExpr(job->scip, job->oracle, job->oracle->conss[i], job->lambda[i], job->x, job->isnewx, job->values);
+      if( retcode != SCIP_OKAY )
+         return retcode;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** adds the weighted Hessians of the constraints to the Hessian of the Lagrangian in parallel
+ *
+ * The constraints are split into one consecutive range per thread. Each job sums the Hessians of its constraints in an
+ * array of its own, and these arrays are added to the Hessian of the Lagrangian in the order of the jobs.
+ *
+ * @return SCIP_INVALIDDATA, if the Hessian could not be evaluated (domain error, etc.)
+ */
+static
+SCIP_RETCODE evalHessianLagParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
+   const SCIP_Real*      x,                  /**< point where to evaluate */
+   SCIP_Bool             isnewx,             /**< has the point x changed since the last call to the constraint evaluation function? */
+   const SCIP_Real*      lambda,             /**< weights (Lagrangian multipliers) for the constraints */
+   SCIP_Real*            hessian,            /**< sparse hessian values to add to */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   HESSIANJOB* jobs;
+   SCIP_RETCODE retcode;
+   int jobsize;
+   int nnz;
+   int i;
+   int j;
+
+   assert(njobs > 1);
+
+   nnz = oracle->heslagoffsets[oracle->nvars];
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, njobs) );
+
+   jobsize = (oracle->nconss + njobs - 1) / njobs;
+   for( j = 0; j < njobs; ++j )
+   {
+      jobs[j].scip = scip;
+      jobs[j].oracle = oracle;
+      jobs[j].x = x;
+      jobs[j].isnewx = isnewx;
+      jobs[j].lambda = lambda;
+      jobs[j].firstcons = j * jobsize;
+      jobs[j].lastcons = MIN((j+1) * jobsize, oracle->nconss);
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs[j].values, nnz) );
+   }
+
+   retcode = oracleRunJobs(execHessianJob, (void*) jobs, sizeof(HESSIANJOB), njobs);
+
+   for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+   {
+      for( i = 0; i < nnz; ++i )
+         hessian[i] += jobs[j].values[i];
+   }
+
+   for( j = njobs - 1; j >= 0; --j )
+   {
+      SCIPfreeBufferArray(scip, &jobs[j].values);
+   }
+   SCIPfreeBufferArray(scip, &jobs);
+
+   return retcode;
+}
+
 /** prints a name, if available, makes sure it has not more than 64 characters, and adds a unique prefix if the longnames flag is set */
 static
 void printName(
@@ -986,6 +1434,7 @@ SCIP_RETCODE SCIPnlpiOracleCreate(
    )
 {
    SCIP_Bool nlpieval;
+   int maxnthreads;
 
    assert(oracle != NULL);
 
@@ -998,10 +1447,20 @@ SCIP_RETCODE SCIPnlpiOracleCreate(
    SCIP_CALL( SCIPexprintCreate(scip, &(*oracle)->exprinterpreter) );
 
    SCIP_CALL( SCIPcreateClock(scip, &(*oracle)->evalclock) );
+   SCIP_CALL( SCIPcreateClock(scip, &(*oracle)->jacclock) );
+   SCIP_CALL( SCIPcreateClock(scip, &(*oracle)->hesclock) );
 
    SCIP_CALL( SCIPgetBoolParam(scip, "timing/nlpieval", &nlpieval) );
    if( !nlpieval )
+   {
       SCIPsetClockEnabled((*oracle)->evalclock, FALSE);
+      SCIPsetClockEnabled((*oracle)->jacclock, FALSE);
+      SCIPsetClockEnabled((*oracle)->hesclock, FALSE);
+   }
+
+   SCIP_CALL( SCIPgetIntParam(scip, "nlp/evalnthreads", &(*oracle)->nthreads) );
+   SCIP_CALL( SCIPgetIntParam(scip, "parallel/maxnthreads", &maxnthreads) );
+   (*oracle)->nthreads = MIN((*oracle)->nthreads, maxnthreads);
 
    /* create zero objective function */
    SCIP_CALL( createConstraint(scip, *oracle, &(*oracle)->objective, 0, NULL, NULL, NULL, 0.0, 0.0, NULL) );
@@ -1027,6 +1486,8 @@ SCIP_RETCODE SCIPnlpiOracleFree(
    SCIP_CALL( freeConstraints(scip, *oracle) );
    freeVariables(scip, *oracle);
 
+   SCIP_CALL( SCIPfreeClock(scip, &(*oracle)->hesclock) );
+   SCIP_CALL( SCIPfreeClock(scip, &(*oracle)->jacclock) );
    SCIP_CALL( SCIPfreeClock(scip, &(*oracle)->evalclock) );
 
    SCIP_CALL( SCIPexprintFree(scip, &(*oracle)->exprinterpreter) );
@@ -2153,6 +2614,8 @@ SCIP_RETCODE SCIPnlpiOracleGetJacobianSparsity(
  *
  *  The values in the Jacobian matrix are returned in the same order as specified by the offset and col arrays obtained by SCIPnlpiOracleGetJacobianSparsity().
  *  The user need to call SCIPnlpiOracleGetJacobianSparsity() at least ones before using this function.
+ *  If parameter nlp/evalnthreads is larger than 1, the gradients of the constraints are evaluated in parallel after the
+ *  Jacobian has been evaluated once sequentially.
  *
  * @return SCIP_INVALIDDATA, if the Jacobian could not be evaluated (domain error, etc.)
  */
@@ -2165,14 +2628,11 @@ SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
    SCIP_Real*            jacobi              /**< pointer to store sparse jacobian values */
    )
 {
-   SCIP_NLPIORACLECONS* cons;
    SCIP_RETCODE retcode;
    SCIP_Real* grad;
-   SCIP_Real nlval;
+   SCIP_Bool usetpi;
+   int njobs;
    int i;
-   int j;
-   int k;
-   int l;
 
    SCIPdebugMessage("%p eval jacobian\n", (void*)oracle);
 
@@ -2181,97 +2641,43 @@ SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
 
    assert(oracle->jacoffsets != NULL);
    assert(oracle->jaccols    != NULL);
+   assert(oracle->jacoffsets[0] == 0);
 
    SCIP_CALL( SCIPstartClock(scip, oracle->evalclock) );
+   SCIP_CALL( SCIPstartClock(scip, oracle->jacclock) );
 
-   SCIP_CALL( SCIPallocCleanBufferArray(scip, &grad, oracle->nvars) );
-
-   retcode = SCIP_OKAY;
-
-   j = oracle->jacoffsets[0];  /* TODO isn't oracle->jacoffsets[0] == 0 and thus always j == k ? */
-   k = 0;
-   for( i = 0; i < oracle->nconss; ++i )
+   /* evaluate the constraints in parallel if each of them has been evaluated sequentially once; the number of jobs
+    * is taken from the number of threads of the oracle, since the task processing interface may not know it outside
+    * of a parallel region
+    */
+   njobs = MIN(oracle->nthreads, oracle->nconss / ORACLE_JOBMINCONSS);
+   usetpi = FALSE;
+   if( oracle->jacparallel && njobs > 1 )
    {
-      cons = oracle->conss[i];
-      assert(cons != NULL);
-
-      if( cons->expr == NULL )
-      {
-         if( convals != NULL )
-            convals[i] = 0.0;
-
-         /* for a linear constraint, we can just copy the linear coefs from the constraint into the jacobian */
-         if( cons->nlinidxs > 0 )
-         {
-            BMScopyMemoryArray(&jacobi[k], cons->lincoefs, cons->nlinidxs);
-            j += cons->nlinidxs;
-            k += cons->nlinidxs;
-            if( convals != NULL )
-               for( l = 0; l < cons->nlinidxs; ++l )
-                  convals[i] += cons->lincoefs[l] * x[cons->linidxs[l]];
-         }
-         assert(j == oracle->jacoffsets[i+1]);
-         continue;
-      }
-
-      /* eval grad for nonlinear and add to jacobi */
-      SCIPdebugMsg(scip, "eval gradient of ");
-      SCIPdebug( if( isnewx ) {printf("\nx ="); for( l = 0; l < oracle->nvars; ++l) printf(" %g", x[l]); printf("\n");} )
-
-      SCIP_CALL( SCIPexprintGrad(scip, oracle->exprinterpreter, cons->expr, cons->exprintdata, (SCIP_Real*)x, isnewx, &nlval, grad) );
+      SCIP_CALL( oracleUseTPI(scip, oracle, &usetpi) );
+   }
 
-      SCIPdebug( printf("g ="); for( l = oracle->jacoffsets[i]; l < oracle->jacoffsets[i+1]; ++l) printf(" %g", grad[oracle->jaccols[l]]); printf("\n"); )
+   if( usetpi )
+   {
+      retcode = evalJacobianParallel(scip, oracle, x, isnewx, convals, jacobi, njobs);
+   }
+   else
+   {
+      SCIP_CALL( SCIPallocCleanBufferArray(scip, &grad, oracle->nvars) );
 
-      if( !SCIPisFinite(nlval) || SCIPisInfinity(scip, ABS(nlval)) )
-      {
-         SCIPdebugMessage("gradient evaluation yield invalid function value %g\n", nlval);
-         retcode = SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
-         goto TERMINATE;
-      }
-      if( convals != NULL )
-         convals[i] = nlval;
+      retcode = SCIP_OKAY;
+      for( i = 0; i < oracle->nconss && retcode == SCIP_OKAY; ++i )
+         retcode = evalJacobianRow(scip, oracle, i, x, isnewx, convals, jacobi, grad);
 
-      /* add linear part to grad */
-      for( l = 0; l < cons->nlinidxs; ++l )
-      {
-         if( convals != NULL )
-            convals[i] += cons->lincoefs[l] * x[cons->linidxs[l]];
-         /* if grad[cons->linidxs[l]] is not finite, then adding a finite value doesn't change that, so don't check that here */
-         grad[cons->linidxs[l]] += cons->lincoefs[l];
-      }
+      SCIPfreeCleanBufferArray(scip, &grad);
 
-      /* store complete gradient (linear + nonlinear) in jacobi
-       * use the already evaluated sparsity pattern to pick only elements from grad that could have been set
-       */
-      assert(j == oracle->jacoffsets[i]);
-      for( ; j < oracle->jacoffsets[i+1]; ++j )
+      if( retcode == SCIP_OKAY && !oracle->jacparallel && njobs > 1 )
       {
-         if( !SCIPisFinite(grad[oracle->jaccols[j]]) )
-         {
-            SCIPdebugMessage("gradient evaluation yield invalid gradient value %g\n", grad[l]);
-            retcode = SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
-            goto TERMINATE;
-         }
-         jacobi[k++] = grad[oracle->jaccols[j]];
-         /* reset to 0 for next constraint */
-         grad[oracle->jaccols[j]] = 0.0;
+         SCIP_CALL( oracleCanEvalParallel(scip, oracle, &oracle->jacparallel) );
       }
-
-#ifndef NDEBUG
-      /* check that exprint really wrote only into expected elements of grad
-       * TODO remove after some testing for better performance of debug runs */
-      for( l = 0; l < oracle->nvars; ++l )
-         assert(grad[l] == 0.0);
-#endif
    }
 
-TERMINATE:
-   /* if there was an eval error, then we may have interrupted before cleaning up the grad buffer */
-   if( retcode == SCIP_INVALIDDATA )
-      BMSclearMemoryArray(grad, oracle->nvars);
-
-   SCIPfreeCleanBufferArray(scip, &grad);
-
+   SCIP_CALL( SCIPstopClock(scip, oracle->jacclock) );
    SCIP_CALL( SCIPstopClock(scip, oracle->evalclock) );
 
    return retcode;
@@ -2374,6 +2780,8 @@ SCIP_RETCODE SCIPnlpiOracleGetHessianLagSparsity(
  *  The values in the Hessian matrix are returned in the same order as specified by the offset and col arrays obtained by SCIPnlpiOracleGetHessianLagSparsity().
  *  The user must call SCIPnlpiOracleGetHessianLagSparsity() at least ones before using this function.
  *  Only elements of the lower left triangle and the diagonal are computed.
+ *  If parameter nlp/evalnthreads is larger than 1, the Hessians of the constraints are evaluated in parallel after the
+ *  Hessian of each constraint has been evaluated once sequentially.
  *
  * @return SCIP_INVALIDDATA, if the Hessian could not be evaluated (domain error, etc.)
  */
@@ -2389,6 +2797,9 @@ SCIP_RETCODE SCIPnlpiOracleEvalHessianLag(
    )
 {  /*lint --e{715}*/
    SCIP_RETCODE retcode = SCIP_OKAY;
+   SCIP_Bool usetpi;
+   SCIP_Bool warmup;
+   int njobs;
    int i;
 
    assert(oracle != NULL);
@@ -2402,22 +2813,66 @@ SCIP_RETCODE SCIPnlpiOracleEvalHessianLag(
    SCIPdebugMessage("%p eval hessian lag\n", (void*)oracle);
 
    SCIP_CALL( SCIPstartClock(scip, oracle->evalclock) );
+   SCIP_CALL( SCIPstartClock(scip, oracle->hesclock) );
 
    BMSclearMemoryArray(hessian, oracle->heslagoffsets[oracle->nvars]);
 
    if( objfactor != 0.0 && oracle->objective->expr != NULL )
    {
-      retcode = hessLagAddExpr(scip, oracle, objfactor, x, isnewx_obj, oracle->objective->expr, oracle->objective->exprintdata, oracle->heslagoffsets, oracle->heslagcols, hessian);
+      retcode = hessLagAddExpr(scip, oracle, oracle->objective, objfactor, x, isnewx_obj, hessian);
    }
 
-   for( i = 0; i < oracle->nconss && retcode == SCIP_OKAY; ++i )
+   /* evaluate the constraints in parallel if the Hessian of each of them has been evaluated sequentially once */
+   njobs = MIN(oracle->nthreads, oracle->nconss / ORACLE_JOBMINCONSS);
+   usetpi = FALSE;
+   if( retcode == SCIP_OKAY && oracle->hesparallel && njobs > 1 )
    {
-      assert( lambda != NULL ); /* for lint */
-      if( lambda[i] == 0.0 || oracle->conss[i]->expr == NULL )
-         continue;
-      retcode = hessLagAddExpr(scip, oracle, lambda[i], x, isnewx_cons, oracle->conss[i]->expr, oracle->conss[i]->exprintdata, oracle->heslagoffsets, oracle->heslagcols, hessian);
+      SCIP_CALL( oracleUseTPI(scip, oracle, &usetpi) );
+   }
+
+   if( usetpi )
+   {
+      retcode = evalHessianLagParallel(scip, oracle, x, isnewx_cons, lambda, hessian, njobs);
    }
+   else
+   {
+      warmup = !oracle->hesparallel && njobs > 1;
+
+      for( i = 0; i < oracle->nconss && retcode == SCIP_OKAY; ++i )
+      {
+         assert( lambda != NULL ); /* for lint */
+         if( lambda[i] == 0.0 || oracle->conss[i]->expr == NULL )
+            continue;
+         retcode = hessLagAddExpr(scip, oracle, oracle->conss[i], lambda[i], x, isnewx_cons, hessian);
+      }
+
+      /* to prepare the evaluation in parallel, evaluate also the Hessians of the constraints with zero multiplier once;
+       * they are added with weight zero and evaluation errors are ignored, but then the evaluation stays sequential
+       */
+      for( i = 0; i < oracle->nconss && retcode == SCIP_OKAY && warmup; ++i )
+      {
+         SCIP_RETCODE warmupretcode;
+
+         assert( lambda != NULL ); /* for lint */
+         if( lambda[i] != 0.0 || oracle->conss[i]->expr == NULL )
+            continue;
 
+         warmupretcode = hessLagAddExpr(scip, oracle, oracle->conss[i], 0.0, x, isnewx_cons, hessian);
+         if( warmupretcode == SCIP_INVALIDDATA )
+            warmup = FALSE;
+         else
+         {
+            SCIP_CALL( warmupretcode );
+         }
+      }
+
+      if( retcode == SCIP_OKAY && warmup )
+      {
+         SCIP_CALL( oracleCanEvalParallel(scip, oracle, &oracle->hesparallel) );
+      }
+   }
+
+   SCIP_CALL( SCIPstopClock(scip, oracle->hesclock) );
    SCIP_CALL( SCIPstopClock(scip, oracle->evalclock) );
 
    return retcode;
@@ -2432,6 +2887,8 @@ SCIP_RETCODE SCIPnlpiOracleResetEvalTime(
    assert(oracle != NULL);
 
    SCIP_CALL( SCIPresetClock(scip, oracle->evalclock) );
+   SCIP_CALL( SCIPresetClock(scip, oracle->jacclock) );
+   SCIP_CALL( SCIPresetClock(scip, oracle->hesclock) );
 
    return SCIP_OKAY;
 }
@@ -2450,6 +2907,34 @@ SCIP_Real SCIPnlpiOracleGetEvalTime(
    return SCIPgetClockTime(scip, oracle->evalclock);
 }
 
+/** gives time spend in evaluation of the Jacobian since last reset of clock
+ *
+ * Gives 0 if the eval clock is disabled.
+ */
+SCIP_Real SCIPnlpiOracleGetJacobianEvalTime(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle              /**< pointer to NLPIORACLE data structure */
+   )
+{
+   assert(oracle != NULL);
+
+   return SCIPgetClockTime(scip, oracle->jacclock);
+}
+
+/** gives time spend in evaluation of the Hessian of the Lagrangian since last reset of clock
+ *
+ * Gives 0 if the eval clock is disabled.
+ */
+SCIP_Real SCIPnlpiOracleGetHessianLagEvalTime(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle              /**< pointer to NLPIORACLE data structure */
+   )
+{
+   assert(oracle != NULL);
+
+   return SCIPgetClockTime(scip, oracle->hesclock);
+}
+
 /** prints the problem to a file. */
 SCIP_RETCODE SCIPnlpiOraclePrintProblem(
    SCIP*                 scip,               /**< SCIP data structure */
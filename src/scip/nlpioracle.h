@@ -356,6 +356,8 @@ SCIP_RETCODE SCIPnlpiOracleGetJacobianSparsity(
  *
  *  The values in the Jacobian matrix are returned in the same order as specified by the offset and col arrays obtained by SCIPnlpiOracleGetJacobianSparsity().
  *  The user need to call SCIPnlpiOracleGetJacobianSparsity() at least ones before using this function.
+ *  If parameter nlp/evalnthreads is larger than 1, the gradients of the constraints are evaluated in parallel after the
+ *  Jacobian has been evaluated once sequentially.
  *
  * @return SCIP_INVALIDDATA, if the Jacobian could not be evaluated (domain error, etc.)
  */
@@ -389,6 +391,8 @@ SCIP_RETCODE SCIPnlpiOracleGetHessianLagSparsity(
  *  The values in the Hessian matrix are returned in the same order as specified by the offset and col arrays obtained by SCIPnlpiOracleGetHessianLagSparsity().
  *  The user must call SCIPnlpiOracleGetHessianLagSparsity() at least ones before using this function.
  *  Only elements of the lower left triangle and the diagonal are computed.
+ *  If parameter nlp/evalnthreads is larger than 1, the Hessians of the constraints are evaluated in parallel after the
+ *  Hessian of each constraint has been evaluated once sequentially.
  *
  * @return SCIP_INVALIDDATA, if the Hessian could not be evaluated (domain error, etc.)
  */
@@ -421,6 +425,26 @@ SCIP_Real SCIPnlpiOracleGetEvalTime(
    SCIP_NLPIORACLE*      oracle              /**< pointer to NLPIORACLE data structure */
    );
 
+/** gives time spend in evaluation of the Jacobian since last reset of clock
+ *
+ * Gives 0 if the eval clock is disabled.
+ */
+SCIP_EXPORT
+SCIP_Real SCIPnlpiOracleGetJacobianEvalTime(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle              /**< pointer to NLPIORACLE data structure */
+   );
+
+/** gives time spend in evaluation of the Hessian of the Lagrangian since last reset of clock
+ *
+ * Gives 0 if the eval clock is disabled.
+ */
+SCIP_EXPORT
+SCIP_Real SCIPnlpiOracleGetHessianLagEvalTime(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLPIORACLE*      oracle              /**< pointer to NLPIORACLE data structure */
+   );
+
 /** prints the problem to a file. */
 SCIP_EXPORT
 SCIP_RETCODE SCIPnlpiOraclePrintProblem(
@@ -64,7 +64,10 @@
 #include "scip/scip_pricer.h"
 #include "scip/scip_prob.h"
 #include "scip/scip_probing.h"
+#include "scip/scip_solve.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
+#include "tpi/def_openmp.h"
 #include <string.h>
 
 #define PRESOL_NAME            "domcol"
@@ -78,6 +81,9 @@
 
 #define DEFAULT_PREDBNDSTR         FALSE     /**< should predictive bound strengthening be applied? */
 #define DEFAULT_CONTINUOUS_RED      TRUE     /**< should reductions for continuous variables be carried out? */
+#define DEFAULT_NTHREADS               1     /**< number of threads for searching parallel column classes (1: sequential) */
+
+#define JOB_MINCOLS                 1000     /**< minimal number of columns searched by one parallel job */
 
 
 
@@ -93,6 +99,7 @@ struct SCIP_PresolData
    int                   numcurrentpairs;    /**< current number of pair comparisons */
    SCIP_Bool             predbndstr;         /**< flag indicating if predictive bound strengthening should be applied */
    SCIP_Bool             continuousred;      /**< flag indicating if reductions for continuous variables should be performed */
+   int                   nthreads;           /**< number of threads for searching parallel column classes */
 };
 
 /** type of fixing direction */
@@ -104,6 +111,32 @@ enum Fixingdirection
 };
 typedef enum Fixingdirection FIXINGDIRECTION;
 
+/** groups of columns that are searched for dominance relations independently of each other */
+struct SearchGroups
+{
+   int*                  cols;               /**< column indices of all groups, stored consecutively */
+   int*                  starts;             /**< start position of each group in cols, plus the end of the last group */
+   SCIP_Bool*            onlybinvars;        /**< flag for each group indicating if it contains only binary variables */
+   int                   ngroups;            /**< number of groups */
+};
+typedef struct SearchGroups SEARCHGROUPS;
+
+/** data of a job searching a range of groups for dominance relations */
+struct SearchJob
+{
+   SCIP*                 scip;               /**< SCIP main data structure */
+   SCIP_MATRIX*          matrix;             /**< matrix containing the constraints */
+   SCIP_PRESOLDATA       presoldata;         /**< private copy of the presolver data for the pair comparison control */
+   SEARCHGROUPS*         groups;             /**< groups of columns */
+   int                   firstgroup;         /**< first group searched by the job */
+   int                   lastgroup;          /**< last group searched by the job, plus one */
+   FIXINGDIRECTION*      varstofix;          /**< array holding information for later upper/lower bound fixing */
+   int                   nfixings;           /**< found number of possible fixings */
+   SCIP_Longint          ndomrelations;      /**< found number of dominance relations */
+   int                   nchgbds;            /**< number of changed bounds */
+};
+typedef struct SearchJob SEARCHJOB;
+
 
 /*
  * Local methods
@@ -1968,6 +2001,191 @@ SCIP_RETCODE findDominancePairs(
 }
 
 
+/** searches the given columns for dominance relations, or only records them as a group if the groups of the first
+ *  stage are searched in parallel afterwards
+ */
+static
+SCIP_RETCODE searchDominancePairs(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_MATRIX*          matrix,             /**< matrix containing the constraints */
+   SCIP_PRESOLDATA*      presoldata,         /**< presolver data */
+   SEARCHGROUPS*         groups,             /**< groups to record the columns in, or NULL to search them directly */
+   int*                  searchcols,         /**< indexes of variables for pair comparisons */
+   int                   searchsize,         /**< number of variables for pair comparisons */
+   SCIP_Bool             onlybinvars,        /**< flag indicating searchcols contains only binary variable indexes */
+   FIXINGDIRECTION*      varstofix,          /**< array holding information for later upper/lower bound fixing */
+   int*                  nfixings,           /**< found number of possible fixings */
+   SCIP_Longint*         ndomrelations,      /**< found number of dominance relations */
+   int*                  nchgbds             /**< number of changed bounds */
+   )
+{
+   int start;
+
+   if( groups == NULL )
+   {
+      SCIP_CALL( findDominancePairs(scip, matrix, presoldata, searchcols, searchsize, onlybinvars,
+            varstofix, nfixings, ndomrelations, nchgbds) );
+
+      return SCIP_OKAY;
+   }
+
+   /* the groups are disjoint, so the columns of all groups fit into the arrays of size ncols */
+   start = groups->starts[groups->ngroups];
+   assert(start + searchsize <= SCIPmatrixGetNColumns(matrix));
+
+   BMScopyMemoryArray(&groups->cols[start], searchcols, searchsize);
+   groups->onlybinvars[groups->ngroups] = onlybinvars;
+   ++groups->ngroups;
+   groups->starts[groups->ngroups] = start + searchsize;
+
+   return SCIP_OKAY;
+}
+
+/** job function searching a range of groups for dominance relations
+ *
+ *  The job only reads the matrix and the variables; fixings are recorded in varstofix, which is not shared with other
+ *  jobs for the columns of its groups.
+ */
+static
+SCIP_RETCODE execSearchJob(
+   void*                 args                /**< the job data */
+   )
+{
+   SEARCHJOB* job;
+   int g;
+
+   job = (SEARCHJOB*) args;
+   assert(job != NULL);
+   assert(!job->presoldata.predbndstr);
+
+   job->presoldata.numcurrentpairs = job->presoldata.nummaxpairs;
+
+   for( g = job->firstgroup; g < job->lastgroup; ++g )
+   {
+      SCIP_CALL( findDominancePairs(job->scip, job->matrix, &job->presoldata, &job->groups->cols[job->groups->starts[g]],
+            job->groups->starts[g + 1] - job->groups->starts[g], job->groups->onlybinvars[g], job->varstofix,
+            &job->nfixings, &job->ndomrelations, &job->nchgbds) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns whether the groups of the first stage are searched in parallel through the task processing interface
+ *
+ *  The groups are searched sequentially if no thread pool is available, see SCIPacquireTPI().
+ */
+static
+SCIP_RETCODE domcolUseTPI(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_PRESOLDATA*      presoldata,         /**< presolver data */
+   SCIP_Bool*            usetpi              /**< pointer to store whether the groups are searched in parallel */
+   )
+{
+   assert(presoldata != NULL);
+   assert(usetpi != NULL);
+
+   *usetpi = FALSE;
+
+   /* predictive bound strengthening changes bounds while searching, which must not happen concurrently */
+   if( presoldata->predbndstr || presoldata->nthreads <= 1 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPacquireTPI(scip, usetpi) );
+
+   return SCIP_OKAY;
+}
+
+/** searches the recorded groups for dominance relations in parallel
+ *
+ *  The groups are split into jobs of consecutive groups with at least JOB_MINCOLS columns each. Every job uses its own
+ *  pair comparison control, so the result depends neither on the number of threads nor on the order in which the jobs
+ *  finish; the counters of the jobs are summed up in the order of the groups.
+ */
+static
+SCIP_RETCODE searchGroupsParallel(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_MATRIX*          matrix,             /**< matrix containing the constraints */
+   SCIP_PRESOLDATA*      presoldata,         /**< presolver data */
+   SEARCHGROUPS*         groups,             /**< groups of columns */
+   FIXINGDIRECTION*      varstofix,          /**< array holding information for later upper/lower bound fixing */
+   int*                  nfixings,           /**< found number of possible fixings */
+   SCIP_Longint*         ndomrelations,      /**< found number of dominance relations */
+   int*                  nchgbds             /**< number of changed bounds */
+   )
+{
+   SEARCHJOB* jobs;
+   SCIP_RETCODE retcode;
+   int njobs;
+   int jobid;
+   int g;
+   int j;
+
+   assert(groups != NULL);
+
+   if( groups->ngroups == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, groups->ngroups) );
+
+   njobs = 0;
+   g = 0;
+   while( g < groups->ngroups )
+   {
+      jobs[njobs].scip = scip;
+      jobs[njobs].matrix = matrix;
+      jobs[njobs].presoldata = *presoldata;
+      jobs[njobs].groups = groups;
+      jobs[njobs].firstgroup = g;
+      jobs[njobs].varstofix = varstofix;
+      jobs[njobs].nfixings = 0;
+      jobs[njobs].ndomrelations = 0;
+      jobs[njobs].nchgbds = 0;
+
+      /* add groups until the job searches enough columns */
+      jobs[njobs].lastgroup = g + 1;
+      while( jobs[njobs].lastgroup < groups->ngroups && groups->starts[jobs[njobs].lastgroup] - groups->starts[g] < JOB_MINCOLS )
+         ++jobs[njobs].lastgroup;
+
+      g = jobs[njobs].lastgroup;
+      ++njobs;
+   }
+
+   jobid = SCIPtpiGetNewJobID();
+
+   TPI_PARA
+   {
+      TPI_SINGLE
+      {
+         for( j = 0; j < njobs; ++j )
+         {
+            /* cppcheck-suppress unassignedVariable */
+            SCIP_JOB* job;
+            SCIP_SUBMITSTATUS status;
+
+            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execSearchJob, (void*) &jobs[j]) );
+            SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+            assert(status == SCIP_SUBMIT_SUCCESS);
+         }
+      }
+   }
+
+   /* the smallest return code of all jobs is returned */
+   retcode = SCIPtpiProcessAndCollectJobs(jobid);
+
+   for( j = 0; j < njobs; ++j )
+   {
+      *nfixings += jobs[j].nfixings;
+      *ndomrelations += jobs[j].ndomrelations;
+      *nchgbds += jobs[j].nchgbds;
+   }
+
+   SCIPfreeBufferArray(scip, &jobs);
+
+   return retcode;
+}
+
+
 /*
  * Callback methods of presolver
  */
@@ -2039,6 +2257,8 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
    int pclassstart;
    int pc;
    SCIP_Bool* varineq;
+   SEARCHGROUPS groups;
+   SCIP_Bool usetpi;
 
    assert(result != NULL);
    *result = SCIP_DIDNOTRUN;
@@ -2121,6 +2341,19 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
       SCIP_CALL( detectParallelCols(scip, matrix, pclass, varineq) );
       SCIPsortIntInt(pclass, colidx, ncols);
 
+      /* the parallel column classes are disjoint, so they can be searched independently of each other: if the search is
+       * done in parallel, the groups of columns are only recorded in the loop below and searched afterwards
+       */
+      SCIP_CALL( domcolUseTPI(scip, presoldata, &usetpi) );
+      if( usetpi )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &groups.cols, ncols) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &groups.starts, ncols + 1) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &groups.onlybinvars, ncols) );
+         groups.starts[0] = 0;
+         groups.ngroups = 0;
+      }
+
       pc = 0;
       while( pc < ncols )
       {
@@ -2165,7 +2398,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* continuous variables */
          if( nconfill > 1 && presoldata->continuousred )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, consearchcols, nconfill, FALSE,
+            SCIP_CALL( searchDominancePairs(scip, matrix, presoldata, usetpi ? &groups : NULL, consearchcols, nconfill, FALSE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nconfill; ++v )
@@ -2182,7 +2415,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* integer and impl-integer variables */
          if( nintfill > 1 )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, intsearchcols, nintfill, FALSE,
+            SCIP_CALL( searchDominancePairs(scip, matrix, presoldata, usetpi ? &groups : NULL, intsearchcols, nintfill, FALSE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nintfill; ++v )
@@ -2199,7 +2432,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* binary variables */
          if( nbinfill > 1 )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, binsearchcols, nbinfill, TRUE,
+            SCIP_CALL( searchDominancePairs(scip, matrix, presoldata, usetpi ? &groups : NULL, binsearchcols, nbinfill, TRUE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nbinfill; ++v )
@@ -2216,6 +2449,15 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( varcount >= ncols )
             break;
       }
+
+      if( usetpi )
+      {
+         SCIP_CALL( searchGroupsParallel(scip, matrix, presoldata, &groups, varstofix, &nfixings, &ndomrelations, nchgbds) );
+
+         SCIPfreeBufferArray(scip, &groups.onlybinvars);
+         SCIPfreeBufferArray(scip, &groups.starts);
+         SCIPfreeBufferArray(scip, &groups.cols);
+      }
    }
 
    /* 2.stage: search dominance relations for the remaining columns
@@ -2461,5 +2703,10 @@ SCIP_RETCODE SCIPincludePresolDomcol(
          "should reductions for continuous variables be performed?",
          &presoldata->continuousred, FALSE, DEFAULT_CONTINUOUS_RED, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "presolving/domcol/nthreads",
+         "number of threads for searching the parallel column classes of equations and ranged rows (1: sequential)",
+         &presoldata->nthreads, FALSE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
    return SCIP_OKAY;
 }
@@ -152,6 +152,7 @@
 
 /* default parameter values for symmetry computation */
 #define DEFAULT_MAXGENERATORS        1500    /**< limit on the number of generators that should be produced within symmetry detection (0 = no limit) */
+#define DEFAULT_MAXGENTIME          1e+20    /**< time limit in seconds for computing generators; the generators found until then are used */
 #define DEFAULT_CHECKSYMMETRIES     FALSE    /**< Should all symmetries be checked after computation? */
 #define DEFAULT_DISPLAYNORBITVARS   FALSE    /**< Should the number of variables affected by some symmetry be displayed? */
 #define DEFAULT_USECOLUMNSPARSITY   FALSE    /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
@@ -255,6 +256,7 @@ struct SCIP_PropData
 
    /* for symmetry computation */
    int                   maxgenerators;      /**< limit on the number of generators that should be produced within symmetry detection (0 = no limit) */
+   SCIP_Real             maxgentime;         /**< time limit in seconds for computing generators; the generators found until then are used */
    SCIP_Bool             checksymmetries;    /**< Should all symmetries be checked after computation? */
    SCIP_Bool             displaynorbitvars;  /**< Whether the number of variables in non-trivial orbits shall be computed */
    SCIP_Bool             compresssymmetries; /**< Should non-affected variables be removed from permutation to save memory? */
@@ -1682,6 +1684,7 @@ SCIP_RETCODE computeSymmetryGroup(
    SCIP_Bool             compresssymmetries, /**< Should non-affected variables be removed from permutation to save memory? */
    SCIP_Real             compressthreshold,  /**< if percentage of moved vars is at most threshold, compression is done */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             maxgentime,         /**< time limit in seconds for computing generators */
    SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
    SCIP_Bool             checksymmetries,    /**< Should all symmetries be checked after computation? */
    SCIP_VAR***           permvars,           /**< pointer to permvars array */
@@ -1703,6 +1706,7 @@ SCIP_RETCODE computeSymmetryGroup(
 {
    SCIP_CONS** conss;
    SYM_GRAPH* graph;
+   SCIP_Real timelimit;
    int nconsnodes = 0;
    int nvalnodes = 0;
    int nopnodes = 0;
@@ -1794,12 +1798,25 @@ SCIP_RETCODE computeSymmetryGroup(
       return SCIP_OKAY;
    }
 
+   /* the symmetry code must not exceed the remaining time of the solving process */
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
+   if ( ! SCIPisInfinity(scip, timelimit) )
+      timelimit = MAX(timelimit - SCIPgetSolvingTime(scip), 0.0);
+   timelimit = MIN(timelimit, maxgentime);
+
    /*
     * actually compute symmetries
     */
-   SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, graph, nperms, nmaxperms,
+   SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, timelimit, graph, nperms, nmaxperms,
          perms, log10groupsize, symcodetime) );
 
+   if ( *symcodetime >= timelimit )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+         "   (%.1fs) symmetry computation reached time limit, using the %d generators found so far\n",
+         SCIPgetSolvingTime(scip), *nperms);
+   }
+
    if ( checksymmetries && *nperms > 0 )
    {
       SCIP_CALL( checkSymmetriesAreSymmetries(scip, symtype, *perms, *nperms, SCIPgetNVars(scip), fixedtype) );
@@ -2237,7 +2254,7 @@ SCIP_RETCODE determineSymmetry(
    /* actually compute (global) symmetry */
    SCIP_CALL( computeSymmetryGroup(scip, (SYM_SYMTYPE) propdata->symtype,
          propdata->compresssymmetries, propdata->compressthreshold,
-         maxgenerators, symspecrequirefixed, propdata->checksymmetries, &propdata->permvars,
+         maxgenerators, propdata->maxgentime, symspecrequirefixed, propdata->checksymmetries, &propdata->permvars,
          &propdata->npermvars, &propdata->nbinpermvars, &propdata->permvardomaincenter,
          &propdata->perms, &propdata->nperms, &propdata->nmaxperms,
          &propdata->nmovedvars, &propdata->binvaraffected, &propdata->compressed,
@@ -6825,6 +6842,11 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "limit on the number of generators that should be produced within symmetry detection (0 = no limit)",
          &propdata->maxgenerators, TRUE, DEFAULT_MAXGENERATORS, 0, INT_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddRealParam(scip,
+         "propagating/" PROP_NAME "/maxgentime",
+         "time limit in seconds for computing generators of the symmetry group; the generators found until then are used",
+         &propdata->maxgentime, TRUE, DEFAULT_MAXGENTIME, 0.0, SCIP_REAL_MAX, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/checksymmetries",
          "Should all symmetries be checked after computation?",
@@ -526,6 +526,23 @@ void SCIPconshdlrSetPropTiming(
    SCIP_PROPTIMING       proptiming          /**< timing mask to be set */
    );
 
+/** returns whether the propagation method of the constraint handler only processes constraints marked to be propagated */
+SCIP_EXPORT
+SCIP_Bool SCIPconshdlrHasPropWorklist(
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   );
+
+/** sets whether the propagation method of the constraint handler can only process constraints marked to be propagated;
+ *  if propagating/worklist is set, the propagation method is then not called if no constraint of the handler is marked,
+ *  and the marked constraints can be sorted by their number of markings before the call, see propagating/sortworklist
+ *  and SCIPisPropWorklistUsed()
+ */
+SCIP_EXPORT
+void SCIPconshdlrSetPropWorklist(
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_Bool             propworklist        /**< does the propagation method only process marked constraints? */
+   );
+
 
 /** returns the timing mask of the presolving method of the constraint handler */
 SCIP_EXPORT
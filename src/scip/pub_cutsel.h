@@ -141,6 +141,32 @@ SCIP_Longint SCIPcutselGetNLocalCutsFiltered(
 SCIP_EXPORT
 SCIP_DECL_SORTPTRCOMP(SCIPcutselComp);
 
+/** records that the cuts at the given positions of the cuts array were swapped */
+SCIP_EXPORT
+void SCIPcutselindexSwap(
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of cuts */
+   int                   pos1,               /**< first position */
+   int                   pos2                /**< second position */
+   );
+
+/** gets the positions of the cuts that share at least one column with the given cut
+ *
+ *  Only positions in the range [firstpos, firstpos + npos) are considered. The positions are returned relative to
+ *  firstpos in decreasing order. All other cuts of the range have a scalar product of zero with the given cut, so that
+ *  their parallelism to the cut is zero.
+ *
+ *  @note The returned array is owned by the index and is overwritten by the next call.
+ */
+SCIP_EXPORT
+void SCIPcutselindexGetCands(
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of cuts */
+   SCIP_ROW*             cut,                /**< cut to find the candidates for */
+   int                   firstpos,           /**< first position of the range */
+   int                   npos,               /**< number of positions of the range */
+   int**                 cands,              /**< pointer to store the positions of the candidates */
+   int*                  ncands              /**< pointer to store the number of candidates */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
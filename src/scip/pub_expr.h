@@ -131,6 +131,13 @@ void SCIPexprhdlrSetIntEval(
    SCIP_DECL_EXPRINTEVAL((*inteval))         /**< interval evaluation callback (can be NULL) */
 );
 
+/** set the batch evaluation callback of an expression handler */
+SCIP_EXPORT
+void SCIPexprhdlrSetEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
+   SCIP_DECL_EXPREVALBATCH((*evalbatch))     /**< batch evaluation callback (can be NULL) */
+);
+
 /** set the simplify callback of an expression handler */
 SCIP_EXPORT
 void SCIPexprhdlrSetSimplify(
@@ -208,6 +215,12 @@ SCIP_Bool SCIPexprhdlrHasIntEval(
    SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
    );
 
+/** returns whether expression handler implements the batch evaluation callback */
+SCIP_EXPORT
+SCIP_Bool SCIPexprhdlrHasEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
+   );
+
 /** returns whether expression handler implements the estimator callback */
 SCIP_EXPORT
 SCIP_Bool SCIPexprhdlrHasEstimate(
@@ -370,6 +383,7 @@ SCIP_Longint SCIPexprhdlrGetNSimplifications(
 #define SCIPexprhdlrSetCompare(exprhdlr, compare_)           (exprhdlr)->compare = compare_
 #define SCIPexprhdlrSetDiff(exprhdlr, bwdiff_, fwdiff_, bwfwdiff_) do { (exprhdlr)->bwdiff = bwdiff_; (exprhdlr)->fwdiff = fwdiff_; (exprhdlr)->bwfwdiff = bwfwdiff_; } while (FALSE)
 #define SCIPexprhdlrSetIntEval(exprhdlr, inteval_)           (exprhdlr)->inteval = inteval_
+#define SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatch_)       (exprhdlr)->evalbatch = evalbatch_
 #define SCIPexprhdlrSetSimplify(exprhdlr, simplify_)         (exprhdlr)->simplify = simplify_
 #define SCIPexprhdlrSetReverseProp(exprhdlr, reverseprop_)   (exprhdlr)->reverseprop = reverseprop_
 #define SCIPexprhdlrSetEstimate(exprhdlr, initestimates_, estimate_) do { (exprhdlr)->initestimates = initestimates_; (exprhdlr)->estimate = estimate_; } while (FALSE)
@@ -382,6 +396,7 @@ SCIP_Longint SCIPexprhdlrGetNSimplifications(
 #define SCIPexprhdlrHasBwdiff(exprhdlr)            ((exprhdlr)->bwdiff != NULL)
 #define SCIPexprhdlrHasFwdiff(exprhdlr)            ((exprhdlr)->fwdiff != NULL)
 #define SCIPexprhdlrHasIntEval(exprhdlr)           ((exprhdlr)->inteval != NULL)
+#define SCIPexprhdlrHasEvalBatch(exprhdlr)         ((exprhdlr)->evalbatch != NULL)
 #define SCIPexprhdlrHasEstimate(exprhdlr)          ((exprhdlr)->estimate != NULL)
 #define SCIPexprhdlrHasInitEstimates(exprhdlr)     ((exprhdlr)->initestimates != NULL)
 #define SCIPexprhdlrHasSimplify(exprhdlr)          ((exprhdlr)->simplify != NULL)
@@ -1028,6 +1043,44 @@ SCIP_Bool SCIPexpriterIsEnd(
 
 /** @} */
 
+/**@name Expression Programs
+ *
+ * An expression program lists all subexpressions of an expression in topological order,
+ * that is, children come before their parents and the root expression is last.
+ *
+ * @{
+ */
+
+/** gives the number of subexpressions in an expression program */
+SCIP_EXPORT
+int SCIPexprprogGetNExprs(
+   SCIP_EXPRPROG*        prog                /**< expression program */
+   );
+
+/** gives the subexpressions of an expression program in topological order, with the root expression last */
+SCIP_EXPORT
+SCIP_EXPR** SCIPexprprogGetExprs(
+   SCIP_EXPRPROG*        prog                /**< expression program */
+   );
+
+/** gives the positions in the program of the children of the subexpression at a given position
+ *
+ * The length of the returned array is the number of children of the subexpression.
+ */
+SCIP_EXPORT
+int* SCIPexprprogGetChildPos(
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   int                   pos                 /**< position of subexpression in program */
+   );
+
+#ifdef NDEBUG
+#define SCIPexprprogGetNExprs(prog)                            (prog)->nexprs
+#define SCIPexprprogGetExprs(prog)                             (prog)->exprs
+#define SCIPexprprogGetChildPos(prog, pos)                     (&(prog)->childpos[(prog)->childbegin[pos]])
+#endif
+
+/** @} */
+
 /**@name Function Curvature */
 /**@{ */
 
@@ -182,6 +182,30 @@ SCIP_Real SCIPheurGetTime(
    SCIP_HEUR*            heur                /**< primal heuristic */
    );
 
+/** gets the number of calls that reused the cached sub-SCIP of this heuristic */
+SCIP_EXPORT
+SCIP_Longint SCIPheurGetNSubscipHits(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   );
+
+/** gets the number of calls that had to copy a new sub-SCIP for the sub-SCIP cache of this heuristic */
+SCIP_EXPORT
+SCIP_Longint SCIPheurGetNSubscipMisses(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   );
+
+/** gets time in seconds used for copying the cached sub-SCIP of this heuristic */
+SCIP_EXPORT
+SCIP_Real SCIPheurGetSubscipCopyTime(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   );
+
+/** gets time in seconds used for resetting the cached sub-SCIP of this heuristic for reuse */
+SCIP_EXPORT
+SCIP_Real SCIPheurGetSubscipResetTime(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   );
+
 /** returns array of divesets of this primal heuristic, or NULL if it has no divesets */
 SCIP_EXPORT
 SCIP_DIVESET** SCIPheurGetDivesets(
@@ -114,6 +114,24 @@ SCIP_Real SCIPnlpiGetEvalTime(
    SCIP_NLPI*            nlpi                /**< NLP interface structure */
    );
 
+/** gives total time spend in evaluation of Jacobians during NLP solves
+ *
+ * If parameter `timing/nlpieval` is off (the default), depending on the NLP solver, this may just return 0.
+ */
+SCIP_EXPORT
+SCIP_Real SCIPnlpiGetJacobianEvalTime(
+   SCIP_NLPI*            nlpi                /**< NLP interface structure */
+   );
+
+/** gives total time spend in evaluation of Hessians of the Lagrangian during NLP solves
+ *
+ * If parameter `timing/nlpieval` is off (the default), depending on the NLP solver, this may just return 0.
+ */
+SCIP_EXPORT
+SCIP_Real SCIPnlpiGetHessianEvalTime(
+   SCIP_NLPI*            nlpi                /**< NLP interface structure */
+   );
+
 /** gives total number of iterations spend by NLP solver so far */
 SCIP_EXPORT
 SCIP_Longint SCIPnlpiGetNIterations(
@@ -155,6 +173,8 @@ void SCIPnlpiMergeStatistics(
 #define SCIPnlpiGetNSolves(nlpi)               (nlpi)->nsolves
 #define SCIPnlpiGetSolveTime(nlpi)             (nlpi)->solvetime
 #define SCIPnlpiGetEvalTime(nlpi)              (nlpi)->evaltime
+#define SCIPnlpiGetJacobianEvalTime(nlpi)      (nlpi)->jacevaltime
+#define SCIPnlpiGetHessianEvalTime(nlpi)       (nlpi)->hesevaltime
 #define SCIPnlpiGetNIterations(nlpi)           (nlpi)->niter
 #define SCIPnlpiGetNTermStat(nlpi, termstatus) (nlpi)->ntermstat[termstatus]
 #define SCIPnlpiGetNSolStat(nlpi, solstatus)   (nlpi)->nsolstat[solstatus]
@@ -89,6 +89,22 @@ SCIP_Bool SCIPreaderCanWrite(
    SCIP_READER*          reader              /**< reader */
    );
 
+/** adds the given number of bytes to the number of bytes read by the reader
+ *
+ *  Readers that call this method in their read callback get their throughput listed in the timing statistics.
+ */
+SCIP_EXPORT
+void SCIPreaderAddNReadBytes(
+   SCIP_READER*          reader,             /**< reader */
+   SCIP_Longint          nbytes              /**< number of bytes read from a file */
+   );
+
+/** gets the number of bytes read by the reader, or 0 if the reader does not report them */
+SCIP_EXPORT
+SCIP_Longint SCIPreaderGetNReadBytes(
+   SCIP_READER*          reader              /**< reader */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -603,6 +603,28 @@ SCIP_Bool SCIPreaderCanWrite(
    return (reader->readerwrite != NULL);
 }
 
+/** adds the given number of bytes to the number of bytes read by the reader */
+void SCIPreaderAddNReadBytes(
+   SCIP_READER*          reader,             /**< reader */
+   SCIP_Longint          nbytes              /**< number of bytes read from a file */
+   )
+{
+   assert(reader != NULL);
+   assert(nbytes >= 0);
+
+   reader->nreadbytes += nbytes;
+}
+
+/** gets the number of bytes read by the reader, or 0 if the reader does not report them */
+SCIP_Longint SCIPreaderGetNReadBytes(
+   SCIP_READER*          reader              /**< reader */
+   )
+{
+   assert(reader != NULL);
+
+   return reader->nreadbytes;
+}
+
 /** gets time in seconds used in this reader for reading */
 SCIP_Real SCIPreaderGetReadingTime(
    SCIP_READER*          reader              /**< reader */
@@ -624,7 +646,7 @@ void SCIPreaderEnableOrDisableClocks(
    SCIPclockEnableOrDisable(reader->readingtime, enable);
 }
 
-/** resets reading time of reader */
+/** resets reading time and number of read bytes of reader */
 SCIP_RETCODE SCIPreaderResetReadingTime(
    SCIP_READER*          reader              /**< reader */
    )
@@ -633,6 +655,7 @@ SCIP_RETCODE SCIPreaderResetReadingTime(
 
    /* reset reading time/clock */
    SCIPclockReset(reader->readingtime);
+   reader->nreadbytes = 0;
 
    return SCIP_OKAY;
 }
@@ -104,7 +104,7 @@ void SCIPreaderEnableOrDisableClocks(
    SCIP_Bool             enable              /**< should the clocks be enabled? */
    );
 
-/** resets reading time of reader */
+/** resets reading time and number of read bytes of reader */
 SCIP_RETCODE SCIPreaderResetReadingTime(
    SCIP_READER*          reader              /**< reader */
    );
@@ -2555,6 +2555,7 @@ SCIP_RETCODE readIndicators(
 static
 SCIP_RETCODE readMps(
    SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_READER*          reader,             /**< the file reader itself */
    const char*           filename,           /**< name of the input file */
    const char***         varnames,           /**< storage for the variable names, or NULL */
    const char***         consnames,          /**< storage for the constraint names, or NULL */
@@ -2643,6 +2644,11 @@ SCIP_RETCODE readMps(
    if( mpsinputSection(mpsi) != MPS_ENDATA )
       mpsinputSyntaxerror(mpsi);
 
+   /* count the bytes for the throughput in the timing statistics; for compressed files, the position refers to the
+    * uncompressed data
+    */
+   SCIPreaderAddNReadBytes(reader, (SCIP_Longint) SCIPftell(fp));
+
    SCIPfclose(fp);
 
    error = mpsinputHasError(mpsi);
@@ -3830,7 +3836,7 @@ SCIP_RETCODE SCIPreadMps(
    assert(scip != NULL);
    assert(result != NULL);
 
-   retcode = readMps(scip, filename, varnames, consnames, varnamessize, consnamessize, nvarnames, nconsnames);
+   retcode = readMps(scip, reader, filename, varnames, consnames, varnamessize, consnamessize, nvarnames, nconsnames);
 
    if( retcode == SCIP_PLUGINNOTFOUND )
       retcode = SCIP_READERROR;
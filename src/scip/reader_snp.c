@@ -0,0 +1,666 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_snp.c
+ * @ingroup DEFPLUGINS_READER
+ * @brief  SNP file reader and writer for binary snapshots of linear problems
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/cons_linear.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_linear.h"
+#include "scip/pub_reader.h"
+#include "scip/pub_var.h"
+#include "scip/reader_snp.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_reader.h"
+#include "scip/scip_var.h"
+#include <stdio.h>
+#include <string.h>
+
+#define READER_NAME             "snpreader"
+#define READER_DESC             "file reader and writer for binary snapshots of linear problems"
+#define READER_EXTENSION        "snp"
+
+#define SNP_MAGIC               "SCIPSNP"    /**< magic string at the beginning of each file (including the zero) */
+#define SNP_MAGICLEN            8            /**< length of the magic string including the terminating zero */
+#define SNP_VERSION             1            /**< version of the format written by this reader */
+#define SNP_BYTEORDER           0x01020304   /**< marker to detect files written with a different byte order */
+
+
+/*
+ * Local methods for reading
+ */
+
+/** reads the given number of items from the file and marks an error if the file ends prematurely */
+static
+void readItems(
+   SCIP_FILE*            fp,                 /**< file to read from */
+   void*                 ptr,                /**< buffer to store the items */
+   size_t                size,               /**< size of one item */
+   size_t                nitems,             /**< number of items */
+   SCIP_Bool*            error               /**< pointer to store whether an error occurred */
+   )
+{
+   assert(fp != NULL);
+   assert(error != NULL);
+
+   if( *error || nitems == 0 )
+      return;
+
+   /* read bytes, since SCIPfread() returns the number of bytes read instead of items if zlib is used */
+   if( SCIPfread(ptr, 1, size * nitems, fp) != size * nitems )
+      *error = TRUE;
+}
+
+/** reads a name into the given buffer, which is reallocated if necessary */
+static
+SCIP_RETCODE readName(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_FILE*            fp,                 /**< file to read from */
+   char**                name,               /**< pointer to the buffer for the name */
+   int*                  namesize,           /**< pointer to the size of the buffer */
+   SCIP_Bool*            error               /**< pointer to store whether an error occurred */
+   )
+{
+   int len = 0;
+
+   readItems(fp, &len, sizeof(int), 1, error);
+
+   if( *error || len < 0 )
+   {
+      *error = TRUE;
+      return SCIP_OKAY;
+   }
+
+   if( len >= *namesize )
+   {
+      int newsize = SCIPcalcMemGrowSize(scip, len + 1);
+
+      SCIP_CALL( SCIPreallocBufferArray(scip, name, newsize) );
+      *namesize = newsize;
+   }
+
+   readItems(fp, *name, sizeof(char), (size_t) len, error);
+   (*name)[len] = '\0';
+
+   return SCIP_OKAY;
+}
+
+/** converts a value read from the file into a SCIP value */
+static
+SCIP_Real readValue(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             val                 /**< value as stored in the file */
+   )
+{
+   if( val >= SCIP_REAL_MAX )
+      return SCIPinfinity(scip);
+   if( val <= -SCIP_REAL_MAX )
+      return -SCIPinfinity(scip);
+
+   return val;
+}
+
+/** reads a problem in SNP format */
+static
+SCIP_RETCODE readSnp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_FILE*            fp,                 /**< file to read from */
+   const char*           filename            /**< name of the input file */
+   )
+{
+   char magic[SNP_MAGICLEN];
+   SCIP_VAR** vars = NULL;
+   SCIP_VAR** consvars = NULL;
+   SCIP_Real* consvals = NULL;
+   int* consinds = NULL;
+   char* name = NULL;
+   SCIP_Real objoffset = 0.0;
+   SCIP_Bool error = FALSE;
+   int header[5];
+   int namesize = SCIP_MAXSTRLEN;
+   int consvarssize = 0;
+   int nvars;
+   int nconss;
+   int i;
+   int j;
+
+   readItems(fp, magic, sizeof(char), (size_t) SNP_MAGICLEN, &error);
+   if( error || memcmp(magic, SNP_MAGIC, (size_t) SNP_MAGICLEN) != 0 )
+   {
+      SCIPerrorMessage("file <%s> is not in SNP format\n", filename);
+      return SCIP_READERROR;
+   }
+
+   /* version, byte order, objective sense, number of variables and constraints */
+   readItems(fp, header, sizeof(int), 5, &error);
+   if( error )
+   {
+      SCIPerrorMessage("unexpected end of file <%s>\n", filename);
+      return SCIP_READERROR;
+   }
+   if( header[1] != SNP_BYTEORDER )
+   {
+      SCIPerrorMessage("file <%s> was written on a machine with a different byte order\n", filename);
+      return SCIP_READERROR;
+   }
+   if( header[0] != SNP_VERSION )
+   {
+      SCIPerrorMessage("file <%s> has SNP format version %d, but only version %d is supported\n", filename,
+         header[0], SNP_VERSION);
+      return SCIP_READERROR;
+   }
+   nvars = header[3];
+   nconss = header[4];
+   if( (header[2] != (int) SCIP_OBJSENSE_MINIMIZE && header[2] != (int) SCIP_OBJSENSE_MAXIMIZE) || nvars < 0 || nconss < 0 )
+   {
+      SCIPerrorMessage("invalid header in file <%s>\n", filename);
+      return SCIP_READERROR;
+   }
+
+   readItems(fp, &objoffset, sizeof(SCIP_Real), 1, &error);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &name, namesize) );
+   SCIP_CALL( readName(scip, fp, &name, &namesize, &error) );
+   if( error )
+      goto TERMINATE;
+
+   SCIP_CALL( SCIPcreateProb(scip, name, NULL, NULL, NULL, NULL, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPsetObjsense(scip, (SCIP_OBJSENSE) header[2]) );
+   if( objoffset != 0.0 ) /*lint !e777*/
+   {
+      SCIP_CALL( SCIPaddOrigObjoffset(scip, objoffset) );
+   }
+
+   /* read variables */
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, nvars) );
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_Real bounds[3];
+      int vartype = 0;
+
+      SCIP_CALL( readName(scip, fp, &name, &namesize, &error) );
+      readItems(fp, &vartype, sizeof(int), 1, &error);
+      readItems(fp, bounds, sizeof(SCIP_Real), 3, &error);
+
+      if( error || vartype < (int) SCIP_VARTYPE_BINARY || vartype > (int) SCIP_VARTYPE_CONTINUOUS )
+      {
+         error = TRUE;
+         nvars = i;
+         goto TERMINATE;
+      }
+
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, readValue(scip, bounds[0]), readValue(scip, bounds[1]),
+            bounds[2], (SCIP_VARTYPE) vartype) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   /* read constraints */
+   for( i = 0; i < nconss && !error; ++i )
+   {
+      SCIP_CONS* cons;
+      SCIP_Real sides[2];
+      int nconsvars = 0;
+
+      SCIP_CALL( readName(scip, fp, &name, &namesize, &error) );
+      readItems(fp, sides, sizeof(SCIP_Real), 2, &error);
+      readItems(fp, &nconsvars, sizeof(int), 1, &error);
+
+      if( error || nconsvars < 0 || nconsvars > nvars )
+      {
+         error = TRUE;
+         break;
+      }
+
+      if( nconsvars > consvarssize )
+      {
+         int newsize = SCIPcalcMemGrowSize(scip, nconsvars);
+
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consinds, newsize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvals, newsize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvars, newsize) );
+         consvarssize = newsize;
+      }
+
+      /* the indices and coefficients of a constraint are stored contiguously and read as a whole */
+      readItems(fp, consinds, sizeof(int), (size_t) nconsvars, &error);
+      readItems(fp, consvals, sizeof(SCIP_Real), (size_t) nconsvars, &error);
+      if( error )
+         break;
+
+      for( j = 0; j < nconsvars; ++j )
+      {
+         if( consinds[j] < 0 || consinds[j] >= nvars )
+         {
+            error = TRUE;
+            break;
+         }
+         consvars[j] = vars[consinds[j]];
+      }
+      if( error )
+         break;
+
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, nconsvars, consvars, consvals,
+            readValue(scip, sides[0]), readValue(scip, sides[1])) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+ TERMINATE:
+   if( error )
+      SCIPerrorMessage("unexpected end of file or invalid data in file <%s>\n", filename);
+
+   if( vars != NULL )
+   {
+      for( i = 0; i < nvars; ++i )
+      {
+         SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+      }
+   }
+
+   /* free buffers in reverse order of allocation */
+   if( consvars != NULL )
+   {
+      SCIPfreeBufferArray(scip, &consvars);
+      SCIPfreeBufferArray(scip, &consvals);
+      SCIPfreeBufferArray(scip, &consinds);
+   }
+   SCIPfreeBufferArrayNull(scip, &vars);
+   SCIPfreeBufferArray(scip, &name);
+
+   return error ? SCIP_READERROR : SCIP_OKAY;
+}
+
+
+/*
+ * Local methods for writing
+ */
+
+/** writes the given items to the file */
+static
+SCIP_RETCODE writeItems(
+   FILE*                 file,               /**< output file */
+   const void*           ptr,                /**< items to write */
+   size_t                size,               /**< size of one item */
+   size_t                nitems              /**< number of items */
+   )
+{
+   assert(file != NULL);
+
+   if( nitems > 0 && fwrite(ptr, size, nitems, file) != nitems )
+   {
+      SCIPerrorMessage("error while writing SNP file\n");
+      return SCIP_WRITEERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** writes a name, preceded by its length */
+static
+SCIP_RETCODE writeName(
+   FILE*                 file,               /**< output file */
+   const char*           name                /**< name to write */
+   )
+{
+   int len;
+
+   len = (int) strlen(name);
+
+   SCIP_CALL( writeItems(file, &len, sizeof(int), 1) );
+   SCIP_CALL( writeItems(file, name, sizeof(char), (size_t) len) );
+
+   return SCIP_OKAY;
+}
+
+/** converts a SCIP value into the value stored in the file, which does not depend on the infinity of SCIP */
+static
+SCIP_Real writeValue(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             val                 /**< value */
+   )
+{
+   if( SCIPisInfinity(scip, val) )
+      return SCIP_REAL_MAX;
+   if( SCIPisInfinity(scip, -val) )
+      return -SCIP_REAL_MAX;
+
+   return val;
+}
+
+/** transforms given variables, scalars, and constant to the corresponding active variables, scalars, and constant */
+static
+SCIP_RETCODE getActiveVariables(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR***           vars,               /**< pointer to vars array to get active variables for */
+   SCIP_Real**           scalars,            /**< pointer to scalars a_1, ..., a_n in linear sum a_1*x_1 + ... + a_n*x_n + c */
+   int*                  nvars,              /**< pointer to number of variables and values in vars and vals array */
+   int*                  varssize,           /**< pointer to the size of the vars and vals array */
+   SCIP_Real*            constant,           /**< pointer to constant c in linear sum a_1*x_1 + ... + a_n*x_n + c  */
+   SCIP_Bool             transformed         /**< transformed constraint? */
+   )
+{
+   int requiredsize;
+   int v;
+
+   assert(scip != NULL);
+   assert(vars != NULL);
+   assert(scalars != NULL);
+   assert(nvars != NULL);
+   assert(constant != NULL);
+
+   if( transformed )
+   {
+      SCIP_CALL( SCIPgetProbvarLinearSum(scip, *vars, *scalars, nvars, *varssize, constant, &requiredsize, TRUE) );
+
+      if( requiredsize > *varssize )
+      {
+         *varssize = SCIPcalcMemGrowSize(scip, requiredsize);
+         SCIP_CALL( SCIPreallocBufferArray(scip, vars, *varssize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, scalars, *varssize) );
+
+         SCIP_CALL( SCIPgetProbvarLinearSum(scip, *vars, *scalars, nvars, *varssize, constant, &requiredsize, TRUE) );
+         assert(requiredsize <= *varssize);
+      }
+   }
+   else
+   {
+      for( v = 0; v < *nvars; ++v )
+      {
+         SCIP_CALL( SCIPvarGetOrigvarSum(&(*vars)[v], &(*scalars)[v], constant) );
+
+         /* negated variables with an original counterpart may also be returned by SCIPvarGetOrigvarSum();
+          * make sure we get the original variable in that case
+          */
+         if( SCIPvarGetStatus((*vars)[v]) == SCIP_VARSTATUS_NEGATED )
+         {
+            (*vars)[v] = SCIPvarGetNegatedVar((*vars)[v]);
+            *constant += (*scalars)[v];
+            (*scalars)[v] *= -1.0;
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** writes a problem in SNP format */
+static
+SCIP_RETCODE writeSnp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           name,               /**< problem name */
+   SCIP_Bool             transformed,        /**< TRUE iff problem is the transformed problem */
+   SCIP_OBJSENSE         objsense,           /**< objective sense */
+   SCIP_Real             objscale,           /**< scalar applied to objective function; external objective value is
+                                              *   extobj = objsense * objscale * (intobj + objoffset) */
+   SCIP_Real             objoffset,          /**< objective offset from bound shifting and fixing */
+   SCIP_VAR**            vars,               /**< array with active variables ordered binary, integer, implicit, continuous */
+   int                   nvars,              /**< number of active variables in the problem */
+   SCIP_CONS**           conss,              /**< array with constraints of the problem */
+   int                   nconss,             /**< number of constraints in the problem */
+   SCIP_RESULT*          result              /**< pointer to store the result of the file writing call */
+   )
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   int* consinds;
+   int header[5];
+   int consvarssize;
+   int consindssize;
+   int c;
+   int v;
+
+   assert(scip != NULL);
+   assert(file != NULL);
+   assert(result != NULL);
+
+   /* check that all constraints can be represented as linear constraints */
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_Bool success;
+
+      (void) SCIPconsGetLhs(scip, conss[c], &success);
+      if( !success )
+      {
+         SCIPerrorMessage("constraint <%s> of type <%s> cannot be written in SNP format\n", SCIPconsGetName(conss[c]),
+            SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])));
+         return SCIP_WRITEERROR;
+      }
+   }
+
+   /* header */
+   header[0] = SNP_VERSION;
+   header[1] = SNP_BYTEORDER;
+   header[2] = (int) objsense;
+   header[3] = nvars;
+   header[4] = nconss;
+   objoffset *= objscale;
+
+   SCIP_CALL( writeItems(file, SNP_MAGIC, sizeof(char), (size_t) SNP_MAGICLEN) );
+   SCIP_CALL( writeItems(file, header, sizeof(int), 5) );
+   SCIP_CALL( writeItems(file, &objoffset, sizeof(SCIP_Real), 1) );
+   SCIP_CALL( writeName(file, name) );
+
+   /* variables */
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), nvars) );
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_Real bounds[3];
+      int vartype;
+
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*) vars[v], v) );
+
+      vartype = (int) SCIPvarGetType(vars[v]);
+      bounds[0] = writeValue(scip, transformed ? SCIPvarGetLbGlobal(vars[v]) : SCIPvarGetLbOriginal(vars[v]));
+      bounds[1] = writeValue(scip, transformed ? SCIPvarGetUbGlobal(vars[v]) : SCIPvarGetUbOriginal(vars[v]));
+      bounds[2] = objscale * SCIPvarGetObj(vars[v]);
+
+      SCIP_CALL( writeName(file, SCIPvarGetName(vars[v])) );
+      SCIP_CALL( writeItems(file, &vartype, sizeof(int), 1) );
+      SCIP_CALL( writeItems(file, bounds, sizeof(SCIP_Real), 3) );
+   }
+
+   /* constraints */
+   consvarssize = MAX(nvars, 1);
+   consindssize = consvarssize;
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvars, consvarssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvals, consvarssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &consinds, consindssize) );
+
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_Real sides[2];
+      SCIP_Real constant = 0.0;
+      SCIP_Bool success;
+      int nconsvars;
+
+      SCIP_CALL( SCIPgetConsNVars(scip, conss[c], &nconsvars, &success) );
+      assert(success);
+
+      if( nconsvars > consvarssize )
+      {
+         consvarssize = SCIPcalcMemGrowSize(scip, nconsvars);
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvars, consvarssize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvals, consvarssize) );
+      }
+
+      SCIP_CALL( SCIPgetConsVars(scip, conss[c], consvars, consvarssize, &success) );
+      assert(success);
+      SCIP_CALL( SCIPgetConsVals(scip, conss[c], consvals, consvarssize, &success) );
+      assert(success);
+
+      SCIP_CALL( getActiveVariables(scip, &consvars, &consvals, &nconsvars, &consvarssize, &constant, transformed) );
+
+      sides[0] = SCIPconsGetLhs(scip, conss[c], &success);
+      sides[1] = SCIPconsGetRhs(scip, conss[c], &success);
+      if( !SCIPisInfinity(scip, -sides[0]) )
+         sides[0] -= constant;
+      if( !SCIPisInfinity(scip, sides[1]) )
+         sides[1] -= constant;
+      sides[0] = writeValue(scip, sides[0]);
+      sides[1] = writeValue(scip, sides[1]);
+
+      if( nconsvars > consindssize )
+      {
+         consindssize = SCIPcalcMemGrowSize(scip, nconsvars);
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consinds, consindssize) );
+      }
+
+      /* translate variables to indices */
+      for( v = 0; v < nconsvars; ++v )
+      {
+         SCIP_VAR* var = consvars[v];
+
+         if( !SCIPhashmapExists(varmap, (void*) var) )
+         {
+            SCIPerrorMessage("variable <%s> of constraint <%s> is not part of the problem\n", SCIPvarGetName(var),
+               SCIPconsGetName(conss[c]));
+            SCIPfreeBufferArray(scip, &consinds);
+            SCIPfreeBufferArray(scip, &consvals);
+            SCIPfreeBufferArray(scip, &consvars);
+            SCIPhashmapFree(&varmap);
+            return SCIP_WRITEERROR;
+         }
+         consinds[v] = SCIPhashmapGetImageInt(varmap, (void*) var);
+      }
+
+      SCIP_CALL( writeName(file, SCIPconsGetName(conss[c])) );
+      SCIP_CALL( writeItems(file, sides, sizeof(SCIP_Real), 2) );
+      SCIP_CALL( writeItems(file, &nconsvars, sizeof(int), 1) );
+      SCIP_CALL( writeItems(file, consinds, sizeof(int), (size_t) nconsvars) );
+      SCIP_CALL( writeItems(file, consvals, sizeof(SCIP_Real), (size_t) nconsvars) );
+   }
+
+   SCIPfreeBufferArray(scip, &consinds);
+   SCIPfreeBufferArray(scip, &consvals);
+   SCIPfreeBufferArray(scip, &consvars);
+   SCIPhashmapFree(&varmap);
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of reader
+ */
+
+/** copy method for reader plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_READERCOPY(readerCopySnp)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   /* call inclusion method of reader */
+   SCIP_CALL( SCIPincludeReaderSnp(scip) );
+
+   return SCIP_OKAY;
+}
+
+
+/** problem reading method of reader */
+static
+SCIP_DECL_READERREAD(readerReadSnp)
+{  /*lint --e{715}*/
+   SCIP_FILE* fp;
+   SCIP_RETCODE retcode;
+
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   fp = SCIPfopen(filename, "rb");
+   if( fp == NULL )
+   {
+      SCIPerrorMessage("cannot open file <%s> for reading\n", filename);
+      SCIPprintSysError(filename);
+      return SCIP_NOFILE;
+   }
+
+   retcode = readSnp(scip, fp, filename);
+
+   SCIPfclose(fp);
+
+   SCIP_CALL( retcode );
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/** problem writing method of reader */
+static
+SCIP_DECL_READERWRITE(readerWriteSnp)
+{  /*lint --e{715}*/
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   SCIP_CALL( writeSnp(scip, file != NULL ? file : stdout, name, transformed, objsense, objscale, objoffset, vars,
+         nvars, conss, nconss, result) );
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * reader specific interface methods
+ */
+
+/** includes the snp file reader in SCIP */
+SCIP_RETCODE SCIPincludeReaderSnp(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_READER* reader;
+
+   /* include reader */
+   SCIP_CALL( SCIPincludeReaderBasic(scip, &reader, READER_NAME, READER_DESC, READER_EXTENSION, NULL) );
+
+   assert(reader != NULL);
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetReaderCopy(scip, reader, readerCopySnp) );
+   SCIP_CALL( SCIPsetReaderRead(scip, reader, readerReadSnp) );
+   SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteSnp) );
+
+   return SCIP_OKAY;
+}
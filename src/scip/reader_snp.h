@@ -0,0 +1,73 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_snp.h
+ * @ingroup FILEREADERS
+ * @brief  SNP file reader and writer for binary snapshots of linear problems
+ *
+ * The SNP format stores a problem whose constraints can be represented as linear constraints (linear, set
+ * partitioning/packing/covering, logic or, knapsack, and variable bound constraints) in a binary, versioned format.
+ * Numbers are stored in the native byte order of the writing machine; a marker in the header lets the reader reject
+ * files of a different byte order. Writing the transformed problem after presolving yields a snapshot of the presolved
+ * model that can be read back without parsing text.
+ *
+ * A file consists of
+ *
+ * - a header: the magic string "SCIPSNP" (8 bytes including the terminating zero), the format version, the byte order
+ *   marker, the objective sense, the number of variables and constraints (all 32-bit integers), the objective offset
+ *   (double), and the problem name (length as 32-bit integer followed by the characters);
+ * - one record per variable: name, type (32-bit integer), lower bound, upper bound, and objective coefficient (doubles);
+ * - one record per constraint: name, left-hand side, right-hand side (doubles), number of nonzeros (32-bit integer),
+ *   the variable indices (32-bit integers), and the coefficients (doubles).
+ *
+ * Variables and constraints are read back as original variables and linear constraints.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_READER_SNP_H__
+#define __SCIP_READER_SNP_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** includes the snp file reader into SCIP
+ *
+ *  @ingroup FileReaderIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeReaderSnp(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -972,6 +972,35 @@ int SCIPgetNConshdlrs(
    return scip->set->nconshdlrs;
 }
 
+/** returns whether the propagation method of the constraint handler should only process the constraints marked to be
+ *  propagated, i.e., whether the handler has a worklist, see SCIPconshdlrSetPropWorklist(), and propagating/worklist
+ *  is set
+ */
+SCIP_Bool SCIPisPropWorklistUsed(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+
+   return scip->set->prop_worklist && SCIPconshdlrHasPropWorklist(conshdlr);
+}
+
+/** returns whether the marked constraints are passed to the propagation method of the constraint handler in decreasing
+ *  order of their number of markings, i.e., whether its worklist is used and propagating/sortworklist is set
+ */
+SCIP_Bool SCIPisPropWorklistSorted(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+
+   return scip->set->prop_sortworklist && SCIPisPropWorklistUsed(scip, conshdlr);
+}
+
 /** creates and captures a constraint of the given constraint handler
  *
  *  @warning If a constraint is marked to be checked for feasibility but not to be enforced, a LP or pseudo solution may
@@ -671,6 +671,25 @@ int SCIPgetNConshdlrs(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns whether the propagation method of the constraint handler should only process the constraints marked to be
+ *  propagated, i.e., whether the handler has a worklist, see SCIPconshdlrSetPropWorklist(), and propagating/worklist
+ *  is set
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPisPropWorklistUsed(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   );
+
+/** returns whether the marked constraints are passed to the propagation method of the constraint handler in decreasing
+ *  order of their number of markings, i.e., whether its worklist is used and propagating/sortworklist is set
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPisPropWorklistSorted(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   );
+
 /** @} */
 
 /**@addtogroup PublicConstraintMethods
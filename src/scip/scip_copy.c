@@ -50,10 +50,12 @@
 #include "scip/cons_linear.h"
 #include "scip/dcmp.h"
 #include "scip/debug.h"
+#include "scip/heur.h"
 #include "scip/primal.h"
 #include "scip/prob.h"
 #include "scip/pub_cons.h"
 #include "scip/pub_cutpool.h"
+#include "scip/pub_heur.h"
 #include "scip/pub_implics.h"
 #include "scip/pub_lp.h"
 #include "scip/pub_message.h"
@@ -80,6 +82,7 @@
 #include "scip/scip_var.h"
 #include "scip/set.h"
 #include "scip/stat.h"
+#include "scip/struct_heur.h"
 #include "scip/struct_mem.h"
 #include "scip/struct_scip.h"
 #include "scip/struct_set.h"
@@ -3414,3 +3417,246 @@ SCIP_RETCODE SCIPsetCommonSubscipParams(
 
    return SCIP_OKAY;
 }
+
+/** changes the original bounds of a variable in a sub-SCIP in problem stage such that the lower bound never exceeds
+ *  the upper bound in between
+ */
+static
+SCIP_RETCODE chgSubscipVarBounds(
+   SCIP*                 subscip,            /**< sub-SCIP in problem stage */
+   SCIP_VAR*             subvar,             /**< variable of the sub-SCIP */
+   SCIP_Real             lb,                 /**< new lower bound */
+   SCIP_Real             ub                  /**< new upper bound */
+   )
+{
+   if( lb > SCIPvarGetUbOriginal(subvar) )
+   {
+      SCIP_CALL( SCIPchgVarUb(subscip, subvar, ub) );
+      SCIP_CALL( SCIPchgVarLb(subscip, subvar, lb) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPchgVarLb(subscip, subvar, lb) );
+      SCIP_CALL( SCIPchgVarUb(subscip, subvar, ub) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** copies the source problem into the sub-SCIP cache of a heuristic, replacing a previous copy */
+static
+SCIP_RETCODE createCachedSubscip(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_SUBSCIPCACHE*    cache,              /**< sub-SCIP cache of the heuristic */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_Bool             copycuts            /**< should the active cuts of the cut pool be copied? */
+   )
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR** vars;
+   int nvars;
+   int i;
+
+   assert(cache != NULL);
+
+   if( cache->subscip != NULL )
+   {
+      SCIP_CALL( SCIPfree(&cache->subscip) );
+   }
+   BMSfreeMemoryArrayNull(&cache->subvars);
+   BMSfreeMemoryArrayNull(&cache->sourcevars);
+
+   SCIP_CALL( SCIPgetVarsData(sourcescip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   SCIP_CALL( SCIPcreate(&cache->subscip) );
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(cache->subscip), nvars) );
+
+   /* copy the problem without fixings; they are applied as bound changes for every call */
+   SCIP_CALL( SCIPcopyConsCompression(sourcescip, cache->subscip, varmap, NULL, suffix, NULL, NULL, 0, TRUE, FALSE,
+         FALSE, TRUE, &cache->valid) );
+
+   if( copycuts )
+   {
+      SCIP_CALL( SCIPcopyCuts(sourcescip, cache->subscip, varmap, NULL, TRUE, NULL) );
+   }
+
+   /* solutions of a call must not be kept as original solution candidates for the next call */
+   SCIP_CALL( SCIPsetBoolParam(cache->subscip, "misc/transsolsorig", FALSE) );
+
+   SCIP_ALLOC( BMSduplicateMemoryArray(&cache->sourcevars, vars, nvars) );
+   SCIP_ALLOC( BMSallocMemoryArray(&cache->subvars, nvars) );
+   for( i = 0; i < nvars; ++i )
+      cache->subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmap, vars[i]);
+
+   SCIPhashmapFree(&varmap);
+
+   cache->nvars = nvars;
+   cache->nruns = SCIPgetNRuns(sourcescip);
+
+   return SCIP_OKAY;
+}
+
+/** returns a copy of the source problem for a large neighborhood search of the given heuristic in which the given
+ *  variables are fixed
+ *
+ *  The copy is kept by the heuristic between its calls. If the active variables of the source problem did not change
+ *  since the copy was created, the copy is reused and only the global bounds of the source problem and the fixings
+ *  are applied as bound changes; otherwise, a new copy is created. Between the calls, the sub-SCIP stays in problem
+ *  stage and must be handed back with SCIPreleaseCachedSubscip().
+ *
+ *  The array of sub-SCIP variables is ordered as the variables of the source problem and owned by the cache; entries
+ *  are NULL for variables that could not be copied.
+ *
+ *  @note The sub-SCIP is only created once, so plugins and parameters that the heuristic sets up once per sub-SCIP
+ *        should only be set if \p created is TRUE. Constraints added to the sub-SCIP persist for later calls.
+ *  @note Cuts are only copied when a new copy is created.
+ *
+ *  @pre This method can be called if sourcescip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_RETCODE SCIPgetCachedSubscip(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_HEUR*            heur,               /**< heuristic that owns the sub-SCIP */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_VAR**            fixedvars,          /**< active source variables whose copies should be fixed, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values, or NULL */
+   int                   nfixedvars,         /**< number of source variables whose copies should be fixed */
+   SCIP_Bool             copycuts,           /**< should the active cuts of the cut pool be copied into a new copy? */
+   SCIP**                subscip,            /**< pointer to store the sub-SCIP */
+   SCIP_VAR***           subvars,            /**< pointer to store the array of sub-SCIP variables */
+   SCIP_Bool*            created,            /**< pointer to store whether a new copy was created */
+   SCIP_Bool*            valid               /**< pointer to store whether the copy is valid, or NULL */
+   )
+{
+   SCIP_SUBSCIPCACHE* cache;
+   SCIP_VAR** vars;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   int nvars;
+   int i;
+
+   assert(sourcescip != NULL);
+   assert(heur != NULL);
+   assert(suffix != NULL);
+   assert(fixedvars != NULL || nfixedvars == 0);
+   assert(fixedvals != NULL || nfixedvars == 0);
+   assert(subscip != NULL);
+   assert(subvars != NULL);
+   assert(created != NULL);
+
+   SCIP_CALL( SCIPcheckStage(sourcescip, "SCIPgetCachedSubscip", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPheurGetSubscipCache(heur, &cache) );
+
+   if( cache->inuse )
+   {
+      SCIPerrorMessage("cached sub-SCIP of heuristic <%s> is already in use\n", SCIPheurGetName(heur));
+      return SCIP_INVALIDCALL;
+   }
+
+   SCIP_CALL( SCIPgetVarsData(sourcescip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   /* the copy can be reused as long as the active problem variables are the same */
+   *created = (cache->subscip == NULL || cache->nruns != SCIPgetNRuns(sourcescip) || cache->nvars != nvars);
+   for( i = 0; i < nvars && !(*created); ++i )
+      *created = (cache->sourcevars[i] != vars[i]);
+
+   if( *created )
+   {
+      SCIPheurStartSubscipClock(heur, sourcescip->set, TRUE);
+      SCIP_CALL( createCachedSubscip(sourcescip, cache, suffix, copycuts) );
+      SCIPheurStopSubscipClock(heur, sourcescip->set, TRUE);
+   }
+   SCIPheurCountSubscipCall(heur, *created);
+
+   assert(SCIPgetStage(cache->subscip) == SCIP_STAGE_PROBLEM);
+
+   SCIPheurStartSubscipClock(heur, sourcescip->set, FALSE);
+
+   SCIP_CALL( SCIPallocBufferArray(sourcescip, &lbs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(sourcescip, &ubs, nvars) );
+
+   for( i = 0; i < nvars; ++i )
+   {
+      lbs[i] = SCIPvarGetLbGlobal(vars[i]);
+      ubs[i] = SCIPvarGetUbGlobal(vars[i]);
+   }
+
+   for( i = 0; i < nfixedvars; ++i )
+   {
+      int idx = SCIPvarGetProbindex(fixedvars[i]);
+
+      assert(idx >= 0 && idx < nvars && vars[idx] == fixedvars[i]);
+      lbs[idx] = fixedvals[i];
+      ubs[idx] = fixedvals[i];
+   }
+
+   for( i = 0; i < nvars; ++i )
+   {
+      if( cache->subvars[i] != NULL )
+      {
+         SCIP_CALL( chgSubscipVarBounds(cache->subscip, cache->subvars[i], lbs[i], ubs[i]) );
+      }
+   }
+
+   SCIPfreeBufferArray(sourcescip, &ubs);
+   SCIPfreeBufferArray(sourcescip, &lbs);
+
+   SCIPheurStopSubscipClock(heur, sourcescip->set, FALSE);
+
+   cache->inuse = TRUE;
+   *subscip = cache->subscip;
+   *subvars = cache->subvars;
+
+   if( valid != NULL )
+      *valid = cache->valid;
+
+   return SCIP_OKAY;
+}
+
+/** hands a sub-SCIP obtained by SCIPgetCachedSubscip() back to the cache of the heuristic
+ *
+ *  The transformed problem of the sub-SCIP is freed such that the sub-SCIP can be reused by the next call of the
+ *  heuristic. If \p discard is TRUE, or the transformed problem cannot be freed, the sub-SCIP is freed completely
+ *  and the next call creates a new copy.
+ */
+SCIP_RETCODE SCIPreleaseCachedSubscip(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_HEUR*            heur,               /**< heuristic that owns the sub-SCIP */
+   SCIP**                subscip,            /**< pointer to the sub-SCIP, will be set to NULL */
+   SCIP_Bool             discard             /**< should the sub-SCIP be freed instead of kept? */
+   )
+{
+   SCIP_SUBSCIPCACHE* cache;
+
+   assert(sourcescip != NULL);
+   assert(heur != NULL);
+   assert(subscip != NULL);
+
+   SCIP_CALL( SCIPheurGetSubscipCache(heur, &cache) );
+   assert(cache->inuse);
+   assert(*subscip == cache->subscip);
+
+   SCIPheurStartSubscipClock(heur, sourcescip->set, FALSE);
+
+   if( !discard && SCIPfreeTransform(cache->subscip) != SCIP_OKAY )
+   {
+      SCIPwarningMessage(sourcescip, "could not free transformed problem of cached sub-SCIP of heuristic <%s>\n",
+         SCIPheurGetName(heur));
+      discard = TRUE;
+   }
+
+   if( discard )
+   {
+      SCIP_CALL( SCIPfree(&cache->subscip) );
+   }
+
+   SCIPheurStopSubscipClock(heur, sourcescip->set, FALSE);
+
+   cache->inuse = FALSE;
+   *subscip = NULL;
+
+   return SCIP_OKAY;
+}
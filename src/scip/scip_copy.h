@@ -43,6 +43,7 @@
 
 #include "scip/def.h"
 #include "scip/type_cons.h"
+#include "scip/type_heur.h"
 #include "scip/type_misc.h"
 #include "scip/type_retcode.h"
 #include "scip/type_scip.h"
@@ -1282,6 +1283,54 @@ SCIP_RETCODE SCIPsetCommonSubscipParams(
    int                   bestsollimit        /**< the limit on the number of best solutions found, or -1 for no limit */
    );
 
+/** returns a copy of the source problem for a large neighborhood search of the given heuristic in which the given
+ *  variables are fixed
+ *
+ *  The copy is kept by the heuristic between its calls. If the active variables of the source problem did not change
+ *  since the copy was created, the copy is reused and only the global bounds of the source problem and the fixings
+ *  are applied as bound changes; otherwise, a new copy is created. Between the calls, the sub-SCIP stays in problem
+ *  stage and must be handed back with SCIPreleaseCachedSubscip().
+ *
+ *  The array of sub-SCIP variables is ordered as the variables of the source problem and owned by the cache; entries
+ *  are NULL for variables that could not be copied.
+ *
+ *  @note The sub-SCIP is only created once, so plugins and parameters that the heuristic sets up once per sub-SCIP
+ *        should only be set if \p created is TRUE. Constraints added to the sub-SCIP persist for later calls.
+ *  @note Cuts are only copied when a new copy is created.
+ *
+ *  @pre This method can be called if sourcescip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetCachedSubscip(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_HEUR*            heur,               /**< heuristic that owns the sub-SCIP */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_VAR**            fixedvars,          /**< active source variables whose copies should be fixed, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values, or NULL */
+   int                   nfixedvars,         /**< number of source variables whose copies should be fixed */
+   SCIP_Bool             copycuts,           /**< should the active cuts of the cut pool be copied into a new copy? */
+   SCIP**                subscip,            /**< pointer to store the sub-SCIP */
+   SCIP_VAR***           subvars,            /**< pointer to store the array of sub-SCIP variables */
+   SCIP_Bool*            created,            /**< pointer to store whether a new copy was created */
+   SCIP_Bool*            valid               /**< pointer to store whether the copy is valid, or NULL */
+   );
+
+/** hands a sub-SCIP obtained by SCIPgetCachedSubscip() back to the cache of the heuristic
+ *
+ *  The transformed problem of the sub-SCIP is freed such that the sub-SCIP can be reused by the next call of the
+ *  heuristic. If \p discard is TRUE, or the transformed problem cannot be freed, the sub-SCIP is freed completely
+ *  and the next call creates a new copy.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPreleaseCachedSubscip(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_HEUR*            heur,               /**< heuristic that owns the sub-SCIP */
+   SCIP**                subscip,            /**< pointer to the sub-SCIP, will be set to NULL */
+   SCIP_Bool             discard             /**< should the sub-SCIP be freed instead of kept? */
+   );
 
 /**@} */
 
@@ -36,6 +36,8 @@
 #include "scip/cutsel.h"
 #include "scip/pub_message.h"
 #include "scip/scip_cutsel.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_prob.h"
 #include "scip/set.h"
 #include "scip/struct_mem.h"
 #include "scip/struct_scip.h"
@@ -268,3 +270,42 @@ SCIP_RETCODE SCIPsetCutselPriority(
 
    return SCIP_OKAY;
 }
+
+/** creates a column index of the given cuts to find the cuts that may be parallel to a cut
+ *
+ *  Cut selectors can use the index to skip the computation of the parallelism of cuts that do not share a column, see
+ *  SCIPcutselindexGetCands(). The cut selector has to record all swaps of cuts in the array by
+ *  SCIPcutselindexSwap().
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPcreateCutselIndex(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CUTSELINDEX**    cutselindex,        /**< pointer to store the column index */
+   SCIP_ROW**            cuts,               /**< array with cuts */
+   int                   ncuts               /**< number of cuts */
+   )
+{
+   assert(scip != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPcreateCutselIndex", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPcutselindexCreate(cutselindex, SCIPblkmem(scip), cuts, ncuts, SCIPgetNVars(scip)) );
+
+   return SCIP_OKAY;
+}
+
+/** frees a column index of cuts */
+void SCIPfreeCutselIndex(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CUTSELINDEX**    cutselindex         /**< pointer to the column index */
+   )
+{
+   assert(scip != NULL);
+
+   SCIPcutselindexFree(cutselindex, SCIPblkmem(scip));
+}
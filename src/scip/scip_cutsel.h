@@ -166,6 +166,33 @@ SCIP_RETCODE SCIPsetCutselPriority(
    int                   priority            /**< new priority of the separator */
    );
 
+/** creates a column index of the given cuts to find the cuts that may be parallel to a cut
+ *
+ *  Cut selectors can use the index to skip the computation of the parallelism of cuts that do not share a column, see
+ *  SCIPcutselindexGetCands(). The cut selector has to record all swaps of cuts in the array by
+ *  SCIPcutselindexSwap().
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateCutselIndex(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CUTSELINDEX**    cutselindex,        /**< pointer to store the column index */
+   SCIP_ROW**            cuts,               /**< array with cuts */
+   int                   ncuts               /**< number of cuts */
+   );
+
+/** frees a column index of cuts */
+SCIP_EXPORT
+void SCIPfreeCutselIndex(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CUTSELINDEX**    cutselindex         /**< pointer to the column index */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
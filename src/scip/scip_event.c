@@ -230,6 +230,25 @@ SCIP_RETCODE SCIPsetEventhdlrDelete(
    return SCIP_OKAY;
 }
 
+/** sets batched execution method of the event handler for local bound changes
+ *
+ *  With this method, the local bound changes caught by the event handler are passed in one call at the end of each
+ *  round of processing the delayed event queue, e.g., after switching to another node, instead of one by one to the
+ *  execution method; see SCIP_DECL_EVENTEXECBATCH.
+ */
+SCIP_RETCODE SCIPsetEventhdlrExecBatch(
+   SCIP*                 scip,               /**< scip instance */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method for local bound changes */
+   )
+{
+   assert(scip != NULL);
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPsetEventhdlrExecBatch", TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIPeventhdlrSetExecBatch(eventhdlr, eventexecbatch);
+   return SCIP_OKAY;
+}
+
 /** returns the event handler of the given name, or NULL if not existing */
 SCIP_EVENTHDLR* SCIPfindEventhdlr(
    SCIP*                 scip,               /**< SCIP data structure */
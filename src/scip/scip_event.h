@@ -82,7 +82,7 @@ SCIP_RETCODE SCIPincludeEventhdlr(
 /** creates an event handler and includes it in SCIP with all its non-fundamental callbacks set
  *  to NULL; if needed, non-fundamental callbacks can be set afterwards via setter functions
  *  SCIPsetEventhdlrCopy(), SCIPsetEventhdlrFree(), SCIPsetEventhdlrInit(), SCIPsetEventhdlrExit(),
- *  SCIPsetEventhdlrInitsol(), SCIPsetEventhdlrExitsol(), and SCIPsetEventhdlrDelete()
+ *  SCIPsetEventhdlrInitsol(), SCIPsetEventhdlrExitsol(), SCIPsetEventhdlrDelete(), and SCIPsetEventhdlrExecBatch()
  *
  *  @note if you want to set all callbacks with a single method call, consider using SCIPincludeEventhdlr() instead
  */
@@ -152,6 +152,19 @@ SCIP_RETCODE SCIPsetEventhdlrDelete(
    SCIP_DECL_EVENTDELETE ((*eventdelete))    /**< free specific event data */
    );
 
+/** sets batched execution method of the event handler for local bound changes
+ *
+ *  With this method, the local bound changes caught by the event handler are passed in one call at the end of each
+ *  round of processing the delayed event queue, e.g., after switching to another node, instead of one by one to the
+ *  execution method; see SCIP_DECL_EVENTEXECBATCH.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetEventhdlrExecBatch(
+   SCIP*                 scip,               /**< scip instance */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method for local bound changes */
+   );
+
 /** returns the event handler of the given name, or NULL if not existing */
 SCIP_EXPORT
 SCIP_EVENTHDLR* SCIPfindEventhdlr(
@@ -2358,6 +2358,277 @@ void SCIPfreeExpriter(
 /**@} */
 
 
+/**@name Expression Program Methods */
+/**@{ */
+
+/** creates an expression program for an expression
+ *
+ * The program lists all subexpressions of the expression in topological order, that is,
+ * each subexpression appears once and after all its children, with the expression itself last.
+ * The subexpressions are not captured. The program becomes invalid if the expression is freed
+ * or the children of any of its subexpressions are changed, and has to be recreated then.
+ */
+SCIP_RETCODE SCIPcreateExprprog(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG**       prog,               /**< buffer to store expression program */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIP_CALL( SCIPexprprogCreate(scip->mem->probmem, scip->stat, prog, expr) );
+
+   return SCIP_OKAY;
+}
+
+/** frees an expression program */
+void SCIPfreeExprprog(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG**       prog                /**< pointer to expression program */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIPexprprogFree(scip->mem->probmem, prog);
+}
+
+/** evaluates the expression of an expression program in a point
+ *
+ * Gives the same result as SCIPevalExpr() for the expression of the program,
+ * but runs over its subexpressions in the order of the program instead of doing an expression walk.
+ * Value can be received via SCIPexprGetEvalValue() of the expression.
+ */
+SCIP_RETCODE SCIPevalExprprog(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   assert(scip != NULL);
+
+   SCIP_CALL( SCIPexprprogEval(scip->set, prog, sol, soltag) );
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the gradient of the expression of an expression program in a point
+ *
+ * Gives the same partial derivatives w.r.t. variable expressions as SCIPevalExprGradient(),
+ * but computes them by a single reverse pass over the program.
+ * For other subexpressions, the derivative of the expression w.r.t. the subexpression is stored.
+ */
+SCIP_RETCODE SCIPevalExprprogGradient(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   assert(scip != NULL);
+
+   SCIP_CALL( SCIPexprprogEvalGradient(scip->set, scip->stat, prog, sol, soltag) );
+
+   return SCIP_OKAY;
+}
+
+/** evaluates an expression and, optionally, its gradient in several points at once
+ *
+ * The points are given column-wise, that is, varvals[j*npoints+k] is the value of variable vars[j] in the k-th point.
+ * The gradients are stored in the same layout, that is, grads[j*npoints+k] is the partial derivative w.r.t. vars[j]
+ * in the k-th point. All variables of the expression need to be in vars.
+ *
+ * The subexpressions are evaluated in all points at once via the batch evaluation callbacks of their expression
+ * handlers, if available, and point by point otherwise.
+ * Values and derivatives are not stored in the expression and its subexpressions.
+ * For points where the expression could not be evaluated, the value and all partial derivatives are SCIP_INVALID.
+ *
+ * The expression program of the expression and the positions of its variables in vars are stored in the expression
+ * and reused by further calls, see SCIPfreeExprBatch().
+ */
+SCIP_RETCODE SCIPevalExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   nvars,              /**< number of variables */
+   SCIP_VAR**            vars,               /**< variables, including all variables of the expression */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables in all points, column-wise */
+   SCIP_Real*            vals,               /**< buffer to store values of expression in all points */
+   SCIP_Real*            grads               /**< buffer to store gradients in all points, column-wise, or NULL */
+   )
+{
+   SCIP_EXPRPROG* prog;
+   SCIP_EXPR** exprs;
+   SCIP_Real** childrenvals;
+   SCIP_Real* exprvals;
+   int* varidx;
+   int maxnchildren;
+   int nexprs;
+   int i;
+   int j;
+   int k;
+
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+   assert(expr != NULL);
+   assert(nvars >= 0);
+   assert(vars != NULL || nvars == 0);
+   assert(npoints >= 0);
+   assert(varvals != NULL || nvars == 0 || npoints == 0);
+   assert(vals != NULL || npoints == 0);
+
+   if( npoints == 0 )
+      return SCIP_OKAY;
+
+   /* get the program and the columns of varvals of its variable expressions, which are kept in the expression */
+   SCIP_CALL( SCIPexprGetBatch(scip->set, scip->stat, scip->mem->probmem, expr, nvars, vars, &prog, &varidx) );
+   exprs = SCIPexprprogGetExprs(prog);
+   nexprs = SCIPexprprogGetNExprs(prog);
+
+   maxnchildren = 1;
+   for( i = 0; i < nexprs; ++i )
+      maxnchildren = MAX(maxnchildren, SCIPexprGetNChildren(exprs[i]));
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &childrenvals, maxnchildren) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprvals, (size_t)nexprs * npoints) );
+
+   /* forward pass: evaluate all subexpressions in all points */
+   for( i = 0; i < nexprs; ++i )
+   {
+      SCIP_Real* ivals = &exprvals[(size_t)i * npoints];
+
+      if( varidx[i] >= 0 )
+      {
+         BMScopyMemoryArray(ivals, &varvals[(size_t)varidx[i] * npoints], npoints);  /*lint !e613*/
+      }
+      else
+      {
+         int* childpos;
+         int c;
+
+         childpos = SCIPexprprogGetChildPos(prog, i);
+         for( c = 0; c < SCIPexprGetNChildren(exprs[i]); ++c )
+            childrenvals[c] = &exprvals[(size_t)childpos[c] * npoints];
+
+         SCIP_CALL( SCIPexprhdlrEvalBatchExpr(SCIPexprGetHdlr(exprs[i]), scip->set, scip->mem->buffer, exprs[i],
+               npoints, childrenvals, ivals) );
+      }
+   }
+
+   BMScopyMemoryArray(vals, &exprvals[(size_t)(nexprs-1) * npoints], npoints);
+
+   /* reverse pass: accumulate the derivatives of the expression w.r.t. all subexpressions in all points */
+   if( grads != NULL )
+   {
+      SCIP_Real* adjoints;
+      SCIP_Real* pointvals;
+      SCIP_Bool* invalid;
+
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &adjoints, (size_t)nexprs * npoints) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &pointvals, maxnchildren) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &invalid, npoints) );
+
+      BMSclearMemoryArray(grads, (size_t)nvars * npoints);
+
+      for( k = 0; k < npoints; ++k )
+      {
+         invalid[k] = vals[k] == SCIP_INVALID; /*lint !e777*/
+         adjoints[(size_t)(nexprs-1) * npoints + k] = 1.0;
+      }
+
+      for( i = nexprs-1; i >= 0; --i )
+      {
+         SCIP_Real* iadjoints = &adjoints[(size_t)i * npoints];
+         int* childpos;
+         int nchildren;
+         int c;
+
+         if( varidx[i] >= 0 )
+         {
+            SCIP_Real* vargrads = &grads[(size_t)varidx[i] * npoints];
+
+            for( k = 0; k < npoints; ++k )
+               vargrads[k] += iadjoints[k];
+
+            continue;
+         }
+
+         nchildren = SCIPexprGetNChildren(exprs[i]);
+         if( nchildren == 0 )
+            continue;
+
+         childpos = SCIPexprprogGetChildPos(prog, i);
+
+         for( k = 0; k < npoints; ++k )
+         {
+            if( invalid[k] )
+               continue;
+
+            for( c = 0; c < nchildren; ++c )
+               pointvals[c] = exprvals[(size_t)childpos[c] * npoints + k];
+
+            for( c = 0; c < nchildren; ++c )
+            {
+               SCIP_Real derivative;
+
+               /* the derivative w.r.t. a value child is not needed */
+               if( SCIPexprIsValue(scip->set, exprs[childpos[c]]) )
+                  continue;
+
+               SCIP_CALL( SCIPexprhdlrBwDiffExpr(SCIPexprGetHdlr(exprs[i]), scip->set, scip->mem->buffer, exprs[i], c,
+                     &derivative, pointvals, exprvals[(size_t)i * npoints + k]) );
+
+               if( derivative == SCIP_INVALID ) /*lint !e777*/
+               {
+                  invalid[k] = TRUE;
+                  break;
+               }
+
+               adjoints[(size_t)childpos[c] * npoints + k] += iadjoints[k] * derivative;
+            }
+         }
+      }
+
+      for( k = 0; k < npoints; ++k )
+      {
+         if( !invalid[k] )
+            continue;
+
+         for( j = 0; j < nvars; ++j )
+            grads[(size_t)j * npoints + k] = SCIP_INVALID;
+      }
+
+      SCIPfreeBufferArray(scip, &invalid);
+      SCIPfreeBufferArray(scip, &pointvals);
+      SCIPfreeBufferArray(scip, &adjoints);
+   }
+
+   SCIPfreeBufferArray(scip, &exprvals);
+   SCIPfreeBufferArray(scip, &childrenvals);
+
+   return SCIP_OKAY;
+}
+
+/** frees the data that SCIPevalExprBatch() stored in an expression
+ *
+ * Before changing the children of the expression or of any of its subexpressions, this function needs to be called.
+ */
+void SCIPfreeExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIPexprFreeBatch(scip->mem->probmem, expr);
+}
+
+/**@} */
+
+
 /**@name Quadratic expression functions */
 /**@{ */
 
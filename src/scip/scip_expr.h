@@ -1020,6 +1020,97 @@ void SCIPfreeExpriter(
 /** @} */
 
 
+/**@name Expression Programs */
+/**@{ */
+
+/** creates an expression program for an expression
+ *
+ * The program lists all subexpressions of the expression in topological order, that is,
+ * each subexpression appears once and after all its children, with the expression itself last.
+ * The subexpressions are not captured. The program becomes invalid if the expression is freed
+ * or the children of any of its subexpressions are changed, and has to be recreated then.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateExprprog(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG**       prog,               /**< buffer to store expression program */
+   SCIP_EXPR*            expr                /**< expression */
+   );
+
+/** frees an expression program */
+SCIP_EXPORT
+void SCIPfreeExprprog(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG**       prog                /**< pointer to expression program */
+   );
+
+/** evaluates the expression of an expression program in a point
+ *
+ * Gives the same result as SCIPevalExpr() for the expression of the program,
+ * but runs over its subexpressions in the order of the program instead of doing an expression walk.
+ * Value can be received via SCIPexprGetEvalValue() of the expression.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprprog(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
+/** evaluates the gradient of the expression of an expression program in a point
+ *
+ * Gives the same partial derivatives w.r.t. variable expressions as SCIPevalExprGradient(),
+ * but computes them by a single reverse pass over the program.
+ * For other subexpressions, the derivative of the expression w.r.t. the subexpression is stored.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprprogGradient(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPRPROG*        prog,               /**< expression program */
+   SCIP_SOL*             sol,                /**< solution to be evaluated (NULL for the current LP solution) */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   );
+
+/** evaluates an expression and, optionally, its gradient in several points at once
+ *
+ * The points are given column-wise, that is, varvals[j*npoints+k] is the value of variable vars[j] in the k-th point.
+ * The gradients are stored in the same layout, that is, grads[j*npoints+k] is the partial derivative w.r.t. vars[j]
+ * in the k-th point. All variables of the expression need to be in vars.
+ *
+ * The subexpressions are evaluated in all points at once via the batch evaluation callbacks of their expression
+ * handlers, if available, and point by point otherwise.
+ * Values and derivatives are not stored in the expression and its subexpressions.
+ * For points where the expression could not be evaluated, the value and all partial derivatives are SCIP_INVALID.
+ *
+ * The expression program of the expression and the positions of its variables in vars are stored in the expression
+ * and reused by further calls, see SCIPfreeExprBatch().
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   nvars,              /**< number of variables */
+   SCIP_VAR**            vars,               /**< variables, including all variables of the expression */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables in all points, column-wise */
+   SCIP_Real*            vals,               /**< buffer to store values of expression in all points */
+   SCIP_Real*            grads               /**< buffer to store gradients in all points, column-wise, or NULL */
+   );
+
+/** frees the data that SCIPevalExprBatch() stored in an expression
+ *
+ * Before changing the children of the expression or of any of its subexpressions, this function needs to be called.
+ */
+SCIP_EXPORT
+void SCIPfreeExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr                /**< expression */
+   );
+
+/** @} */
+
+
 /**@name Quadratic Expressions */
 /**@{ */
 
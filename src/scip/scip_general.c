@@ -72,6 +72,7 @@
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
 #include "scip/syncstore.h"
+#include "tpi/tpi.h"
 #include "scip/lapack_calls.h"
 
 #include <string.h>
@@ -349,6 +350,13 @@ SCIP_RETCODE SCIPfree(
    SCIP_CALL( SCIPfreeProb(*scip) );
    assert((*scip)->set->stage == SCIP_STAGE_INIT);
 
+   /* release the shared thread pool if it has been acquired before the problem was transformed */
+   if( (*scip)->tpiacquired )
+   {
+      SCIP_CALL( SCIPtpiReleaseShared() );
+      (*scip)->tpiacquired = FALSE;
+   }
+
    /* switch stage to FREE */
    (*scip)->set->stage = SCIP_STAGE_FREE;
 
@@ -463,6 +463,57 @@ int SCIPgetNLPRows(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** gets the coefficient matrix of the current LP in compressed sparse row format
+ *
+ *  Row r of the LP has the entries rowbeg[r], ..., rowbeg[r+1]-1 of the arrays colind and vals, where the column
+ *  indices are the positions of the columns in the LP, see SCIPcolGetLPPos(). Only coefficients of LP columns are
+ *  contained. The arrays are owned by the LP and must not be modified; they stay valid until rows or columns are added
+ *  to or removed from the LP or a coefficient of the LP changes. The snapshot is built on demand and updated
+ *  incrementally if rows were only added to or removed from the end of the LP. If the LP of the focus node is not
+ *  constructed, NULL pointers and zero entries are returned.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetLPMatrixRows(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int**                 rowbeg,             /**< pointer to store the start of each row (nrows+1 entries) */
+   int**                 colind,             /**< pointer to store the LP positions of the columns of the entries */
+   SCIP_Real**           vals,               /**< pointer to store the coefficients of the entries */
+   int*                  nnonz               /**< pointer to store the number of entries */
+   );
+
+/** gets the coefficient matrix of the current LP in compressed sparse column format
+ *
+ *  Column c of the LP has the entries colbeg[c], ..., colbeg[c+1]-1 of the arrays rowind and vals, sorted by increasing
+ *  row index, where the row indices are the positions of the rows in the LP, see SCIProwGetLPPos(). The arrays are
+ *  owned by the LP and must not be modified; they stay valid until rows or columns are added to or removed from the LP
+ *  or a coefficient of the LP changes. If the LP of the focus node is not constructed, NULL pointers and zero entries
+ *  are returned.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetLPMatrixCols(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int**                 colbeg,             /**< pointer to store the start of each column (ncols+1 entries) */
+   int**                 rowind,             /**< pointer to store the LP positions of the rows of the entries */
+   SCIP_Real**           vals,               /**< pointer to store the coefficients of the entries */
+   int*                  nnonz               /**< pointer to store the number of entries */
+   );
+
 /** returns TRUE iff all columns, i.e. every variable with non-empty column w.r.t. all ever created rows, are present
  *  in the LP, and FALSE, if there are additional already existing columns, that may be added to the LP in pricing
  *
@@ -1480,6 +1531,27 @@ SCIP_Real SCIPgetRowSolActivity(
    SCIP_SOL*             sol                 /**< primal CIP solution */
    );
 
+/** computes the activities of several rows for the given primal solution
+ *
+ *  Calling this method is equivalent to calling SCIPgetRowSolActivity() for each row, but if a primal solution is
+ *  given, the solution values of the columns are looked up only once for all rows.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre this method can be called in one of the following stages of the SCIP solving process:
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetRowsSolActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW**            rows,               /**< LP rows */
+   int                   nrows,              /**< number of LP rows */
+   SCIP_SOL*             sol,                /**< primal CIP solution, or NULL for current LP/pseudo solution */
+   SCIP_Real*            activities          /**< array to store the activities of the rows */
+   );
+
 /** returns the feasibility of a row for the given primal solution
  *
  *  @return the feasibility of a row for the given primal solution
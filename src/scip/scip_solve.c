@@ -112,6 +112,7 @@
 #include "scip/tree.h"
 #include "scip/var.h"
 #include "scip/visual.h"
+#include "tpi/tpi.h"
 
 /** calculates number of nonzeros in problem */
 static
@@ -1815,6 +1816,23 @@ SCIP_RETCODE freeReoptSolve(
    return SCIP_OKAY;
 }
 
+/** releases the reference to the shared thread pool of the task processing interface, see SCIPacquireTPI() */
+static
+SCIP_RETCODE releaseTPI(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   assert(scip != NULL);
+
+   if( scip->tpiacquired )
+   {
+      SCIP_CALL( SCIPtpiReleaseShared() );
+      scip->tpiacquired = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** free transformed problem */
 static
 SCIP_RETCODE freeTransform(
@@ -1979,6 +1997,8 @@ SCIP_RETCODE freeTransform(
    /* reset original variable's local and global bounds to their original values */
    SCIP_CALL( SCIPprobResetBounds(scip->origprob, scip->mem->probmem, scip->set, scip->stat) );
 
+   SCIP_CALL( releaseTPI(scip) );
+
    return SCIP_OKAY;
 }
 
@@ -2026,6 +2046,8 @@ SCIP_RETCODE freeTransforming(
    /* switch stage to PROBLEM */
    scip->set->stage = SCIP_STAGE_PROBLEM;
 
+   SCIP_CALL( releaseTPI(scip) );
+
    return SCIP_OKAY;
 }
 
@@ -2910,6 +2932,17 @@ SCIP_RETCODE SCIPsolveConcurrent(
          return SCIP_OKAY;
       }
 
+      /* the threads of the task processing interface are used by the concurrent solvers */
+      SCIP_CALL( releaseTPI(scip) );
+
+      /* another SCIP instance may still hold a reference to the shared thread pool */
+      if( SCIPtpiIsAvailable() )
+      {
+         SCIPwarningMessage(scip, "threads of the task processing interface are in use, doing sequential solve instead\n");
+         SCIP_CALL( SCIPfreeConcurrent(scip) );
+         return SCIPsolve(scip);
+      }
+
       nthreads = INT_MAX;
       /* substract the memory already used by the main SCIP and the estimated memory usage of external software */
       memorylimit = scip->set->limit_memory;
@@ -3019,6 +3052,36 @@ SCIP_RETCODE SCIPsolveConcurrent(
 #endif
 }
 
+/** makes the thread pool of the task processing interface available for parallel jobs of plugins
+ *
+ *  The thread pool is shared by all SCIP instances, including sub-SCIPs, and is created with parallel/maxnthreads
+ *  threads when it is first needed. SCIP holds its reference until the transformed problem is freed. No thread pool is
+ *  available if SCIP was compiled without task processing interface, if parallel/maxnthreads is 1, or during a
+ *  concurrent solve, whose threads are used by the concurrent solvers. Plugins should then run their jobs
+ *  sequentially.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ */
+SCIP_RETCODE SCIPacquireTPI(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Bool*            available           /**< pointer to store whether jobs can be submitted to the thread pool */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+   assert(available != NULL);
+
+   if( !scip->tpiacquired && scip->set->parallel_maxnthreads > 1 )
+   {
+      SCIP_CALL( SCIPtpiAcquireShared(scip->set->parallel_maxnthreads, &scip->tpiacquired) );
+   }
+
+   *available = scip->tpiacquired;
+
+   return SCIP_OKAY;
+}
+
 /** include specific heuristics and branching rules for reoptimization
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
@@ -193,6 +193,23 @@ SCIP_RETCODE SCIPsolveConcurrent(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** makes the thread pool of the task processing interface available for parallel jobs of plugins
+ *
+ *  The thread pool is shared by all SCIP instances, including sub-SCIPs, and is created with parallel/maxnthreads
+ *  threads when it is first needed. SCIP holds its reference until the transformed problem is freed. No thread pool is
+ *  available if SCIP was compiled without task processing interface, if parallel/maxnthreads is 1, or during a
+ *  concurrent solve, whose threads are used by the concurrent solvers. Plugins should then run their jobs
+ *  sequentially.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPacquireTPI(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Bool*            available           /**< pointer to store whether jobs can be submitted to the thread pool */
+   );
+
 /** frees branch and bound tree and all solution process data; statistics, presolving data and transformed problem is
  *  preserved
  *
@@ -2827,6 +2827,12 @@ void SCIPprintPropagatorStatistics(
 	 SCIPpropGetRespropTime(prop),
 	 SCIPpropGetStrongBranchPropTime(prop));
    }
+
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "Propagation Rounds :     Rounds       Time   PerRound\n");
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  total            : %10" SCIP_LONGINT_FORMAT " %10.2f %10.6f\n",
+      scip->stat->npropagationrounds,
+      SCIPclockGetTime(scip->stat->proproundtime),
+      scip->stat->npropagationrounds > 0 ? SCIPclockGetTime(scip->stat->proproundtime) / scip->stat->npropagationrounds : 0.0);
 }
 
 /** outputs conflict statistics
@@ -3203,6 +3209,7 @@ void SCIPprintHeuristicStatistics(
    FILE*                 file                /**< output file */
    )
 {
+   SCIP_Bool printedcacheheader;
    int ndivesets = 0;
    int i;
 
@@ -3246,6 +3253,35 @@ void SCIPprintHeuristicStatistics(
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  other solutions  :          -          -          - %10" SCIP_LONGINT_FORMAT "          -\n",
       scip->stat->nexternalsolsfound);
 
+   /* print statistics of heuristics that keep their sub-SCIP between calls */
+   printedcacheheader = FALSE;
+   for( i = 0; i < scip->set->nheurs; ++i )
+   {
+      SCIP_HEUR* heur = scip->set->heurs[i];
+      SCIP_Longint nmisses = SCIPheurGetNSubscipMisses(heur);
+      SCIP_Real savedtime;
+
+      if( nmisses == 0 )
+         continue;
+
+      if( !printedcacheheader )
+      {
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, "Sub-SCIP Cache     :       Hits     Misses   CopyTime  ResetTime  SavedTime\n");
+         printedcacheheader = TRUE;
+      }
+
+      /* a reuse saves the average copy time but costs the reset time */
+      savedtime = SCIPheurGetNSubscipHits(heur) * SCIPheurGetSubscipCopyTime(heur) / nmisses - SCIPheurGetSubscipResetTime(heur);
+
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %-17.17s: %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10.2f %10.2f %10.2f\n",
+         SCIPheurGetName(heur),
+         SCIPheurGetNSubscipHits(heur),
+         nmisses,
+         SCIPheurGetSubscipCopyTime(heur),
+         SCIPheurGetSubscipResetTime(heur),
+         savedtime);
+   }
+
    if ( ndivesets > 0 && scip->set->misc_showdivingstats )
    {
       int c;
@@ -3584,6 +3620,8 @@ void SCIPprintTreeStatistics(
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  delayed cutoffs  : %10" SCIP_LONGINT_FORMAT "\n", scip->stat->ndelayedcutoffs);
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  repropagations   : %10" SCIP_LONGINT_FORMAT " (%" SCIP_LONGINT_FORMAT " domain reductions, %" SCIP_LONGINT_FORMAT " cutoffs)\n",
       scip->stat->nreprops, scip->stat->nrepropboundchgs, scip->stat->nrepropcutoffs);
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  stored LP states : %10" SCIP_LONGINT_FORMAT " (%.1f bytes per state)\n",
+      scip->stat->nlpstates, scip->stat->nlpstates > 0 ? (SCIP_Real)scip->stat->lpstatebytes / (SCIP_Real)scip->stat->nlpstates : 0.0);
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  avg switch length: %10.2f\n",
       scip->stat->nnodes > 0
       ? (SCIP_Real)(scip->stat->nactivatednodes + scip->stat->ndeactivatednodes) / (SCIP_Real)scip->stat->nnodes : 0.0);
@@ -3960,6 +3998,36 @@ void SCIPprintRootStatistics(
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "%21s\n","-");
 }
 
+/** outputs the reading time, the number of read bytes, and the throughput of the readers that report the number of
+ *  bytes they read
+ */
+static
+void printReaderThroughput(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file                /**< output file */
+   )
+{
+   int r;
+
+   for( r = 0; r < scip->set->nreaders; ++r )
+   {
+      SCIP_READER* reader;
+      SCIP_Real nmbytes;
+      SCIP_Real time;
+
+      reader = scip->set->readers[r];
+
+      if( SCIPreaderGetNReadBytes(reader) == 0 )
+         continue;
+
+      nmbytes = (SCIP_Real) SCIPreaderGetNReadBytes(reader) / 1048576.0;
+      time = SCIPreaderGetReadingTime(reader);
+
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "    %-15.15s: %10.2f (%.1f MB, %.1f MB/s)\n", SCIPreaderGetName(reader),
+         time, nmbytes, nmbytes / MAX(time, 1e-6));
+   }
+}
+
 /** outputs timing statistics
  *
  *  @pre This method can be called if SCIP is in one of the following stages:
@@ -3990,6 +4058,7 @@ void SCIPprintTimingStatistics(
    {
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "Total Time         : %10.2f\n", readingtime);
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "  reading          : %10.2f\n", readingtime);
+      printReaderThroughput(scip, file);
    }
    else
    {
@@ -4007,6 +4076,7 @@ void SCIPprintTimingStatistics(
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "  solving          : %10.2f\n", solvingtime);
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "  presolving       : %10.2f (included in solving)\n", SCIPclockGetTime(scip->stat->presolvingtime));
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "  reading          : %10.2f%s\n", readingtime, scip->set->time_reading ? " (included in solving)" : "");
+      printReaderThroughput(scip, file);
 
       if( scip->stat->ncopies > 0 )
       {
@@ -4110,6 +4180,8 @@ void SCIPprintNLPIStatistics(
    {
       SCIP_Real solvetime;
       SCIP_Real evaltime = 0.0;
+      SCIP_Real jacevaltime = 0.0;
+      SCIP_Real hesevaltime = 0.0;
       SCIP_Longint niter;
       SCIP_NLPI* nlpi;
       int j;
@@ -4128,7 +4200,7 @@ void SCIPprintNLPIStatistics(
             " %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s"
             " %10s %10s %10s %10s %10s %10s %10s\n",
             "#Problems", "ProblemTi", "#Solves", "SolveTime",
-            scip->set->time_nlpieval ? "  EvalTime%" : "",
+            scip->set->time_nlpieval ? "  EvalTime%   JacTime%   HesTime%" : "",
             "#Iter", "Time/Iter",
             "#Okay", "#TimeLimit", "#IterLimit", "#LObjLimit", "#Interrupt", "#NumError", "#EvalError", "#OutOfMem", "#LicenseEr", "#OtherTerm",
             "#GlobOpt", "#LocOpt", "#Feasible", "#LocInfeas", "#GlobInfea", "#Unbounded", "#Unknown"
@@ -4138,7 +4210,11 @@ void SCIPprintNLPIStatistics(
 
       solvetime = SCIPnlpiGetSolveTime(nlpi);
       if( scip->set->time_nlpieval )
+      {
          evaltime = SCIPnlpiGetEvalTime(nlpi);
+         jacevaltime = SCIPnlpiGetJacobianEvalTime(nlpi);
+         hesevaltime = SCIPnlpiGetHessianEvalTime(nlpi);
+      }
       niter = SCIPnlpiGetNIterations(nlpi);
 
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %-17s:", SCIPnlpiGetName(nlpi));
@@ -4147,7 +4223,11 @@ void SCIPprintNLPIStatistics(
       SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10d", SCIPnlpiGetNSolves(nlpi));
       SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10.2f", solvetime);
       if( scip->set->time_nlpieval )
+      {
          SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10.2f", solvetime > 0.0 ? 100.0 * evaltime / solvetime : 0.0);
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10.2f", solvetime > 0.0 ? 100.0 * jacevaltime / solvetime : 0.0);
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10.2f", solvetime > 0.0 ? 100.0 * hesevaltime / solvetime : 0.0);
+      }
       SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10" SCIP_LONGINT_FORMAT, niter);
       SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10.2f", niter > 0 ? solvetime / niter : 0.0);
 
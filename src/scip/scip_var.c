@@ -7685,7 +7685,69 @@ SCIP_Bool SCIPhaveVarsCommonClique(
 #endif
 
    return (SCIPvarGetNCliques(var1, value1) + SCIPvarGetNCliques(var2, value2) > SCIPcliquetableGetNCliques(scip->cliquetable)
-      || SCIPvarsHaveCommonClique(var1, value1, var2, value2, regardimplics));
+      || SCIPcliquetableHaveCommonClique(scip->cliquetable, var1, value1, var2, value2)
+      || (regardimplics && SCIPvarHasImplic(var1, value1, var2, value2 ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER)));
+}
+
+/** stores for each of the given variable/value pairs whether there is a clique that contains it together with the given
+ *  variable/value pair; this is faster than calling SCIPhaveVarsCommonClique() for each pair;
+ *  the variables must be active binary variables;
+ *  if regardimplics is FALSE, only the cliques in the clique table are looked at;
+ *  if regardimplics is TRUE, both the cliques and the implications of the implication graph are regarded
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  @note a variable with it's negated variable are NOT! in a clique
+ *  @note a variable with itself are in a clique
+ */
+SCIP_RETCODE SCIPgetVarCommonCliques(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Bool             value,              /**< value of the variable */
+   SCIP_VAR**            vars,               /**< variables to check */
+   SCIP_Bool*            values,             /**< values of the variables to check */
+   int                   nvars,              /**< number of variables to check */
+   SCIP_Bool             regardimplics,      /**< should the implication graph also be searched for a clique? */
+   SCIP_Bool*            common              /**< array to store for each variable whether it has a common clique with
+                                              *   the given variable */
+   )
+{
+   int v;
+
+   assert(scip != NULL);
+   assert(var != NULL);
+   assert(SCIPvarIsActive(var));
+   assert(SCIPvarIsBinary(var));
+   assert(vars != NULL || nvars == 0);
+   assert(values != NULL || nvars == 0);
+   assert(common != NULL || nvars == 0);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPgetVarCommonCliques", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPcliquetableHaveCommonCliques(scip->cliquetable, scip->set, var, value, vars, values, nvars, common) );
+
+   if( regardimplics )
+   {
+      for( v = 0; v < nvars; ++v )
+      {
+         if( !common[v] )
+            common[v] = SCIPvarHasImplic(var, value, vars[v], values[v] ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER);
+      }
+   }
+
+   return SCIP_OKAY;
 }
 
 /** writes the clique graph to a gml file
@@ -2651,6 +2651,42 @@ SCIP_Bool SCIPhaveVarsCommonClique(
    SCIP_Bool             regardimplics       /**< should the implication graph also be searched for a clique? */
    );
 
+/** stores for each of the given variable/value pairs whether there is a clique that contains it together with the given
+ *  variable/value pair; this is faster than calling SCIPhaveVarsCommonClique() for each pair;
+ *  the variables must be active binary variables;
+ *  if regardimplics is FALSE, only the cliques in the clique table are looked at;
+ *  if regardimplics is TRUE, both the cliques and the implications of the implication graph are regarded
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  @note a variable with it's negated variable are NOT! in a clique
+ *  @note a variable with itself are in a clique
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetVarCommonCliques(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Bool             value,              /**< value of the variable */
+   SCIP_VAR**            vars,               /**< variables to check */
+   SCIP_Bool*            values,             /**< values of the variables to check */
+   int                   nvars,              /**< number of variables to check */
+   SCIP_Bool             regardimplics,      /**< should the implication graph also be searched for a clique? */
+   SCIP_Bool*            common              /**< array to store for each variable whether it has a common clique with
+                                              *   the given variable */
+   );
+
 /** writes the clique graph to a gml file
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
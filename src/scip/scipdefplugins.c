@@ -87,6 +87,7 @@ SCIP_RETCODE SCIPincludeDefaultPlugins(
    SCIP_CALL( SCIPincludeReaderCnf(scip) );
    SCIP_CALL( SCIPincludeReaderCip(scip) );
    SCIP_CALL( SCIPincludeReaderSmps(scip) );
+   SCIP_CALL( SCIPincludeReaderSnp(scip) );
    SCIP_CALL( SCIPincludeReaderSto(scip) );
    SCIP_CALL( SCIPincludeReaderTim(scip) );
    SCIP_CALL( SCIPincludeReaderCor(scip) );
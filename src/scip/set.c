@@ -265,11 +265,13 @@
 #define SCIP_DEFAULT_LP_SOLUTIONPOLISHING     3 /**< LP solution polishing method (0: disabled, 1: only root, 2: always, 3: auto) */
 #define SCIP_DEFAULT_LP_REFACTORINTERVAL      0 /**< LP refactorization interval (0: automatic) */
 #define SCIP_DEFAULT_LP_ALWAYSGETDUALS    FALSE /**< should the dual solution always be collected */
+#define SCIP_DEFAULT_LP_PACKSTATES        FALSE /**< should the LP states of fork nodes be stored as packed bases? */
 
 /* NLP */
 
 #define SCIP_DEFAULT_NLP_SOLVER              "" /**< name of NLP solver to use, or "" if solver should be chosen by priority */
 #define SCIP_DEFAULT_NLP_DISABLE          FALSE /**< should the NLP be always disabled? */
+#define SCIP_DEFAULT_NLP_EVALNTHREADS         1 /**< number of threads for evaluating Jacobians and Hessians in NLP solves */
 
 
 /* Memory */
@@ -337,6 +339,8 @@
 #define SCIP_DEFAULT_PRESOL_MAXROUNDS        -1 /**< maximal number of presolving rounds (-1: unlimited, 0: off) */
 #define SCIP_DEFAULT_PRESOL_MAXRESTARTS      -1 /**< maximal number of restarts (-1: unlimited) */
 #define SCIP_DEFAULT_PRESOL_CLQTABLEFAC     2.0 /**< limit on number of entries in clique table relative to number of problem nonzeros */
+#define SCIP_DEFAULT_PRESOL_CLQINDEXFAC     4.0 /**< limit on number of entries in adjacency index of clique table relative to
+                                                 *   number of entries in clique table (0.0: no index) */
 #define SCIP_DEFAULT_PRESOL_RESTARTFAC    0.025 /**< fraction of integer variables that were fixed in the root node
                                                  *   triggering a restart with preprocessing after root node evaluation */
 #define SCIP_DEFAULT_PRESOL_IMMRESTARTFAC  0.10 /**< fraction of integer variables that were fixed in the root node triggering an
@@ -421,6 +425,11 @@
 #define SCIP_DEFAULT_PROP_MAXROUNDSROOT    1000 /**< maximal number of propagation rounds in root node (-1: unlimited) */
 #define SCIP_DEFAULT_PROP_ABORTONCUTOFF    TRUE /**< should propagation be aborted immediately? setting this to FALSE could
                                                  *   help conflict analysis to produce more conflict constraints */
+#define SCIP_DEFAULT_PROP_WORKLIST        FALSE /**< should constraint handlers with a worklist only propagate their marked
+                                                 *   constraints and be skipped if none of them is marked? */
+#define SCIP_DEFAULT_PROP_SORTWORKLIST    FALSE /**< should the marked constraints be propagated in decreasing order of
+                                                 *   their number of markings since their last propagation (only with
+                                                 *   propagating/worklist)? */
 
 
 /* Separation */
@@ -458,6 +467,7 @@
 #define SCIP_DEFAULT_SEPA_CUTAGELIMIT        80 /**< maximum age a cut can reach before it is deleted from global cut pool
                                                  *   (-1: cuts are never deleted from the global cut pool) */
 #define SCIP_DEFAULT_SEPA_POOLFREQ           10 /**< separation frequency for the global cut pool */
+#define SCIP_DEFAULT_SEPA_POOLNTHREADS        1 /**< number of threads for computing the efficacies of the cut pools */
 #define SCIP_DEFAULT_SEPA_MINACTIVITYQUOT   0.8 /**< minimum cut activity quotient to convert cuts into constraints
                                                  *   during a restart (0.0: all cuts are converted) */
 
@@ -1883,6 +1893,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should the Farkas duals always be collected when an LP is found to be infeasible?",
          &(*set)->lp_alwaysgetduals, FALSE, SCIP_DEFAULT_LP_ALWAYSGETDUALS,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "lp/packstates",
+         "should the LP states of fork nodes be stored as bases with two bits per status, as changes against the basis of the parent fork if this needs less memory?",
+         &(*set)->lp_packstates, TRUE, SCIP_DEFAULT_LP_PACKSTATES,
+         NULL, NULL) );
 
    /* NLP parameters */
    SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
@@ -1895,6 +1910,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should the NLP relaxation be always disabled (also for NLPs/MINLPs)?",
          &(*set)->nlp_disable, FALSE, SCIP_DEFAULT_NLP_DISABLE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "nlp/evalnthreads",
+         "number of threads for evaluating the Jacobian and the Hessian of the Lagrangian in NLP solves (1: sequential)",
+         &(*set)->nlp_evalnthreads, TRUE, SCIP_DEFAULT_NLP_EVALNTHREADS, 1, 64,
+         NULL, NULL) );
 
    /* memory parameters */
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
@@ -2196,6 +2216,11 @@ SCIP_RETCODE SCIPsetCreate(
          "limit on number of entries in clique table relative to number of problem nonzeros",
          &(*set)->presol_clqtablefac, TRUE, SCIP_DEFAULT_PRESOL_CLQTABLEFAC, 0.0, SCIP_REAL_MAX,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "presolving/clqindexfac",
+         "limit on number of entries in the adjacency index for common clique queries relative to number of entries in clique table (0.0: no index)",
+         &(*set)->presol_clqindexfac, TRUE, SCIP_DEFAULT_PRESOL_CLQINDEXFAC, 0.0, SCIP_REAL_MAX,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "presolving/immrestartfac",
          "fraction of integer variables that were fixed in the root node triggering an immediate restart with preprocessing",
@@ -2304,6 +2329,16 @@ SCIP_RETCODE SCIPsetCreate(
          "should propagation be aborted immediately? setting this to FALSE could help conflict analysis to produce more conflict constraints",
          &(*set)->prop_abortoncutoff, FALSE, SCIP_DEFAULT_PROP_ABORTONCUTOFF,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "propagating/worklist",
+         "should constraint handlers with a worklist only propagate their marked constraints and be skipped if none of them is marked?",
+         &(*set)->prop_worklist, TRUE, SCIP_DEFAULT_PROP_WORKLIST,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "propagating/sortworklist",
+         "should the marked constraints be propagated in decreasing order of their number of markings since their last propagation (only with propagating/worklist)?",
+         &(*set)->prop_sortworklist, TRUE, SCIP_DEFAULT_PROP_SORTWORKLIST,
+         NULL, NULL) );
 
    /* reoptimization */
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
@@ -2547,6 +2582,11 @@ SCIP_RETCODE SCIPsetCreate(
          "separation frequency for the global cut pool (-1: disable global cut pool, 0: only separate pool at the root)",
          &(*set)->sepa_poolfreq, FALSE, SCIP_DEFAULT_SEPA_POOLFREQ, -1, SCIP_MAXTREEDEPTH,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "separating/poolnthreads",
+         "number of threads for computing the efficacies of the cuts in the cut pools w.r.t. the LP solution (1: sequential)",
+         &(*set)->sepa_poolnthreads, TRUE, SCIP_DEFAULT_SEPA_POOLNTHREADS, 1, 64,
+         NULL, NULL) );
 
    /* parallel parameters */
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
@@ -612,6 +612,9 @@ SCIP_RETCODE propagateDomains(
    while( propagain && !(*cutoff) && !(*postpone) && propround < maxproprounds && !SCIPsolveIsStopped(set, stat, FALSE) )
    {
       propround++;
+      stat->npropagationrounds++;
+
+      SCIPclockStart(stat->proproundtime, set);
 
       /* perform the propagation round by calling the propagators and constraint handlers */
       SCIP_CALL( propagationRound(blkmem, set, stat, tree, depth, fullpropagation, FALSE, &delayed, &propagain, timingmask, cutoff, postpone) );
@@ -623,6 +626,8 @@ SCIP_RETCODE propagateDomains(
          SCIP_CALL( propagationRound(blkmem, set, stat, tree, depth, fullpropagation, TRUE, &delayed, &propagain, timingmask, cutoff, postpone) );
       }
 
+      SCIPclockStop(stat->proproundtime, set);
+
       /* if a reduction was found, we want to do another full propagation round (even if the propagator only claimed
        * to have done a domain reduction without applying a domain change)
        */
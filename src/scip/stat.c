@@ -86,6 +86,7 @@ SCIP_RETCODE SCIPstatCreate(
    SCIP_CALL( SCIPclockCreate(&(*stat)->nlpsoltime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->copyclock, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->strongpropclock, SCIP_CLOCKTYPE_DEFAULT) );
+   SCIP_CALL( SCIPclockCreate(&(*stat)->proproundtime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->reoptupdatetime, SCIP_CLOCKTYPE_DEFAULT) );
 
    /* turn statistic timing on or off, depending on the user parameter */
@@ -139,6 +140,7 @@ SCIP_RETCODE SCIPstatFree(
    SCIPclockFree(&(*stat)->nlpsoltime);
    SCIPclockFree(&(*stat)->copyclock);
    SCIPclockFree(&(*stat)->strongpropclock);
+   SCIPclockFree(&(*stat)->proproundtime);
    SCIPclockFree(&(*stat)->reoptupdatetime);
 
    SCIPhistoryFree(&(*stat)->glbhistory, blkmem);
@@ -215,6 +217,7 @@ void SCIPstatReset(
    SCIPclockReset(stat->nlpsoltime);
    SCIPclockReset(stat->copyclock);
    SCIPclockReset(stat->strongpropclock);
+   SCIPclockReset(stat->proproundtime);
 
    SCIPhistoryReset(stat->glbhistory);
 
@@ -261,6 +264,7 @@ void SCIPstatReset(
    stat->nprobholechgs = 0;
    stat->nsbdowndomchgs = 0;
    stat->nsbupdomchgs = 0;
+   stat->npropagationrounds = 0;
    stat->nruns = 0;
    stat->nconfrestarts = 0;
    stat->nrootboundchgs = 0;
@@ -629,6 +633,8 @@ void SCIPstatResetCurrentRun(
    stat->ndeactivatednodes = 0;
    stat->nbacktracks = 0;
    stat->ndelayedcutoffs = 0;
+   stat->nlpstates = 0;
+   stat->lpstatebytes = 0;
    stat->nreprops = 0;
    stat->nrepropboundchgs = 0;
    stat->nrepropcutoffs = 0;
@@ -770,6 +776,7 @@ void SCIPstatEnableOrDisableStatClocks(
    SCIPclockEnableOrDisable(stat->nlpsoltime, enable);
    SCIPclockEnableOrDisable(stat->copyclock, enable);
    SCIPclockEnableOrDisable(stat->strongpropclock, enable);
+   SCIPclockEnableOrDisable(stat->proproundtime, enable);
 }
 
 /** recompute root LP best-estimate from scratch */
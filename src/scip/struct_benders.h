@@ -102,6 +102,9 @@ struct SCIP_Benders
    SCIP_Bool             threadsafe;         /**< has the copy been created requiring thread safety */
    SCIP_Real             solutiontol;        /**< storing the tolerance for optimality in Benders' decomposition */
    int                   numthreads;         /**< the number of threads to use when solving the subproblem */
+   SCIP_Real*            mastersolvals;      /**< values of the active master problem variables while the subproblems are
+                                              *   solved in parallel, or NULL */
+   int                   nmastersolvals;     /**< number of values in mastersolvals */
    SCIP_Bool             execfeasphase;      /**< should a feasibility phase be executed during the root node, i.e.
                                                   adding slack variables to constraints to ensure feasibility */
    SCIP_Real             slackvarcoef;       /**< the initial objective coefficient of the slack variables in the subproblem */
@@ -65,6 +65,8 @@ struct SCIP_Cons
    int                   activedepth;        /**< depth level of constraint activation (-2: inactive, -1: problem constraint) */
    int                   validdepth;         /**< depth level where constraint is valid (-1: equals activedepth) */
    int                   nuses;              /**< number of times, this constraint is referenced */
+   int                   npropmarks;         /**< number of times, the constraint was marked to be propagated since it was
+                                              *   last unmarked */
    unsigned int          initial:1;          /**< TRUE iff LP relaxation of constraint should be in initial LP, if possible */
    unsigned int          separate:1;         /**< TRUE iff constraint should be separated during LP processing */
    unsigned int          enforce:1;          /**< TRUE iff constraint should be enforced during node processing */
@@ -277,6 +279,8 @@ struct SCIP_Conshdlr
    SCIP_Bool             delaysepa;          /**< should separation method be delayed, if other separators found cuts? */
    SCIP_Bool             delayprop;          /**< should propagation method be delayed, if other propagators found reductions? */
    SCIP_Bool             needscons;          /**< should the constraint handler be skipped, if no constraints are available? */
+   SCIP_Bool             propworklist;       /**< does the propagation method only process constraints marked to be
+                                              *   propagated, such that it can be skipped if none is marked? */
    SCIP_Bool             sepalpwasdelayed;   /**< was the LP separation method delayed at the last call? */
    SCIP_Bool             sepasolwasdelayed;  /**< was the SOL separation method delayed at the last call? */
    SCIP_Bool             propwasdelayed;     /**< was the propagation method delayed at the last call? */
@@ -69,6 +69,24 @@ struct SCIP_Cutsel
    SCIP_Longint          nlocalcutsfiltered; /**< number of local cuts filtered */
 };
 
+/** column index of the cuts of a cut selection round
+ *
+ *  For every problem variable, the index stores the cuts that contain its column. The cuts are identified by their
+ *  position in the cuts array at creation of the index; the index follows the swaps of the cut selector.
+ */
+struct SCIP_CutselIndex
+{
+   int*                  colbeg;             /**< start of the cuts of each variable in colcuts (nvars + 1 entries) */
+   int*                  colcuts;            /**< cuts containing the columns of the variables */
+   int*                  cutpos;             /**< current position of each cut */
+   int*                  poscut;             /**< cut at each position */
+   int*                  marks;              /**< mark of each cut in the last candidate query */
+   int*                  cands;              /**< buffer for the positions of the candidates */
+   int                   ncuts;              /**< number of cuts */
+   int                   nvars;              /**< number of problem variables */
+   int                   curmark;            /**< mark of the current candidate query */
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -213,9 +213,18 @@ struct SCIP_Eventhdlr
    SCIP_DECL_EVENTEXITSOL((*eventexitsol));  /**< solving process deinitialization method of event handler */
    SCIP_DECL_EVENTDELETE ((*eventdelete));   /**< free specific event data */
    SCIP_DECL_EVENTEXEC   ((*eventexec));     /**< execute event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)); /**< batched execution method for local bound changes, or NULL */
    SCIP_EVENTHDLRDATA*   eventhdlrdata;      /**< event handler data */
    SCIP_CLOCK*           setuptime;          /**< time spend for setting up this event handler for the next stages */
    SCIP_CLOCK*           eventtime;          /**< time spend in this event handler execution method */
+   SCIP_VAR**            batchvars;          /**< variables of the collected bound changes */
+   SCIP_Real*            batcholdbounds;     /**< old bounds of the collected bound changes */
+   SCIP_Real*            batchnewbounds;     /**< new bounds of the collected bound changes */
+   SCIP_EVENTTYPE*       batcheventtypes;    /**< event types of the collected bound changes */
+   SCIP_EVENTDATA**      batcheventdatas;    /**< event data of the collected bound changes */
+   int                   batchsize;          /**< size of the batch arrays */
+   int                   nbatch;             /**< number of collected bound changes */
+   SCIP_Bool             batching;           /**< are bound changes currently collected instead of executed? */
    SCIP_Bool             initialized;        /**< is event handler initialized? */
 };
 
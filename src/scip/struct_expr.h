@@ -57,6 +57,7 @@ struct SCIP_Exprhdlr
    SCIP_DECL_EXPRPRINT((*print));            /**< print callback (can be NULL) */
    SCIP_DECL_EXPRPARSE((*parse));            /**< parse callback (can be NULL) */
    SCIP_DECL_EXPREVAL((*eval));              /**< point evaluation callback (can never be NULL) */
+   SCIP_DECL_EXPREVALBATCH((*evalbatch));    /**< batch evaluation callback (can be NULL) */
    SCIP_DECL_EXPRBWDIFF((*bwdiff));          /**< backward derivative evaluation callback (can be NULL) */
    SCIP_DECL_EXPRFWDIFF((*fwdiff));          /**< forward derivative evaluation callback (can be NULL) */
    SCIP_DECL_EXPRBWFWDIFF((*bwfwdiff));      /**< backward over forward derivative evaluation callback (can be NULL) */
@@ -143,6 +144,9 @@ struct SCIP_Expr
    /* view expression as quadratic */
    SCIP_QUADEXPR*        quaddata;            /**< representation of expression as a quadratic, if checked and being quadratic */
    SCIP_Bool             quadchecked;         /**< whether it has been checked whether the expression is quadratic */
+
+   /* evaluation in several points at once */
+   SCIP_EXPRBATCH*       batchdata;           /**< expression program and variable positions of the last batch evaluation, if any */
 };
 
 /** representation of an expression as quadratic */
@@ -225,4 +229,27 @@ struct SCIP_ExprIter
    unsigned int          stopstages;         /**< stages in which to interrupt iterator */
 };
 
+/** expression program */
+struct SCIP_ExprProg
+{
+   SCIP_EXPR**           exprs;              /**< subexpressions in topological order, root expression last */
+   int*                  childbegin;         /**< start of the children positions of each subexpression in childpos (length nexprs+1) */
+   int*                  childpos;           /**< positions of the children of all subexpressions in exprs */
+   int                   nexprs;             /**< number of subexpressions */
+};
+
+/** data for evaluating an expression in several points at once
+ *
+ * Stores the expression program of the expression and the positions of its variable expressions
+ * in the variables array given to the last batch evaluation.
+ */
+struct SCIP_ExprBatch
+{
+   SCIP_EXPRPROG*        prog;               /**< expression program of the expression */
+   int*                  varidx;             /**< position in vars of each variable expression of prog, -1 for other subexpressions */
+   SCIP_VAR**            vars;               /**< variables given to the last batch evaluation */
+   int                   nvars;              /**< number of variables in vars, -1 if varidx is not valid */
+   int                   varssize;           /**< length of vars array */
+};
+
 #endif /* SCIP_STRUCT_EXPR_H_ */
@@ -37,6 +37,8 @@
 #include "scip/def.h"
 #include "scip/type_clock.h"
 #include "scip/type_heur.h"
+#include "scip/type_scip.h"
+#include "scip/type_var.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,12 +95,30 @@ struct SCIP_Diveset
    SCIP_DECL_DIVESETAVAILABLE((*divesetavailable)); /**< callback to check availability of dive set at the current stage, or NULL if always available */
 };
 
+/** sub-SCIP of a large neighborhood search heuristic that is kept between calls of the heuristic
+ *
+ *  The sub-SCIP is a copy of the source problem without variable fixings; it is kept in problem stage between the
+ *  calls and the fixings and global bounds of a call are applied as changes of the original bounds.
+ */
+struct SCIP_SubscipCache
+{
+   SCIP*                 subscip;            /**< copy of the source problem, or NULL if no copy exists */
+   SCIP_VAR**            sourcevars;         /**< active variables of the source problem at the time of copying */
+   SCIP_VAR**            subvars;            /**< copies of the source variables in the sub-SCIP (entries may be NULL) */
+   int                   nvars;              /**< number of source variables */
+   int                   nruns;              /**< run of the source SCIP in which the copy was created */
+   SCIP_Bool             valid;              /**< was the copy valid? */
+   SCIP_Bool             inuse;              /**< is the sub-SCIP currently in use by the heuristic? */
+};
+
 /** primal heuristics data */
 struct SCIP_Heur
 {
    SCIP_Longint          ncalls;             /**< number of times, this heuristic was called */
    SCIP_Longint          nsolsfound;         /**< number of feasible primal solutions found so far by this heuristic */
    SCIP_Longint          nbestsolsfound;     /**< number of new best primal CIP solutions found so far by this heuristic */
+   SCIP_Longint          nsubsciphits;       /**< number of calls that reused the cached sub-SCIP of this heuristic */
+   SCIP_Longint          nsubscipmisses;     /**< number of calls that had to copy a new sub-SCIP for this heuristic */
    char*                 name;               /**< name of primal heuristic */
    char*                 desc;               /**< description of primal heuristic */
    SCIP_DECL_HEURCOPY    ((*heurcopy));      /**< copy method of primal heuristic or NULL if you don't want to copy your plugin into sub-SCIPs */
@@ -112,6 +132,9 @@ struct SCIP_Heur
    SCIP_DIVESET**        divesets;           /**< array of diving controllers of this heuristic */
    SCIP_CLOCK*           setuptime;          /**< time spend for setting up this heuristic for the next stages */
    SCIP_CLOCK*           heurclock;          /**< heuristic execution time */
+   SCIP_CLOCK*           subscipcopytime;    /**< time spent for copying the cached sub-SCIP */
+   SCIP_CLOCK*           subscipresettime;   /**< time spent for resetting the cached sub-SCIP for reuse */
+   SCIP_SUBSCIPCACHE*    subscipcache;       /**< cached sub-SCIP of a large neighborhood search, or NULL */
    int                   priority;           /**< priority of the primal heuristic */
    int                   freq;               /**< frequency for calling primal heuristic */
    int                   freqofs;            /**< frequency offset for calling primal heuristic */
@@ -100,7 +100,11 @@ struct SCIP_CliqueTable
    SCIP_HASHMAP*         varidxtable;        /**< mapping from binary variable to their corresponding node indices */
    SCIP_DISJOINTSET*     djset;              /**< disjoint set (union find) data structure to maintain component information */
    SCIP_CLIQUE**         cliques;            /**< cliques stored in the table */
+   int*                  adjbeg;             /**< start of the neighbors of each variable/value pair in adjlits, or NULL */
+   int*                  adjlits;            /**< sorted neighbors of each variable/value pair 2 * index + value in the clique graph */
    SCIP_Longint          nentries;           /**< number of entries in the whole clique table */
+   SCIP_Longint          nadjlits;           /**< number of entries of the adjacency index */
+   SCIP_Longint          adjqueryeffort;     /**< number of clique list entries looked at by queries without the adjacency index */
    int                   ncliques;           /**< number of cliques stored in the table */
    int                   size;               /**< size of cliques array */
    int                   ncreatedcliques;    /**< number of ever created cliques */
@@ -108,8 +112,10 @@ struct SCIP_CliqueTable
    int                   ncleanupaggrvars;   /**< number of aggregated variables when the last cleanup was performed */
    int                   ndirtycliques;      /**< number of cliques stored when the last cleanup was performed */
    int                   ncliquecomponents;  /**< number of connected components in clique graph */
+   int                   nadjlitidx;         /**< number of variable/value pairs in the adjacency index */
    SCIP_Bool             incleanup;          /**< is this clique table currently performing cleanup? */
    SCIP_Bool             compsfromscratch;   /**< must the connected components of the clique graph be recomputed from scratch? */
+   SCIP_Bool             adjvalid;           /**< is the adjacency index up to date with the cliques? */
 };
 
 #ifdef __cplusplus
@@ -76,6 +76,7 @@
 
 
 #include "scip/def.h"
+#include "scip/bitencode.h"
 #include "scip/type_lp.h"
 #include "scip/type_var.h"
 #include "scip/type_event.h"
@@ -125,6 +126,30 @@ struct SCIP_LpSolVals
    SCIP_Bool             lpissolved;         /**< is current LP solved? */
 };
 
+/** basis statuses of the columns and rows of the LP, stored with two bits per status
+ *
+ *  If the basis has a parent, the columns and rows of the parent are the first columns and rows of the basis. Only
+ *  the statuses of the remaining columns and rows are packed, and the statuses of the parent's columns and rows are
+ *  stored as the list of changes against the parent.
+ */
+struct SCIP_PackedBasis
+{
+   SCIP_PACKEDBASIS*     parent;             /**< basis the changes refer to, or NULL if all statuses are packed */
+   SCIP_DUALPACKET*      packed;             /**< packed statuses of the columns followed by the rows that are not in the parent */
+   int*                  changes;            /**< changes against the parent, stored as 4 * position + status, where the
+                                              *   positions of the rows start after the last column of the basis */
+   int                   ncols;              /**< number of columns of the basis */
+   int                   nrows;              /**< number of rows of the basis */
+   int                   npacked;            /**< number of packed statuses */
+   int                   nchanges;           /**< number of changes against the parent */
+   int                   depth;              /**< number of parents of the basis */
+   int                   nuses;              /**< number of times the basis is used, by its owner and its children */
+#ifndef NDEBUG
+   int*                  colidx;             /**< indices of the columns of the basis, to check that it fits the LP */
+   int*                  rowidx;             /**< indices of the rows of the basis, to check that it fits the LP */
+#endif
+};
+
 /** LP column;
  *  The row vector of the LP column is partitioned into two parts: The first col->nlprows rows in the rows array
  *  are the ones that belong to the current LP (col->rows[j]->lppos >= 0) and that are linked to the column
@@ -307,6 +332,12 @@ struct SCIP_Lp
    SCIP_SIDETYPE*        divechgsidetypes;   /**< stores the side type of the changes done in the current diving */
    SCIP_ROW**            divechgrows;        /**< stores the rows changed in the current diving */
    SCIP_LPSOLVALS*       storedsolvals;      /**< collected values of the LP data which depend on the LP solution */
+   int*                  matrowbeg;          /**< start of each row in the row-wise matrix snapshot (matnrows+1 entries) */
+   int*                  matrowind;          /**< LP positions of the columns in the row-wise matrix snapshot */
+   SCIP_Real*            matrowval;          /**< coefficients of the row-wise matrix snapshot */
+   int*                  matcolbeg;          /**< start of each column in the column-wise matrix snapshot (ncols+1 entries) */
+   int*                  matcolind;          /**< LP positions of the rows in the column-wise matrix snapshot */
+   SCIP_Real*            matcolval;          /**< coefficients of the column-wise matrix snapshot */
    SCIP_SOL*             validsoldirsol;     /**< primal solution for which the currently stored solution direction vector is valid */
    SCIP_Longint          validsollp;         /**< LP number for which the currently stored solution values are valid */
    SCIP_Longint          validfarkaslp;      /**< LP number for which the currently stored Farkas row multipliers are valid */
@@ -341,6 +372,12 @@ struct SCIP_Lp
    int                   ndivingrows;        /**< number of rows when entering diving mode */
    int                   ndivechgsides;      /**< number of side changes in current diving */
    int                   divechgsidessize;   /**< size of the arrays */
+   int                   matrowbegsize;      /**< available slots in matrowbeg vector */
+   int                   matrownnonzsize;    /**< available slots in matrowind and matrowval vectors */
+   int                   matcolbegsize;      /**< available slots in matcolbeg vector */
+   int                   matcolnnonzsize;    /**< available slots in matcolind and matcolval vectors */
+   int                   matnrows;           /**< number of leading LP rows stored in the row-wise matrix snapshot,
+                                              *   or -1 if the snapshot is invalid */
    int                   divinglpiitlim;     /**< LPI iteration limit when entering diving mode */
    int                   lpiitlim;           /**< current iteration limit setting in LPI */
    int                   lpifastmip;         /**< current FASTMIP setting in LPI */
@@ -363,6 +400,7 @@ struct SCIP_Lp
    SCIP_Bool             flushdeletedrows;   /**< have LPI-rows been deleted in the last lpFlush() call? */
    SCIP_Bool             flushaddedrows;     /**< have LPI-rows been added in the last lpFlush() call? */
    SCIP_Bool             updateintegrality;  /**< does integrality information need to be updated? */
+   SCIP_Bool             matcolsvalid;       /**< is the column-wise matrix snapshot up to date? */
    SCIP_Bool             flushed;            /**< are all cached changes applied to the LP solver? */
    SCIP_Bool             solved;             /**< is current LP solved? */
    SCIP_Bool             primalfeasible;     /**< is current LP solution (rather LPI state) primal feasible? */
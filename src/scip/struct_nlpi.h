@@ -78,6 +78,8 @@ struct SCIP_Nlpi
    SCIP_CLOCK*                     problemtime;                 /**< time spend in problem setup and modification */
    SCIP_Real                       solvetime;                   /**< time spend in solve as reported by solver */
    SCIP_Real                       evaltime;                    /**< time spend in function evaluation during solve */
+   SCIP_Real                       jacevaltime;                 /**< time spend in Jacobian evaluation during solve */
+   SCIP_Real                       hesevaltime;                 /**< time spend in evaluation of the Hessian of the Lagrangian during solve */
    SCIP_Longint                    niter;                       /**< total number of iterations */
    int                             ntermstat[SCIP_NLPTERMSTAT_OTHER+1]; /**< number of times a specific termination status occurred */
    int                             nsolstat[SCIP_NLPSOLSTAT_UNKNOWN+1]; /**< number of times a specific solution status occurred */
@@ -53,6 +53,7 @@ struct SCIP_Reader
    SCIP_DECL_READERWRITE ((*readerwrite));   /**< write method */
    SCIP_READERDATA*      readerdata;         /**< reader data */
    SCIP_CLOCK*           readingtime;        /**< time used for reading of this reader */
+   SCIP_Longint          nreadbytes;         /**< number of bytes read by this reader, if it reports them */
 };
 
 #ifdef __cplusplus
@@ -109,6 +109,8 @@ struct Scip
    /* PARALLEL */
    SCIP_SYNCSTORE*       syncstore;          /**< the data structure for storing synchronization information */
    SCIP_CONCURRENT*      concurrent;         /**< data required for concurrent solve */
+   SCIP_Bool             tpiacquired;        /**< does SCIP hold a reference to the shared thread pool of the task
+                                              *   processing interface, see SCIPacquireTPI()? */
 };
 
 #ifdef __cplusplus
@@ -373,10 +373,12 @@ struct SCIP_Set
    int                   lp_solutionpolishing;/**< LP solution polishing method (0: disabled, 1: only root, 2: always, 3: auto) */
    int                   lp_refactorinterval;/**< LP refactorization interval (0: automatic) */
    SCIP_Bool             lp_alwaysgetduals;  /**< should the dual solution always be collected for LP solutions. */
+   SCIP_Bool             lp_packstates;      /**< should the LP states of fork nodes be stored as packed bases? */
 
    /* NLP settings */
    SCIP_Bool             nlp_disable;        /**< should the NLP be disabled even if a constraint handler enabled it? */
    char*                 nlp_solver;         /**< name of NLP solver to use */
+   int                   nlp_evalnthreads;   /**< number of threads for evaluating Jacobians and Hessians in NLP solves (1: sequential) */
 
    /* memory settings */
    SCIP_Real             mem_savefac;        /**< fraction of maximal memory usage resulting in switch to memory saving mode */
@@ -453,6 +455,8 @@ struct SCIP_Set
    int                   presol_maxrounds;   /**< maximal number of presolving rounds (-1: unlimited) */
    int                   presol_maxrestarts; /**< maximal number of restarts (-1: unlimited) */
    SCIP_Real             presol_clqtablefac; /**< limit on number of entries in clique table relative to number of problem nonzeros */
+   SCIP_Real             presol_clqindexfac; /**< limit on number of entries in adjacency index of clique table relative to
+                                              *   number of entries in clique table (0.0: no index) */
    SCIP_Real             presol_restartfac;  /**< fraction of integer variables that were fixed in the root node
                                               *   triggering a restart with preprocessing after root node evaluation */
    SCIP_Real             presol_immrestartfac;/**< fraction of integer variables that were fixed in the root node triggering an
@@ -490,6 +494,11 @@ struct SCIP_Set
    int                   prop_maxroundsroot; /**< maximal number of propagation rounds in the root node (-1: unlimited) */
    SCIP_Bool             prop_abortoncutoff; /**< should propagation be aborted immediately? setting this to FALSE could
                                               *   help conflict analysis to produce more conflict constraints */
+   SCIP_Bool             prop_worklist;      /**< should constraint handlers with a worklist only propagate their marked
+                                              *   constraints and be skipped if none of them is marked? */
+   SCIP_Bool             prop_sortworklist;  /**< should the marked constraints be propagated in decreasing order of their
+                                              *   number of markings since their last propagation (only with
+                                              *   propagating/worklist)? */
 
    /* reoptimization settings */
    SCIP_Real             reopt_objsimsol;    /**< similarity of two objective functions to reuse stored solutions. */
@@ -571,6 +580,7 @@ struct SCIP_Set
    int                   sepa_maxcutsroot;   /**< maximal number of separated cuts at the root node */
    int                   sepa_cutagelimit;   /**< maximum age a cut can reach before it is deleted from the global cut pool */
    int                   sepa_poolfreq;      /**< separation frequency for the global cut pool */
+   int                   sepa_poolnthreads;  /**< number of threads for computing the efficacies of the cut pools (1: sequential) */
 
    /* parallel settings */
    int                   parallel_mode;      /**< the mode for the parallel implementation. 0: opportunistic or
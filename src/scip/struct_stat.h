@@ -95,9 +95,12 @@ struct SCIP_Stat
    SCIP_Longint          nnodesaboverefbound;/**< counter for the number of focus nodes exceeding the reference bound */
    SCIP_Longint          nbacktracks;        /**< number of times, the new node was chosen from the leaves queue */
    SCIP_Longint          ndelayedcutoffs;    /**< number of times, the selected node was from a cut off subtree */
+   SCIP_Longint          nlpstates;          /**< number of LP states stored at fork nodes in current run */
+   SCIP_Longint          lpstatebytes;       /**< number of bytes of the LP states stored at fork nodes in current run */
    SCIP_Longint          nreprops;           /**< number of times, a solved node is repropagated again */
    SCIP_Longint          nrepropboundchgs;   /**< number of bound changes generated in repropagating nodes */
    SCIP_Longint          nrepropcutoffs;     /**< number of times, a repropagated node was cut off */
+   SCIP_Longint          npropagationrounds; /**< number of domain propagation rounds */
    SCIP_Longint          nlpsolsfound;       /**< number of CIP-feasible LP solutions found so far */
    SCIP_Longint          nrelaxsolsfound;    /**< number of CIP-feasible relaxation solutions found so far */
    SCIP_Longint          npssolsfound;       /**< number of CIP-feasible pseudo solutions found so far */
@@ -177,6 +180,7 @@ struct SCIP_Stat
    SCIP_CLOCK*           nlpsoltime;         /**< time needed for solving NLPs */
    SCIP_CLOCK*           copyclock;          /**< time needed for copying problems */
    SCIP_CLOCK*           strongpropclock;    /**< time needed for propagation during strong branching */
+   SCIP_CLOCK*           proproundtime;      /**< time needed for domain propagation rounds */
    SCIP_CLOCK*           reoptupdatetime;    /**< time needed for storing and recreating nodes and solutions for reoptimization */
    SCIP_HISTORY*         glbhistory;         /**< global history information over all variables */
    SCIP_HISTORY*         glbhistorycrun;     /**< global history information over all variables for current run */
@@ -108,7 +108,8 @@ struct SCIP_Fork
 {
    SCIP_COL**            addedcols;          /**< array with pointers to new columns added at this node into the LP */
    SCIP_ROW**            addedrows;          /**< array with pointers to new rows added at this node into the LP */
-   SCIP_LPISTATE*        lpistate;           /**< LP state information */
+   SCIP_LPISTATE*        lpistate;           /**< LP state information, or NULL if the state is stored as packed basis */
+   SCIP_PACKEDBASIS*     packedbasis;        /**< LP basis stored with two bits per status, or NULL */
    SCIP_Real             lpobjval;           /**< the LP objective value for that node, needed to compute the pseudo costs correctly */
    int                   naddedcols;         /**< number of columns added at this node */
    int                   naddedrows;         /**< number of rows added at this node */
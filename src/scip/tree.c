@@ -196,6 +196,8 @@ SCIP_RETCODE forkReleaseLPIState(
    if( fork->nlpistateref == 0 )
    {
       SCIP_CALL( SCIPlpFreeState(lp, blkmem, &(fork->lpistate)) );
+      if( fork->packedbasis != NULL )
+         SCIPpackedbasisRelease(&fork->packedbasis, blkmem);
    }
 
    SCIPdebugMessage("released LPI state of fork %p -> new nlpistateref=%d\n", (void*)fork, fork->nlpistateref);
@@ -527,6 +529,7 @@ SCIP_RETCODE forkCreate(
    SCIP_FORK**           fork,               /**< pointer to fork data */
    BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
    SCIP_PROB*            prob,               /**< transformed problem after presolve */
    SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_LP*              lp                  /**< current LP data */
@@ -546,7 +549,37 @@ SCIP_RETCODE forkCreate(
 
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, fork) );
 
-   SCIP_CALL( SCIPlpGetState(lp, blkmem, &((*fork)->lpistate)) );
+   (*fork)->lpistate = NULL;
+   (*fork)->packedbasis = NULL;
+
+   /* store the basis packed, as changes against the basis of the LP state fork of the focus node if possible */
+   if( set->lp_packstates )
+   {
+      SCIP_PACKEDBASIS* parentbasis;
+
+      parentbasis = NULL;
+      if( tree->focuslpstatefork != NULL && SCIPnodeGetType(tree->focuslpstatefork) == SCIP_NODETYPE_FORK )
+         parentbasis = tree->focuslpstatefork->data.fork->packedbasis;
+
+      SCIP_CALL( SCIPlpGetPackedBasis(lp, blkmem, set, parentbasis, &(*fork)->packedbasis) );
+   }
+
+   if( (*fork)->packedbasis != NULL )
+   {
+      ++stat->nlpstates;
+      stat->lpstatebytes += SCIPpackedbasisGetMemSize((*fork)->packedbasis);
+   }
+   else
+   {
+      SCIP_CALL( SCIPlpGetState(lp, blkmem, &((*fork)->lpistate)) );
+
+      if( (*fork)->lpistate != NULL )
+      {
+         ++stat->nlpstates;
+         stat->lpstatebytes += SCIPlpGetStateSize(lp, (*fork)->lpistate);
+      }
+   }
+
    (*fork)->lpwasprimfeas = lp->primalfeasible;
    (*fork)->lpwasprimchecked = lp->primalchecked;
    (*fork)->lpwasdualfeas = lp->dualfeasible;
@@ -600,6 +633,7 @@ SCIP_RETCODE forkFree(
    assert((*fork)->nchildren == 0);
    assert((*fork)->nlpistateref == 0);
    assert((*fork)->lpistate == NULL);
+   assert((*fork)->packedbasis == NULL);
    assert(blkmem != NULL);
    assert(set != NULL);
    assert(lp != NULL);
@@ -3641,9 +3675,18 @@ SCIP_RETCODE SCIPtreeLoadLPState(
       if( SCIPnodeGetType(lpstatefork) == SCIP_NODETYPE_FORK )
       {
          assert(lpstatefork->data.fork != NULL);
-         SCIP_CALL( SCIPlpSetState(lp, blkmem, set, prob, eventqueue, lpstatefork->data.fork->lpistate,
-               lpstatefork->data.fork->lpwasprimfeas, lpstatefork->data.fork->lpwasprimchecked,
-               lpstatefork->data.fork->lpwasdualfeas, lpstatefork->data.fork->lpwasdualchecked) );
+         if( lpstatefork->data.fork->packedbasis != NULL )
+         {
+            SCIP_CALL( SCIPlpSetPackedBasis(lp, blkmem, set, prob, eventqueue, lpstatefork->data.fork->packedbasis,
+                  lpstatefork->data.fork->lpwasprimfeas, lpstatefork->data.fork->lpwasprimchecked,
+                  lpstatefork->data.fork->lpwasdualfeas, lpstatefork->data.fork->lpwasdualchecked) );
+         }
+         else
+         {
+            SCIP_CALL( SCIPlpSetState(lp, blkmem, set, prob, eventqueue, lpstatefork->data.fork->lpistate,
+                  lpstatefork->data.fork->lpwasprimfeas, lpstatefork->data.fork->lpwasprimchecked,
+                  lpstatefork->data.fork->lpwasdualfeas, lpstatefork->data.fork->lpwasdualchecked) );
+         }
       }
       else
       {
@@ -4133,7 +4176,7 @@ SCIP_RETCODE focusnodeToFork(
    assert(lp->solved);
 
    /* create fork data */
-   SCIP_CALL( forkCreate(&fork, blkmem, set, transprob, tree, lp) );
+   SCIP_CALL( forkCreate(&fork, blkmem, set, stat, transprob, tree, lp) );
 
    tree->focusnode->nodetype = SCIP_NODETYPE_FORK; /*lint !e641*/
    tree->focusnode->data.fork = fork;
@@ -51,6 +51,7 @@ extern "C" {
 
 typedef struct SCIP_Cutsel SCIP_CUTSEL;         /**< cut selector data structure */
 typedef struct SCIP_CutselData SCIP_CUTSELDATA; /**< cut selector specific data */
+typedef struct SCIP_CutselIndex SCIP_CUTSELINDEX; /**< column index of cuts to find the cuts that may be parallel to a cut */
 
 
 /** copy method for cut selector plugins (called when SCIP copies plugins)
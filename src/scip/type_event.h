@@ -46,6 +46,7 @@
 #include "scip/def.h"
 #include "scip/type_retcode.h"
 #include "scip/type_scip.h"
+#include "scip/type_var.h"
 
 #if !defined(_MSC_VER) || _MSC_VER > 1600
 #ifdef __cplusplus
@@ -252,6 +253,31 @@ typedef struct SCIP_EventQueue SCIP_EVENTQUEUE;   /**< event queue to cache even
  */
 #define SCIP_DECL_EVENTEXEC(x) SCIP_RETCODE x (SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT* event, SCIP_EVENTDATA* eventdata)
 
+/** batched execution method of event handler for local bound changes
+ *
+ *  If an event handler has this method, the local bound change events (SCIP_EVENTTYPE_BOUNDCHANGED) that it catches
+ *  are not passed to the execution method one by one while the delayed event queue is processed, e.g., when switching
+ *  to another node. Instead, they are collected and passed to this method once at the end of the processing round,
+ *  in the order in which they were processed. The event queue merges all changes of the same bound of a variable
+ *  within a round, so a bound appears at most once per round unless it is changed again during event processing.
+ *  All other events, and bound change events that are processed immediately, are passed to the execution method.
+ *
+ *  The method must not drop events of the event handler. Events that are dropped before the end of the round are
+ *  removed from the batch.
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - eventhdlr       : the event handler itself
+ *  - vars            : variables whose bounds changed
+ *  - oldbounds       : old bounds of the variables
+ *  - newbounds       : new bounds of the variables
+ *  - eventtypes      : types of the bound changes
+ *  - eventdatas      : user data of the events
+ *  - nevents         : number of bound changes
+ */
+#define SCIP_DECL_EVENTEXECBATCH(x) SCIP_RETCODE x (SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_VAR** vars, \
+      SCIP_Real* oldbounds, SCIP_Real* newbounds, SCIP_EVENTTYPE* eventtypes, SCIP_EVENTDATA** eventdatas, int nevents)
+
 #ifdef __cplusplus
 }
 #endif
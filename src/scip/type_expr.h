@@ -429,6 +429,29 @@ typedef struct SCIP_ExprhdlrData SCIP_EXPRHDLRDATA; /**< expression handler data
    SCIP_Real* val,  \
    SCIP_SOL*  sol)
 
+/** expression batch evaluation callback
+ *
+ * The method evaluates an expression in several points at once by taking the values of its children in these points
+ * into account. It is optional: if not implemented, the expression is evaluated point by point via the point
+ * evaluation callback.
+ *
+ * The value of the i-th child in the k-th point is given by childrenvals[i][k].
+ * For points where the expression cannot be evaluated (e.g., due to a domain error), SCIP_INVALID should be stored.
+ * Points where a child has value SCIP_INVALID are disregarded, i.e., their value is set to SCIP_INVALID afterwards.
+ *
+ *  \param[in] scip SCIP main data structure
+ *  \param[in] expr expression to be evaluated
+ *  \param[in] npoints number of points
+ *  \param[in] childrenvals values of children in all points
+ *  \param[out] vals buffer where to store the values of the expression in all points
+ */
+#define SCIP_DECL_EXPREVALBATCH(x) SCIP_RETCODE x (\
+   SCIP*       scip,         \
+   SCIP_EXPR*  expr,         \
+   int         npoints,      \
+   SCIP_Real** childrenvals, \
+   SCIP_Real*  vals)
+
 /** backward derivative evaluation callback
  *
  * The method should compute the partial derivative of expr w.r.t. its child at childidx.
@@ -721,6 +744,20 @@ typedef struct SCIP_ExprIter     SCIP_EXPRITER;      /**< expression iterator */
 
 /** @} */  /* expression iterator */
 
+/** @name Expression programs
+ *
+ * An expression program lists all subexpressions of an expression in topological order, that is,
+ * each subexpression appears exactly once and after all its children, with the expression itself last.
+ * This allows to evaluate an expression, its gradient, or its activity by a single loop over the program
+ * instead of a walk with an expression iterator.
+ * @{
+ */
+
+typedef struct SCIP_ExprProg     SCIP_EXPRPROG;      /**< expression program */
+typedef struct SCIP_ExprBatch    SCIP_EXPRBATCH;     /**< data for evaluating an expression in several points at once */
+
+/** @} */  /* expression programs */
+
 /** @name Expression printing
  * @{
  */
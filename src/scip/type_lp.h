@@ -90,6 +90,7 @@ typedef enum SCIP_LPAlgo SCIP_LPALGO;
 typedef struct SCIP_ColSolVals SCIP_COLSOLVALS;   /**< collected values of a column which depend on the LP solution */
 typedef struct SCIP_RowSolVals SCIP_ROWSOLVALS;   /**< collected values of a row which depend on the LP solution */
 typedef struct SCIP_LpSolVals SCIP_LPSOLVALS;     /**< collected values of the LP data which depend on the LP solution */
+typedef struct SCIP_PackedBasis SCIP_PACKEDBASIS; /**< basis statuses of the LP stored with two bits each, possibly as changes against another basis */
 
 /** column of an LP
  *
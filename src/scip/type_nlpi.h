@@ -199,6 +199,8 @@ struct SCIP_NlpStatistics
    int                   niterations;        /**< number of iterations the NLP solver spend in the last solve command */
    SCIP_Real             totaltime;          /**< total time in CPU sections the NLP solver spend in the last solve command */
    SCIP_Real             evaltime;           /**< time spend in evaluation of functions and their derivatives (only measured if timing/nlpieval = TRUE) */
+   SCIP_Real             jacevaltime;        /**< part of evaltime spend in evaluation of the Jacobian */
+   SCIP_Real             hesevaltime;        /**< part of evaltime spend in evaluation of the Hessian of the Lagrangian */
 
    SCIP_Real             consviol;           /**< maximal absolute constraint violation in current solution, or SCIP_INVALID if not available */
    SCIP_Real             boundviol;          /**< maximal absolute variable bound violation in current solution, or SCIP_INVALID if not available */
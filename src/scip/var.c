@@ -11310,6 +11310,7 @@ SCIP_RETCODE SCIPvarAddClique(
 
       /* add variable to clique */
       SCIP_CALL( SCIPcliqueAddVar(clique, blkmem, set, var, value, &doubleentry, &oppositeentry) );
+      SCIPcliquetableInvalidateAdjacency(cliquetable);
 
       /* add clique to variable's clique list */
       SCIP_CALL( SCIPcliquelistAdd(&var->cliquelist, blkmem, set, value, clique) );
@@ -66,6 +66,8 @@ SCIP_EXPORT
 SCIP_RETCODE SYMcomputeSymmetryGenerators(
    SCIP*                 scip,               /**< SCIP pointer */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the symmetry code; the generators found
+                                              *   until the limit is reached are returned */
    SYM_GRAPH*            graph,              /**< symmetry detection graph */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
@@ -64,6 +64,7 @@ struct BLISS_Data
    int**                 perms;              /**< permutation generators as (nperms x npermvars) matrix */
    int                   nmaxperms;          /**< maximal number of permutations */
    int                   maxgenerators;      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             endtime;            /**< solving time at which the search for generators is stopped */
    SCIP_Bool             restricttovars;     /**< whether permutations shall be restricted to variables */
 };
 
@@ -86,6 +87,10 @@ void blisshook(
    if ( data->maxgenerators != 0 && data->nperms >= data->maxgenerators )
       return;
 
+   /* ignore further generators once the time limit is reached */
+   if ( SCIPgetSolvingTime(data->scip) >= data->endtime )
+      return;
+
    /* copy first part of automorphism */
    bool isIdentity = true;
    int* p = 0;
@@ -300,6 +305,7 @@ SCIP_RETCODE computeAutomorphisms(
    bliss::Graph*         G,                  /**< pointer to graph for that automorphisms are computed */
    int                   nsymvars,           /**< number of variables encoded in graph */
    int                   maxgenerators,      /**< maximum number of generators to be constructed (=0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the search */
    int***                perms,              /**< pointer to store generators as (nperms x npermvars) matrix */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations
@@ -346,15 +352,17 @@ SCIP_RETCODE computeAutomorphisms(
    G->set_component_recursion(false);
 
    oldtime = SCIPgetSolvingTime(scip);
+   data.endtime = SCIPisInfinity(scip, timelimit) ? SCIPinfinity(scip) : oldtime + timelimit;
 #if BLISS_VERSION_MAJOR >= 1 || BLISS_VERSION_MINOR >= 76
    /* lambda function to have access to data and pass it to the blisshook above */
    auto reportglue = [&](unsigned int n, const unsigned int* aut) {
       blisshook((void*)&data, n, aut);
    };
 
-   /* lambda function to have access to data and terminate the search if maxgenerators are reached */
+   /* lambda function to have access to data and terminate the search if maxgenerators or the time limit are reached */
    auto term = [&]() {
-      return (maxgenerators != 0 && data.nperms >= maxgenerators); /* check the number of generators that we have created so far */
+      /* check the number of generators that we have created so far */
+      return (maxgenerators != 0 && data.nperms >= maxgenerators) || SCIPgetSolvingTime(scip) >= data.endtime;
    };
 
    /* start search */
@@ -405,6 +413,7 @@ SCIP_RETCODE computeAutomorphisms(
 SCIP_RETCODE SYMcomputeSymmetryGenerators(
    SCIP*                 scip,               /**< SCIP pointer */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the symmetry code */
    SYM_GRAPH*            graph,              /**< symmetry detection graph */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations
@@ -617,7 +626,7 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    SCIPdebugMsg(scip, "Symmetry detection graph has %d nodes and %d edges.\n", nnodes, nedges);
 
    /* compute automorphisms */
-   SCIP_CALL( computeAutomorphisms(scip, symtype, &G, nsymvars, maxgenerators,
+   SCIP_CALL( computeAutomorphisms(scip, symtype, &G, nsymvars, maxgenerators, timelimit,
          perms, nperms, nmaxperms, log10groupsize, TRUE, symcodetime) );
 
    return SCIP_OKAY;
@@ -800,7 +809,7 @@ SCIP_Bool SYMcheckGraphsAreIdentical(
    int nnodesfromG1 = nusedvars + G1->nnodes;
    SCIP_Real symcodetime = 0.0;
 
-   SCIP_CALL_ABORT( computeAutomorphisms(scip, symtype, &G, n, 0,
+   SCIP_CALL_ABORT( computeAutomorphisms(scip, symtype, &G, n, 0, SCIPinfinity(scip),
          &perms, &nperms, &nmaxperms, &log10groupsize, FALSE, &symcodetime) );
 
    /* since G1 and G2 are connected and disjoint, they are isomorphic iff there is a permutation
@@ -71,6 +71,7 @@ struct NAUTY_Data
    int**                 perms;              /**< permutation generators as (nperms x npermvars) matrix */
    int                   nmaxperms;          /**< maximal number of permutations */
    int                   maxgenerators;      /**< maximal number of generators to be constructed (= 0 if unlimited) */
+   SCIP_Real             endtime;            /**< solving time at which the search for generators is stopped */
    SCIP_Bool             restricttovars;     /**< whether permutations shall be restricted to variables */
 };
 
@@ -98,8 +99,9 @@ void nautyhook(
 
    assert( p != NULL );
 
-   /* make sure we do not generate more than maxgenerators many permutations */
-   if ( data_.maxgenerators != 0 && data_.nperms >= data_.maxgenerators )
+   /* make sure we do not generate more than maxgenerators many permutations and respect the time limit */
+   if ( (data_.maxgenerators != 0 && data_.nperms >= data_.maxgenerators)
+      || SCIPgetSolvingTime(data_.scip) >= data_.endtime )
    {
       /* request a kill from nauty */
       nauty_kill_request = 1;
@@ -158,6 +160,29 @@ void nautyhook(
    data_.perms[data_.nperms++] = pp;
 }
 
+/** callback function for nauty, which is called at every node of the search tree and stops the search at the time
+ *  limit, also if no further generators are found
+ */  /*lint -e{715}*/
+static
+void nautynodehook(
+   graph*                g,                  /**< graph */
+   int*                  lab,                /**< labelling of the current node */
+   int*                  ptn,                /**< partition of the current node */
+   int                   level,              /**< level of the current node */
+   int                   numcells,           /**< number of cells of the partition */
+   int                   tc,                 /**< index of the target cell */
+   int                   code,               /**< code produced by the refinement */
+   int                   m,                  /**< number of setwords per row of the graph */
+   int                   n                   /**< number of nodes in the graph */
+   )
+{  /* lint --e{715} */
+   if ( SCIPgetSolvingTime(data_.scip) >= data_.endtime )
+   {
+      /* request a kill from nauty */
+      nauty_kill_request = 1;
+   }
+}
+
 #else
 
 /** callback function for traces */
@@ -175,8 +200,9 @@ void traceshook(
 
    assert( p != NULL );
 
-   /* make sure we do not generate more than maxgenerators many permutations */
-   if ( data_.maxgenerators != 0 && data_.nperms >= data_.maxgenerators )
+   /* make sure we do not generate more than maxgenerators many permutations and respect the time limit */
+   if ( (data_.maxgenerators != 0 && data_.nperms >= data_.maxgenerators)
+      || SCIPgetSolvingTime(data_.scip) >= data_.endtime )
    {
       /* request a kill from traces */
       nauty_kill_request = 1;
@@ -1185,6 +1211,7 @@ const char* SYMsymmetryGetAddDesc(void)
 SCIP_RETCODE SYMcomputeSymmetryGenerators(
    SCIP*                 scip,               /**< SCIP pointer */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the symmetry code */
    SYM_GRAPH*            symgraph,           /**< symmetry detection graph */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
@@ -1229,6 +1256,7 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    /* init callback functions for nauty (accumulate the group generators found by nauty) */
    options.writeautoms = FALSE;
    options.userautomproc = nautyhook;
+   options.usernodeproc = nautynodehook;
    options.defaultptn = FALSE; /* use color classes */
 #else
    /* init callback functions for traces (accumulate the group generators found by traces) */
@@ -1292,11 +1320,13 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    data_.nperms = 0;
    data_.nmaxperms = 0;
    data_.maxgenerators = maxgenerators;
+   data_.endtime = SCIPisInfinity(scip, timelimit) ? SCIPinfinity(scip) : oldtime + timelimit;
    data_.perms = NULL;
    data_.symtype = SCIPgetSymgraphSymtype(symgraph);
    data_.restricttovars = TRUE;
 
-   /* call nauty/traces */
+   /* call nauty/traces; a kill request of an earlier call would stop the search immediately */
+   nauty_kill_request = 0;
 #ifdef NAUTY
    sparsenauty(&SG, lab, ptn, orbits, &options, &stats, NULL);
 #else
@@ -1393,6 +1423,7 @@ SCIP_Bool SYMcheckGraphsAreIdentical(
    /* init callback functions for nauty (accumulate the group generators found by nauty) */
    options.writeautoms = FALSE;
    options.userautomproc = nautyhook;
+   options.usernodeproc = nautynodehook;
    options.defaultptn = FALSE; /* use color classes */
 #else
    /* init callback functions for traces (accumulate the group generators found by traces) */
@@ -1476,11 +1507,13 @@ SCIP_Bool SYMcheckGraphsAreIdentical(
    data_.nperms = 0;
    data_.nmaxperms = 0;
    data_.maxgenerators = 0;
+   data_.endtime = SCIPinfinity(scip);
    data_.perms = NULL;
    data_.symtype = symtype;
    data_.restricttovars = FALSE;
 
-   /* call nauty/traces */
+   /* call nauty/traces; a kill request of an earlier call would stop the search immediately */
+   nauty_kill_request = 0;
 #ifdef NAUTY
    sparsenauty(&SG, lab, ptn, orbits, &options, &stats, NULL);
 #else
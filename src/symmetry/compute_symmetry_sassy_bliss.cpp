@@ -88,6 +88,7 @@ struct SYMMETRY_Data
    int**                 perms;              /**< permutation generators as (nperms x npermvars) matrix */
    int                   nmaxperms;          /**< maximal number of permutations */
    int                   maxgenerators;      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             endtime;            /**< solving time at which the search for generators is stopped */
    SCIP_Bool             restricttovars;     /**< whether permutations shall be restricted to variables */
 };
 
@@ -115,6 +116,10 @@ void sassyhook(
    if ( data->maxgenerators != 0 && data->nperms >= data->maxgenerators )
       return;
 
+   /* ignore further generators once the time limit is reached */
+   if ( SCIPgetSolvingTime(data->scip) >= data->endtime )
+      return;
+
    /* copy first part of automorphism */
    bool isIdentity = true;
    int* p = 0;
@@ -224,6 +229,7 @@ SCIP_RETCODE computeAutomorphisms(
    sassy::static_graph*  G,                  /**< pointer to graph for that automorphisms are computed */
    int                   nsymvars,           /**< number of variables encoded in graph */
    int                   maxgenerators,      /**< maximum number of generators to be constructed (=0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the search */
    int***                perms,              /**< pointer to store generators as (nperms x npermvars) matrix */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations
@@ -263,6 +269,7 @@ SCIP_RETCODE computeAutomorphisms(
    data.restricttovars = restricttovars;
 
    oldtime = SCIPgetSolvingTime(scip);
+   data.endtime = SCIPisInfinity(scip, timelimit) ? SCIPinfinity(scip) : oldtime + timelimit;
 
    /* set up sassy preprocessor */
    sassy::preprocessor sassy;
@@ -313,9 +320,10 @@ SCIP_RETCODE computeAutomorphisms(
    blissgraph.set_component_recursion(false);
 
 #if BLISS_VERSION_MAJOR >= 1 || BLISS_VERSION_MINOR >= 76
-   /* lambda function to have access to data and terminate the search if maxgenerators are reached */
+   /* lambda function to have access to data and terminate the search if maxgenerators or the time limit are reached */
    auto term = [&]() {
-      return (maxgenerators != 0 && data.nperms >= maxgenerators); /* check the number of generators that we have created so far */
+      /* check the number of generators that we have created so far */
+      return (maxgenerators != 0 && data.nperms >= maxgenerators) || SCIPgetSolvingTime(scip) >= data.endtime;
    };
 
    auto hook = [&](unsigned int n, const unsigned int* aut) {
@@ -370,6 +378,7 @@ SCIP_RETCODE computeAutomorphisms(
 SCIP_RETCODE SYMcomputeSymmetryGenerators(
    SCIP*                 scip,               /**< SCIP pointer */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the symmetry code */
    SYM_GRAPH*            graph,              /**< symmetry detection graph */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
@@ -403,7 +412,7 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
 
    /* compute symmetries */
    SCIP_CALL( computeAutomorphisms(scip, SCIPgetSymgraphSymtype(graph), &sassygraph, SCIPgetSymgraphNVars(graph),
-         maxgenerators, perms, nperms, nmaxperms, log10groupsize, TRUE, symcodetime) );
+         maxgenerators, timelimit, perms, nperms, nmaxperms, log10groupsize, TRUE, symcodetime) );
 
    return SCIP_OKAY;
 }
@@ -434,7 +443,7 @@ SCIP_Bool SYMcheckGraphsAreIdentical(
       return FALSE;
 
    /* compute symmetries */
-   SCIP_CALL_ABORT( computeAutomorphisms(scip, SCIPgetSymgraphSymtype(G1), &sassygraph, nnodes, 0,
+   SCIP_CALL_ABORT( computeAutomorphisms(scip, SCIPgetSymgraphSymtype(G1), &sassygraph, nnodes, 0, SCIPinfinity(scip),
          &perms, &nperms, &nmaxperms, &log10groupsize, FALSE, &symcodetime) );
 
    /* since G1 and G2 are connected and disjoint, they are isomorphic iff there is a permutation
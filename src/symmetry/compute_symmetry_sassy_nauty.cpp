@@ -100,12 +100,43 @@ struct SYMMETRY_Data
    int**                 perms;              /**< permutation generators as (nperms x npermvars) matrix */
    int                   nmaxperms;          /**< maximal number of permutations */
    int                   maxgenerators;      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             endtime;            /**< solving time at which the search for generators is stopped */
    SCIP_Bool             restricttovars;     /**< whether permutations shall be restricted to variables */
 };
 
 
 /* ------------------- hook functions ------------------- */
 
+#ifdef NAUTY
+/* static data for the node callback of nauty, which does not get user data */
+static struct SYMMETRY_Data* nodehookdata_ = NULL;
+
+/** callback function for nauty, which is called at every node of the search tree and stops the search at the time
+ *  limit, also if no further generators are found
+ */  /*lint -e{715}*/
+static
+void nautynodehook(
+   graph*                g,                  /**< graph */
+   int*                  lab,                /**< labelling of the current node */
+   int*                  ptn,                /**< partition of the current node */
+   int                   level,              /**< level of the current node */
+   int                   numcells,           /**< number of cells of the partition */
+   int                   tc,                 /**< index of the target cell */
+   int                   code,               /**< code produced by the refinement */
+   int                   m,                  /**< number of setwords per row of the graph */
+   int                   n                   /**< number of nodes in the graph */
+   )
+{  /* lint --e{715} */
+   assert( nodehookdata_ != NULL );
+
+   if ( SCIPgetSolvingTime(nodehookdata_->scip) >= nodehookdata_->endtime )
+   {
+      /* request a kill from nauty */
+      nauty_kill_request = 1;
+   }
+}
+#endif
+
 /** callback function for sassy */  /*lint -e{715}*/
 static
 void sassyhook(
@@ -127,6 +158,13 @@ void sassyhook(
    if ( data->maxgenerators != 0 && data->nperms >= data->maxgenerators )
       return;
 
+   /* ignore further generators once the time limit is reached, and stop nauty/traces if they are running */
+   if ( SCIPgetSolvingTime(data->scip) >= data->endtime )
+   {
+      nauty_kill_request = 1;
+      return;
+   }
+
    /* copy first part of automorphism */
    bool isIdentity = true;
    int* p = 0;
@@ -241,6 +279,7 @@ SCIP_RETCODE computeAutomorphisms(
    sassy::static_graph*  G,                  /**< pointer to graph for that automorphisms are computed */
    int                   nsymvars,           /**< number of variables encoded in graph */
    int                   maxgenerators,      /**< maximum number of generators to be constructed (=0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the search */
    int***                perms,              /**< pointer to store generators as (nperms x npermvars) matrix */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations
@@ -280,6 +319,7 @@ SCIP_RETCODE computeAutomorphisms(
    data.restricttovars = restricttovars;
 
    oldtime = SCIPgetSolvingTime(scip);
+   data.endtime = SCIPisInfinity(scip, timelimit) ? SCIPinfinity(scip) : oldtime + timelimit;
 
    /* set up sassy preprocessor */
    sassy::preprocessor sassy;
@@ -311,10 +351,15 @@ SCIP_RETCODE computeAutomorphisms(
    /* init callback functions for nauty (accumulate the group generators found by nauty) */
    options.writeautoms = FALSE;
    options.userautomproc = sassy::preprocessor::nauty_hook;
+   options.usernodeproc = nautynodehook;
    options.defaultptn = FALSE; /* use color classes */
    *log10groupsize = 0.0;
-   if(sg.nv > 0) {
+   if(sg.nv > 0 && SCIPgetSolvingTime(scip) < data.endtime) {
+      /* a kill request of an earlier call or of the preprocessing would stop the search immediately */
+      nauty_kill_request = 0;
+      nodehookdata_ = &data;
       sparsenauty(&sg, lab, ptn, orbits, &options, &stats, NULL);
+      nodehookdata_ = NULL;
       *log10groupsize = (SCIP_Real) stats.grpsize2;
    }
 #else
@@ -327,7 +372,9 @@ SCIP_RETCODE computeAutomorphisms(
    options.writeautoms = FALSE;
    options.userautomproc = sassy::preprocessor::traces_hook;
    options.defaultptn = FALSE; /* use color classes */
-   if(sg.nv > 0) {
+   if(sg.nv > 0 && SCIPgetSolvingTime(scip) < data.endtime) {
+      /* a kill request of an earlier call or of the preprocessing would stop the search immediately */
+      nauty_kill_request = 0;
       Traces(&sg, lab, ptn, orbits, &options, &stats, NULL);
    }
 #endif
@@ -363,6 +410,7 @@ SCIP_RETCODE computeAutomorphisms(
 SCIP_RETCODE SYMcomputeSymmetryGenerators(
    SCIP*                 scip,               /**< SCIP pointer */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SCIP_Real             timelimit,          /**< time limit in seconds for the symmetry code */
    SYM_GRAPH*            symgraph,           /**< symmetry detection graph */
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
@@ -396,7 +444,7 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
 
    /* compute symmetries */
    SCIP_CALL( computeAutomorphisms(scip, SCIPgetSymgraphSymtype(symgraph), &sassygraph, SCIPgetSymgraphNVars(symgraph),
-         maxgenerators, perms, nperms, nmaxperms, log10groupsize, TRUE, symcodetime) );
+         maxgenerators, timelimit, perms, nperms, nmaxperms, log10groupsize, TRUE, symcodetime) );
 
    return SCIP_OKAY;
 }
@@ -427,7 +475,7 @@ SCIP_Bool SYMcheckGraphsAreIdentical(
       return FALSE;
 
    /* compute symmetries */
-   SCIP_CALL_ABORT( computeAutomorphisms(scip, SCIPgetSymgraphSymtype(G1), &sassygraph, nnodes, 0,
+   SCIP_CALL_ABORT( computeAutomorphisms(scip, SCIPgetSymgraphSymtype(G1), &sassygraph, nnodes, 0, SCIPinfinity(scip),
          &perms, &nperms, &nmaxperms, &log10groupsize, FALSE, &symcodetime) );
 
    /* since G1 and G2 are connected and disjoint, they are isomorphic iff there is a permutation
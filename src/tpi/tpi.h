@@ -102,6 +102,12 @@ int SCIPtpiGetNumThreads(
    void
    );
 
+/** returns whether the task processing interface has been initialized, i.e., whether jobs can be submitted */
+SCIP_EXPORT
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   );
+
 /** returns the thread number */
 SCIP_EXPORT
 int SCIPtpiGetThreadNum(
@@ -138,7 +144,21 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    int                   jobid               /**< the jobid of the jobs to wait for */
    );
 
-/** initializes tpi */
+/** blocks until all jobs of the given jobid have finished, executing the ones that are still queued in the calling
+ *  thread, and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  Jobs that wait for jobs themselves, e.g., within the solving process of a sub-SCIP, cannot block all threads of the
+ *  pool this way. The jobs must not depend on the thread that executes them, see SCIPtpiGetThreadNum().
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiProcessAndCollectJobs(
+   int                   jobid               /**< the jobid of the jobs to wait for */
+   );
+
+/** initializes tpi
+ *
+ *  Returns an error if the task processing interface has already been initialized, e.g., by SCIPtpiAcquireShared().
+ */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
@@ -153,4 +173,25 @@ SCIP_RETCODE SCIPtpiExit(
    void
    );
 
+/** acquires a reference to the thread pool that is shared by the parallel jobs of all solving processes
+ *
+ *  The first reference initializes the task processing interface with the given number of threads, later references
+ *  share its threads. If the task processing interface has been initialized by SCIPtpiInit(), e.g., for a concurrent
+ *  solve, its threads are not shared and no reference is acquired.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiAcquireShared(
+   int                   nthreads,           /**< the number of threads to be used if the thread pool is created */
+   SCIP_Bool*            acquired            /**< pointer to store whether a reference has been acquired */
+   );
+
+/** releases a reference to the shared thread pool; the last reference deinitializes the task processing interface
+ *
+ *  The last reference must not be released from within a job.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiReleaseShared(
+   void
+   );
+
 #endif
@@ -137,6 +137,14 @@ int SCIPtpiGetNumThreads(
    return 1;
 }
 
+/** returns whether the task processing interface has been initialized, i.e., whether jobs can be submitted */
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   )
+{
+   return FALSE;
+}
+
 /** returns the thread number */
 int SCIPtpiGetThreadNum(
    void
@@ -198,6 +206,21 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    return SCIP_ERROR;
 }
 
+/** blocks until all jobs of the given jobid have finished, executing the ones that are still queued in the calling
+ *  thread, and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  Jobs that wait for jobs themselves, e.g., within the solving process of a sub-SCIP, cannot block all threads of the
+ *  pool this way. The jobs must not depend on the thread that executes them, see SCIPtpiGetThreadNum().
+ */
+SCIP_RETCODE SCIPtpiProcessAndCollectJobs(
+   int                   jobid               /**< the id of the jobs to collect */
+   )
+{
+   SCIP_UNUSED( jobid );
+
+   return SCIP_ERROR;
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int         nthreads,                     /**< the number of threads to be used */
@@ -219,3 +242,33 @@ SCIP_RETCODE SCIPtpiExit(
 {
    return SCIP_ERROR;
 }
+
+/** acquires a reference to the thread pool that is shared by the parallel jobs of all solving processes
+ *
+ *  The first reference initializes the task processing interface with the given number of threads, later references
+ *  share its threads. If the task processing interface has been initialized by SCIPtpiInit(), e.g., for a concurrent
+ *  solve, its threads are not shared and no reference is acquired.
+ */
+SCIP_RETCODE SCIPtpiAcquireShared(
+   int                   nthreads,           /**< the number of threads to be used if the thread pool is created */
+   SCIP_Bool*            acquired            /**< pointer to store whether a reference has been acquired */
+   )
+{
+   SCIP_UNUSED( nthreads );
+   assert(acquired != NULL);
+
+   *acquired = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** releases a reference to the shared thread pool; the last reference deinitializes the task processing interface
+ *
+ *  The last reference must not be released from within a job.
+ */
+SCIP_RETCODE SCIPtpiReleaseShared(
+   void
+   )
+{
+   return SCIP_ERROR;
+}
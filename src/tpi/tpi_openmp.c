@@ -36,6 +36,7 @@
 #include "blockmemshell/memory.h"
 #include "scip/pub_message.h"
 #include <omp.h>
+#include <limits.h>
 
 /* macros for direct access */
 
@@ -99,6 +100,7 @@ struct SCIP_JobQueues
 typedef struct SCIP_JobQueues SCIP_JOBQUEUES;
 
 static SCIP_JOBQUEUES* _jobqueues = NULL;
+static int _nsharedrefs = 0;                 /**< number of references to the shared job queues, see SCIPtpiAcquireShared() */
 
 
 /** create job queue */
@@ -418,6 +420,14 @@ int SCIPtpiGetNumThreads(
    return omp_get_num_threads();
 }
 
+/** returns whether the task processing interface has been initialized, i.e., whether jobs can be submitted */
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   )
+{
+   return _jobqueues != NULL;
+}
+
 /** returns the thread number */
 int SCIPtpiGetThreadNum(
    )
@@ -591,6 +601,21 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    return retcode;
 }
 
+/** blocks until all jobs of the given jobid have finished, executing the ones that are still queued in the calling
+ *  thread, and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  Jobs that wait for jobs themselves, e.g., within the solving process of a sub-SCIP, cannot block all threads of the
+ *  pool this way. The jobs must not depend on the thread that executes them, see SCIPtpiGetThreadNum().
+ *
+ *  The jobs are OpenMP tasks, which may be executed by any thread of the team anyway, so this only waits for them.
+ */
+SCIP_RETCODE SCIPtpiProcessAndCollectJobs(
+   int                   jobid               /**< the jobid of the jobs to wait for */
+   )
+{
+   return SCIPtpiCollectJobs(jobid);
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
@@ -598,12 +623,24 @@ SCIP_RETCODE SCIPtpiInit(
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    )
 {
-   omp_set_num_threads(nthreads);
-   assert(_jobqueues == NULL);
+   SCIP_RETCODE retcode;
 
-   SCIP_CALL( createJobQueue(nthreads, queuesize, blockwhenfull) );
+   #pragma omp critical (SCIPtpiShared)
+   {
+      /* the shared job queues may be held by another solving process */
+      if( _jobqueues != NULL )
+      {
+         SCIPerrorMessage("task processing interface is already in use\n");
+         retcode = SCIP_ERROR;
+      }
+      else
+      {
+         omp_set_num_threads(nthreads);
+         retcode = createJobQueue(nthreads, queuesize, blockwhenfull);
+      }
+   }
 
-   return SCIP_OKAY;
+   return retcode;
 }
 
 /** deinitializes tpi */
@@ -611,14 +648,85 @@ SCIP_RETCODE SCIPtpiExit(
    void
    )
 {
-   assert(_jobqueues != NULL);
-   assert(_jobqueues->finishedjobs.njobs == 0);
-   assert(_jobqueues->jobqueue.njobs == 0);
-   assert(_jobqueues->ncurrentjobs == 0);
+   SCIP_RETCODE retcode;
 
-   SCIP_CALL( freeJobQueue() );
+   #pragma omp critical (SCIPtpiShared)
+   {
+      assert(_jobqueues != NULL);
+      assert(_jobqueues->finishedjobs.njobs == 0);
+      assert(_jobqueues->jobqueue.njobs == 0);
+      assert(_jobqueues->ncurrentjobs == 0);
+      assert(_nsharedrefs == 0);
 
-   return SCIP_OKAY;
+      retcode = freeJobQueue();
+   }
+
+   return retcode;
+}
+
+/** acquires a reference to the thread pool that is shared by the parallel jobs of all solving processes
+ *
+ *  The first reference initializes the task processing interface with the given number of threads, later references
+ *  share its threads. If the task processing interface has been initialized by SCIPtpiInit(), e.g., for a concurrent
+ *  solve, its threads are not shared and no reference is acquired.
+ */
+SCIP_RETCODE SCIPtpiAcquireShared(
+   int                   nthreads,           /**< the number of threads to be used if the thread pool is created */
+   SCIP_Bool*            acquired            /**< pointer to store whether a reference has been acquired */
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
+   assert(acquired != NULL);
+
+   *acquired = FALSE;
+
+   #pragma omp critical (SCIPtpiShared)
+   {
+      if( _jobqueues == NULL )
+      {
+         assert(_nsharedrefs == 0);
+
+         if( nthreads > 1 )
+         {
+            omp_set_num_threads(nthreads);
+            retcode = createJobQueue(nthreads, INT_MAX, FALSE);
+            *acquired = (retcode == SCIP_OKAY);
+         }
+      }
+      else
+      {
+         /* job queues without references have been created by SCIPtpiInit() */
+         *acquired = (_nsharedrefs > 0);
+      }
+
+      if( *acquired )
+         ++_nsharedrefs;
+   }
+
+   return retcode;
+}
+
+/** releases a reference to the shared thread pool; the last reference deinitializes the task processing interface
+ *
+ *  The last reference must not be released from within a job.
+ */
+SCIP_RETCODE SCIPtpiReleaseShared(
+   void
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
+   #pragma omp critical (SCIPtpiShared)
+   {
+      assert(_jobqueues != NULL);
+      assert(_nsharedrefs > 0);
+
+      if( --_nsharedrefs == 0 )
+         retcode = freeJobQueue();
+   }
+
+   return retcode;
 }
 
 
@@ -36,6 +36,7 @@
 #include "blockmemshell/memory.h"
 #include "tinycthread/tinycthread.h"
 #include "scip/pub_message.h"
+#include <limits.h>
 
 /* macros for direct access */
 
@@ -69,6 +70,11 @@ typedef struct SCIP_ThreadPool SCIP_THREADPOOL;
 static SCIP_THREADPOOL* _threadpool = NULL;
 _Thread_local int _threadnumber; /*lint !e129*/
 
+/* references to the shared thread pool, see SCIPtpiAcquireShared() */
+static once_flag _sharedlockonce = ONCE_FLAG_INIT;
+static mtx_t _sharedlock;                    /**< lock to create and free the thread pool */
+static int _nsharedrefs = 0;                 /**< number of references to the shared thread pool */
+
 /** A job added to the queue */
 struct SCIP_Job
 {
@@ -117,6 +123,121 @@ struct SCIP_ThreadPool
    cnd_t                 jobfinished;        /**< condition to broadcast that a job has been finished */
 };
 
+/** removes the given job from the job queue and adds it to the current jobs
+ *
+ *  This function needs to be called from within a mutex.
+ */
+static
+SCIP_RETCODE threadPoolStartJob(
+   SCIP_THREADPOOL*      threadpool,         /**< thread pool */
+   SCIP_JOB*             newjob,             /**< job in the job queue */
+   SCIP_JOB*             prevjob             /**< job before newjob in the job queue, or NULL if newjob is the first one */
+   )
+{
+   assert(threadpool != NULL);
+   assert(newjob != NULL);
+   assert(prevjob == NULL || prevjob->nextjob == newjob);
+
+   /* updating the queue */
+   if( prevjob == NULL )
+      threadpool->jobqueue->firstjob = newjob->nextjob;
+   else
+      prevjob->nextjob = newjob->nextjob;
+
+   if( newjob == threadpool->jobqueue->lastjob )
+      threadpool->jobqueue->lastjob = prevjob;
+
+   threadpool->jobqueue->njobs--;            /* decreasing the number of jobs in the queue */
+   newjob->nextjob = NULL;
+
+   /* if we want to wait when the queue is full, then we broadcast that the queue can now take new jobs */
+   if( threadpool->blockwhenfull &&
+       threadpool->jobqueue->njobs == threadpool->queuesize - 1 )
+   {
+      SCIP_CALL( SCIPtnyBroadcastCondition(&(threadpool->queuenotfull)) );
+   }
+
+   /* indicating that the queue is empty */
+   if( threadpool->jobqueue->njobs == 0 )
+   {
+      SCIP_CALL( SCIPtnyBroadcastCondition(&(threadpool->queueempty)) );
+   }
+
+   /* updating the current job list */
+   if( threadpool->currentjobs->njobs == 0 )
+   {
+      threadpool->currentjobs->firstjob = newjob;
+      threadpool->currentjobs->lastjob = newjob;
+   }
+   else
+   {
+      threadpool->currentjobs->lastjob->nextjob = newjob;
+      threadpool->currentjobs->lastjob = newjob;
+   }
+
+   threadpool->currentjobs->njobs++;
+
+   return SCIP_OKAY;
+}
+
+/** moves the given job from the current jobs to the finished jobs and signals that it has been finished
+ *
+ *  This function needs to be called from within a mutex.
+ */
+static
+SCIP_RETCODE threadPoolFinishJob(
+   SCIP_THREADPOOL*      threadpool,         /**< thread pool */
+   SCIP_JOB*             newjob              /**< job in the current jobs */
+   )
+{
+   SCIP_JOB* currjob;
+   SCIP_JOB* prevjob;
+
+   assert(threadpool != NULL);
+   assert(newjob != NULL);
+
+   /* finding the location of the processed job in the currentjobs queue */
+   currjob = threadpool->currentjobs->firstjob;
+   prevjob = NULL;
+
+   while( currjob != newjob )
+   {
+      prevjob = currjob;
+      currjob = prevjob->nextjob;
+   }
+
+   /* removing the processed job from current jobs list */
+   if( currjob == threadpool->currentjobs->firstjob )
+      threadpool->currentjobs->firstjob = currjob->nextjob;
+   else
+      prevjob->nextjob = currjob->nextjob; /*lint !e794*/
+
+   if( currjob == threadpool->currentjobs->lastjob )
+      threadpool->currentjobs->lastjob = prevjob;
+
+   threadpool->currentjobs->njobs--;
+
+   /* updating the finished job list */
+   newjob->nextjob = NULL;
+   if( threadpool->finishedjobs->njobs == 0 )
+   {
+      threadpool->finishedjobs->firstjob = newjob;
+      threadpool->finishedjobs->lastjob = newjob;
+   }
+   else
+   {
+      threadpool->finishedjobs->lastjob->nextjob = newjob;
+      threadpool->finishedjobs->lastjob = newjob;
+   }
+
+   threadpool->finishedjobs->njobs++;
+
+   /* signalling that a job has been finished */
+   SCIP_CALL( SCIPtnyBroadcastCondition(&(threadpool)->jobfinished) );
+
+   return SCIP_OKAY;
+}
+
 /** this function controls the execution of each of the threads */
 static
 SCIP_RETCODE threadPoolThreadRetcode(
@@ -124,8 +245,6 @@ SCIP_RETCODE threadPoolThreadRetcode(
    )
 {
    SCIP_JOB* newjob;
-   SCIP_JOB* prevjob;
-   SCIP_JOB* currjob;
 
    _threadnumber = (int)(uintptr_t) threadnum;
 
@@ -157,88 +276,17 @@ SCIP_RETCODE threadPoolThreadRetcode(
 
       /* getting the next job in the queue */
       newjob = _threadpool->jobqueue->firstjob;
-      _threadpool->jobqueue->njobs--;            /* decreasing the number of jobs in the queue */
-
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         _threadpool->jobqueue->firstjob = NULL;
-         _threadpool->jobqueue->lastjob = NULL;
-      }
-      else
-         _threadpool->jobqueue->firstjob = newjob->nextjob;     /* updating the queue */
-
-      /* if we want to wait when the queue is full, then we broadcast that the queue can now take new jobs */
-      if( _threadpool->blockwhenfull &&
-          _threadpool->jobqueue->njobs == _threadpool->queuesize - 1 )
-      {
-         SCIP_CALL( SCIPtnyBroadcastCondition(&(_threadpool->queuenotfull)) );
-      }
-
-      /* indicating that the queue is empty */
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         SCIP_CALL( SCIPtnyBroadcastCondition(&(_threadpool->queueempty)) );
-      }
-
-      /* updating the current job list */
-      if( _threadpool->currentjobs->njobs == 0 )
-      {
-         _threadpool->currentjobs->firstjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
-      }
-      else
-      {
-         _threadpool->currentjobs->lastjob->nextjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
-      }
-
-      _threadpool->currentjobs->njobs++;
+      SCIP_CALL( threadPoolStartJob(_threadpool, newjob, NULL) );
 
       SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
 
       /* setting the job to run on this thread */
       newjob->retcode = (*(newjob->jobfunc))(newjob->args);
 
-      /* setting the current job on this thread to NULL */
+      /* setting the current job to NULL */
       SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
 
-      /* finding the location of the processed job in the currentjobs queue */
-      currjob = _threadpool->currentjobs->firstjob;
-      prevjob = NULL;
-
-      while( currjob != newjob )
-      {
-         prevjob = currjob;
-         currjob = prevjob->nextjob;
-      }
-
-      /* removing the processed job from current jobs list */
-      if( currjob == _threadpool->currentjobs->firstjob )
-         _threadpool->currentjobs->firstjob = currjob->nextjob;
-      else
-         prevjob->nextjob = currjob->nextjob; /*lint !e794*/
-
-      if( currjob == _threadpool->currentjobs->lastjob )
-         _threadpool->currentjobs->lastjob = prevjob;
-
-      _threadpool->currentjobs->njobs--;
-
-      /* updating the finished job list */
-      if( _threadpool->finishedjobs->njobs == 0 )
-      {
-         _threadpool->finishedjobs->firstjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
-      }
-      else
-      {
-         _threadpool->finishedjobs->lastjob->nextjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
-      }
-
-      _threadpool->finishedjobs->njobs++;
-
-      /* signalling that a job has been finished */
-      SCIP_CALL( SCIPtnyBroadcastCondition(&(_threadpool)->jobfinished) );
+      SCIP_CALL( threadPoolFinishJob(_threadpool, newjob) );
 
       SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
    }
@@ -577,6 +625,23 @@ int SCIPtpiGetNumThreads(
    return _threadpool->nthreads;
 }
 
+/** returns whether the task processing interface has been initialized, i.e., whether jobs can be submitted */
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   )
+{
+   return _threadpool != NULL;
+}
+
+/** initializes the lock that protects the references to the shared thread pool */
+static
+void initSharedLock(
+   void
+   )
+{
+   SCIP_CALL_ABORT( SCIPtnyInitLock(&_sharedlock) );
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
@@ -584,9 +649,23 @@ SCIP_RETCODE SCIPtpiInit(
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    )
 {
-   assert(_threadpool == NULL);
-   SCIP_CALL( createThreadPool(&_threadpool, nthreads, queuesize, blockwhenfull) );
-   return SCIP_OKAY;
+   SCIP_RETCODE retcode;
+
+   call_once(&_sharedlockonce, initSharedLock);
+   SCIP_CALL( SCIPtnyAcquireLock(&_sharedlock) );
+
+   /* the shared thread pool may be held by another solving process */
+   if( _threadpool != NULL )
+   {
+      SCIPerrorMessage("task processing interface is already in use\n");
+      retcode = SCIP_ERROR;
+   }
+   else
+      retcode = createThreadPool(&_threadpool, nthreads, queuesize, blockwhenfull);
+
+   SCIP_CALL( SCIPtnyReleaseLock(&_sharedlock) );
+
+   return retcode;
 }
 
 /** deinitializes tpi */
@@ -594,11 +673,84 @@ SCIP_RETCODE SCIPtpiExit(
    void
    )
 {
+   SCIP_RETCODE retcode;
+
+   SCIP_CALL( SCIPtnyAcquireLock(&_sharedlock) );
+
    assert(_threadpool != NULL);
+   assert(_nsharedrefs == 0);
+   retcode = freeThreadPool(&_threadpool, TRUE, TRUE);
 
-   SCIP_CALL( freeThreadPool(&_threadpool, TRUE, TRUE) );
+   SCIP_CALL( SCIPtnyReleaseLock(&_sharedlock) );
 
-   return SCIP_OKAY;
+   return retcode;
+}
+
+/** acquires a reference to the thread pool that is shared by the parallel jobs of all solving processes
+ *
+ *  The first reference initializes the task processing interface with the given number of threads, later references
+ *  share its threads. If the task processing interface has been initialized by SCIPtpiInit(), e.g., for a concurrent
+ *  solve, its threads are not shared and no reference is acquired.
+ */
+SCIP_RETCODE SCIPtpiAcquireShared(
+   int                   nthreads,           /**< the number of threads to be used if the thread pool is created */
+   SCIP_Bool*            acquired            /**< pointer to store whether a reference has been acquired */
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
+   assert(acquired != NULL);
+
+   *acquired = FALSE;
+
+   call_once(&_sharedlockonce, initSharedLock);
+   SCIP_CALL( SCIPtnyAcquireLock(&_sharedlock) );
+
+   if( _threadpool == NULL )
+   {
+      assert(_nsharedrefs == 0);
+
+      if( nthreads > 1 )
+      {
+         retcode = createThreadPool(&_threadpool, nthreads, INT_MAX, FALSE);
+         *acquired = (retcode == SCIP_OKAY);
+      }
+   }
+   else
+   {
+      /* a thread pool without references has been created by SCIPtpiInit() */
+      *acquired = (_nsharedrefs > 0);
+   }
+
+   if( *acquired )
+      ++_nsharedrefs;
+
+   SCIP_CALL( SCIPtnyReleaseLock(&_sharedlock) );
+
+   return retcode;
+}
+
+/** releases a reference to the shared thread pool; the last reference deinitializes the task processing interface
+ *
+ *  The last reference must not be released from within a job.
+ */
+SCIP_RETCODE SCIPtpiReleaseShared(
+   void
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
+   SCIP_CALL( SCIPtnyAcquireLock(&_sharedlock) );
+
+   assert(_threadpool != NULL);
+   assert(_nsharedrefs > 0);
+
+   if( --_nsharedrefs == 0 )
+      retcode = freeThreadPool(&_threadpool, TRUE, TRUE);
+
+   SCIP_CALL( SCIPtnyReleaseLock(&_sharedlock) );
+
+   return retcode;
 }
 
 /** creates a job for parallel processing */
@@ -651,9 +803,14 @@ SCIP_RETCODE SCIPtpiSubmitJob(
 
 /** blocks until all jobs of the given jobid have finished
  *  and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  If queued jobs should be processed, the calling thread takes the jobs of the given id from the queue and executes
+ *  them itself instead of only waiting for the threads of the pool.
  */
-SCIP_RETCODE SCIPtpiCollectJobs(
-   int                   jobid               /**< the jobid of the jobs to wait for */
+static
+SCIP_RETCODE threadPoolCollectJobs(
+   int                   jobid,              /**< the jobid of the jobs to wait for */
+   SCIP_Bool             processqueued       /**< should queued jobs of the given id be executed by the calling thread? */
    )
 {
    SCIP_RETCODE retcode;
@@ -662,9 +819,38 @@ SCIP_RETCODE SCIPtpiCollectJobs(
 
    SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
 
-   while( isJobRunning(_threadpool->currentjobs, jobid) || isJobRunning(_threadpool->jobqueue, jobid) )
+   while( TRUE ) /*lint !e716*/
    {
-      SCIP_CALL( SCIPtnyWaitCondition(&_threadpool->jobfinished, &_threadpool->poollock) );
+      currjob = NULL;
+      prevjob = NULL;
+
+      if( processqueued )
+      {
+         currjob = _threadpool->jobqueue->firstjob;
+
+         while( currjob != NULL && currjob->jobid != jobid )
+         {
+            prevjob = currjob;
+            currjob = currjob->nextjob;
+         }
+      }
+
+      if( currjob != NULL )
+      {
+         SCIP_CALL( threadPoolStartJob(_threadpool, currjob, prevjob) );
+         SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
+
+         currjob->retcode = (*(currjob->jobfunc))(currjob->args);
+
+         SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
+         SCIP_CALL( threadPoolFinishJob(_threadpool, currjob) );
+      }
+      else if( isJobRunning(_threadpool->currentjobs, jobid) || isJobRunning(_threadpool->jobqueue, jobid) )
+      {
+         SCIP_CALL( SCIPtnyWaitCondition(&_threadpool->jobfinished, &_threadpool->poollock) );
+      }
+      else
+         break;
    }
 
    /* finding the location of the processed job in the currentjobs queue */
@@ -717,6 +903,29 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    return retcode;
 }
 
+/** blocks until all jobs of the given jobid have finished
+ *  and then returns the smallest SCIP_RETCODE of all the jobs
+ */
+SCIP_RETCODE SCIPtpiCollectJobs(
+   int                   jobid               /**< the jobid of the jobs to wait for */
+   )
+{
+   return threadPoolCollectJobs(jobid, FALSE);
+}
+
+/** blocks until all jobs of the given jobid have finished, executing the ones that are still queued in the calling
+ *  thread, and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  Jobs that wait for jobs themselves, e.g., within the solving process of a sub-SCIP, cannot block all threads of the
+ *  pool this way. The jobs must not depend on the thread that executes them, see SCIPtpiGetThreadNum().
+ */
+SCIP_RETCODE SCIPtpiProcessAndCollectJobs(
+   int                   jobid               /**< the jobid of the jobs to wait for */
+   )
+{
+   return threadPoolCollectJobs(jobid, TRUE);
+}
+
 
 /*
  * locks
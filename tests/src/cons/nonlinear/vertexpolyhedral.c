@@ -24,6 +24,9 @@
 
 /**@file   vertexpolyhedral.c
  * @brief  tests estimation of vertexpolyhedral functions
+ *
+ * Also checks that a facet computed with a function that is evaluated in all corners at once is the one computed with
+ * a function that is evaluated in one corner at a time.
  */
 
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
@@ -109,6 +112,27 @@ SCIP_DECL_VERTEXPOLYFUN(prodfunction)
    return ret;
 }
 
+/** evaluates prodfunction() in all given points, which are stored column-wise */
+static
+SCIP_DECL_VERTEXPOLYFUNBATCH(prodfunctionbatch)
+{
+   SCIP_Real point[SCIP_MAXVERTEXPOLYDIM];
+   int j;
+   int k;
+
+   assert(nargs <= SCIP_MAXVERTEXPOLYDIM);
+
+   for( k = 0; k < npoints; ++k )
+   {
+      for( j = 0; j < nargs; ++j )
+         point[j] = args[j * npoints + k];
+
+      vals[k] = prodfunction(point, nargs, funcdata);
+   }
+
+   return SCIP_OKAY;
+}
+
 
 /* generates matrix of size *size and prints it; checks it is the expected matrix */
 ParameterizedTest(const int* size, separation, multilinearLP)
@@ -462,4 +486,91 @@ Test(separation, vertexpolyhedral,
    cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory is leaking!!");
 }
 
+/** computes a facet with prodfunction() and prodfunctionbatch() and checks that they are the same */
+static
+void test_vertexpolyhedralbatch(
+   int       dim,
+   double*   box,
+   double*   xstar,
+   SCIP_Bool overestimate
+)
+{
+   SCIP_Real facetcoefs[SCIP_MAXVERTEXPOLYDIM];
+   SCIP_Real batchcoefs[SCIP_MAXVERTEXPOLYDIM];
+   SCIP_Real facetconstant;
+   SCIP_Real batchconstant;
+   SCIP_Real targetval;
+   SCIP_Bool success = FALSE;
+   SCIP_Bool batchsuccess = FALSE;
+   int j;
+
+   targetval = overestimate ? SCIPinfinity(scip) : -SCIPinfinity(scip);
+
+   SCIP_CALL_ABORT( SCIPcomputeFacetVertexPolyhedralNonlinear(scip, SCIPfindConshdlr(scip, "nonlinear"), overestimate,
+      prodfunction, NULL, xstar, box, dim, targetval, &success, facetcoefs, &facetconstant) );
+   SCIP_CALL_ABORT( SCIPcomputeFacetVertexPolyhedralNonlinearBatch(scip, SCIPfindConshdlr(scip, "nonlinear"),
+      overestimate, prodfunctionbatch, NULL, xstar, box, dim, targetval, &batchsuccess, batchcoefs, &batchconstant) );
+
+   cr_assert(success);
+   cr_assert(batchsuccess);
+
+   for( j = 0; j < dim; ++j )
+   {
+      cr_expect(SCIPisEQ(scip, facetcoefs[j], batchcoefs[j]), "coefficient %d of facet %.15g differs from %.15g", j,
+         facetcoefs[j], batchcoefs[j]);
+   }
+   cr_expect(SCIPisEQ(scip, facetconstant, batchconstant), "constant of facet %.15g differs from %.15g", facetconstant,
+      batchconstant);
+}
+
+Test(separation, vertexpolyhedralbatch,
+   .description = "test that facets for vertex-polyhedral functions evaluated in all corners at once are the same"
+   )
+{
+   SCIP_Real box[2*SCIP_MAXVERTEXPOLYDIM];
+   SCIP_Real xstar[SCIP_MAXVERTEXPOLYDIM];
+   int dim;
+   int nfixed;
+   int i;
+
+   SCIP_CALL_ABORT( SCIPcreate(&scip) );
+   SCIP_CALL_ABORT( SCIPincludeConshdlrNonlinear(scip) );
+
+   SCIP_CALL_ABORT( SCIPcreateRandom(scip, &randnumgen, 20181106, FALSE) );
+
+   for( dim = 1; dim <= SCIP_MAXVERTEXPOLYDIM; ++dim )
+   {
+      for( i = 0; i < dim; ++i )
+      {
+         box[2*i] = -i-1;
+         box[2*i+1] = (i+1)/2.0;
+         xstar[i] = sqrt(i) * (i%2 ? -1.0 : 1.0);
+      }
+
+      test_vertexpolyhedralbatch(dim, box, xstar, TRUE);
+      test_vertexpolyhedralbatch(dim, box, xstar, FALSE);
+
+      /* fix ~50% of the variables and try again */
+      nfixed = 0;
+      for( i = 0; i < dim; ++i )
+         if( SCIPrandomGetReal(randnumgen, 0.0, 1.0) < 0.5 )
+         {
+            box[2*i] = box[2*i+1];
+            xstar[i] = box[2*i];
+            ++nfixed;
+         }
+
+      if( nfixed == 0 || nfixed == dim )
+         continue;
+
+      test_vertexpolyhedralbatch(dim, box, xstar, TRUE);
+      test_vertexpolyhedralbatch(dim, box, xstar, FALSE);
+   }
+
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL_ABORT( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory is leaking!!");
+}
+
 #endif  /* if !intel */
@@ -0,0 +1,155 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   watchedvars.c
+ * @brief  unit tests for the watched mode of set partitioning / packing / covering constraints
+ *
+ * The instance enigma must be solved to its optimal value zero both in watched mode and when counting the fixed
+ * variables. For a single set partitioning constraint, fixing all but one variable to zero in probing must fix the last
+ * variable to one, with the counters of fixed variables kept up to date, and fixing all variables to zero must give a
+ * cutoff.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/cons_setppc.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 4
+
+static SCIP* scip;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(watchedvars, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(watchedvars, solve, .description = "a MIP with set partitioning constraints is solved in watched mode")
+{
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/setppc/watchedvars", TRUE) );
+   SCIP_CALL( SCIPreadProb(scip, "../check/instances/MIP/enigma.mps", NULL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisZero(scip, SCIPgetPrimalbound(scip)));
+}
+
+Test(watchedvars, counting, .description = "the same MIP is solved when counting the fixed variables")
+{
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/setppc/watchedvars", FALSE) );
+   SCIP_CALL( SCIPreadProb(scip, "../check/instances/MIP/enigma.mps", NULL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisZero(scip, SCIPgetPrimalbound(scip)));
+}
+
+Test(watchedvars, propagate, .description = "fixings to zero are propagated and counted in watched mode")
+{
+   SCIP_VAR* vars[NVARS];
+   SCIP_VAR* transvars[NVARS];
+   SCIP_CONS* cons;
+   SCIP_CONS* transcons;
+   SCIP_Bool cutoff;
+   SCIP_Longint ndomreds;
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/setppc/watchedvars", TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 0) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1L) );
+
+   /* the objective prefers no variable to be one, such that the root node has to be branched on */
+   SCIP_CALL( SCIPcreateProbBasic(scip, "watchedvars") );
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real)(i + 1), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+   SCIP_CALL( SCIPcreateConsBasicSetpart(scip, &cons, "part", NVARS, vars) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+
+   /* stop after the root node to stay in the solving stage */
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStage(scip), SCIP_STAGE_SOLVING);
+
+   SCIP_CALL( SCIPgetTransformedCons(scip, cons, &transcons) );
+   cr_assert_not_null(transcons);
+   SCIP_CALL( SCIPgetTransformedVars(scip, NVARS, vars, transvars) );
+
+   /* fix all but the last variable to zero: the last variable has to be fixed to one */
+   SCIP_CALL( SCIPstartProbing(scip) );
+   for( i = 0; i < NVARS - 1; ++i )
+   {
+      SCIP_CALL( SCIPfixVarProbing(scip, transvars[i], 0.0) );
+   }
+   cr_assert_eq(SCIPgetNFixedzerosSetppc(scip, transcons), NVARS - 1);
+
+   SCIP_CALL( SCIPpropagateProbing(scip, -1, &cutoff, &ndomreds) );
+   cr_assert(!cutoff);
+   cr_assert(SCIPvarGetLbLocal(transvars[NVARS - 1]) > 0.5);
+   cr_assert_eq(SCIPgetNFixedonesSetppc(scip, transcons), 1);
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   /* fixing all variables to zero is infeasible */
+   SCIP_CALL( SCIPstartProbing(scip) );
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPfixVarProbing(scip, transvars[i], 0.0) );
+   }
+   SCIP_CALL( SCIPpropagateProbing(scip, -1, &cutoff, &ndomreds) );
+   cr_assert(cutoff);
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
@@ -0,0 +1,249 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   evalbatch.c
+ * @brief  tests evaluation of expressions in several points at once
+ *
+ * The values and gradients computed by SCIPevalExprBatch() are compared to those of SCIPevalExpr() and
+ * SCIPevalExprGradient() in each point. Evaluating an expression again with its variables in a different order or after
+ * SCIPfreeExprBatch() must give the same values and gradients as before.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/expr_var.h"
+#include "include/scip_test.h"
+
+#define NPOINTS 17
+
+static SCIP* scip;
+static SCIP_SOL* sol;
+static SCIP_VAR* vars[3];
+static SCIP_RANDNUMGEN* rndgen;
+
+/** gives the partial derivative of an expression w.r.t. a variable, summed over all variable expressions of the variable */
+static
+SCIP_Real getPartialDiff(
+   SCIP_EXPR*            expr,               /**< expression */
+   SCIP_VAR*             var                 /**< variable */
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_Real deriv = 0.0;
+
+   SCIP_CALL_ABORT( SCIPcreateExpriter(scip, &it) );
+
+   for( SCIPexpriterInit(it, expr, SCIP_EXPRITER_DFS, FALSE); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+      if( SCIPisExprVar(scip, expr) && SCIPgetVarExprVar(expr) == var )
+         deriv += SCIPexprGetDerivative(expr);
+
+   SCIPfreeExpriter(&it);
+
+   return deriv;
+}
+
+/** compares value and gradient of an expression from a batch evaluation to those from an evaluation in each point */
+static
+void checkEvalBatch(
+   const char*           input,              /**< string of expression */
+   SCIP_Real             lb,                 /**< lower bound for random values of x and y */
+   SCIP_Real             ub                  /**< upper bound for random values of x and y */
+   )
+{
+   SCIP_EXPR* expr;
+   SCIP_Real varvals[3 * NPOINTS];
+   SCIP_Real vals[NPOINTS];
+   SCIP_Real grads[3 * NPOINTS];
+   int j;
+   int k;
+
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)input, NULL, NULL, NULL) );
+
+   for( k = 0; k < NPOINTS; ++k )
+   {
+      varvals[k] = SCIPrandomGetReal(rndgen, lb, ub);
+      varvals[NPOINTS + k] = SCIPrandomGetReal(rndgen, lb, ub);
+      varvals[2 * NPOINTS + k] = SCIPrandomGetReal(rndgen, -10.0, 10.0);
+   }
+
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, 3, vars, NPOINTS, varvals, vals, grads) );
+
+   for( k = 0; k < NPOINTS; ++k )
+   {
+      SCIP_Real val;
+
+      for( j = 0; j < 3; ++j )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sol, vars[j], varvals[j * NPOINTS + k]) );
+      }
+
+      SCIP_CALL( SCIPevalExprGradient(scip, expr, sol, 0) );
+      val = SCIPexprGetEvalValue(expr);
+
+      if( val == SCIP_INVALID || SCIPexprGetDerivative(expr) == SCIP_INVALID )
+      {
+         cr_expect(val != SCIP_INVALID || vals[k] == SCIP_INVALID, "value of <%s> in point %d: %g should be invalid",
+            input, k, vals[k]);
+         for( j = 0; j < 3; ++j )
+            cr_expect_eq(grads[j * NPOINTS + k], SCIP_INVALID, "derivative of <%s> in point %d should be invalid", input, k);
+         continue;
+      }
+
+      cr_expect(SCIPisEQ(scip, vals[k], val), "value of <%s> in point %d: %g != %g", input, k, vals[k], val);
+      for( j = 0; j < 3; ++j )
+      {
+         cr_expect(SCIPisEQ(scip, grads[j * NPOINTS + k], getPartialDiff(expr, vars[j])),
+            "derivative of <%s> w.r.t. <%s> in point %d: %g != %g", input, SCIPvarGetName(vars[j]), k,
+            grads[j * NPOINTS + k], getPartialDiff(expr, vars[j]));
+      }
+   }
+
+   /* without gradient */
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, 3, vars, NPOINTS, varvals, grads, NULL) );
+   for( k = 0; k < NPOINTS; ++k )
+      cr_expect_eq(grads[k], vals[k]);
+
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "test_problem") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[0], "x", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[1], "y", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[2], "z", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, vars[0]) );
+   SCIP_CALL( SCIPaddVar(scip, vars[1]) );
+   SCIP_CALL( SCIPaddVar(scip, vars[2]) );
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   SCIP_CALL( SCIPcreateRandom(scip, &rndgen, 1, TRUE) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIPfreeRandom(scip, &rndgen);
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIP_CALL( SCIPreleaseVar(scip, &vars[0]) );
+   SCIP_CALL( SCIPreleaseVar(scip, &vars[1]) );
+   SCIP_CALL( SCIPreleaseVar(scip, &vars[2]) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(evalbatch, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(evalbatch, callbacks, .description = "expressions with batch evaluation callbacks give the same values and gradients")
+{
+   cr_expect(SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "sum")));
+   cr_expect(SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "prod")));
+   cr_expect(SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "pow")));
+   cr_expect(SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "exp")));
+   cr_expect(SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "log")));
+   cr_expect(SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "sin")));
+   cr_expect(SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "cos")));
+
+   checkEvalBatch("<x>[C]", 0.1, 10.0);
+   checkEvalBatch("2.5", 0.1, 10.0);
+   checkEvalBatch("<x>[C] * <y>[C] + 3 * <z>[C] - 1", 0.1, 10.0);
+   checkEvalBatch("exp(<x>[C] * <y>[C] / 10) + (<x>[C] * <y>[C])^2 + log(<x>[C]) * <z>[C]", 0.1, 10.0);
+   checkEvalBatch("sin(<z>[C] * <x>[C]) / (1 + <y>[C]^2) + cos(<z>[C]) * sin(<z>[C] * <x>[C])", 0.1, 10.0);
+   checkEvalBatch("<x>[C]^1.5 * <y>[C]^(-2) - cos(<x>[C] + <y>[C] + <z>[C])^2", 0.1, 10.0);
+}
+
+Test(evalbatch, fallback, .description = "expressions without batch evaluation callbacks are evaluated point by point")
+{
+   cr_expect(!SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "abs")));
+   cr_expect(!SCIPexprhdlrHasEvalBatch(SCIPfindExprhdlr(scip, "entropy")));
+
+   checkEvalBatch("abs(<z>[C]) * entropy(<y>[C]) + signpower(<z>[C],2.5) * <x>[C]", 0.1, 10.0);
+   checkEvalBatch("abs(<x>[C] - <z>[C])^3 + entropy(<x>[C] * <y>[C])", 0.1, 10.0);
+}
+
+Test(evalbatch, invalid, .description = "points with domain errors get invalid values and gradients")
+{
+   /* some of the points are outside the domain of log, pow, and entropy */
+   checkEvalBatch("<y>[C] + log(<x>[C] - 1) * <z>[C]", 0.0, 2.0);
+   checkEvalBatch("(<x>[C] - 1)^0.5 + <y>[C]^(-1) * <z>[C]", 0.0, 2.0);
+   checkEvalBatch("entropy(<x>[C] - 1) + <z>[C]", 0.0, 2.0);
+}
+
+Test(evalbatch, varorder, .description = "later evaluations may give the variables in a different order")
+{
+   SCIP_EXPR* expr;
+   SCIP_VAR* revvars[3];
+   SCIP_Real varvals[3 * NPOINTS];
+   SCIP_Real revvarvals[3 * NPOINTS];
+   SCIP_Real vals[NPOINTS];
+   SCIP_Real revvals[NPOINTS];
+   SCIP_Real grads[3 * NPOINTS];
+   SCIP_Real revgrads[3 * NPOINTS];
+   int j;
+   int k;
+
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)"<x>[C] * exp(<y>[C] / 10) - <z>[C]^2 * <x>[C]", NULL, NULL, NULL) );
+
+   for( j = 0; j < 3; ++j )
+   {
+      revvars[j] = vars[2 - j];
+      for( k = 0; k < NPOINTS; ++k )
+      {
+         varvals[j * NPOINTS + k] = SCIPrandomGetReal(rndgen, -10.0, 10.0);
+         revvarvals[(2 - j) * NPOINTS + k] = varvals[j * NPOINTS + k];
+      }
+   }
+
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, 3, vars, NPOINTS, varvals, vals, grads) );
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, 3, revvars, NPOINTS, revvarvals, revvals, revgrads) );
+
+   for( k = 0; k < NPOINTS; ++k )
+   {
+      cr_expect_eq(revvals[k], vals[k], "value in point %d: %g != %g", k, revvals[k], vals[k]);
+      for( j = 0; j < 3; ++j )
+         cr_expect_eq(revgrads[(2 - j) * NPOINTS + k], grads[j * NPOINTS + k]);
+   }
+
+   /* after freeing the data stored in the expression, the evaluation gives the same values again */
+   SCIPfreeExprBatch(scip, expr);
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, 3, vars, NPOINTS, varvals, revvals, NULL) );
+
+   for( k = 0; k < NPOINTS; ++k )
+      cr_expect_eq(revvals[k], vals[k], "value in point %d: %g != %g", k, revvals[k], vals[k]);
+
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+}
@@ -0,0 +1,246 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   exprprog.c
+ * @brief  tests evaluation of expressions via expression programs
+ *
+ * The values and gradients computed with an expression program are compared to those of SCIPevalExpr() and
+ * SCIPevalExprGradient().
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/expr_var.h"
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_SOL* sol;
+static SCIP_VAR* x;
+static SCIP_VAR* y;
+static SCIP_VAR* z;
+static SCIP_RANDNUMGEN* rndgen;
+
+/** gives the partial derivative of an expression w.r.t. a variable, summed over all variable expressions of the variable */
+static
+SCIP_Real getPartialDiff(
+   SCIP_EXPR*            expr,               /**< expression */
+   SCIP_VAR*             var                 /**< variable */
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_Real deriv = 0.0;
+
+   SCIP_CALL_ABORT( SCIPcreateExpriter(scip, &it) );
+
+   for( SCIPexpriterInit(it, expr, SCIP_EXPRITER_DFS, FALSE); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+      if( SCIPisExprVar(scip, expr) && SCIPgetVarExprVar(expr) == var )
+         deriv += SCIPexprGetDerivative(expr);
+
+   SCIPfreeExpriter(&it);
+
+   return deriv;
+}
+
+/** compares value and gradient of an expression via an expression program to those from an expression walk in random points */
+static
+void checkEval(
+   const char*           input               /**< string of expression */
+   )
+{
+   SCIP_EXPRPROG* prog;
+   SCIP_EXPR* expr;
+   SCIP_Bool replacedroot;
+   int i;
+
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)input, NULL, NULL, NULL) );
+
+   /* share common subexpressions, such that the expression is a DAG */
+   SCIP_CALL( SCIPreplaceCommonSubexpressions(scip, &expr, 1, &replacedroot) );
+
+   SCIP_CALL( SCIPcreateExprprog(scip, &prog, expr) );
+
+   for( i = 0; i < 10; ++i )
+   {
+      SCIP_Real val;
+      SCIP_Real dx;
+      SCIP_Real dy;
+      SCIP_Real dz;
+
+      SCIP_CALL( SCIPsetSolVal(scip, sol, x, SCIPrandomGetReal(rndgen, 0.1, 10.0)) );
+      SCIP_CALL( SCIPsetSolVal(scip, sol, y, SCIPrandomGetReal(rndgen, 0.1, 10.0)) );
+      SCIP_CALL( SCIPsetSolVal(scip, sol, z, SCIPrandomGetReal(rndgen, -10.0, 10.0)) );
+
+      SCIP_CALL( SCIPevalExprGradient(scip, expr, sol, 0) );
+      val = SCIPexprGetEvalValue(expr);
+      dx = getPartialDiff(expr, x);
+      dy = getPartialDiff(expr, y);
+      dz = getPartialDiff(expr, z);
+
+      SCIP_CALL( SCIPevalExprprogGradient(scip, prog, sol, 0) );
+      cr_expect(SCIPisEQ(scip, SCIPexprGetEvalValue(expr), val), "value of <%s>: %g != %g", input,
+         SCIPexprGetEvalValue(expr), val);
+      cr_expect(SCIPisEQ(scip, getPartialDiff(expr, x), dx), "derivative of <%s> w.r.t. x: %g != %g", input,
+         getPartialDiff(expr, x), dx);
+      cr_expect(SCIPisEQ(scip, getPartialDiff(expr, y), dy), "derivative of <%s> w.r.t. y: %g != %g", input,
+         getPartialDiff(expr, y), dy);
+      cr_expect(SCIPisEQ(scip, getPartialDiff(expr, z), dz), "derivative of <%s> w.r.t. z: %g != %g", input,
+         getPartialDiff(expr, z), dz);
+
+      /* with a solution tag, nothing is reevaluated */
+      SCIP_CALL( SCIPevalExprprog(scip, prog, sol, 42L) );
+      val = SCIPexprGetEvalValue(expr);
+      SCIP_CALL( SCIPsetSolVal(scip, sol, x, 20.0) );
+      SCIP_CALL( SCIPevalExprprog(scip, prog, sol, 42L) );
+      cr_expect_eq(SCIPexprGetEvalValue(expr), val);
+   }
+
+   SCIPfreeExprprog(scip, &prog);
+   cr_expect_null(prog);
+
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "test_problem") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &x, "x", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &y, "y", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &z, "z", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, x) );
+   SCIP_CALL( SCIPaddVar(scip, y) );
+   SCIP_CALL( SCIPaddVar(scip, z) );
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   SCIP_CALL( SCIPcreateRandom(scip, &rndgen, 1, TRUE) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIPfreeRandom(scip, &rndgen);
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIP_CALL( SCIPreleaseVar(scip, &x) );
+   SCIP_CALL( SCIPreleaseVar(scip, &y) );
+   SCIP_CALL( SCIPreleaseVar(scip, &z) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(exprprog, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(exprprog, order, .description = "subexpressions appear once and after their children")
+{
+   SCIP_EXPRPROG* prog;
+   SCIP_EXPR** exprs;
+   SCIP_EXPR* expr;
+   SCIP_Bool replacedroot;
+   const char* input = "exp(<x>[C] * <y>[C]) + (<x>[C] * <y>[C])^2 + log(<x>[C])";
+   int nexprs;
+   int i;
+   int j;
+   int c;
+
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)input, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPreplaceCommonSubexpressions(scip, &expr, 1, &replacedroot) );
+
+   SCIP_CALL( SCIPcreateExprprog(scip, &prog, expr) );
+
+   exprs = SCIPexprprogGetExprs(prog);
+   nexprs = SCIPexprprogGetNExprs(prog);
+
+   /* sum, exp, pow, log, product, x, y */
+   cr_assert_eq(nexprs, 7);
+   cr_assert_eq(exprs[nexprs-1], expr);
+
+   for( i = 0; i < nexprs; ++i )
+   {
+      int* childpos;
+
+      for( j = 0; j < i; ++j )
+         cr_expect_neq(exprs[i], exprs[j], "expression at positions %d and %d", i, j);
+
+      childpos = SCIPexprprogGetChildPos(prog, i);
+      for( c = 0; c < SCIPexprGetNChildren(exprs[i]); ++c )
+      {
+         cr_expect_lt(childpos[c], i);
+         cr_expect_eq(exprs[childpos[c]], SCIPexprGetChildren(exprs[i])[c]);
+      }
+   }
+
+   SCIPfreeExprprog(scip, &prog);
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+}
+
+Test(exprprog, eval, .description = "values and gradients are the same as with an expression walk")
+{
+   checkEval("<x>[C]");
+   checkEval("2.5");
+   checkEval("<x>[C] * <y>[C] + 3 * <z>[C]");
+   checkEval("exp(<x>[C] * <y>[C]) + (<x>[C] * <y>[C])^2 + log(<x>[C]) * <z>[C]");
+   checkEval("sin(<z>[C] * <x>[C]) / (1 + <y>[C]^2) + abs(<z>[C]) * sin(<z>[C] * <x>[C])");
+   checkEval("<x>[C]^1.5 * <y>[C]^(-2) + entropy(<y>[C]) - cos(<x>[C] + <y>[C] + <z>[C])^2");
+}
+
+Test(exprprog, invalid, .description = "evaluation errors are reported for value and gradient")
+{
+   SCIP_EXPRPROG* prog;
+   SCIP_EXPR* expr;
+   const char* input = "<y>[C] + log(<x>[C] - 1) * <z>[C]";
+
+   SCIP_CALL( SCIPparseExpr(scip, &expr, (char*)input, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprprog(scip, &prog, expr) );
+
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 0.5) );
+   SCIP_CALL( SCIPevalExprprog(scip, prog, sol, 0) );
+   cr_expect_eq(SCIPexprGetEvalValue(expr), SCIP_INVALID);
+
+   SCIP_CALL( SCIPevalExprprogGradient(scip, prog, sol, 0) );
+   cr_expect_eq(SCIPexprGetDerivative(expr), SCIP_INVALID);
+
+   /* the domain error is remembered for the solution tag */
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 2.0) );
+   SCIP_CALL( SCIPevalExprprog(scip, prog, sol, 1L) );
+   cr_expect_neq(SCIPexprGetEvalValue(expr), SCIP_INVALID);
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 0.5) );
+   SCIP_CALL( SCIPevalExprprog(scip, prog, sol, 2L) );
+   cr_expect_eq(SCIPexprGetEvalValue(expr), SCIP_INVALID);
+   SCIP_CALL( SCIPevalExprprog(scip, prog, sol, 2L) );
+   cr_expect_eq(SCIPexprGetEvalValue(expr), SCIP_INVALID);
+
+   SCIPfreeExprprog(scip, &prog);
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+}
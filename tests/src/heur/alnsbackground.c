@@ -0,0 +1,177 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+/**@file   alnsbackground.c
+ * @brief  unit test for solving the sub-SCIPs of ALNS in the background
+ *
+ * Solves a small multidimensional knapsack problem with sub-SCIPs of ALNS running on worker threads and checks that
+ * background jobs are launched and collected, that they pass solutions to the main SCIP, that the optimal value matches
+ * the one found with synchronous sub-SCIPs, and that sub-SCIPs still running at the end of the solve are interrupted
+ * and freed. Without the tinycthread implementation of the task processing interface, the sub-SCIPs are solved
+ * synchronously, and it is checked that no background job is launched.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/heur_alns.c"
+
+#include "include/scip_test.h"
+
+#define NITEMS 24
+
+static SCIP* scip;
+static SCIP_HEUR* alns;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NITEMS];
+   SCIP_Real weights[NITEMS];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int d;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "mknapsack") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real) (10 + (7 * i) % 13), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   for( d = 0; d < 3; ++d )
+   {
+      for( i = 0; i < NITEMS; ++i )
+         weights[i] = (SCIP_Real) (3 + (5 * i + 3 * d) % 11);
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "capacity%d", d);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, NITEMS, vars, weights, -SCIPinfinity(scip), 40.0) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   alns = SCIPfindHeur(scip, "alns");
+   cr_assert(alns != NULL);
+
+   /* call ALNS at every node; the problem is solved by branching since there is no LP, and the sub-SCIPs get enough
+    * nodes to find improving solutions
+    */
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/freq", 1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/nbackground", 2) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 4) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "heuristics/alns/nodesofs", 2000LL) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "heuristics/alns/initduringroot", TRUE) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(alnsbackground, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(alnsbackground, optimal, .description = "background sub-SCIPs do not change the optimal value")
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_Real optval;
+
+   heurdata = SCIPheurGetData(alns);
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect_gt(SCIPheurGetNCalls(alns), 0);
+   optval = SCIPgetPrimalbound(scip);
+
+#ifdef TPI_TNY
+   /* sub-SCIPs were solved in the background, and their results and solutions reached the main SCIP */
+   cr_expect_gt(heurdata->nbglaunched, 0);
+   cr_expect_gt(heurdata->nbgcollected, 0);
+   cr_expect_gt(heurdata->nbgsols, 0);
+   cr_expect_leq(heurdata->nbgcollected + heurdata->nbgdiscarded, heurdata->nbglaunched);
+#else
+   cr_expect_eq(heurdata->nbglaunched, 0);
+#endif
+
+   /* solve again with synchronous sub-SCIPs */
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/nbackground", 0) );
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect_eq(heurdata->nbglaunched, 0);
+
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optval), "optimal value %g with background sub-SCIPs, %g without",
+      optval, SCIPgetPrimalbound(scip));
+}
+
+Test(alnsbackground, interrupt, .description = "sub-SCIPs running at the end of the solve are interrupted and freed")
+{
+   SCIP_HEURDATA* heurdata;
+
+   heurdata = SCIPheurGetData(alns);
+
+   /* stop after a few nodes, such that ALNS has launched sub-SCIPs that have not finished yet */
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 5LL) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "heuristics/alns/nodesofs", 100000LL) );
+   SCIP_CALL( SCIPsetRealParam(scip, "heuristics/alns/nodesquot", 1.0) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_expect_eq(SCIPgetStatus(scip), SCIP_STATUS_NODELIMIT);
+   cr_expect_gt(SCIPheurGetNCalls(alns), 0);
+
+   /* the transformed problem can be freed and solved again; freeing it discards the sub-SCIPs that are still running,
+    * such that every launched sub-SCIP has been collected or discarded, depending on whether it finished in time
+    */
+   SCIP_CALL( SCIPfreeTransform(scip) );
+#ifdef TPI_TNY
+   cr_expect_gt(heurdata->nbglaunched, 0);
+   cr_expect_eq(heurdata->nbgcollected + heurdata->nbgdiscarded, heurdata->nbglaunched);
+#else
+   cr_expect_eq(heurdata->nbglaunched, 0);
+#endif
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", -1LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_expect_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+}
@@ -0,0 +1,188 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   subscipcache.c
+ * @brief  unit test for reusing the sub-SCIP of a large neighborhood search heuristic between calls
+ *
+ * A test heuristic fixes a different variable of a small knapsack problem in every call and solves its cached sub-SCIP.
+ * The tests check that the sub-SCIP is copied only in the first call, that each call sees only its own fixing and the
+ * global bounds, that the hits and misses of the heuristic count the calls, and that freeing the transformed problem
+ * of the main SCIP forces a new copy.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 8
+
+static SCIP* scip;
+static SCIP_HEUR* heur;
+static int ncalls;
+static int ncreated;
+
+/** execution method of the test heuristic */
+static
+SCIP_DECL_HEUREXEC(heurExecCachetest)
+{
+   SCIP* subscip;
+   SCIP_VAR** subvars;
+   SCIP_VAR** vars;
+   SCIP_VAR* fixedvar;
+   SCIP_Real fixedval;
+   SCIP_Bool created;
+   SCIP_Bool success;
+   int nvars;
+   int i;
+
+   *result = SCIP_DIDNOTFIND;
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   /* fix a different variable in every call */
+   fixedvar = vars[ncalls % nvars];
+   fixedval = SCIPvarGetUbGlobal(fixedvar);
+
+   SCIP_CALL( SCIPgetCachedSubscip(scip, heur, "test", &fixedvar, &fixedval, 1, FALSE, &subscip, &subvars, &created, NULL) );
+   cr_assert_eq(SCIPgetStage(subscip), SCIP_STAGE_PROBLEM);
+
+   ++ncalls;
+   if( created )
+   {
+      ++ncreated;
+      SCIP_CALL( SCIPsetIntParam(subscip, "display/verblevel", 0) );
+   }
+
+   /* only the fixing of this call is applied; all other variables have their global bounds */
+   for( i = 0; i < nvars; ++i )
+   {
+      cr_assert(subvars[i] != NULL);
+      if( vars[i] == fixedvar )
+      {
+         cr_expect(SCIPisEQ(scip, SCIPvarGetLbOriginal(subvars[i]), fixedval));
+         cr_expect(SCIPisEQ(scip, SCIPvarGetUbOriginal(subvars[i]), fixedval));
+      }
+      else
+      {
+         cr_expect(SCIPisEQ(scip, SCIPvarGetLbOriginal(subvars[i]), SCIPvarGetLbGlobal(vars[i])));
+         cr_expect(SCIPisEQ(scip, SCIPvarGetUbOriginal(subvars[i]), SCIPvarGetUbGlobal(vars[i])));
+      }
+   }
+
+   SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", 10LL) );
+   SCIP_CALL( SCIPsolve(subscip) );
+
+   SCIP_CALL( SCIPtranslateSubSols(scip, subscip, heur, subvars, &success, NULL) );
+   if( success )
+      *result = SCIP_FOUNDSOL;
+
+   SCIP_CALL( SCIPreleaseCachedSubscip(scip, heur, &subscip, FALSE) );
+   cr_assert(subscip == NULL);
+
+   return SCIP_OKAY;
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS];
+   SCIP_Real weights[NVARS];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "knapsack") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real) (i + 2), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      weights[i] = (SCIP_Real) (i + 1);
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", NVARS, vars, weights, -SCIPinfinity(scip), 13.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   /* solve without LP and let only the test heuristic run */
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 20LL) );
+
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur, "test", "test heuristic with cached sub-SCIP", 't', 0, 1, 0, -1,
+         SCIP_HEURTIMING_AFTERNODE, TRUE, heurExecCachetest, NULL) );
+
+   ncalls = 0;
+   ncreated = 0;
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(subscipcache, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(subscipcache, reuse, .description = "the sub-SCIP is copied once and reused in later calls")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_gt(ncalls, 1);
+   cr_expect_eq(ncreated, 1);
+   cr_expect_eq(SCIPheurGetNSubscipMisses(heur), ncreated);
+   cr_expect_eq(SCIPheurGetNSubscipHits(heur), ncalls - ncreated);
+}
+
+Test(subscipcache, freetransform, .description = "the sub-SCIP is freed with the transformed problem of the main SCIP")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+   SCIP_CALL( SCIPfreeTransform(scip) );
+
+   /* solving again needs a new copy */
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_gt(ncalls, 2);
+   cr_expect_eq(ncreated, 2);
+}
@@ -0,0 +1,287 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   bmsthreads.c
+ * @brief  allocation throughput of thread-private block memories compared to plain malloc
+ *
+ * Block memories are not thread-safe; parallel code has to give each thread its own BMS_BLKMEM. The tests below run
+ * the same allocation pattern in 1, 4, and 16 jobs of the task processing interface, once with a private block memory
+ * per job and once with BMSallocMemory(), and report the throughput of both. The pattern mimics the sizes of rows,
+ * nodes, and domain changes.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "tpi/tpi.h"
+#include "include/scip_test.h"
+
+#define NELEMS     4096      /* number of elements that are alive at the same time in each job */
+#define NROUNDS    64        /* number of rounds of freeing and reallocating half of the elements */
+#define NSIZES     6         /* number of different element sizes */
+
+/** data of a single allocation job */
+struct AllocJob
+{
+   SCIP_Bool             useblkmem;          /* should a private block memory be used instead of malloc? */
+   unsigned int          seed;               /* seed for the sequence of element sizes */
+   long long             nops;               /* number of allocations and frees performed */
+   SCIP_Bool             leak;               /* did the block memory report used memory at the end? */
+};
+typedef struct AllocJob ALLOCJOB;
+
+/* global variables */
+static SCIP* scip;
+static const size_t sizes[NSIZES] = { 16, 24, 48, 96, 136, 256 };
+
+/** returns the next pseudo random number of a linear congruential generator */
+static
+unsigned int nextRand(
+   unsigned int*         seed                /**< seed of the generator */
+   )
+{
+   *seed = *seed * 1103515245u + 12345u;
+   return (*seed >> 16) & 0x7fff;
+}
+
+/** job that allocates and frees elements of varying sizes */
+static
+SCIP_RETCODE allocJob(
+   void*                 args                /**< the ALLOCJOB data */
+   )
+{
+   ALLOCJOB* job;
+   BMS_BLKMEM* blkmem = NULL;
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   void* elems[NELEMS];
+   size_t elemsizes[NELEMS];
+   unsigned int seed;
+   int r;
+   int i;
+
+   job = (ALLOCJOB*) args;
+   seed = job->seed;
+   job->nops = 0;
+   job->leak = FALSE;
+
+   for( i = 0; i < NELEMS; ++i )
+      elems[i] = NULL;
+
+   /* each job owns its block memory, so no synchronization is needed */
+   if( job->useblkmem )
+   {
+      blkmem = BMScreateBlockMemory(1, 10);
+      if( blkmem == NULL )
+         return SCIP_NOMEMORY;
+   }
+
+   for( i = 0; i < NELEMS; ++i )
+   {
+      elemsizes[i] = sizes[nextRand(&seed) % NSIZES];
+      if( job->useblkmem )
+         BMSallocBlockMemorySize(blkmem, &elems[i], elemsizes[i]);
+      else
+         BMSallocMemorySize(&elems[i], elemsizes[i]);
+      if( elems[i] == NULL )
+      {
+         retcode = SCIP_NOMEMORY;
+         goto TERMINATE;
+      }
+   }
+   job->nops += NELEMS;
+
+   for( r = 0; r < NROUNDS; ++r )
+   {
+      /* free every second element, with an offset depending on the round, and reallocate it with a new size */
+      for( i = r % 2; i < NELEMS; i += 2 )
+      {
+         if( job->useblkmem )
+            BMSfreeBlockMemorySize(blkmem, &elems[i], elemsizes[i]);
+         else
+            BMSfreeMemory(&elems[i]);
+      }
+
+      for( i = r % 2; i < NELEMS; i += 2 )
+      {
+         elemsizes[i] = sizes[nextRand(&seed) % NSIZES];
+         if( job->useblkmem )
+            BMSallocBlockMemorySize(blkmem, &elems[i], elemsizes[i]);
+         else
+            BMSallocMemorySize(&elems[i], elemsizes[i]);
+         if( elems[i] == NULL )
+         {
+            retcode = SCIP_NOMEMORY;
+            goto TERMINATE;
+         }
+      }
+      job->nops += NELEMS;
+   }
+
+ TERMINATE:
+   /* free the remaining elements; after a failed allocation, some of them are not allocated */
+   for( i = NELEMS - 1; i >= 0; --i )
+   {
+      if( elems[i] == NULL )
+         continue;
+
+      if( job->useblkmem )
+         BMSfreeBlockMemorySize(blkmem, &elems[i], elemsizes[i]);
+      else
+         BMSfreeMemory(&elems[i]);
+      ++job->nops;
+   }
+
+   if( job->useblkmem )
+   {
+      job->leak = (BMSgetBlockMemoryUsed(blkmem) != 0);
+      BMSdestroyBlockMemory(&blkmem);
+   }
+
+   return retcode;
+}
+
+/** runs the allocation pattern in the given number of jobs and returns the number of operations per second
+ *
+ *  Without a task processing interface, the jobs are run one after the other.
+ */
+static
+SCIP_Real runJobs(
+   int                   njobs,              /**< number of jobs */
+   SCIP_Bool             useblkmem           /**< should private block memories be used? */
+   )
+{
+   SCIP_CLOCK* clock;
+   ALLOCJOB* jobs;
+   SCIP_Real time;
+   long long nops;
+   int i;
+#ifndef TPI_NONE
+   SCIP_SUBMITSTATUS status;
+   int jobid;
+#endif
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, njobs) );
+   SCIP_CALL( SCIPcreateWallClock(scip, &clock) );
+
+   for( i = 0; i < njobs; ++i )
+   {
+      jobs[i].useblkmem = useblkmem;
+      jobs[i].seed = (unsigned int) (i + 1);
+   }
+
+#ifdef TPI_NONE
+   SCIP_CALL( SCIPstartClock(scip, clock) );
+
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_CALL( allocJob(&jobs[i]) );
+   }
+
+   SCIP_CALL( SCIPstopClock(scip, clock) );
+#else
+   SCIP_CALL( SCIPtpiInit(njobs, INT_MAX, FALSE) );
+
+   SCIP_CALL( SCIPstartClock(scip, clock) );
+
+   jobid = SCIPtpiGetNewJobID();
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_JOB* job;
+
+      SCIP_CALL( SCIPtpiCreateJob(&job, jobid, allocJob, &jobs[i]) );
+      SCIP_CALL( SCIPtpiSubmitJob(job, &status) );
+      cr_assert_eq(status, SCIP_SUBMIT_SUCCESS);
+   }
+   SCIP_CALL( SCIPtpiCollectJobs(jobid) );
+
+   SCIP_CALL( SCIPstopClock(scip, clock) );
+
+   SCIP_CALL( SCIPtpiExit() );
+#endif
+
+   time = SCIPgetClockTime(scip, clock);
+
+   nops = 0;
+   for( i = 0; i < njobs; ++i )
+   {
+      cr_assert(!jobs[i].leak, "block memory of job %d is not empty", i);
+      nops += jobs[i].nops;
+   }
+
+   SCIP_CALL( SCIPfreeClock(scip, &clock) );
+   SCIPfreeBufferArray(scip, &jobs);
+
+   return (SCIP_Real) nops / MAX(time, 1e-6);
+}
+
+/** compares the throughput of private block memories and malloc for the given number of jobs */
+static
+void compareThroughput(
+   int                   njobs               /**< number of jobs */
+   )
+{
+   SCIP_Real blkmemops;
+   SCIP_Real mallocops;
+
+   blkmemops = runJobs(njobs, TRUE);
+   mallocops = runJobs(njobs, FALSE);
+
+   SCIPinfoMessage(scip, NULL, "%2d jobs: block memory %10.3g ops/s, malloc %10.3g ops/s, ratio %.2f\n",
+      njobs, blkmemops, mallocops, blkmemops / mallocops);
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(bmsthreads, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(bmsthreads, onejob)
+{
+   compareThroughput(1);
+}
+
+Test(bmsthreads, fourjobs)
+{
+   compareThroughput(4);
+}
+
+Test(bmsthreads, sixteenjobs)
+{
+   compareThroughput(16);
+}
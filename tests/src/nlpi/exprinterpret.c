@@ -521,6 +521,35 @@ Test(checkad, griewank)
    SCIP_CALL( SCIPreleaseExpr(scip, &exprsum) );
 }
 
+/* expressions of the same structure share a tape, expressions with other coefficients or variables must not */
+Test(checkad, tapecache)
+{
+   SCIP_EXPR* expr;
+   SCIP_EXPR* children[2];
+   SCIP_Real coef;
+   int k;
+
+   varvals[0][0] = 0.5;
+   varvals[0][1] = -1.5;
+   varvals[1][0] = -2.0;
+   varvals[1][1] = 0.25;
+
+   /* x0 * exp(x1) twice, then x1 * exp(x0), then 2*x0 * exp(x1) */
+   for( k = 0; k < 4; ++k )
+   {
+      coef = k == 3 ? 2.0 : 1.0;
+      SCIP_CALL( SCIPcreateExprSum(scip, &children[0], 1, &varexprs[k == 2 ? 1 : 0], &coef, 0.0, NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprExp(scip, &children[1], varexprs[k == 2 ? 0 : 1], NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprProduct(scip, &expr, 2, children, 1.0, NULL, NULL) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &children[1]) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &children[0]) );
+
+      checkAD(expr, 2, 2);
+
+      SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+   }
+}
+
 /* for testing, keep these numbers down
  * but to check timing, set these numbers higher
  */
@@ -545,3 +545,192 @@ Test(nlpi, fixvars, .init = setup, .fini = teardown,
       SCIP_CALL( resolveAfterFixingVars(nlpi) );
    }
 }
+
+#define NTHREADVARS  40
+#define NTHREADCONSS 300
+
+/* helper function to create an oracle with NTHREADCONSS nonlinear constraints of the form
+ * x_a * x_b + 2 x_c^p + 0.5 exp(x_b) and objective x_0^4
+ */
+static
+SCIP_RETCODE createThreadsOracle(
+   SCIP_NLPIORACLE**     oracle
+   )
+{
+   SCIP_EXPR* exprs[NTHREADCONSS];
+   SCIP_EXPR* varexprs[3];
+   SCIP_EXPR* children[3];
+   SCIP_Real coefs[3] = {1.0, 2.0, 0.5};
+   SCIP_EXPR* objexpr;
+   int i;
+
+   SCIP_CALL( SCIPnlpiOracleCreate(scip, oracle) );
+   SCIP_CALL( SCIPnlpiOracleAddVars(scip, *oracle, NTHREADVARS, NULL, NULL, NULL) );
+
+   for( i = 0; i < NTHREADCONSS; ++i )
+   {
+      SCIP_CALL( SCIPcreateExprVaridx(scip, &varexprs[0], i % NTHREADVARS, NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprVaridx(scip, &varexprs[1], (7 * i + 1) % NTHREADVARS, NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprVaridx(scip, &varexprs[2], (3 * i + 2) % NTHREADVARS, NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprProduct(scip, &children[0], 2, varexprs, 1.0, NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprPow(scip, &children[1], varexprs[2], 2.0 + (i % 3), NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprExp(scip, &children[2], varexprs[1], NULL, NULL) );
+      SCIP_CALL( SCIPcreateExprSum(scip, &exprs[i], 3, children, coefs, 0.0, NULL, NULL) );
+
+      SCIP_CALL( SCIPreleaseExpr(scip, &children[2]) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &children[1]) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &children[0]) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &varexprs[2]) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &varexprs[1]) );
+      SCIP_CALL( SCIPreleaseExpr(scip, &varexprs[0]) );
+   }
+   SCIP_CALL( SCIPnlpiOracleAddConstraints(scip, *oracle, NTHREADCONSS, NULL, NULL, NULL, NULL, NULL, exprs, NULL) );
+
+   for( i = 0; i < NTHREADCONSS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseExpr(scip, &exprs[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateExprVaridx(scip, &varexprs[0], 0, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprPow(scip, &objexpr, varexprs[0], 4.0, NULL, NULL) );
+   SCIP_CALL( SCIPnlpiOracleSetObjective(scip, *oracle, 0.0, 0, NULL, NULL, objexpr) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &objexpr) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &varexprs[0]) );
+
+   return SCIP_OKAY;
+}
+
+Test(nlpi, evalnthreads, .init = setup, .fini = teardown,
+   .description = "compares the Jacobian and Hessian of the Lagrangian of an oracle evaluated with one and with several threads"
+   )
+{
+   SCIP_NLPIORACLE* oracle1;
+   SCIP_NLPIORACLE* oracle4;
+   const int* offset;
+   const int* col;
+   SCIP_Real* jac1;
+   SCIP_Real* jac4;
+   SCIP_Real* hes1;
+   SCIP_Real* hes4;
+   SCIP_Real x[NTHREADVARS];
+   SCIP_Real lambdas[NTHREADCONSS];
+   int njac;
+   int nhes;
+   int round;
+   int i;
+
+   /* the number of threads is taken from the parameters when the oracle is created */
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 4) );
+   SCIP_CALL( SCIPsetIntParam(scip, "nlp/evalnthreads", 1) );
+   SCIP_CALL( createThreadsOracle(&oracle1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "nlp/evalnthreads", 4) );
+   SCIP_CALL( createThreadsOracle(&oracle4) );
+
+   SCIP_CALL( SCIPnlpiOracleGetJacobianSparsity(scip, oracle1, &offset, &col) );
+   njac = offset[NTHREADCONSS];
+   SCIP_CALL( SCIPnlpiOracleGetJacobianSparsity(scip, oracle4, &offset, &col) );
+   cr_assert_eq(offset[NTHREADCONSS], njac);
+
+   SCIP_CALL( SCIPnlpiOracleGetHessianLagSparsity(scip, oracle1, &offset, &col) );
+   nhes = offset[NTHREADVARS];
+   SCIP_CALL( SCIPnlpiOracleGetHessianLagSparsity(scip, oracle4, &offset, &col) );
+   cr_assert_eq(offset[NTHREADVARS], nhes);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jac1, njac) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jac4, njac) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &hes1, nhes) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &hes4, nhes) );
+
+   /* the first round is evaluated sequentially by both oracles, later rounds in parallel by the second one;
+    * some multipliers are zero to check that the Hessians of these constraints are still prepared
+    */
+   for( round = 0; round < 4; ++round )
+   {
+      for( i = 0; i < NTHREADVARS; ++i )
+         x[i] = 0.1 * ((13 * i + 5 * round) % 17) - 0.7;
+      for( i = 0; i < NTHREADCONSS; ++i )
+         lambdas[i] = (i + round) % 4 == 0 ? 0.0 : 0.01 * ((11 * i + round) % 23);
+
+      SCIP_CALL( SCIPnlpiOracleEvalJacobian(scip, oracle1, x, TRUE, NULL, jac1) );
+      SCIP_CALL( SCIPnlpiOracleEvalJacobian(scip, oracle4, x, TRUE, NULL, jac4) );
+      for( i = 0; i < njac; ++i )
+         cr_expect_eq(jac1[i], jac4[i], "round %d: Jacobian entry %d differs: %g != %g", round, i, jac1[i], jac4[i]);
+
+      SCIP_CALL( SCIPnlpiOracleEvalHessianLag(scip, oracle1, x, TRUE, TRUE, 1.5, lambdas, hes1) );
+      SCIP_CALL( SCIPnlpiOracleEvalHessianLag(scip, oracle4, x, TRUE, TRUE, 1.5, lambdas, hes4) );
+      for( i = 0; i < nhes; ++i )
+         cr_expect(SCIPisEQ(scip, hes1[i], hes4[i]), "round %d: Hessian entry %d differs: %g != %g", round, i, hes1[i], hes4[i]);
+   }
+
+   SCIPfreeBufferArray(scip, &hes4);
+   SCIPfreeBufferArray(scip, &hes1);
+   SCIPfreeBufferArray(scip, &jac4);
+   SCIPfreeBufferArray(scip, &jac1);
+
+   SCIP_CALL( SCIPnlpiOracleFree(scip, &oracle4) );
+   SCIP_CALL( SCIPnlpiOracleFree(scip, &oracle1) );
+}
+
+#define NTHREADRUNS  60
+
+Test(nlpi, evalnthreadsruns, .init = setup, .fini = teardown,
+   .description = "evaluates derivatives in parallel in several SCIP instances one after the other, each starting its own worker threads"
+   )
+{
+   SCIP_NLPIORACLE* oracle;
+   const int* offset;
+   const int* col;
+   SCIP_Real jacref[3 * NTHREADCONSS];
+   SCIP_Real jac[3 * NTHREADCONSS];
+   SCIP_Real hes[NTHREADVARS * NTHREADVARS];
+   SCIP_Real x[NTHREADVARS];
+   SCIP_Real lambdas[NTHREADCONSS];
+   int njac = 0;
+   int nhes;
+   int run;
+   int i;
+
+   for( i = 0; i < NTHREADVARS; ++i )
+      x[i] = 0.1 * ((13 * i) % 17) - 0.7;
+   for( i = 0; i < NTHREADCONSS; ++i )
+      lambdas[i] = 0.01 * ((11 * i) % 23);
+
+   /* the threads of a SCIP instance exit when it is freed; their CppAD thread numbers must be given back, since CppAD
+    * supports only a limited number of them
+    */
+   for( run = 0; run < NTHREADRUNS; ++run )
+   {
+      SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 4) );
+      SCIP_CALL( SCIPsetIntParam(scip, "nlp/evalnthreads", 4) );
+      SCIP_CALL( createThreadsOracle(&oracle) );
+
+      SCIP_CALL( SCIPnlpiOracleGetJacobianSparsity(scip, oracle, &offset, &col) );
+      cr_assert_leq(offset[NTHREADCONSS], 3 * NTHREADCONSS);
+      if( run == 0 )
+         njac = offset[NTHREADCONSS];
+      cr_assert_eq(offset[NTHREADCONSS], njac);
+
+      SCIP_CALL( SCIPnlpiOracleGetHessianLagSparsity(scip, oracle, &offset, &col) );
+      nhes = offset[NTHREADVARS];
+      cr_assert_leq(nhes, NTHREADVARS * NTHREADVARS);
+
+      /* the first evaluation is sequential, the second one in parallel */
+      SCIP_CALL( SCIPnlpiOracleEvalJacobian(scip, oracle, x, TRUE, NULL, jac) );
+      SCIP_CALL( SCIPnlpiOracleEvalHessianLag(scip, oracle, x, TRUE, TRUE, 1.5, lambdas, hes) );
+      SCIP_CALL( SCIPnlpiOracleEvalJacobian(scip, oracle, x, TRUE, NULL, jac) );
+      SCIP_CALL( SCIPnlpiOracleEvalHessianLag(scip, oracle, x, TRUE, TRUE, 1.5, lambdas, hes) );
+
+      for( i = 0; i < njac; ++i )
+      {
+         if( run == 0 )
+            jacref[i] = jac[i];
+         cr_expect_eq(jac[i], jacref[i], "run %d: Jacobian entry %d differs: %g != %g", run, i, jac[i], jacref[i]);
+      }
+
+      SCIP_CALL( SCIPnlpiOracleFree(scip, &oracle) );
+
+      /* freeing SCIP releases the thread pool */
+      SCIP_CALL( SCIPfree(&scip) );
+      setup();
+   }
+}
@@ -0,0 +1,134 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   mpsbenchmark.c
+ * @brief  benchmark for reading a generated MPS file
+ *
+ * A set covering instance is written in MPS format and read back. The test checks the dimensions of the problem and
+ * that the MPS reader counted all bytes of the file, and reports the read throughput in MB/s.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NROWS     2000                       /**< number of rows of the generated instance */
+#define NCOLS    20000                       /**< number of columns of the generated instance */
+#define NENTRIES     6                       /**< number of nonzero entries per column */
+
+static SCIP* scip;
+
+/** writes a set covering instance in free MPS format and returns the size of the file in bytes */
+static
+long writeMps(
+   const char*           filename            /**< name of the file to write */
+   )
+{
+   FILE* fp;
+   long size;
+   int i;
+   int j;
+
+   fp = fopen(filename, "w");
+   cr_assert(fp != NULL);
+
+   fprintf(fp, "NAME          benchmark\n");
+   fprintf(fp, "ROWS\n");
+   fprintf(fp, " N  obj\n");
+   for( i = 0; i < NROWS; ++i )
+      fprintf(fp, " G  c%d\n", i);
+
+   fprintf(fp, "COLUMNS\n");
+   fprintf(fp, "    MARKER                 'MARKER'                 'INTORG'\n");
+   for( j = 0; j < NCOLS; ++j )
+   {
+      fprintf(fp, "    x%d  obj  %d\n", j, 1 + j % 17);
+
+      /* spread the entries of a column over the rows such that every row is covered */
+      for( i = 0; i < NENTRIES; ++i )
+         fprintf(fp, "    x%d  c%d  1\n", j, (j + i * (NROWS / NENTRIES)) % NROWS);
+   }
+   fprintf(fp, "    MARKER                 'MARKER'                 'INTEND'\n");
+
+   fprintf(fp, "RHS\n");
+   for( i = 0; i < NROWS; ++i )
+      fprintf(fp, "    rhs  c%d  1\n", i);
+
+   fprintf(fp, "ENDATA\n");
+
+   size = ftell(fp);
+   fclose(fp);
+
+   return size;
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(mpsbenchmark, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(mpsbenchmark, setcover, .description = "read a generated set covering instance and report the throughput")
+{
+   const char* filename = "mpsbenchmark.mps";
+   SCIP_READER* reader;
+   SCIP_Longint nbytes;
+
+   nbytes = (SCIP_Longint) writeMps(filename);
+
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+
+   (void)remove(filename);
+
+   cr_assert_eq(SCIPgetNOrigVars(scip), NCOLS);
+   cr_assert_eq(SCIPgetNOrigBinVars(scip), NCOLS);
+   cr_assert_eq(SCIPgetNOrigConss(scip), NROWS);
+
+   reader = SCIPfindReader(scip, "mpsreader");
+   cr_assert(reader != NULL);
+   cr_assert_eq(SCIPreaderGetNReadBytes(reader), nbytes, "reader counted %lld bytes of %lld", SCIPreaderGetNReadBytes(reader), nbytes);
+
+   /* the timing statistics list the throughput of the MPS reader */
+   SCIPprintTimingStatistics(scip, NULL);
+}
@@ -0,0 +1,159 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   snp.c
+ * @brief  unit test for writing and reading binary problem snapshots
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define SNPFILE "snptest.snp"
+
+static SCIP* scip;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   char filename[SCIP_MAXSTRLEN];
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   TESTsetTestfilename(filename, __FILE__, "oc5.mps");
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   (void)remove(SNPFILE);
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(readersnp, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(readersnp, original, .description = "write the original problem and read it back")
+{
+   SCIP_VAR** vars;
+   SCIP_CONS** conss;
+   SCIP_Real lbs[5];
+   SCIP_Real ubs[5];
+   SCIP_Real objs[5];
+   SCIP_OBJSENSE objsense;
+   int nconss;
+   int nvars;
+   int i;
+
+   nvars = SCIPgetNOrigVars(scip);
+   nconss = SCIPgetNOrigConss(scip);
+   objsense = SCIPgetObjsense(scip);
+   cr_assert_eq(nvars, 5);
+
+   vars = SCIPgetOrigVars(scip);
+   for( i = 0; i < nvars; ++i )
+   {
+      lbs[i] = SCIPvarGetLbOriginal(vars[i]);
+      ubs[i] = SCIPvarGetUbOriginal(vars[i]);
+      objs[i] = SCIPvarGetObj(vars[i]);
+   }
+
+   SCIP_CALL( SCIPwriteOrigProblem(scip, SNPFILE, NULL, FALSE) );
+   SCIP_CALL( SCIPfreeProb(scip) );
+   SCIP_CALL( SCIPreadProb(scip, SNPFILE, NULL) );
+
+   cr_assert_eq(SCIPgetNOrigVars(scip), nvars);
+   cr_assert_eq(SCIPgetNOrigConss(scip), nconss);
+   cr_assert_eq(SCIPgetObjsense(scip), objsense);
+
+   vars = SCIPgetOrigVars(scip);
+   for( i = 0; i < nvars; ++i )
+   {
+      cr_expect_eq(SCIPvarGetType(vars[i]), SCIP_VARTYPE_BINARY);
+      cr_expect(SCIPisEQ(scip, SCIPvarGetLbOriginal(vars[i]), lbs[i]));
+      cr_expect(SCIPisEQ(scip, SCIPvarGetUbOriginal(vars[i]), ubs[i]));
+      cr_expect(SCIPisEQ(scip, SCIPvarGetObj(vars[i]), objs[i]));
+   }
+
+   /* all constraints are read back as linear constraints */
+   conss = SCIPgetOrigConss(scip);
+   for( i = 0; i < nconss; ++i )
+      cr_expect_str_eq(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[i])), "linear");
+}
+
+Test(readersnp, presolved, .description = "write the presolved problem and read it back")
+{
+   SCIP_Real objoffset;
+   int nconss;
+   int nvars;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPpresolve(scip) );
+
+   /* the instance may be solved by presolving */
+   if( SCIPgetStage(scip) != SCIP_STAGE_PRESOLVED )
+      return;
+
+   nvars = SCIPgetNVars(scip);
+   nconss = SCIPgetNConss(scip);
+   /* for maximization problems, the internal objective is the negated external objective */
+   objoffset = (SCIP_Real) SCIPgetObjsense(scip) * SCIPgetTransObjscale(scip) * SCIPgetTransObjoffset(scip);
+
+   SCIP_CALL( SCIPwriteTransProblem(scip, SNPFILE, NULL, FALSE) );
+   SCIP_CALL( SCIPfreeProb(scip) );
+   SCIP_CALL( SCIPreadProb(scip, SNPFILE, NULL) );
+
+   cr_assert_eq(SCIPgetNOrigVars(scip), nvars);
+   cr_assert_eq(SCIPgetNOrigConss(scip), nconss);
+   cr_expect(SCIPisEQ(scip, SCIPgetOrigObjoffset(scip), objoffset));
+}
+
+Test(readersnp, invalid, .description = "reject files that are not in SNP format")
+{
+   FILE* fp;
+   SCIP_RETCODE retcode;
+
+   fp = fopen(SNPFILE, "w");
+   fprintf(fp, "this is not a snapshot\n");
+   fclose(fp);
+
+   SCIPmessageSetErrorPrinting(NULL, NULL);
+   retcode = SCIPreadProb(scip, SNPFILE, NULL);
+   SCIPmessageSetErrorPrintingDefault();
+
+   cr_assert_eq(retcode, SCIP_READERROR);
+}
@@ -0,0 +1,217 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cliqueindex.c
+ * @brief  unit test for the adjacency index of the clique table
+ *
+ * Random cliques are added to the transformed problem; the answers of the clique queries with the adjacency index are
+ * compared to the intersection of the clique lists of the variables.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_scip.h"
+#include "scip/struct_implics.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 30
+#define NCLIQUES 40
+#define MAXLEN 4
+
+static SCIP* scip;
+
+/** adds random cliques to the transformed problem */
+static
+void addRandomCliques(void)
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_VAR** vars;
+   SCIP_VAR* cliquevars[MAXLEN];
+   SCIP_Bool cliquevalues[MAXLEN];
+   SCIP_Bool infeasible;
+   int i;
+
+   vars = SCIPgetVars(scip);
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+
+   for( i = 0; i < NCLIQUES; ++i )
+   {
+      int first;
+      int len;
+      int j;
+
+      /* the variables of a clique are consecutive, such that no variable appears twice */
+      len = SCIPrandomGetInt(randnumgen, 2, MAXLEN);
+      first = SCIPrandomGetInt(randnumgen, 0, NVARS - len);
+      for( j = 0; j < len; ++j )
+      {
+         cliquevars[j] = vars[first + j];
+         cliquevalues[j] = SCIPrandomGetInt(randnumgen, 0, 3) > 0;
+      }
+
+      SCIP_CALL( SCIPaddClique(scip, cliquevars, cliquevalues, len, FALSE, &infeasible, NULL) );
+      cr_assert(!infeasible);
+   }
+
+   SCIPfreeRandom(scip, &randnumgen);
+}
+
+/** compares the single and batched clique queries to the intersection of the clique lists for all pairs of literals */
+static
+void checkQueries(void)
+{
+   SCIP_VAR** vars;
+   SCIP_Bool* values;
+   SCIP_Bool* common;
+   int i;
+   int j;
+   int vali;
+   int valj;
+
+   vars = SCIPgetVars(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &values, NVARS) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &common, NVARS) );
+
+   for( vali = 0; vali <= 1; ++vali )
+   {
+      for( valj = 0; valj <= 1; ++valj )
+      {
+         for( j = 0; j < NVARS; ++j )
+            values[j] = (SCIP_Bool)valj;
+
+         for( i = 0; i < NVARS; ++i )
+         {
+            SCIP_CALL( SCIPgetVarCommonCliques(scip, vars[i], (SCIP_Bool)vali, vars, values, NVARS, FALSE, common) );
+
+            for( j = 0; j < NVARS; ++j )
+            {
+               SCIP_Bool expected;
+
+               expected = SCIPvarsHaveCommonClique(vars[i], (SCIP_Bool)vali, vars[j], (SCIP_Bool)valj, FALSE);
+
+               cr_expect_eq(SCIPhaveVarsCommonClique(scip, vars[i], (SCIP_Bool)vali, vars[j], (SCIP_Bool)valj, FALSE),
+                  expected, "wrong single query for <%s>=%d and <%s>=%d", SCIPvarGetName(vars[i]), vali,
+                  SCIPvarGetName(vars[j]), valj);
+               cr_expect_eq(common[j], expected, "wrong batched query for <%s>=%d and <%s>=%d",
+                  SCIPvarGetName(vars[i]), vali, SCIPvarGetName(vars[j]), valj);
+            }
+         }
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &common);
+   SCIPfreeBufferArray(scip, &values);
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cliqueindex") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+
+   /* the problem has no constraints, so the size of the clique table must not depend on the number of nonzeros */
+   SCIP_CALL( SCIPsetRealParam(scip, "presolving/clqtablefac", SCIPinfinity(scip)) );
+
+   SCIP_CALL( SCIPtransformProb(scip) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(cliqueindex, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(cliqueindex, queries, .description = "the clique queries give the same answers with and without the index")
+{
+   SCIP_Bool infeasible;
+
+   addRandomCliques();
+
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+   cr_assert(!scip->cliquetable->adjvalid);
+
+   /* the queries without the index make the next cleanup build it */
+   checkQueries();
+
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+   cr_assert(scip->cliquetable->adjvalid);
+
+   checkQueries();
+
+   /* a new clique invalidates the index */
+   addRandomCliques();
+   cr_assert(!scip->cliquetable->adjvalid);
+
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+
+   checkQueries();
+}
+
+Test(cliqueindex, disabled, .description = "no index is built if presolving/clqindexfac is 0")
+{
+   SCIP_Bool infeasible;
+
+   SCIP_CALL( SCIPsetRealParam(scip, "presolving/clqindexfac", 0.0) );
+
+   addRandomCliques();
+
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+   checkQueries();
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+   cr_assert(!scip->cliquetable->adjvalid);
+
+   checkQueries();
+}
@@ -0,0 +1,177 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file   cutpoolefficacy.c
+ * @brief  unit test for the parallel computation of the LP efficacies of cut pool rows
+ *
+ * Random rows are added to the probing LP and a random LP solution is set. The efficacies computed by jobs of the task
+ * processing interface have to be identical to those computed row by row for every efficacy norm.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/cutpool.c"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS        101                     /**< number of variables */
+#define NROWS       (4 * CUTPOOL_JOBMINROWS + 17) /**< number of rows, such that the last job gets fewer rows */
+#define ROWLEN        10                     /**< number of entries per row */
+
+static SCIP* scip = NULL;
+static SCIP_RANDNUMGEN* randnumgen = NULL;
+
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP_VAR** vars;
+   SCIP_ROW* row;
+   SCIP_Bool cutoff;
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cutpoolefficacy") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, -10.0, 10.0, 1.0, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+
+   SCIP_CALL( SCIPsetIntParam(scip, "separating/poolnthreads", 4) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 4) );
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+
+   SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
+   cr_assert_not(cutoff);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+
+   vars = SCIPgetVars(scip);
+   for( r = 0; r < NROWS; ++r )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "cut%d", r);
+      SCIP_CALL( SCIPcreateEmptyRowUnspec(scip, &row, name, -SCIPinfinity(scip), SCIPrandomGetReal(randnumgen, -5.0, 5.0),
+            FALSE, FALSE, TRUE) );
+
+      SCIP_CALL( SCIPcacheRowExtensions(scip, row) );
+      for( i = 0; i < ROWLEN; ++i )
+      {
+         SCIP_CALL( SCIPaddVarToRow(scip, row, vars[SCIPrandomGetInt(randnumgen, 0, NVARS - 1)],
+               SCIPrandomGetReal(randnumgen, -3.0, 3.0)) );
+      }
+      SCIP_CALL( SCIPflushRowExtensions(scip, row) );
+
+      SCIP_CALL( SCIPaddRowProbing(scip, row) );
+      SCIP_CALL( SCIPreleaseRow(scip, &row) );
+   }
+   SCIP_CALL( SCIPflushLP(scip) );
+
+   /* set a random LP solution without solving the LP */
+   for( i = 0; i < SCIPgetNLPCols(scip); ++i )
+      SCIPgetLPCols(scip)[i]->primsol = SCIPrandomGetReal(randnumgen, -10.0, 10.0);
+   scip->stat->lpcount++;
+   scip->lp->validsollp = scip->stat->lpcount;
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** invalidates the cached LP activities of the rows, such that they are recomputed */
+static
+void invalidateActivities(
+   SCIP_ROW**            rows,               /**< rows */
+   int                   nrows               /**< number of rows */
+   )
+{
+   int r;
+
+   for( r = 0; r < nrows; ++r )
+      rows[r]->validactivitylp = -1;
+}
+
+TestSuite(cutpoolefficacy, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(cutpoolefficacy, parallel, .description = "parallel efficacies are identical to sequential ones for every norm")
+{
+   const char norms[] = { 'e', 'm', 's', 'd' };
+   SCIP_ROW** rows;
+   SCIP_Real* seqefficacies;
+   SCIP_Real* parefficacies;
+   SCIP_Bool usetpi;
+   int nrows;
+   int n;
+   int r;
+
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+   cr_assert_eq(nrows, NROWS);
+
+   /* acquire the thread pool; without one, the jobs are executed by this thread */
+   SCIP_CALL( cutpoolUseTPI(scip->cutpool, scip->set, &usetpi) );
+   SCIP_UNUSED(usetpi);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &seqefficacies, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &parefficacies, nrows) );
+
+   for( n = 0; n < (int) sizeof(norms); ++n )
+   {
+      SCIP_CALL( SCIPsetCharParam(scip, "separating/efficacynorm", norms[n]) );
+
+      invalidateActivities(rows, nrows);
+      for( r = 0; r < nrows; ++r )
+         seqefficacies[r] = SCIProwGetLPEfficacy(rows[r], scip->set, scip->stat, scip->lp);
+
+      invalidateActivities(rows, nrows);
+      SCIP_CALL( computeLPEfficaciesParallel(rows, nrows, scip->set, scip->stat, scip->lp, parefficacies) );
+
+      for( r = 0; r < nrows; ++r )
+      {
+         cr_assert_eq(parefficacies[r], seqefficacies[r], "norm '%c', row %d: parallel efficacy %g, sequential %g",
+            norms[n], r, parefficacies[r], seqefficacies[r]);
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &parefficacies);
+   SCIPfreeBufferArray(scip, &seqefficacies);
+}
@@ -0,0 +1,210 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cutselindex.c
+ * @brief  unit test for the column index of cuts used by the cut selectors
+ *
+ * Random sparse cuts are created while solving; the candidates returned by the index are compared to the cuts with
+ * nonzero parallelism.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 50
+#define NCUTS 40
+#define MAXLEN 4
+
+static SCIP* scip;
+static SCIP_Bool tested;
+
+/** checks that the candidates of the given cut in the range of positions are exactly the cuts with nonzero
+ *  parallelism, in decreasing order of their position
+ */
+static
+void checkCands(
+   SCIP_CUTSELINDEX*     cutselindex,        /**< column index of cuts */
+   SCIP_ROW**            cuts,               /**< array with cuts */
+   SCIP_ROW*             cut,                /**< cut to find the candidates for */
+   int                   firstpos,           /**< first position of the range */
+   int                   npos                /**< number of positions of the range */
+   )
+{
+   int* cands;
+   int ncands;
+   int nparallel;
+   int c;
+   int i;
+
+   SCIPcutselindexGetCands(cutselindex, cut, firstpos, npos, &cands, &ncands);
+
+   for( c = 1; c < ncands; ++c )
+      cr_assert_gt(cands[c - 1], cands[c]);
+
+   nparallel = 0;
+   for( i = 0; i < npos; ++i )
+   {
+      if( SCIProwGetParallelism(cut, cuts[firstpos + i], 'e') != 0.0 )
+      {
+         SCIP_Bool found;
+
+         ++nparallel;
+
+         found = FALSE;
+         for( c = 0; c < ncands && !found; ++c )
+            found = (cands[c] == i);
+         cr_expect(found, "cut at position %d is parallel, but no candidate", firstpos + i);
+      }
+   }
+
+   /* random cuts with common columns are almost never orthogonal */
+   cr_expect_eq(ncands, nparallel);
+}
+
+/** execution method of the test heuristic: creates random cuts and checks the index */
+static
+SCIP_DECL_HEUREXEC(heurExecCutselindextest)
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_CUTSELINDEX* cutselindex;
+   SCIP_ROW* cuts[NCUTS];
+   SCIP_VAR** vars;
+   char name[SCIP_MAXSTRLEN];
+   int nvars;
+   int i;
+   int j;
+
+   *result = SCIP_DIDNOTRUN;
+
+   if( tested )
+      return SCIP_OKAY;
+   tested = TRUE;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+
+   for( i = 0; i < NCUTS; ++i )
+   {
+      int len;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "cut%d", i);
+      SCIP_CALL( SCIPcreateEmptyRowUnspec(scip, &cuts[i], name, -SCIPinfinity(scip), 1.0, FALSE, FALSE, TRUE) );
+
+      len = SCIPrandomGetInt(randnumgen, 1, MAXLEN);
+      SCIP_CALL( SCIPcacheRowExtensions(scip, cuts[i]) );
+      for( j = 0; j < len; ++j )
+      {
+         SCIP_CALL( SCIPaddVarToRow(scip, cuts[i], vars[SCIPrandomGetInt(randnumgen, 0, nvars - 1)],
+               SCIPrandomGetReal(randnumgen, 0.5, 2.0)) );
+      }
+      SCIP_CALL( SCIPflushRowExtensions(scip, cuts[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateCutselIndex(scip, &cutselindex, cuts, NCUTS) );
+
+   /* all cuts over the full range */
+   for( i = 0; i < NCUTS; ++i )
+      checkCands(cutselindex, cuts, cuts[i], 0, NCUTS);
+
+   /* swap cuts like a cut selector and check the candidates in the remaining range */
+   for( i = 0; i < NCUTS / 2; ++i )
+   {
+      int pos;
+
+      pos = SCIPrandomGetInt(randnumgen, i, NCUTS - 1);
+      SCIPswapPointers((void**) &cuts[pos], (void**) &cuts[i]);
+      SCIPcutselindexSwap(cutselindex, pos, i);
+
+      checkCands(cutselindex, cuts, cuts[i], i + 1, NCUTS - i - 1);
+   }
+
+   SCIPfreeCutselIndex(scip, &cutselindex);
+
+   for( i = 0; i < NCUTS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &cuts[i]) );
+   }
+
+   SCIPfreeRandom(scip, &randnumgen);
+
+   return SCIP_OKAY;
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cutselindex") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, 1.0, 1.0, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+
+   SCIP_CALL( SCIPincludeHeurBasic(scip, NULL, "test", "test heuristic checking the column index of cuts", 't', 0, 1, 0,
+         -1, SCIP_HEURTIMING_BEFORENODE, TRUE, heurExecCutselindextest, NULL) );
+
+   tested = FALSE;
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(cutselindex, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(cutselindex, candidates, .description = "the candidates of a cut are the cuts with nonzero parallelism")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert(tested);
+}
@@ -0,0 +1,230 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   eventbatch.c
+ * @brief  unit test for passing local bound changes to event handlers in batches
+ *
+ * Two event handlers catch the local bound changes of all variables while a small knapsack problem is solved by
+ * branching; only the first one has a batched execution method. The test checks that node switches pass bound changes
+ * to the first handler in batches, that the last change of a bound in a batch gives the current local bound, and that
+ * the first handler gets each bound change exactly once, i.e., as many as the second handler gets one by one.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 10
+
+static SCIP* scip;
+static int nsingle;
+static int nbatchcalls;
+static int nbatched;
+static int nreference;
+
+/** initialization method of the test event handlers: catch the local bound changes of all variables */
+static
+SCIP_DECL_EVENTINITSOL(eventInitsolBatchtest)
+{
+   SCIP_VAR** vars;
+   int nvars;
+   int i;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, vars[i], SCIP_EVENTTYPE_BOUNDCHANGED, eventhdlr, NULL, NULL) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method of the test event handlers */
+static
+SCIP_DECL_EVENTEXITSOL(eventExitsolBatchtest)
+{
+   SCIP_VAR** vars;
+   int nvars;
+   int i;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_CALL( SCIPdropVarEvent(scip, vars[i], SCIP_EVENTTYPE_BOUNDCHANGED, eventhdlr, NULL, -1) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution method of the test event handler */
+static
+SCIP_DECL_EVENTEXEC(eventExecBatchtest)
+{
+   cr_assert((SCIPeventGetType(event) & SCIP_EVENTTYPE_BOUNDCHANGED) != 0);
+   ++nsingle;
+
+   return SCIP_OKAY;
+}
+
+/** execution method of the reference event handler, which has no batched execution method */
+static
+SCIP_DECL_EVENTEXEC(eventExecReference)
+{
+   cr_assert((SCIPeventGetType(event) & SCIP_EVENTTYPE_BOUNDCHANGED) != 0);
+   ++nreference;
+
+   return SCIP_OKAY;
+}
+
+/** batched execution method of the test event handler */
+static
+SCIP_DECL_EVENTEXECBATCH(eventExecBatchBatchtest)
+{
+   int i;
+   int j;
+
+   cr_assert_gt(nevents, 0);
+   ++nbatchcalls;
+   nbatched += nevents;
+
+   for( i = 0; i < nevents; ++i )
+   {
+      SCIP_Bool islb;
+      SCIP_Bool last;
+
+      cr_assert((eventtypes[i] & SCIP_EVENTTYPE_BOUNDCHANGED) != 0);
+      cr_assert(eventdatas[i] == NULL);
+      islb = (eventtypes[i] & SCIP_EVENTTYPE_LBCHANGED) != 0;
+
+      /* the last change of a bound in the batch leads to the current local bound */
+      last = TRUE;
+      for( j = i + 1; j < nevents && last; ++j )
+      {
+         if( vars[j] == vars[i] && ((eventtypes[j] & SCIP_EVENTTYPE_LBCHANGED) != 0) == islb )
+            last = FALSE;
+      }
+
+      if( last )
+      {
+         cr_expect(SCIPisEQ(scip, newbounds[i], islb ? SCIPvarGetLbLocal(vars[i]) : SCIPvarGetUbLocal(vars[i])));
+      }
+      cr_expect(!SCIPisEQ(scip, oldbounds[i], newbounds[i]));
+   }
+
+   return SCIP_OKAY;
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_EVENTHDLR* eventhdlr;
+   SCIP_VAR* vars[NVARS];
+   SCIP_Real weights[NVARS];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "knapsack") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real) (i + 2), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      weights[i] = (SCIP_Real) (i + 1);
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", NVARS, vars, weights, -SCIPinfinity(scip), 17.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   /* solve by branching without LP */
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, "batchtest", "event handler with batched bound changes",
+         eventExecBatchtest, NULL) );
+   SCIP_CALL( SCIPsetEventhdlrInitsol(scip, eventhdlr, eventInitsolBatchtest) );
+   SCIP_CALL( SCIPsetEventhdlrExitsol(scip, eventhdlr, eventExitsolBatchtest) );
+   SCIP_CALL( SCIPsetEventhdlrExecBatch(scip, eventhdlr, eventExecBatchBatchtest) );
+
+   /* the initsol and exitsol methods catch and drop the events of the handler that calls them */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, "reference", "event handler with single bound changes",
+         eventExecReference, NULL) );
+   SCIP_CALL( SCIPsetEventhdlrInitsol(scip, eventhdlr, eventInitsolBatchtest) );
+   SCIP_CALL( SCIPsetEventhdlrExitsol(scip, eventhdlr, eventExitsolBatchtest) );
+
+   nsingle = 0;
+   nbatchcalls = 0;
+   nbatched = 0;
+   nreference = 0;
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(eventbatch, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(eventbatch, nodeswitch, .description = "bound changes of node switches are passed in batches")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert_gt(SCIPgetNNodes(scip), 1);
+
+   /* bound changes of propagation are passed immediately, those of switching nodes in batches */
+   cr_expect_gt(nsingle, 0);
+   cr_expect_gt(nbatchcalls, 0);
+   cr_expect_gt(nbatched, nbatchcalls);
+
+   /* no bound change is lost or passed twice */
+   cr_expect_eq(nsingle + nbatched, nreference, "%d single and %d batched bound changes, but %d reference bound changes",
+      nsingle, nbatched, nreference);
+}
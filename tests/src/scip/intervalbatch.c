@@ -0,0 +1,229 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   intervalbatch.c
+ * @brief  tests the interval operations on vectors against the operations on single intervals
+ *
+ * The vector operations switch the rounding mode once per vector instead of once per operation. The tests check that
+ * they give the same intervals as the operations on single intervals. A benchmark, which is disabled by default since
+ * it only reports timings, compares the throughput of both for addition and multiplication.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/intervalarith.h"
+#include "include/scip_test.h"
+
+#define LENGTH     1000      /* length of the vectors of intervals */
+#define NROUNDS   20000      /* number of rounds over the vectors in the throughput benchmark */
+
+/* global variables */
+static SCIP* scip;
+static SCIP_RANDNUMGEN* rndgen;
+static SCIP_INTERVAL operand1[LENGTH];
+static SCIP_INTERVAL operand2[LENGTH];
+static SCIP_INTERVAL resultant[LENGTH];
+static SCIP_Real scalars[LENGTH];
+
+/** returns a random interval, which may be a point or have infinite bounds */
+static
+SCIP_INTERVAL getRandomInterval(void)
+{
+   SCIP_INTERVAL interval;
+   SCIP_Real a;
+   SCIP_Real b;
+
+   a = SCIPrandomGetReal(rndgen, -100.0, 100.0);
+   b = SCIPrandomGetInt(rndgen, 0, 9) == 0 ? a : SCIPrandomGetReal(rndgen, -100.0, 100.0);
+   SCIPintervalSetBounds(&interval, MIN(a, b), MAX(a, b));
+
+   if( SCIPrandomGetInt(rndgen, 0, 9) == 0 )
+      interval.inf = -SCIP_INTERVAL_INFINITY;
+   if( SCIPrandomGetInt(rndgen, 0, 9) == 0 )
+      interval.sup = SCIP_INTERVAL_INFINITY;
+
+   return interval;
+}
+
+/** checks that the resultant of a vector operation is the same as the intervals in expected */
+static
+void checkResultant(
+   const char*           op,                 /**< name of operation */
+   SCIP_INTERVAL*        expected            /**< intervals computed by the operation on single intervals */
+   )
+{
+   int i;
+
+   for( i = 0; i < LENGTH; ++i )
+   {
+      cr_expect(resultant[i].inf == expected[i].inf && resultant[i].sup == expected[i].sup,  /*lint !e777*/
+         "%s of entry %d: [%.20g,%.20g] != [%.20g,%.20g]", op, i, resultant[i].inf, resultant[i].sup,
+         expected[i].inf, expected[i].sup);
+   }
+}
+
+/** returns the number of operations per second of an operation on single intervals or vectors */
+static
+SCIP_Real getThroughput(
+   SCIP_Bool             mul,                /**< multiplication instead of addition? */
+   SCIP_Bool             vector              /**< vector operation instead of operations on single intervals? */
+   )
+{
+   SCIP_CLOCK* clock;
+   SCIP_Real time;
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPcreateWallClock(scip, &clock) );
+   SCIP_CALL( SCIPstartClock(scip, clock) );
+
+   for( r = 0; r < NROUNDS; ++r )
+   {
+      if( vector && mul )
+         SCIPintervalMulVectors(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1, operand2);
+      else if( vector )
+         SCIPintervalAddVectors(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1, operand2);
+      else if( mul )
+      {
+         for( i = 0; i < LENGTH; ++i )
+            SCIPintervalMul(SCIP_INTERVAL_INFINITY, &resultant[i], operand1[i], operand2[i]);
+      }
+      else
+      {
+         for( i = 0; i < LENGTH; ++i )
+            SCIPintervalAdd(SCIP_INTERVAL_INFINITY, &resultant[i], operand1[i], operand2[i]);
+      }
+   }
+
+   SCIP_CALL( SCIPstopClock(scip, clock) );
+   time = SCIPgetClockTime(scip, clock);
+   SCIP_CALL( SCIPfreeClock(scip, &clock) );
+
+   return (SCIP_Real)NROUNDS * LENGTH / MAX(time, 1e-6);
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateRandom(scip, &rndgen, 1, TRUE) );
+
+   for( i = 0; i < LENGTH; ++i )
+   {
+      operand1[i] = getRandomInterval();
+      operand2[i] = getRandomInterval();
+      scalars[i] = SCIPrandomGetInt(rndgen, 0, 4) == 0 ? (SCIP_Real)SCIPrandomGetInt(rndgen, -1, 1)
+         : SCIPrandomGetReal(rndgen, -10.0, 10.0);
+   }
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIPfreeRandom(scip, &rndgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(intervalbatch, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(intervalbatch, binary, .description = "vector addition and multiplication give the same intervals")
+{
+   SCIP_INTERVAL expected[LENGTH];
+   int i;
+
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalAdd(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i], operand2[i]);
+   SCIPintervalAddVectors(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1, operand2);
+   checkResultant("add", expected);
+
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalMul(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i], operand2[i]);
+   SCIPintervalMulVectors(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1, operand2);
+   checkResultant("mul", expected);
+
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalMulScalar(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i], scalars[i]);
+   SCIPintervalMulScalarVectors(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1, scalars);
+   checkResultant("mulscalar", expected);
+}
+
+Test(intervalbatch, unary, .description = "vector square, square root, exponential, and logarithm give the same intervals")
+{
+   SCIP_INTERVAL expected[LENGTH];
+   int i;
+
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalSquare(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i]);
+   SCIPintervalSquareVector(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1);
+   checkResultant("square", expected);
+
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalSquareRoot(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i]);
+   SCIPintervalSquareRootVector(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1);
+   checkResultant("sqrt", expected);
+
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalExp(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i]);
+   SCIPintervalExpVector(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1);
+   checkResultant("exp", expected);
+
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalLog(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i]);
+   SCIPintervalLogVector(SCIP_INTERVAL_INFINITY, resultant, LENGTH, operand1);
+   checkResultant("log", expected);
+
+   /* the vector may be modified in place */
+   for( i = 0; i < LENGTH; ++i )
+      SCIPintervalSquareRoot(SCIP_INTERVAL_INFINITY, &expected[i], operand1[i]);
+   SCIPintervalSquareRootVector(SCIP_INTERVAL_INFINITY, operand1, LENGTH, operand1);
+   BMScopyMemoryArray(resultant, operand1, LENGTH);
+   checkResultant("sqrt in place", expected);
+}
+
+/* the benchmark only reports timings, which depend on the machine and the build, so it is not run with the unit tests */
+Test(intervalbatch, throughput, .description = "compares the throughput of vector operations and single operations",
+   .disabled = TRUE)
+{
+   SCIP_Real singleops;
+   SCIP_Real vectorops;
+
+   singleops = getThroughput(FALSE, FALSE);
+   vectorops = getThroughput(FALSE, TRUE);
+   SCIPinfoMessage(scip, NULL, "add: single %10.3g ops/s, vector %10.3g ops/s, ratio %.2f\n",
+      singleops, vectorops, vectorops / singleops);
+
+   singleops = getThroughput(TRUE, FALSE);
+   vectorops = getThroughput(TRUE, TRUE);
+   SCIPinfoMessage(scip, NULL, "mul: single %10.3g ops/s, vector %10.3g ops/s, ratio %.2f\n",
+      singleops, vectorops, vectorops / singleops);
+}
@@ -0,0 +1,306 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   lpmatrix.c
+ * @brief  unit test for the row-wise and column-wise matrix snapshots of the LP
+ *
+ * The LP consists of random set partitioning rows that are added in probing mode. The snapshots are compared with the
+ * rows of the LP, and a sweep computing y^T A over the row objects is compared with the same sweep over the snapshot.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS       2003                     /**< number of variables, prime such that strided rows have distinct entries */
+#define NROWS       1000                     /**< number of set partitioning rows */
+#define ROWLEN        30                     /**< number of entries per row */
+
+static SCIP* scip = NULL;
+static SCIP_RANDNUMGEN* randnumgen = NULL;
+
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP_Bool cutoff;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "lpmatrix") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+
+   SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
+   cr_assert_not(cutoff);
+   cr_assert_eq(SCIPgetNLPCols(scip), NVARS);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** adds random set partitioning rows to the probing LP */
+static
+SCIP_RETCODE addRows(
+   int                   nrows               /**< number of rows to add */
+   )
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP_VAR** vars;
+   SCIP_ROW* row;
+   int start;
+   int stride;
+   int r;
+   int j;
+
+   vars = SCIPgetVars(scip);
+   assert(SCIPgetNVars(scip) == NVARS);
+
+   for( r = 0; r < nrows; ++r )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "part%d", SCIPgetNLPRows(scip));
+      SCIP_CALL( SCIPcreateEmptyRowUnspec(scip, &row, name, 1.0, 1.0, FALSE, FALSE, TRUE) );
+
+      /* entries start, start + stride, ... modulo the prime number of variables are distinct */
+      start = SCIPrandomGetInt(randnumgen, 0, NVARS - 1);
+      stride = SCIPrandomGetInt(randnumgen, 1, 50);
+
+      SCIP_CALL( SCIPcacheRowExtensions(scip, row) );
+      for( j = 0; j < ROWLEN; ++j )
+      {
+         SCIP_CALL( SCIPaddVarToRow(scip, row, vars[(start + j * stride) % NVARS], 1.0) );
+      }
+      SCIP_CALL( SCIPflushRowExtensions(scip, row) );
+
+      SCIP_CALL( SCIPaddRowProbing(scip, row) );
+      SCIP_CALL( SCIPreleaseRow(scip, &row) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** checks the row-wise and the column-wise snapshot against the rows of the LP */
+static
+SCIP_RETCODE checkSnapshot(void)
+{
+   SCIP_ROW** rows;
+   SCIP_COL** rowcols;
+   SCIP_Real* rowvals;
+   SCIP_Real* vals;
+   SCIP_Real* colvals;
+   int* rowbeg;
+   int* colind;
+   int* colbeg;
+   int* rowind;
+   int nrows;
+   int ncols;
+   int nnonz;
+   int ncolnnonz;
+   int pos;
+   int r;
+   int c;
+   int i;
+
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+   ncols = SCIPgetNLPCols(scip);
+
+   SCIP_CALL( SCIPgetLPMatrixRows(scip, &rowbeg, &colind, &vals, &nnonz) );
+   cr_assert_eq(rowbeg[0], 0);
+   cr_assert_eq(rowbeg[nrows], nnonz);
+
+   for( r = 0; r < nrows; ++r )
+   {
+      rowcols = SCIProwGetCols(rows[r]);
+      rowvals = SCIProwGetVals(rows[r]);
+      pos = rowbeg[r];
+
+      for( i = 0; i < SCIProwGetNNonz(rows[r]); ++i )
+      {
+         if( SCIPcolGetLPPos(rowcols[i]) < 0 )
+            continue;
+
+         cr_assert_lt(pos, rowbeg[r + 1]);
+         cr_assert_eq(colind[pos], SCIPcolGetLPPos(rowcols[i]));
+         cr_assert_eq(vals[pos], rowvals[i]);
+         ++pos;
+      }
+      cr_assert_eq(pos, rowbeg[r + 1], "row %d has %d entries in the snapshot, expected %d", r,
+         rowbeg[r + 1] - rowbeg[r], pos - rowbeg[r]);
+   }
+
+   SCIP_CALL( SCIPgetLPMatrixCols(scip, &colbeg, &rowind, &colvals, &ncolnnonz) );
+   cr_assert_eq(ncolnnonz, nnonz);
+   cr_assert_eq(colbeg[0], 0);
+   cr_assert_eq(colbeg[ncols], nnonz);
+
+   /* every column-wise entry has to be found in its row, and the rows of a column have to be increasing */
+   for( c = 0; c < ncols; ++c )
+   {
+      for( pos = colbeg[c]; pos < colbeg[c + 1]; ++pos )
+      {
+         SCIP_Bool found = FALSE;
+
+         r = rowind[pos];
+         cr_assert(0 <= r && r < nrows);
+         cr_assert(pos == colbeg[c] || rowind[pos - 1] < r);
+
+         for( i = rowbeg[r]; i < rowbeg[r + 1] && !found; ++i )
+            found = (colind[i] == c && vals[i] == colvals[pos]);
+         cr_assert(found, "entry (%d,%d) of the column-wise snapshot not found in row", r, c);
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+TestSuite(lpmatrix, .init = setup, .fini = teardown);
+
+Test(lpmatrix, empty, .description = "the snapshot of an LP without rows is empty")
+{
+   int* rowbeg;
+   int* colind;
+   SCIP_Real* vals;
+   int nnonz;
+
+   SCIP_CALL( SCIPgetLPMatrixRows(scip, &rowbeg, &colind, &vals, &nnonz) );
+   cr_assert_eq(nnonz, 0);
+   cr_assert_eq(rowbeg[0], 0);
+
+   SCIP_CALL( checkSnapshot() );
+}
+
+Test(lpmatrix, rows_and_cols, .description = "the snapshots agree with the rows of the LP")
+{
+   SCIP_CALL( addRows(NROWS) );
+   SCIP_CALL( checkSnapshot() );
+}
+
+Test(lpmatrix, incremental, .description = "the snapshots stay correct when rows are added and removed")
+{
+   SCIP_CALL( addRows(NROWS / 2) );
+   SCIP_CALL( checkSnapshot() );
+
+   /* rows appended to the LP are appended to the snapshot */
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+   SCIP_CALL( addRows(NROWS / 2) );
+   cr_assert_eq(SCIPgetNLPRows(scip), 2 * (NROWS / 2));
+   SCIP_CALL( checkSnapshot() );
+
+   /* backtracking removes the rows at the end of the LP, such that the snapshot is truncated */
+   SCIP_CALL( SCIPbacktrackProbing(scip, 1) );
+   cr_assert_eq(SCIPgetNLPRows(scip), NROWS / 2);
+   SCIP_CALL( checkSnapshot() );
+
+   /* different rows at the same positions */
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+   SCIP_CALL( addRows(NROWS / 4) );
+   SCIP_CALL( checkSnapshot() );
+}
+
+Test(lpmatrix, sweep, .description = "compare a sweep over the row objects with a sweep over the row-wise snapshot")
+{
+   SCIP_ROW** rows;
+   SCIP_COL** rowcols;
+   SCIP_Real* rowvals;
+   SCIP_Real* vals;
+   SCIP_Real* weights;
+   SCIP_Real* rowsum;
+   SCIP_Real* matsum;
+   int* rowbeg;
+   int* colind;
+   int nrows;
+   int ncols;
+   int nnonz;
+   int pos;
+   int r;
+   int c;
+   int i;
+
+   SCIP_CALL( addRows(NROWS) );
+
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+   ncols = SCIPgetNLPCols(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &weights, nrows) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &rowsum, ncols) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &matsum, ncols) );
+
+   for( r = 0; r < nrows; ++r )
+      weights[r] = SCIPrandomGetReal(randnumgen, -1.0, 1.0);
+
+   /* y^T A over the row objects */
+   for( r = 0; r < nrows; ++r )
+   {
+      rowcols = SCIProwGetCols(rows[r]);
+      rowvals = SCIProwGetVals(rows[r]);
+
+      for( i = 0; i < SCIProwGetNNonz(rows[r]); ++i )
+      {
+         pos = SCIPcolGetLPPos(rowcols[i]);
+         if( pos >= 0 )
+            rowsum[pos] += weights[r] * rowvals[i];
+      }
+   }
+
+   /* y^T A over the snapshot */
+   SCIP_CALL( SCIPgetLPMatrixRows(scip, &rowbeg, &colind, &vals, &nnonz) );
+   for( r = 0; r < nrows; ++r )
+   {
+      for( i = rowbeg[r]; i < rowbeg[r + 1]; ++i )
+         matsum[colind[i]] += weights[r] * vals[i];
+   }
+
+   /* the entries are summed up in the same order, so the results are identical */
+   for( c = 0; c < ncols; ++c )
+      cr_assert_eq(rowsum[c], matsum[c], "column %d: %g != %g", c, rowsum[c], matsum[c]);
+
+   SCIPfreeBufferArray(scip, &matsum);
+   SCIPfreeBufferArray(scip, &rowsum);
+   SCIPfreeBufferArray(scip, &weights);
+}
@@ -0,0 +1,251 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   packedbasis.c
+ * @brief  unit test for storing and loading packed bases of the LP
+ *
+ * The optimal basis of a probing LP is stored as a packed basis, the basis of the LP solver is cleared, and the packed
+ * basis is loaded again after a bound change that keeps the basis optimal. Resolving the LP must not need any
+ * iteration and must give the stored basis. A second basis is stored as changes against the first one after a row was
+ * added to the LP.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/lp.h"
+#include "scip/struct_lp.h"
+#include "scip/struct_mem.h"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 6
+#define NCONSS 3
+
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+
+/** creates an LP whose variables are bounded by 10, but cannot exceed 8 in any feasible solution */
+static
+void setup(void)
+{
+   SCIP_Real vals[NVARS];
+   SCIP_VAR* origvars[NVARS];
+   SCIP_Bool cutoff;
+   char name[SCIP_MAXSTRLEN];
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "packedbasis") );
+
+   for( j = 0; j < NVARS; ++j )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", j);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &origvars[j], name, 0.0, 10.0, -1.0 - j, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, origvars[j]) );
+   }
+
+   for( i = 0; i < NCONSS; ++i )
+   {
+      SCIP_CONS* cons;
+
+      for( j = 0; j < NVARS; ++j )
+         vals[j] = 1.0 + ((i + 2 * j) % 5);
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "c%d", i);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, NVARS, origvars, vals, -SCIPinfinity(scip), 8.0 - i) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   for( j = 0; j < NVARS; ++j )
+   {
+      SCIP_CALL( SCIPgetTransformedVar(scip, origvars[j], &vars[j]) );
+      SCIP_CALL( SCIPreleaseVar(scip, &origvars[j]) );
+   }
+
+   SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
+   cr_assert_not(cutoff);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPendProbing(scip) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** solves the probing LP and stores its basis in the given arrays */
+static
+void solveLP(
+   int*                  cstat,              /**< array to store the column statuses */
+   int*                  rstat,              /**< array to store the row statuses */
+   SCIP_Longint*         nlpiterations       /**< pointer to store the number of LP iterations */
+   )
+{
+   SCIP_LPI* lpi;
+   SCIP_Longint oldnlpiterations;
+   SCIP_Bool lperror;
+   SCIP_Bool cutoff;
+
+   oldnlpiterations = SCIPgetNLPIterations(scip);
+
+   SCIP_CALL( SCIPsolveProbingLP(scip, -1, &lperror, &cutoff) );
+   cr_assert_not(lperror);
+   cr_assert_not(cutoff);
+   cr_assert_eq(SCIPgetLPSolstat(scip), SCIP_LPSOLSTAT_OPTIMAL);
+
+   *nlpiterations = SCIPgetNLPIterations(scip) - oldnlpiterations;
+
+   SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+   SCIP_CALL( SCIPlpiGetBase(lpi, cstat, rstat) );
+}
+
+/** clears the basis of the LP solver, tightens a redundant bound, and loads the packed basis again */
+static
+void reloadBasis(
+   SCIP_PACKEDBASIS*     basis               /**< packed basis */
+   )
+{
+   SCIP_LPI* lpi;
+
+   SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+   SCIP_CALL( SCIPlpiClearState(lpi) );
+
+   SCIP_CALL( SCIPchgVarUbProbing(scip, vars[0], SCIPvarGetUbLocal(vars[0]) - 0.5) );
+
+   SCIP_CALL( SCIPlpSetPackedBasis(scip->lp, scip->mem->probmem, scip->set, scip->transprob, scip->eventqueue, basis,
+         TRUE, FALSE, TRUE, FALSE) );
+}
+
+/** checks that two bases are identical */
+static
+void checkBasis(
+   int*                  cstat1,             /**< column statuses of the first basis */
+   int*                  rstat1,             /**< row statuses of the first basis */
+   int*                  cstat2,             /**< column statuses of the second basis */
+   int*                  rstat2,             /**< row statuses of the second basis */
+   int                   nrows               /**< number of rows */
+   )
+{
+   int i;
+
+   for( i = 0; i < NVARS; ++i )
+      cr_expect_eq(cstat1[i], cstat2[i], "status of column %d differs: %d != %d", i, cstat1[i], cstat2[i]);
+   for( i = 0; i < nrows; ++i )
+      cr_expect_eq(rstat1[i], rstat2[i], "status of row %d differs: %d != %d", i, rstat1[i], rstat2[i]);
+}
+
+TestSuite(packedbasis, .init = setup, .fini = teardown);
+
+Test(packedbasis, reload, .description = "loads a completely packed basis and checks that it is the optimal basis")
+{
+   SCIP_PACKEDBASIS* basis;
+   SCIP_Longint nlpiterations;
+   int cstat[NVARS];
+   int rstat[NCONSS];
+   int reloadcstat[NVARS];
+   int reloadrstat[NCONSS];
+
+   solveLP(cstat, rstat, &nlpiterations);
+   cr_assert_eq(SCIPgetNLPRows(scip), NCONSS);
+
+   SCIP_CALL( SCIPlpGetPackedBasis(scip->lp, scip->mem->probmem, scip->set, NULL, &basis) );
+   cr_assert(basis != NULL);
+   cr_expect(basis->parent == NULL);
+   cr_expect_eq(basis->npacked, NVARS + NCONSS);
+
+   reloadBasis(basis);
+   solveLP(reloadcstat, reloadrstat, &nlpiterations);
+
+   cr_expect_eq(nlpiterations, 0, "resolving from the loaded basis needed %lld iterations", nlpiterations);
+   checkBasis(cstat, rstat, reloadcstat, reloadrstat, NCONSS);
+
+   SCIPpackedbasisRelease(&basis, scip->mem->probmem);
+}
+
+Test(packedbasis, changes, .description = "stores a basis as changes against its parent after adding a row and loads it")
+{
+   SCIP_PACKEDBASIS* parent;
+   SCIP_PACKEDBASIS* basis;
+   SCIP_ROW* row;
+   SCIP_Longint nlpiterations;
+   int cstat[NVARS];
+   int rstat[NCONSS + 1];
+   int reloadcstat[NVARS];
+   int reloadrstat[NCONSS + 1];
+   int j;
+
+   solveLP(cstat, rstat, &nlpiterations);
+
+   SCIP_CALL( SCIPlpGetPackedBasis(scip->lp, scip->mem->probmem, scip->set, NULL, &parent) );
+   cr_assert(parent != NULL);
+
+   /* add a redundant row, which is basic in the optimal basis */
+   SCIP_CALL( SCIPcreateEmptyRowUnspec(scip, &row, "redundant", -SCIPinfinity(scip), 100.0, FALSE, FALSE, TRUE) );
+   for( j = 0; j < NVARS; ++j )
+   {
+      SCIP_CALL( SCIPaddVarToRow(scip, row, vars[j], 1.0) );
+   }
+   SCIP_CALL( SCIPaddRowProbing(scip, row) );
+   SCIP_CALL( SCIPreleaseRow(scip, &row) );
+
+   solveLP(cstat, rstat, &nlpiterations);
+   cr_assert_eq(SCIPgetNLPRows(scip), NCONSS + 1);
+   cr_expect_eq(rstat[NCONSS], (int) SCIP_BASESTAT_BASIC);
+
+   /* the statuses of the parent's columns and rows did not change, so only the new row is packed */
+   SCIP_CALL( SCIPlpGetPackedBasis(scip->lp, scip->mem->probmem, scip->set, parent, &basis) );
+   cr_assert(basis != NULL);
+   cr_expect(basis->parent == parent);
+   cr_expect_eq(basis->nchanges, 0);
+   cr_expect_eq(basis->npacked, 1);
+
+   reloadBasis(basis);
+   solveLP(reloadcstat, reloadrstat, &nlpiterations);
+
+   cr_expect_eq(nlpiterations, 0, "resolving from the loaded basis needed %lld iterations", nlpiterations);
+   checkBasis(cstat, rstat, reloadcstat, reloadrstat, NCONSS + 1);
+
+   /* the parent fits the extended LP as well, since the new row is set basic */
+   reloadBasis(parent);
+   solveLP(reloadcstat, reloadrstat, &nlpiterations);
+
+   cr_expect_eq(nlpiterations, 0, "resolving from the loaded parent basis needed %lld iterations", nlpiterations);
+   checkBasis(cstat, rstat, reloadcstat, reloadrstat, NCONSS + 1);
+
+   SCIPpackedbasisRelease(&basis, scip->mem->probmem);
+   SCIPpackedbasisRelease(&parent, scip->mem->probmem);
+}
@@ -0,0 +1,214 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   propworklist.c
+ * @brief  unit test for skipping and sorting the propagation of constraint handlers with a worklist
+ *
+ * Checks that constraint handlers with a worklist are called less often if handlers without marked constraints are
+ * skipped, and that skipping and sorting the marked constraints do not change the optimal value of p0033 or of a set
+ * covering problem given by logicor constraints, which are only propagated when a watched variable changed. Also
+ * checks that the worklist of a constraint handler is only used with propagating/worklist, and that its marked
+ * constraints are only sorted if propagating/sortworklist is set as well.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NCOVERVARS  20
+#define NCOVERCONSS 30
+
+static SCIP* scip;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   /* solve by branching only */
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** creates a set covering problem with logicor constraints */
+static
+void createSetCover(void)
+{
+   SCIP_VAR* vars[NCOVERVARS];
+   SCIP_VAR* consvars[3];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "setcover") );
+
+   for( i = 0; i < NCOVERVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real) (1 + (3 * i) % 7), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   for( i = 0; i < NCOVERCONSS; ++i )
+   {
+      consvars[0] = vars[i % NCOVERVARS];
+      consvars[1] = vars[(3 * i + 1) % NCOVERVARS];
+      consvars[2] = vars[(7 * i + 5) % NCOVERVARS];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "cover%d", i);
+      SCIP_CALL( SCIPcreateConsBasicLogicor(scip, &cons, name, 3, consvars) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( i = 0; i < NCOVERVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
+
+/** returns the number of propagation calls of the constraint handlers with a worklist */
+static
+SCIP_Longint getNWorklistPropCalls(void)
+{
+   SCIP_CONSHDLR** conshdlrs;
+   SCIP_Longint npropcalls;
+   int c;
+
+   conshdlrs = SCIPgetConshdlrs(scip);
+   npropcalls = 0;
+
+   for( c = 0; c < SCIPgetNConshdlrs(scip); ++c )
+   {
+      if( SCIPconshdlrHasPropWorklist(conshdlrs[c]) )
+         npropcalls += SCIPconshdlrGetNPropCalls(conshdlrs[c]);
+   }
+
+   return npropcalls;
+}
+
+TestSuite(propworklist, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(propworklist, params, .description = "the worklist is only used and sorted if the parameters are set")
+{
+   SCIP_CONSHDLR* logicor;
+   SCIP_CONSHDLR* nonlinear;
+
+   logicor = SCIPfindConshdlr(scip, "logicor");
+   nonlinear = SCIPfindConshdlr(scip, "nonlinear");
+   cr_assert(logicor != NULL);
+   cr_assert(nonlinear != NULL);
+   cr_assert(SCIPconshdlrHasPropWorklist(logicor));
+   cr_assert_not(SCIPconshdlrHasPropWorklist(nonlinear));
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/worklist", TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/sortworklist", TRUE) );
+   cr_expect(SCIPisPropWorklistUsed(scip, logicor));
+   cr_expect(SCIPisPropWorklistSorted(scip, logicor));
+   cr_expect_not(SCIPisPropWorklistUsed(scip, nonlinear));
+   cr_expect_not(SCIPisPropWorklistSorted(scip, nonlinear));
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/sortworklist", FALSE) );
+   cr_expect(SCIPisPropWorklistUsed(scip, logicor));
+   cr_expect_not(SCIPisPropWorklistSorted(scip, logicor));
+
+   /* without the worklist, the marked constraints are not sorted either */
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/worklist", FALSE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/sortworklist", TRUE) );
+   cr_expect_not(SCIPisPropWorklistUsed(scip, logicor));
+   cr_expect_not(SCIPisPropWorklistSorted(scip, logicor));
+}
+
+Test(propworklist, worklist, .description = "constraint handlers without marked constraints are skipped")
+{
+   SCIP_Longint npropcalls;
+
+   SCIP_CALL( SCIPreadProb(scip, "../check/instances/MIP/p0033.osil", NULL) );
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/worklist", TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/sortworklist", TRUE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 3089.0));
+   npropcalls = getNWorklistPropCalls();
+
+   /* without the worklist, all constraint handlers are called in every propagation round */
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/worklist", FALSE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/sortworklist", FALSE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 3089.0));
+   cr_expect_lt(npropcalls, getNWorklistPropCalls(), "%" SCIP_LONGINT_FORMAT " propagation calls with the worklist, %"
+      SCIP_LONGINT_FORMAT " without", npropcalls, getNWorklistPropCalls());
+}
+
+Test(propworklist, logicor, .description = "logicor constraints are propagated only when they are marked")
+{
+   SCIP_Real optval;
+
+   createSetCover();
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/worklist", TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/sortworklist", TRUE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   optval = SCIPgetPrimalbound(scip);
+
+   /* without presolving, all constraints stay logicor constraints and are propagated in the tree */
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optval));
+   cr_expect_gt(SCIPconshdlrGetNPropCalls(SCIPfindConshdlr(scip, "logicor")), 0);
+
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/worklist", FALSE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/sortworklist", FALSE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optval));
+}
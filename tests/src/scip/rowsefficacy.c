@@ -0,0 +1,170 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   rowsefficacy.c
+ * @brief  unit test for the activities and efficacies of several rows for a primal solution
+ *
+ * Random rows with one or two finite sides are evaluated for a random solution. The activities computed for all rows at
+ * once and the efficacies for each efficacy norm must be identical to those computed row by row.
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/lp.h"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS   50
+#define NROWS  200
+#define MAXLEN  12
+
+static SCIP* scip;
+static SCIP_ROW* rows[NROWS];
+static SCIP_SOL* sol;
+
+/** creates random rows over the transformed variables and a random solution */
+static
+void setup(void)
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_VAR* vars[NVARS];
+   char name[SCIP_MAXSTRLEN];
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "rowsefficacy") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, -10.0, 10.0, 1.0, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   for( i = 0; i < NVARS; ++i )
+      vars[i] = SCIPgetVars(scip)[i];
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 17, TRUE) );
+
+   for( r = 0; r < NROWS; ++r )
+   {
+      SCIP_Real lhs;
+      SCIP_Real rhs;
+      int len;
+
+      lhs = SCIPrandomGetReal(randnumgen, -20.0, 0.0);
+      rhs = SCIPrandomGetReal(randnumgen, 0.0, 20.0);
+      if( r % 3 == 1 )
+         lhs = -SCIPinfinity(scip);
+      else if( r % 3 == 2 )
+         rhs = SCIPinfinity(scip);
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "r%d", r);
+      SCIP_CALL( SCIPcreateEmptyRowUnspec(scip, &rows[r], name, lhs, rhs, FALSE, FALSE, TRUE) );
+
+      /* rows may contain a variable more than once */
+      len = SCIPrandomGetInt(randnumgen, 0, MAXLEN);
+      for( i = 0; i < len; ++i )
+      {
+         SCIP_CALL( SCIPaddVarToRow(scip, rows[r], vars[SCIPrandomGetInt(randnumgen, 0, NVARS - 1)],
+               SCIPrandomGetReal(randnumgen, -5.0, 5.0)) );
+      }
+   }
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+   for( i = 0; i < NVARS; ++i )
+   {
+      if( SCIPrandomGetInt(randnumgen, 0, 4) > 0 )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sol, vars[i], SCIPrandomGetReal(randnumgen, -10.0, 10.0)) );
+      }
+   }
+
+   SCIPfreeRandom(scip, &randnumgen);
+}
+
+static
+void teardown(void)
+{
+   int r;
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   for( r = 0; r < NROWS; ++r )
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &rows[r]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(rowsefficacy, .init = setup, .fini = teardown);
+
+Test(rowsefficacy, activities, .description = "the activities of all rows are those of each single row")
+{
+   SCIP_Real activities[NROWS];
+   int r;
+
+   SCIP_CALL( SCIPgetRowsSolActivities(scip, rows, NROWS, sol, activities) );
+
+   for( r = 0; r < NROWS; ++r )
+   {
+      cr_expect_eq(activities[r], SCIPgetRowSolActivity(scip, rows[r], sol), "activity of row %d: %.17g != %.17g", r,
+         activities[r], SCIPgetRowSolActivity(scip, rows[r], sol));
+   }
+}
+
+Test(rowsefficacy, efficacies, .description = "the efficacies of all rows are those of each single row for every norm")
+{
+   SCIP_Real efficacies[NROWS];
+   const char* norms = "emsd";
+   int n;
+   int r;
+
+   for( n = 0; norms[n] != '\0'; ++n )
+   {
+      SCIP_CALL( SCIPsetCharParam(scip, "separating/efficacynorm", norms[n]) );
+
+      SCIP_CALL( SCIProwsGetSolEfficacies(rows, NROWS, scip->set, scip->stat, sol, efficacies) );
+
+      for( r = 0; r < NROWS; ++r )
+      {
+         SCIP_Real efficacy;
+
+         efficacy = SCIProwGetSolEfficacy(rows[r], scip->set, scip->stat, sol);
+         cr_expect_eq(efficacies[r], efficacy, "efficacy of row %d for norm %c: %.17g != %.17g", r, norms[n],
+            efficacies[r], efficacy);
+      }
+   }
+}